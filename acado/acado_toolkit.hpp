@@ -37,12 +37,14 @@
 #include <acado/curve/curve.hpp>
 #include <acado/controller/controller.hpp>
 #include <acado/estimator/estimator.hpp>
+#include <acado/estimator/kalman_filter.hpp>
 #include <acado/control_law/control_law.hpp>
 #include <acado/control_law/pid_controller.hpp>
 #include <acado/control_law/linear_state_feedback.hpp>
 #include <acado/control_law/feedforward_law.hpp>
 #include <acado/reference_trajectory/reference_trajectory.hpp>
 #include <acado/simulation_environment/simulation_environment.hpp>
+#include <acado/simulation_environment/monte_carlo_simulation.hpp>
 #include <acado/process/process.hpp>
 #include <acado/noise/noise.hpp>
 #include <acado/transfer_device/actuator.hpp>
@@ -56,6 +56,8 @@ ACADOcsparse::ACADOcsparse()
 	index1 = 0;
 	index2 = 0;
 	x = 0;
+	C = 0;
+	position = 0;
 	S = 0;
 	N = 0;
 	TOL = 1e-14;
@@ -80,11 +82,33 @@ ACADOcsparse::ACADOcsparse(const ACADOcsparse &arg)
 			x[run1] = arg.x[run1];
 	}
 
+	C = 0;
+	position = 0;
 	S = 0;
 	N = 0;
 
 	TOL = arg.TOL;
 	printLevel = arg.printLevel;
+
+	if (arg.index1 != 0 && arg.index2 != 0)
+		setIndices(arg.index1, arg.index2);
+
+	// The symbolic analysis only depends on the sparsity pattern and
+	// can therefore be shared, the numeric factorization is not copied.
+	if (arg.S != 0 && C != 0)
+	{
+		S = (css*) cs_calloc(1, sizeof(css));
+		S->m2 = arg.S->m2;
+		S->lnz = arg.S->lnz;
+		S->unz = arg.S->unz;
+
+		if (arg.S->q != 0)
+		{
+			S->q = (int*) cs_malloc(dim, sizeof(int));
+			for (run1 = 0; run1 < dim; run1++)
+				S->q[run1] = arg.S->q[run1];
+		}
+	}
 }
 
 ACADOcsparse::~ACADOcsparse()
@@ -96,21 +120,7 @@ ACADOcsparse::~ACADOcsparse()
 	if (x != 0)
 		delete[] x;
 
-	if (S != 0)
-		cs_free(S);
-	if (N != 0)
-	{
-
-		if (N->L != 0)
-			cs_spfree(N->L);
-		if (N->U != 0)
-			cs_spfree(N->U);
-		if (N->pinv != 0)
-			free(N->pinv);
-		if (N->B != 0)
-			free(N->B);
-		free(N);
-	}
+	clearFactorization();
 }
 
 ACADOcsparse* ACADOcsparse::clone() const
@@ -127,7 +137,7 @@ returnValue ACADOcsparse::solve(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
@@ -148,15 +158,15 @@ returnValue ACADOcsparse::solveTranspose(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
 
-	cs_ipvec(N->pinv, b, x, dim); /* x = b(p) */
+	cs_pvec(S->q, b, x, dim); /* x = b(q) */
 	cs_utsolve(N->U, x); /* x = U'\x */
 	cs_ltsolve(N->L, x); /* x = L'\x */
-	cs_ipvec(S->q, x, b, dim); /* b(q) = x */
+	cs_pvec(N->pinv, x, b, dim); /* b = x(p^{-1}) */
 
 	return SUCCESSFUL_RETURN;
 }
@@ -198,31 +208,58 @@ returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
 		index1[run1] = rowIdx_[run1];
 		index2[run1] = colIdx_[run1];
 	}
+
+	clearFactorization();
+
+	if (dim <= 0 || nDense <= 0)
+		return SUCCESSFUL_RETURN;
+
+	// Compress the pattern once; the numerical value of each triplet is its
+	// own running index, which tells where the entry ends up in C.
+	cs *T = cs_spalloc(dim, dim, nDense, 1, 1);
+
+	for (run1 = 0; run1 < nDense; run1++)
+		cs_entry(T, index1[run1], index2[run1], (double) run1);
+
+	C = cs_compress(T);
+	cs_spfree(T);
+
+	if (C == 0)
+		return ACADOERROR(RET_UNKNOWN_BUG);
+
+	position = new int[nDense];
+	for (run1 = 0; run1 < nDense; run1++)
+		position[(int) C->x[run1]] = run1;
+
 	return SUCCESSFUL_RETURN;
 }
 
 returnValue ACADOcsparse::setMatrix(double *A_)
 {
 	int run1;
-	int order = 0;
+	int order = 1;
 
 	if (dim <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-
-	cs *C, *D;
-	C = cs_spalloc(0, 0, 1, 1, 1);
+	if (C == 0)
+		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	for (run1 = 0; run1 < nDense; run1++)
-		cs_entry(C, index1[run1], index2[run1], A_[run1]);
+		C->x[position[run1]] = A_[run1];
+
+	// fill-reducing ordering of A+A' (only once per sparsity pattern):
+	if (S == 0)
+		S = cs_sqr(order, C, 0);
+	if (S == 0)
+		return ACADOERROR(RET_UNKNOWN_BUG);
 
-	D = cs_compress(C);
-	S = cs_sqr(order, D, 0);
-	N = cs_lu(D, S, TOL);
+	N = cs_nfree(N);
+	N = cs_lu(C, S, TOL);
 
-	cs_spfree(C);
-	cs_spfree(D);
+	if (N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -248,6 +285,21 @@ returnValue ACADOcsparse::setPrintLevel(PrintLevel printLevel_)
 	return SUCCESSFUL_RETURN;
 }
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void ACADOcsparse::clearFactorization()
+{
+	N = cs_nfree(N);
+	S = cs_sfree(S);
+	C = cs_spfree(C);
+
+	if (position != 0)
+		delete[] position;
+	position = 0;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 #else // __MATLAB__
@@ -43,6 +43,7 @@
 
 // FORWARD DECLARATIONS:
 // ---------------------
+   struct cs_sparse  ;
    struct cs_numeric ;
    struct cs_symbolic;
 
@@ -101,7 +102,9 @@ class ACADOcsparse : public SparseSolver{
 
 
         /** Sets an index list containing the positions of the \n
-         *  non-zero elements in the matrix  A.
+         *  non-zero elements in the matrix  A. The sparsity     \n
+         *  pattern is compressed once and any previous symbolic \n
+         *  analysis is discarded.                               \n
          */
         virtual returnValue setIndices( const int *rowIdx_,
                                         const int *colIdx_  );
@@ -110,7 +113,13 @@ class ACADOcsparse : public SparseSolver{
 
         /** Sets the non-zero elements of the matrix A. The double* A  \n
          *  is assumed to contain  nDense  entries corresponding to    \n
-         *  non-zero elements of A.                                    \n
+         *  non-zero elements of A. The symbolic analysis of the       \n
+         *  sparsity pattern is only performed at the first call,      \n
+         *  subsequent calls only compute a new numeric factorization. \n
+         *                                                             \n
+         *   \return SUCCESSFUL_RETURN                                 \n
+         *           RET_MEMBER_NOT_INITIALISED                        \n
+         *           RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR            \n
          */
         virtual returnValue setMatrix( double *A_ );
 
@@ -168,6 +177,11 @@ class ACADOcsparse : public SparseSolver{
     //
     protected:
 
+        /** Frees the compressed pattern, the symbolic analysis and \n
+         *  the numeric factorization.                              \n
+         */
+        void clearFactorization( );
+
 
 
     //
@@ -191,6 +205,8 @@ class ACADOcsparse : public SparseSolver{
 
     // AUXILIARY VARIABLES:
     // --------------------
+    cs_sparse           *C;          // the matrix A in compressed column form (pattern fixed by setIndices)
+    int          *position;          // position of the i-th non-zero entry within the compressed matrix
     cs_symbolic         *S;          // pointer to a struct, which contains symbolic information about the matrix
     cs_numeric          *N;          // pointer to a struct, which contains numeric information about the matrix
 
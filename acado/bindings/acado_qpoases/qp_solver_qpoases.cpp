@@ -56,7 +56,7 @@ QPsolver_qpOASES::QPsolver_qpOASES( UserInteraction* _userInteraction ) : DenseQ
 QPsolver_qpOASES::QPsolver_qpOASES( const QPsolver_qpOASES& rhs ) : DenseQPsolver( rhs )
 {
 	if ( rhs.qp != 0 )
-		qp = new qpOASES::SQProblem( *(rhs.qp) );
+		qp = rhs.copyQPobject( );
 	else
 		qp = 0;
 }
@@ -80,7 +80,7 @@ QPsolver_qpOASES& QPsolver_qpOASES::operator=( const QPsolver_qpOASES& rhs )
 
 
 		if ( rhs.qp != 0 )
-			qp = new qpOASES::SQProblem( *(rhs.qp) );
+			qp = rhs.copyQPobject( );
 		else
 			qp = 0;
 
@@ -134,10 +134,9 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 	}
 	else
 	{
-		int performHotstart = 0;
-		get( HOTSTART_QP,performHotstart );
+		updateSettings( );
 
-		if ( (bool)performHotstart == true )
+		if ( (bool)settings.hotstartQP == true )
 		{
 			 returnvalue = qp->hotstart( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
 		}
@@ -342,7 +341,7 @@ returnValue QPsolver_qpOASES::setupQPobject( uint nV, uint nC )
 		delete qp;
 
 	/* create new qpOASES QP object... */
-	qp = new qpOASES::SQProblem( nV,nC );
+	qp = createQPobject( nV,nC );
 	
 	qpOASES::Options options;
 	options.setToFast();
@@ -374,6 +373,18 @@ returnValue QPsolver_qpOASES::setupQPobject( uint nV, uint nC )
 }
 
 
+qpOASES::SQProblem* QPsolver_qpOASES::createQPobject( uint nV, uint nC ) const
+{
+	return new qpOASES::SQProblem( nV,nC );
+}
+
+
+qpOASES::SQProblem* QPsolver_qpOASES::copyQPobject( ) const
+{
+	return new qpOASES::SQProblem( *qp );
+}
+
+
 returnValue QPsolver_qpOASES::updateQPstatus( int ret )
 {
 	switch ( (qpOASES::returnValue)ret )
@@ -195,6 +195,16 @@ class QPsolver_qpOASES : public DenseQPsolver
 		returnValue updateQPstatus(	int ret
 									);
 
+		/** Allocates the qpOASES QP object used by setupQPobject.
+		 *  \return Pointer to new QP object */
+		virtual qpOASES::SQProblem* createQPobject(	uint nV,	/**< Number of QP variables. */
+														uint nC		/**< Number of QP constraints (without bounds). */
+														) const;
+
+		/** Returns a deep copy of the qpOASES QP object.
+		 *  \return Pointer to copy of QP object */
+		virtual qpOASES::SQProblem* copyQPobject( ) const;
+
 
 
     //
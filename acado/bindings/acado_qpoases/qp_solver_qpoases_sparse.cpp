@@ -0,0 +1,375 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file acado/bindings/acado_qpoases/qp_solver_qpoases_sparse.cpp
+ *    \date 2014
+ */
+
+
+#include <acado/bindings/acado_qpoases/qp_solver_qpoases_sparse.hpp>
+#include <qpOASES-3.2.0/include/qpOASES.hpp>
+
+#include <algorithm>
+
+BEGIN_NAMESPACE_ACADO
+
+
+#if defined(SOLVER_MA27) || defined(SOLVER_MA57)
+typedef qpOASES::SQProblemSchur SparseSQProblemBase;
+#else
+typedef qpOASES::SQProblem SparseSQProblemBase;
+#endif
+
+
+/**
+ *	qpOASES QP object that owns the sparse matrices it has been given,
+ *	such that copies of it are deep copies.
+ */
+class SparseSQProblem : public SparseSQProblemBase
+{
+	public:
+
+		SparseSQProblem(	uint nV,
+							uint nC
+							) : SparseSQProblemBase( nV,nC )
+		{
+		}
+
+		qpOASES::returnValue solve(	bool isHotstart,
+									qpOASES::SymSparseMat* H_new,
+									const double* g_new,
+									qpOASES::SparseMatrix* A_new,
+									const double* lb_new,
+									const double* ub_new,
+									const double* lbA_new,
+									const double* ubA_new,
+									int& nWSR
+									)
+		{
+			qpOASES::returnValue returnvalue;
+
+			if ( isHotstart == true )
+				returnvalue = hotstart( H_new,g_new,A_new,lb_new,ub_new,lbA_new,ubA_new,nWSR,0 );
+			else
+				returnvalue = init( H_new,g_new,A_new,lb_new,ub_new,lbA_new,ubA_new,nWSR,0 );
+
+			/* matrices taken over are freed by qpOASES, the others right here */
+			if ( H == H_new )
+				freeHessian = qpOASES::BT_TRUE;
+			else
+				delete H_new;
+
+			if ( A == A_new )
+				freeConstraintMatrix = qpOASES::BT_TRUE;
+			else
+				delete A_new;
+
+			return returnvalue;
+		}
+};
+
+
+/* returns whether an entry is a non-zero of the sparse matrix (NaNs are kept) */
+static inline bool isNonZero(	double value
+								)
+{
+	return (bool)acadoIsExactlyZero( value ) == false;
+}
+
+
+/* orders matrix blocks by their first row */
+static bool isAbove(	const DenseCP::MatrixBlock& lhs,
+						const DenseCP::MatrixBlock& rhs
+						)
+{
+	return lhs.rowOffset < rhs.rowOffset;
+}
+
+
+/* stores the non-zero entries of the given blocks of a row-wise dense matrix
+ * column-wise, all entries outside of the blocks are known to be zero */
+template< typename MatrixType >
+static MatrixType* createSparseMatrix(	uint nRows,
+										uint nCols,
+										const double* M,
+										const std::vector< DenseCP::MatrixBlock >& blocks,
+										bool keepDiagonal
+										)
+{
+	uint i, j, k;
+
+	/* blocks covering each column, ordered by their first row */
+	std::vector< DenseCP::MatrixBlock > sortedBlocks( blocks );
+	std::stable_sort( sortedBlocks.begin( ),sortedBlocks.end( ),isAbove );
+
+	std::vector< std::vector< const DenseCP::MatrixBlock* > > columnBlocks( nCols );
+	for( k=0; k<sortedBlocks.size( ); ++k )
+		for( j=sortedBlocks[k].colOffset; j<sortedBlocks[k].colOffset+sortedBlocks[k].nCols; ++j )
+			columnBlocks[j].push_back( &sortedBlocks[k] );
+
+	std::vector< qpOASES::sparse_int_t > ir;
+	std::vector< qpOASES::sparse_int_t > jc( nCols+1 );
+	std::vector< double > val;
+
+	for( j=0; j<nCols; ++j )
+	{
+		jc[j] = ir.size( );
+
+		/* diagonal entries are stored even if no block covers them */
+		bool hasDiagonal = ( keepDiagonal == false ) || ( j >= nRows );
+
+		for( k=0; k<columnBlocks[j].size( ); ++k )
+		{
+			const DenseCP::MatrixBlock& block = *columnBlocks[j][k];
+
+			for( i=block.rowOffset; i<block.rowOffset+block.nRows; ++i )
+			{
+				if ( ( hasDiagonal == false ) && ( i > j ) )
+				{
+					ir.push_back( j );
+					val.push_back( M[j*nCols+j] );
+					hasDiagonal = true;
+				}
+
+				if ( ( isNonZero( M[i*nCols+j] ) == true ) || ( ( hasDiagonal == false ) && ( i == j ) ) )
+				{
+					ir.push_back( i );
+					val.push_back( M[i*nCols+j] );
+				}
+
+				if ( i == j )
+					hasDiagonal = true;
+			}
+		}
+
+		if ( hasDiagonal == false )
+		{
+			ir.push_back( j );
+			val.push_back( M[j*nCols+j] );
+		}
+	}
+	jc[nCols] = ir.size( );
+
+	/* the arrays are handed over to qpOASES, which frees them */
+	qpOASES::sparse_int_t* irSparse = new qpOASES::sparse_int_t[ir.size( )];
+	qpOASES::sparse_int_t* jcSparse = new qpOASES::sparse_int_t[nCols+1];
+	double* valSparse = new double[val.size( )];
+
+	std::copy( ir.begin( ),ir.end( ),irSparse );
+	std::copy( jc.begin( ),jc.end( ),jcSparse );
+	std::copy( val.begin( ),val.end( ),valSparse );
+
+	MatrixType* result = new MatrixType( nRows,nCols,irSparse,jcSparse,valSparse );
+	result->doFreeMemory( );
+
+	return result;
+}
+
+
+/* stores the non-zero entries of a row-wise dense matrix column-wise */
+template< typename MatrixType >
+static MatrixType* createSparseMatrix(	uint nRows,
+										uint nCols,
+										const double* M,
+										bool keepDiagonal
+										)
+{
+	std::vector< DenseCP::MatrixBlock > blocks;
+
+	if ( ( nRows > 0 ) && ( nCols > 0 ) )
+	{
+		DenseCP::MatrixBlock block = { 0,0,nRows,nCols };
+		blocks.push_back( block );
+	}
+
+	return createSparseMatrix< MatrixType >( nRows,nCols,M,blocks,keepDiagonal );
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+QPsolver_qpOASES_sparse::QPsolver_qpOASES_sparse( ) : QPsolver_qpOASES( )
+{
+	constraintBlocks = 0;
+}
+
+
+QPsolver_qpOASES_sparse::QPsolver_qpOASES_sparse( UserInteraction* _userInteraction ) : QPsolver_qpOASES( _userInteraction )
+{
+	constraintBlocks = 0;
+}
+
+
+QPsolver_qpOASES_sparse::QPsolver_qpOASES_sparse( const QPsolver_qpOASES_sparse& rhs ) : QPsolver_qpOASES( rhs )
+{
+	constraintBlocks = 0;
+}
+
+
+QPsolver_qpOASES_sparse::~QPsolver_qpOASES_sparse( )
+{
+}
+
+
+QPsolver_qpOASES_sparse& QPsolver_qpOASES_sparse::operator=( const QPsolver_qpOASES_sparse& rhs )
+{
+    if ( this != &rhs )
+		QPsolver_qpOASES::operator=( rhs );
+
+    return *this;
+}
+
+
+DenseCPsolver* QPsolver_qpOASES_sparse::clone( ) const
+{
+	return new QPsolver_qpOASES_sparse(*this);
+}
+
+
+DenseQPsolver* QPsolver_qpOASES_sparse::cloneDenseQPsolver( ) const
+{
+	return new QPsolver_qpOASES_sparse(*this);
+}
+
+
+returnValue QPsolver_qpOASES_sparse::solve( DenseCP *cp_  )
+{
+	/* the non-zero blocks of the constraint matrix are known while solving the CP */
+	if ( cp_->ABlocks.empty( ) == false )
+		constraintBlocks = &cp_->ABlocks;
+
+	returnValue returnvalue = DenseQPsolver::solve( cp_ );
+	constraintBlocks = 0;
+
+	return returnvalue;
+}
+
+
+returnValue QPsolver_qpOASES_sparse::solve(	double* H,
+											double* A,
+											double* g,
+											double* lb,
+											double* ub,
+											double* lbA,
+											double* ubA,
+											uint maxIter
+											)
+{
+	if ( qp == 0 )
+		return ACADOERROR( RET_INITIALIZE_FIRST );
+
+	uint nV = qp->getNV( );
+	uint nC = qp->getNC( );
+
+	qpOASES::SymSparseMat* HSparse = createSparseMatrix< qpOASES::SymSparseMat >( nV,nV,H,true );
+	qpOASES::SparseMatrix* ASparse;
+
+	if ( constraintBlocks != 0 )
+		ASparse = createSparseMatrix< qpOASES::SparseMatrix >( nC,nV,A,*constraintBlocks,false );
+	else
+		ASparse = createSparseMatrix< qpOASES::SparseMatrix >( nC,nV,A,false );
+	HSparse->createDiagInfo( );
+
+	/* call to qpOASES, using hotstart if possible and desired */
+	numberOfSteps = maxIter;
+	qpOASES::returnValue returnvalue;
+	qpStatus = QPS_SOLVING;
+
+	SparseSQProblem* sparseQP = static_cast< SparseSQProblem* >( qp );
+
+	if ( (bool)qp->isInitialised( ) == false )
+	{
+		returnvalue = sparseQP->solve( false,HSparse,g,ASparse,lb,ub,lbA,ubA,numberOfSteps );
+	}
+	else
+	{
+		updateSettings( );
+
+		if ( (bool)settings.hotstartQP == true )
+		{
+			returnvalue = sparseQP->solve( true,HSparse,g,ASparse,lb,ub,lbA,ubA,numberOfSteps );
+		}
+		else
+		{
+			/* if no hotstart is desired, reset QP and use cold start */
+			qp->reset( );
+			returnvalue = sparseQP->solve( false,HSparse,g,ASparse,lb,ub,lbA,ubA,numberOfSteps );
+		}
+	}
+	setLast( LOG_NUM_QP_ITERATIONS, numberOfSteps );
+
+	/* update QP status and determine return value */
+	return updateQPstatus( returnvalue );
+}
+
+
+returnValue QPsolver_qpOASES_sparse::solve(	DMatrix *H,
+											DMatrix *A,
+											DVector *g,
+											DVector *lb,
+											DVector *ub,
+											DVector *lbA,
+											DVector *ubA,
+											uint maxIter
+											)
+{
+	return solve(	H->data(),
+					A->data(),
+					g->data(),
+					lb->data(),
+					ub->data(),
+					lbA->data(),
+					ubA->data(),
+					maxIter
+					);
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+qpOASES::SQProblem* QPsolver_qpOASES_sparse::createQPobject( uint nV, uint nC ) const
+{
+	return new SparseSQProblem( nV,nC );
+}
+
+
+qpOASES::SQProblem* QPsolver_qpOASES_sparse::copyQPobject( ) const
+{
+	return new SparseSQProblem( *static_cast< SparseSQProblem* >( qp ) );
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,145 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file acado/bindings/acado_qpoases/qp_solver_qpoases_sparse.hpp
+ *    \date 2014
+ */
+
+
+#ifndef ACADO_TOOLKIT_QP_SOLVER_QPOASES_SPARSE_HPP
+#define ACADO_TOOLKIT_QP_SOLVER_QPOASES_SPARSE_HPP
+
+
+#include <acado/bindings/acado_qpoases/qp_solver_qpoases.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+/**
+ *	\brief Interfaces qpOASES with sparse QP matrices.
+ *
+ *	\ingroup ExternalFunctionality
+ *
+ *  The class QPsolver_qpOASES_sparse interfaces the qpOASES software package
+ *  like QPsolver_qpOASES, but hands the Hessian and the constraint matrix
+ *  over in compressed column storage. Only their non-zero entries are stored,
+ *  which pays off for the mostly empty constraint matrices of condensed QPs
+ *  with many path constraints. If qpOASES is compiled with a sparse linear
+ *  solver (MA27 or MA57), its Schur-complement method is used.
+ *
+ *  Hotstarts and the variance-covariance estimate work as for QPsolver_qpOASES.
+ */
+class QPsolver_qpOASES_sparse : public QPsolver_qpOASES
+{
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+        /** Default constructor. */
+        QPsolver_qpOASES_sparse( );
+
+        QPsolver_qpOASES_sparse(	UserInteraction* _userInteraction
+									);
+
+        /** Copy constructor (deep copy). */
+        QPsolver_qpOASES_sparse( const QPsolver_qpOASES_sparse& rhs );
+
+        /** Destructor. */
+        virtual ~QPsolver_qpOASES_sparse( );
+
+        /** Assignment operator (deep copy). */
+        QPsolver_qpOASES_sparse& operator=( const QPsolver_qpOASES_sparse& rhs );
+
+
+        virtual DenseCPsolver* clone( ) const;
+
+        virtual DenseQPsolver* cloneDenseQPsolver( ) const;
+
+
+        /** Solves the QP. If the CP declares the non-zero blocks of its
+		 *  constraint matrix, only these blocks are searched for non-zeros. */
+        virtual returnValue solve( DenseCP *cp_  );
+
+
+        /** Solves QP using at most <maxIter> iterations. The matrices are given
+		 *  row-wise and only their non-zero entries are passed to qpOASES.
+		 * \return SUCCESSFUL_RETURN \n
+		 *         RET_QP_SOLUTION_REACHED_LIMIT \n
+		 *         RET_QP_SOLUTION_FAILED \n
+		 *         RET_INITIALIZE_FIRST */
+        virtual returnValue solve(	double* H,	/**< Hessian matrix of neighbouring QP to be solved. */
+									double* A,	/**< Constraint matrix of neighbouring QP to be solved. */
+									double* g,	/**< Gradient of neighbouring QP to be solved. */
+									double* lb,	/**< Lower bounds of neighbouring QP to be solved. */
+									double* ub,	/**< Upper bounds of neighbouring QP to be solved. */
+									double* lbA,	/**< Lower constraints' bounds of neighbouring QP to be solved. */
+									double* ubA,	/**< Upper constraints' bounds of neighbouring QP to be solved. */
+									uint maxIter		/**< Maximum number of iterations. */
+									);
+
+        /** Solves QP using at most <maxIter> iterations. */
+        virtual returnValue solve(  DMatrix *H,    /**< Hessian matrix of neighbouring QP to be solved. */
+                                    DMatrix *A,    /**< Constraint matrix of neighbouring QP to be solved. */
+                                    DVector *g,    /**< Gradient of neighbouring QP to be solved. */
+                                    DVector *lb,   /**< Lower bounds of neighbouring QP to be solved. */
+                                    DVector *ub,   /**< Upper bounds of neighbouring QP to be solved. */
+                                    DVector *lbA,  /**< Lower constraints' bounds of neighbouring QP to be solved. */
+                                    DVector *ubA,  /**< Upper constraints' bounds of neighbouring QP to be solved. */
+                                    uint maxIter        /**< Maximum number of iterations. */
+									);
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+		virtual qpOASES::SQProblem* createQPobject(	uint nV,
+														uint nC
+														) const;
+
+		virtual qpOASES::SQProblem* copyQPobject( ) const;
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+		/** Non-zero blocks of the constraint matrix of the CP being solved (0 if unknown). */
+		const std::vector< DenseCP::MatrixBlock >* constraintBlocks;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_QP_SOLVER_QPOASES_SPARSE_HPP
+
+/*
+ *	end of file
+ */
@@ -154,10 +154,14 @@ returnValue ExportAcadoFunction::exportCode(	std::ostream& stream,
 	if (external == true)
 		return SUCCESSFUL_RETURN;
 
+	// With a solver context there is no global workspace to hold the intermediate
+	// values, so they are kept on the stack of the function instead.
+	bool allocateMemory = (ExportStatement::contextName.empty() == false);
+
 	return f->exportCode(
 			stream, name.c_str(), _realString.c_str(), numX, numXA, numU, numP, numDX, numOD,
 			// TODO: Here we allocate local memory for the function, this should be extended.
-			false, false);
+			allocateMemory, false);
 }
 
 
@@ -170,6 +174,12 @@ bool ExportAcadoFunction::isDefined( ) const
 }
 
 
+bool ExportAcadoFunction::isContextFree( ) const
+{
+	return true;
+}
+
+
 unsigned ExportAcadoFunction::getFunctionDim( void )
 {
 	ASSERT( external == false );
@@ -162,6 +162,11 @@ public:
 	 */
 	virtual bool isDefined( ) const;
 
+	/** Exported ACADO functions only operate on their input and output arrays,
+	 *  hence they never take the solver context pointer.
+	 */
+	virtual bool isContextFree( ) const;
+
 	/** Get output dimension of the ACADO function. */
 	unsigned getFunctionDim( void );
 
@@ -31,6 +31,7 @@
 
 
 #include <acado/code_generation/export_argument_list.hpp>
+#include <acado/code_generation/export_statement.hpp>
 
 
 
@@ -44,6 +45,7 @@ BEGIN_NAMESPACE_ACADO
 ExportArgumentList::ExportArgumentList( )
 {
 	doIncludeType( );
+	doNotPassContext( );
 }
 
 
@@ -58,6 +60,9 @@ ExportArgumentList::ExportArgumentList(	const ExportArgument& _argument1,
 										const ExportArgument& _argument9
 										)
 {
+	doIncludeType( );
+	doNotPassContext( );
+
 	addArgument( _argument1,_argument2,_argument3,
 				 _argument4,_argument5,_argument6,
 				 _argument7,_argument8,_argument9 );
@@ -69,6 +74,7 @@ ExportArgumentList::ExportArgumentList( const ExportArgumentList& arg )
 	arguments = arg.arguments;
 	
 	includeType = arg.includeType;
+	passContext = arg.passContext;
 }
 
 
@@ -87,6 +93,7 @@ ExportArgumentList& ExportArgumentList::operator=( const ExportArgumentList& arg
 		arguments = arg.arguments;
 		
 		includeType = arg.includeType;
+		passContext = arg.passContext;
 	}
 
 	return *this;
@@ -133,6 +140,18 @@ returnValue ExportArgumentList::exportCode(	std::ostream& stream,
 											) const
 {
 	bool started = false;
+
+	// The solver context pointer always comes first
+	if ( passContext == true && ExportStatement::contextName.empty() == false )
+	{
+		if ( includeType == true )
+			stream << ExportStatement::varPrefix << "context* const ";
+
+		stream << ExportStatement::contextName;
+
+		started = true;
+	}
+
 	for (unsigned i = 0; i < arguments.size(); ++i)
 	{
 		// Allow only undefined arguments and defined integer scalars
@@ -143,7 +162,7 @@ returnValue ExportArgumentList::exportCode(	std::ostream& stream,
 				)
 			continue;
 
-		if (i > 0 && started == true)
+		if (started == true)
 			stream << ", ";
 
 		if ( includeType == true )
@@ -190,6 +209,20 @@ returnValue ExportArgumentList::doNotIncludeType( )
 }
 
 
+returnValue ExportArgumentList::doPassContext( )
+{
+	passContext = true;
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportArgumentList::doNotPassContext( )
+{
+	passContext = false;
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
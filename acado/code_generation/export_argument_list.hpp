@@ -174,6 +174,21 @@ class ExportArgumentList
 		 */
 		returnValue doNotIncludeType( );
 
+
+		/** Specifies to pass the solver context pointer as first calling argument,
+		 *  provided that the exported code uses a solver context.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue doPassContext( );
+
+
+		/** Specifies not to pass the solver context pointer.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue doNotPassContext( );
+
 		/** Get the list of arguments.
 		 *
 		 *	\return Argument list
@@ -205,6 +220,9 @@ class ExportArgumentList
 		
 		/** Flag indicating whether variable types are to be included in calling arguments. */
 		bool includeType;
+
+		/** Flag indicating whether the solver context pointer is to be passed as first calling argument. */
+		bool passContext;
 };
 
 
@@ -39,6 +39,8 @@
 using namespace std;
 BEGIN_NAMESPACE_ACADO
 
+ExportMultiplicationKernel ExportArithmeticStatement::multiplicationKernel = MULTIPLICATION_LOOPS;
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -342,10 +344,18 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 	if (op2 == ESO_ADD || op2 == ESO_SUBTRACT)
 		optimizationsAllowed &= rhs3.isGiven() == false;
 
+	//
+	// Blocked kernels keep the code size independent of the matrix dimensions,
+	// so they replace also the unrolled code of medium sized products.
+	//
+	bool useBlockedKernel =
+			optimizationsAllowed == true && multiplicationKernel != MULTIPLICATION_LOOPS &&
+			lhs.isCalledByValue() == false && numberOfFlops >= 1024;
+
 	//
 	// Depending on the flops count different export strategies are performed
 	//
-	if (numberOfFlops < 4096 || optimizationsAllowed == false)
+	if ((numberOfFlops < 4096 && useBlockedKernel == false) || optimizationsAllowed == false)
 	{
 		//
 		// Unroll all loops
@@ -408,6 +418,14 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 			}
 		}
 	}
+	else if ( useBlockedKernel == true )
+	{
+		//
+		// Register-blocked micro-kernels
+		//
+
+		return exportCodeMultiplyBlocked(stream, transposeRhs1, sign, _realString);
+	}
 //	else if ( numberOfFlops < 32768 )
 //	{
 //		//
@@ -545,6 +563,209 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 }
 
 
+returnValue ExportArithmeticStatement::exportCodeMultiplyBlocked(	std::ostream& stream,
+																	bool transposeRhs1,
+																	const std::string& _sign,
+																	const std::string& _realString
+																	) const
+{
+	ExportMultiplicationKernel kernel = multiplicationKernel;
+
+	// Vectorized kernels load consecutive columns of rhs2 at once
+	if (rhs2->isAccessedTransposed() == true)
+		kernel = MULTIPLICATION_BLOCKED;
+
+	uint nRowsTile = 4;
+	uint nColsTile = kernel == MULTIPLICATION_BLOCKED_AVX ? 8 : 4;
+
+	uint nRowsBlocked = (getNumRows( ) / nRowsTile) * nRowsTile;
+	uint nColsBlocked = (getNumCols( ) / nColsTile) * nColsTile;
+
+	ExportIndex ii, jj, kk;
+
+	memAllocator->acquire( ii );
+	memAllocator->acquire( jj );
+	memAllocator->acquire( kk );
+
+	for (uint block = 0; block < 2; ++block)
+	{
+		// First all full row tiles, then the remaining rows
+		ExportIndex rowIdx = ii;
+		uint nRows = nRowsTile;
+
+		if (block == 0)
+		{
+			if (nRowsBlocked == 0)
+				continue;
+
+			stream << "for (" << ii.getName() << " = 0; ";
+			stream << ii.getName() << " < " << nRowsBlocked << "; ";
+			stream << ii.getName() << " += " << nRowsTile << ")\n{\n";
+		}
+		else
+		{
+			if (nRowsBlocked == getNumRows( ))
+				continue;
+
+			rowIdx = nRowsBlocked;
+			nRows = getNumRows( ) - nRowsBlocked;
+		}
+
+		if (nColsBlocked > 0)
+		{
+			stream << "for (" << jj.getName() << " = 0; ";
+			stream << jj.getName() << " < " << nColsBlocked << "; ";
+			stream << jj.getName() << " += " << nColsTile << ")\n{\n";
+
+			exportCodeMultiplyTile(stream, transposeRhs1, _sign, _realString, kernel,
+					rowIdx, jj, nRows, nColsTile, kk);
+
+			stream << "}\n";
+		}
+
+		if (nColsBlocked < getNumCols( ))
+			exportCodeMultiplyTile(stream, transposeRhs1, _sign, _realString, MULTIPLICATION_BLOCKED,
+					rowIdx, nColsBlocked, nRows, getNumCols( ) - nColsBlocked, kk);
+
+		if (block == 0)
+			stream << "}\n";
+	}
+
+	memAllocator->release( ii );
+	memAllocator->release( jj );
+	memAllocator->release( kk );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportArithmeticStatement::exportCodeMultiplyTile(	std::ostream& stream,
+																bool transposeRhs1,
+																const std::string& _sign,
+																const std::string& _realString,
+																ExportMultiplicationKernel kernel,
+																const ExportIndex& rowIdx,
+																const ExportIndex& colIdx,
+																uint nRowsTile,
+																uint nColsTile,
+																const ExportIndex& kk
+																) const
+{
+	uint nColsRhs1 = transposeRhs1 == false ? rhs1->getNumCols( ) : rhs1->getNumRows( );
+
+	// Vector type and intrinsics of the kernel; width 1 denotes plain C
+	uint width = 1;
+	std::string vecType, vecPrefix;
+
+	if (kernel == MULTIPLICATION_BLOCKED_SSE2)
+	{
+		width = 2;
+		vecType = "__m128d";
+		vecPrefix = "_mm_";
+	}
+	else if (kernel == MULTIPLICATION_BLOCKED_AVX)
+	{
+		width = 4;
+		vecType = "__m256d";
+		vecPrefix = "_mm256_";
+	}
+
+	ASSERT( nColsTile % width == 0 );
+	uint nVecs = nColsTile / width;
+
+	stream << "{\n";
+
+	//
+	// Accumulators of the tile
+	//
+	for (uint i = 0; i < nRowsTile; ++i)
+	{
+		stream << (width == 1 ? _realString : vecType) << " ";
+		for (uint j = 0; j < nVecs; ++j)
+		{
+			stream << "t" << i << j << " = " << (width == 1 ? "0.0" : vecPrefix + "setzero_pd()");
+			stream << (j + 1 < nVecs ? ", " : ";\n");
+		}
+	}
+
+	if (width > 1)
+		stream << _realString << " tile[" << nRowsTile << "][" << nColsTile << "];\n";
+
+	//
+	// Loop over the inner dimension, rank-1 update of the tile
+	//
+	stream << "for (" << kk.getName() << " = 0; ";
+	stream << kk.getName() << " < " << nColsRhs1 <<"; ";
+	stream << "++" << kk.getName() << ")\n{\n";
+
+	for (uint j = 0; j < nVecs; ++j)
+	{
+		stream << (j == 0 ? (width == 1 ? _realString : vecType) + " " : std::string(", ")) << "b" << j << " = ";
+		if (width == 1)
+			stream << rhs2->get(kk, colIdx + j);
+		else
+			stream << vecPrefix << "loadu_pd( &" << rhs2->get(kk, colIdx + j * width) << " )";
+	}
+	stream << ";\n";
+
+	stream << (width == 1 ? _realString : vecType) << " a;\n";
+
+	for (uint i = 0; i < nRowsTile; ++i)
+	{
+		std::string a = transposeRhs1 == false ? rhs1->get(rowIdx + i, kk) : rhs1->get(kk, rowIdx + i);
+
+		if (width == 1)
+			stream << "a = " << a << ";\n";
+		else
+			stream << "a = " << vecPrefix << "set1_pd( " << a << " );\n";
+
+		for (uint j = 0; j < nVecs; ++j)
+		{
+			if (width == 1)
+				stream << "t" << i << j << " += a*b" << j << ";\n";
+			else
+				stream << "t" << i << j << " = " << vecPrefix << "add_pd( t" << i << j << ", "
+						<< vecPrefix << "mul_pd( a, b" << j << " ) );\n";
+		}
+	}
+
+	stream << "}\n";
+
+	//
+	// Store the tile
+	//
+	for (uint i = 0; i < nRowsTile; ++i)
+	{
+		if (width > 1)
+			for (uint j = 0; j < nVecs; ++j)
+				stream << vecPrefix << "storeu_pd( &tile[" << i << "][" << j * width << "], t" << i << j << " );\n";
+
+		for (uint j = 0; j < nColsTile; ++j)
+		{
+			stream << lhs->get(rowIdx + i, colIdx + j) << " " << getAssignString() << " ";
+			if (_sign == "-")
+				stream << "- ";
+
+			if (width == 1)
+				stream << "t" << i << j;
+			else
+				stream << "tile[" << i << "][" << j << "]";
+
+			if (op2 == ESO_ADD)
+				stream << " + " << rhs3->get(rowIdx + i, colIdx + j);
+			else if (op2 == ESO_SUBTRACT)
+				stream << " - " << rhs3->get(rowIdx + i, colIdx + j);
+
+			stream << ";\n";
+		}
+	}
+
+	stream << "}\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ExportArithmeticStatement::exportCodeAssign(	std::ostream& stream,
 															const std::string& _op,
 															const std::string& _realString,
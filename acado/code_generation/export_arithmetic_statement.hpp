@@ -131,6 +131,9 @@ class ExportArithmeticStatement : public ExportStatement
 
 		ExportArithmeticStatement& allocate( MemoryAllocatorPtr allocator );
 
+		/** Kernel used to export products of matrices that are not hard-coded. */
+		static ExportMultiplicationKernel multiplicationKernel;
+
 	//
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -170,6 +173,52 @@ class ExportArithmeticStatement : public ExportStatement
 										const std::string& _intString = "int"
 										) const;
 
+		/** Exports source code for a multiplication to given file, using
+		 *  register-blocked micro-kernels that keep a tile of the result in local
+		 *  accumulators while running over the inner dimension.
+		 *
+		 *	@param[in] stream			Name of file to be used to export statement.
+		 *	@param[in] transposeRhs1	Flag indicating whether rhs1 shall be transposed.
+		 *	@param[in] _sign			std::string of the sign of the product ("+" or "-").
+		 *	@param[in] _realString		std::string to be used to declare real variables.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCodeMultiplyBlocked(	std::ostream& stream,
+												bool transposeRhs1,
+												const std::string& _sign,
+												const std::string& _realString = "real_t"
+												) const;
+
+		/** Exports source code of a micro-kernel computing a (nRowsTile x nColsTile)-tile
+		 *  of a blocked multiplication.
+		 *
+		 *	@param[in] stream			Name of file to be used to export statement.
+		 *	@param[in] transposeRhs1	Flag indicating whether rhs1 shall be transposed.
+		 *	@param[in] _sign			std::string of the sign of the product ("+" or "-").
+		 *	@param[in] _realString		std::string to be used to declare real variables.
+		 *	@param[in] kernel			Kernel to be used; vectorized kernels require nColsTile
+		 *								to be a multiple of the vector width.
+		 *	@param[in] rowIdx			Index of first row of the tile.
+		 *	@param[in] colIdx			Index of first column of the tile.
+		 *	@param[in] nRowsTile		Number of rows of the tile.
+		 *	@param[in] nColsTile		Number of columns of the tile.
+		 *	@param[in] kk				Index used for the loop over the inner dimension.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCodeMultiplyTile(	std::ostream& stream,
+											bool transposeRhs1,
+											const std::string& _sign,
+											const std::string& _realString,
+											ExportMultiplicationKernel kernel,
+											const ExportIndex& rowIdx,
+											const ExportIndex& colIdx,
+											uint nRowsTile,
+											uint nColsTile,
+											const ExportIndex& kk
+											) const;
+
 		/** Exports source code for an assignment to given file. 
 		 *  Its appearance can be adjusted by various options.
 		 *
@@ -51,6 +51,8 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
                                             const std::string& _modulePrefix,
 											bool _useSinglePrecision,
 											bool _useComplexArithmetic,
+											bool _useSolverContext,
+											ExportMultiplicationKernel _multiplicationKernel,
 											QPSolverName _qpSolver,
 											const std::map<std::string, std::pair<std::string, std::string> >& _options,
 											const std::string& _variables,
@@ -64,6 +66,11 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
 
 	stringstream ss;
 	if( _useComplexArithmetic ) ss << "\n#include <complex.h>\n" << endl;
+	if( _multiplicationKernel == MULTIPLICATION_BLOCKED_SSE2 ) ss << "\n#include <emmintrin.h>\n" << endl;
+	if( _multiplicationKernel == MULTIPLICATION_BLOCKED_AVX ) ss << "\n#include <immintrin.h>\n" << endl;
+
+	ss	<< "/** Indicator whether all solver data is kept in a context structure instead of global variables. */" << endl
+		<< "#define " << _modulePrefix << "_USE_SOLVER_CONTEXT " << (_useSolverContext == true ? 1 : 0) << endl << endl;
 
 	ss 	<< "/** qpOASES QP solver indicator. */" << endl
 		<< "#define " << _modulePrefix << "_QPOASES  0" << endl
@@ -74,7 +81,9 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
 		<< "#define " << _modulePrefix << "_QPDUNES  3" << endl
 		<< "/** HPMPC QP solver indicator. */" << endl
 		<< "#define " << _modulePrefix << "_HPMPC    4" << endl
-        << "#define " << _modulePrefix << "_GENERIC    5" << endl << endl
+        << "#define " << _modulePrefix << "_GENERIC    5" << endl
+		<< "/** Riccati QP solver indicator. */" << endl
+		<< "#define " << _modulePrefix << "_RICCATI  6" << endl << endl
 		<< "/** Indicator for determining the QP solver used by the ACADO solver code. */" << endl;
 
 	switch ( _qpSolver )
@@ -122,6 +131,17 @@ returnValue ExportCommonHeader::configure(	const std::string& _moduleName,
 
 		break;
 
+	case QP_RICCATI:
+		ss << "#define " << _modulePrefix << "_QP_SOLVER " << _modulePrefix << "_RICCATI\n" << endl;
+
+		ss << "/** Definition of the floating point data type. */\n";
+		if (_useSinglePrecision == true)
+			ss << "typedef float real_t;\n";
+		else
+			ss << "typedef double real_t;\n";
+
+		break;
+
 	default:
 		return ACADOERROR( RET_INVALID_OPTION );
 
@@ -77,6 +77,8 @@ public:
                             const std::string& _modulePrefix,
 							bool _useSinglePrecision,
 							bool _useComplexArithmetic,
+							bool _useSolverContext,
+							ExportMultiplicationKernel _multiplicationKernel,
 							QPSolverName _qpSolver,
 							const std::map<std::string, std::pair<std::string, std::string> >& _options,
 							const std::string& _variables,
@@ -148,6 +148,17 @@ std::string ExportData::getDoc( ) const
 	return (*this)->getDoc();
 }
 
+returnValue ExportData::setTemporary(	bool _isTemporary
+										)
+{
+	return (*this)->setTemporary( _isTemporary );
+}
+
+bool ExportData::isTemporary( ) const
+{
+	return (*this)->isTemporary();
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -184,6 +184,24 @@ class ExportData : public CasADi::SharedObject
 		virtual returnValue setDoc(const std::string& _doc);
 
 		virtual std::string getDoc() const;
+
+		/** Marks the data object as temporary: its value is not needed between calls of
+		 *  the exported functions, so that its memory may be shared with other temporaries
+		 *  of the workspace whose lifetimes do not overlap.
+		 *
+		 *	@param[in] _isTemporary		Flag indicating whether data object is temporary.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setTemporary(	bool _isTemporary = true
+									);
+
+		/** Returns whether the data object is temporary.
+		 *
+		 *	\return true  iff data object is temporary, \n
+		 *	        false otherwise
+		 */
+		bool isTemporary( ) const;
 };
 
 CLOSE_NAMESPACE_ACADO
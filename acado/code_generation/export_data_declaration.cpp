@@ -101,6 +101,12 @@ returnValue ExportDataDeclaration::exportCode(	std::ostream& stream,
 }
 
 
+const ExportData& ExportDataDeclaration::getData( ) const
+{
+	return data;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
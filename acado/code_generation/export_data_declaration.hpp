@@ -123,6 +123,12 @@ class ExportDataDeclaration : public ExportStatement
 										int _precision = 16
 										) const;
 
+		/** Returns the declared data object.
+		 *
+		 *	\return Declared data object
+		 */
+		const ExportData& getData( ) const;
+
 
 	//
     // PROTECTED MEMBER FUNCTIONS:
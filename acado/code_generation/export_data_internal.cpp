@@ -27,6 +27,7 @@
 BEGIN_NAMESPACE_ACADO
 
 std::string ExportDataInternal::fcnPrefix = "acado";
+std::string ExportDataInternal::contextName = "";
 
         
 using namespace CasADi;
@@ -42,7 +43,7 @@ ExportDataInternal::ExportDataInternal(	const std::string& _name,
 										const std::string& _prefix
 										)
 	: SharedObjectNode(), name( _name ), type( _type ), prefix( _prefix ), dataStruct( _dataStruct ),
-	  description()
+	  description(), temporary( false )
 {
 	setFullName();
 }
@@ -156,11 +157,17 @@ std::string ExportDataInternal::getDataStructString( ) const
 	switch ( dataStruct )
 	{
 		case ACADO_VARIABLES:
-			tmp << fcnPrefix + "Variables";
+			if (contextName.empty() == false)
+				tmp << contextName + "->variables";
+			else
+				tmp << fcnPrefix + "Variables";
 			break;
 
 		case ACADO_WORKSPACE:
-			tmp << fcnPrefix + "Workspace";
+			if (contextName.empty() == false)
+				tmp << contextName + "->workspace";
+			else
+				tmp << fcnPrefix + "Workspace";
 			break;
 
 		case ACADO_PARAMS:
@@ -255,4 +262,17 @@ std::string ExportDataInternal::getDoc() const
 	return description;
 }
 
+returnValue ExportDataInternal::setTemporary(	bool _isTemporary
+												)
+{
+	temporary = _isTemporary;
+
+	return SUCCESSFUL_RETURN;
+}
+
+bool ExportDataInternal::isTemporary( ) const
+{
+	return temporary;
+}
+
 CLOSE_NAMESPACE_ACADO
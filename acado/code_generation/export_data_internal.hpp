@@ -164,6 +164,23 @@ public:
 	virtual returnValue setDoc( const std::string& _doc );
 	virtual std::string getDoc( ) const;
 
+	/** Marks the data object as temporary, i.e. its value is not needed between
+	 *  calls of the exported functions, and its memory may be shared.
+	 *
+	 *	@param[in] _isTemporary		Flag indicating whether data object is temporary.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue setTemporary(	bool _isTemporary
+								);
+
+	/** Returns whether the data object is temporary.
+	 *
+	 *	\return true  iff data object is temporary, \n
+	 *	        false otherwise
+	 */
+	bool isTemporary( ) const;
+
 	//
 	// PROTECTED MEMBER FUNCTIONS:
 	//
@@ -190,10 +207,15 @@ protected:
 
 	/** Description of the variable */
 	std::string description;
+
+	/** Flag indicating whether the data object is temporary. */
+	bool temporary;
     
     
 public:
     static std::string fcnPrefix;
+    /** Name of the solver context pointer through which the variables and the workspace are accessed; empty if they are global. */
+    static std::string contextName;
 };
 
 CLOSE_NAMESPACE_ACADO
@@ -57,6 +57,7 @@ ExportFunction::ExportFunction(	const std::string& _name,
 {
 	returnAsPointer = false;
 	flagPrivate = false;
+	setContextFree( false );
 
 	memAllocator = MemoryAllocatorPtr( new MemoryAllocator );
 
@@ -391,6 +392,23 @@ bool ExportFunction::isPrivate() const
 	return flagPrivate;
 }
 
+ExportFunction& ExportFunction::setContextFree(bool _set)
+{
+	flagContextFree = _set;
+
+	if (flagContextFree == true)
+		functionArguments.doNotPassContext();
+	else
+		functionArguments.doPassContext();
+
+	return *this;
+}
+
+bool ExportFunction::isContextFree() const
+{
+	return flagContextFree;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -272,6 +272,13 @@ public:
 	/** Is function private? */
 	virtual bool isPrivate() const;
 
+	/** Set the function as context free. If this is true, the function does not
+	 *  take the solver context pointer, even if the exported code uses one. */
+	virtual ExportFunction& setContextFree(	bool _set = true );
+
+	/** Is function context free? */
+	virtual bool isContextFree() const;
+
 protected:
 	/** Frees internal dynamic memory to yield an empty function.
 	 *
@@ -296,6 +303,8 @@ protected:
 	std::vector< ExportVariable > localVariables;
 	/** Private flag. In principle if this guy is true, do not export function declaration. */
 	bool flagPrivate;
+	/** Context free flag. If this guy is true, the function only operates on its calling arguments. */
+	bool flagContextFree;
 };
 
 CLOSE_NAMESPACE_ACADO
@@ -169,6 +169,9 @@ returnValue ExportFunctionCall::init(	const ExportFunction& _f,
 		return SUCCESSFUL_RETURN;
 	}
 
+	if (_f.isContextFree() == false)
+		functionArguments.doPassContext( );
+
 	functionArguments.addArgument( 	_argument1,_argument2,_argument3,
 									_argument4,_argument5,_argument6,
 									_argument7,_argument8,_argument9 );
@@ -212,6 +215,7 @@ returnValue ExportFunctionCall::clear( )
 {
 	functionArguments.clear( );
 	functionArguments.doNotIncludeType( );
+	functionArguments.doNotPassContext( );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -2087,7 +2087,7 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument() << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) { // ALSO IN THE CASE OF CONDENSED REGULARIZATION, THIS IS CURRENTLY NECESSARY:
@@ -2118,7 +2118,7 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	feedback.addLinebreak();
 
 	stringstream s;
-	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	s << tmp.getName() << " = " << solve.getName() << "( " << ExportStatement::getContextArgument() << " );" << endl;
 	feedback <<  s.str();
 	feedback.addLinebreak();
 
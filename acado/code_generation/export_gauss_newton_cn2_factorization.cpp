@@ -1784,7 +1784,7 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument() << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	preparation.addFunctionCall( condensePrep );
@@ -1809,7 +1809,7 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	feedback.addLinebreak();
 
 	stringstream s;
-	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	s << tmp.getName() << " = " << solve.getName() << "( " << ExportStatement::getContextArgument() << " );" << endl;
 	feedback <<  s.str();
 	feedback.addLinebreak();
 
@@ -1222,6 +1222,9 @@ returnValue ExportGaussNewtonCondensed::setupConstraintsEvaluation( void )
 
 returnValue ExportGaussNewtonCondensed::setupCondensing( void )
 {
+	// Sensitivities are copied into E right after the simulation
+	evGu.setTemporary();
+
 	//
 	// Define LM regularization terms
 	//
@@ -2050,6 +2053,11 @@ returnValue ExportGaussNewtonCondensed::setupVariables( )
 
 	QDy.setup ("QDy", (N + 1) * NX, 1, REAL, ACADO_WORKSPACE);
 
+	// Intermediate results of the condensing only
+	T.setTemporary();
+	QE.setTemporary();
+	QDy.setTemporary();
+
 	// Setup all QP stuff
 
 	H.setup("H", getNumQPvars(), getNumQPvars(), REAL, ACADO_WORKSPACE);
@@ -2250,7 +2258,7 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument() << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	preparation.addFunctionCall( condensePrep );
@@ -2274,7 +2282,7 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	feedback.addFunctionCall( condenseFdb );
 	feedback.addLinebreak();
 
-	feedback << tmp.getName() << " = " << solve.getName() << "( );\n";
+	feedback << tmp.getName() << " = " << solve.getName() << "( " << ExportStatement::getContextArgument() << " );\n";
 	feedback.addLinebreak();
 
 	feedback.addFunctionCall( expand );
@@ -143,7 +143,7 @@ protected:
 	 */
 	virtual returnValue setupEvaluation( );
 
-private:
+protected:
 	/** Current state feedback. */
 	ExportVariable x0;
 
@@ -0,0 +1,126 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file src/code_generation/export_gauss_newton_riccati.cpp
+ *    \date 2014
+ */
+
+#include <acado/code_generation/export_gauss_newton_riccati.hpp>
+#include <acado/code_generation/export_riccati_interface.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+using namespace std;
+
+ExportGaussNewtonRiccati::ExportGaussNewtonRiccati(	UserInteraction* _userInteraction,
+													const std::string& _commonHeaderName
+													) : ExportGaussNewtonGeneric( _userInteraction,_commonHeaderName )
+{}
+
+returnValue ExportGaussNewtonRiccati::setup( )
+{
+	if (initialStateFixed() == false)
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"The Riccati QP solver supports only problems with a fixed initial state.");
+
+	if (performsSingleShooting() == true)
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"The Riccati QP solver requires multiple shooting.");
+
+	returnValue status = ExportGaussNewtonGeneric::setup();
+	if (status != SUCCESSFUL_RETURN)
+		return status;
+
+	if (qpDimHtot != N * dimPacH)
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"The Riccati QP solver does not support point constraints.");
+
+	return setupQPInterface();
+}
+
+returnValue ExportGaussNewtonRiccati::getCode(	ExportStatementBlock& code
+												)
+{
+	qpInterface->exportCode();
+
+	string moduleName;
+	get(CG_MODULE_NAME, moduleName);
+
+	// Forward declaration, same as in the template file.
+	code << "#ifdef __cplusplus\n";
+	code << "extern \"C\"{\n";
+	code << "#endif\n";
+	code << "int " << moduleName << "_solve( void );\n";
+	code << "#ifdef __cplusplus\n";
+	code << "}\n";
+	code << "#endif\n";
+
+	return ExportGaussNewtonGeneric::getCode( code );
+}
+
+//
+// PROTECTED FUNCTIONS:
+//
+
+returnValue ExportGaussNewtonRiccati::setupQPInterface( )
+{
+	string folderName;
+	get(CG_EXPORT_FOLDER_NAME, folderName);
+
+	string moduleName;
+	get(CG_MODULE_NAME, moduleName);
+
+	string outFile = folderName + "/" + moduleName + "_riccati_interface.c";
+
+	qpInterface = std::shared_ptr< ExportRiccatiInterface >(new ExportRiccatiInterface(outFile, commonHeaderName));
+
+	int maxNumQPiterations;
+	get(MAX_NUM_QP_ITERATIONS, maxNumQPiterations);
+
+	// XXX If not specified, use default value
+	if ( maxNumQPiterations <= 0 )
+		maxNumQPiterations = 100;
+
+	int printLevel;
+	get(PRINTLEVEL, printLevel);
+
+	return qpInterface->configure(
+			maxNumQPiterations,
+			(PrintLevel)printLevel >= HIGH ? 1 : 0,
+			dimPacH,
+			evGx, evGu, d,
+			qpQ, qpS, qpR, qpQf,
+			qpq, qpr, qpqf,
+			qpLb, qpUb,
+			qpLbA, qpUbA,
+			pacEvHx, pacEvHu,
+			qpx, qpu,
+			qpLambda, qpMu,
+			nIt
+	);
+}
+
+CLOSE_NAMESPACE_ACADO
@@ -0,0 +1,102 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file include/acado/code_generation/export_gauss_newton_riccati.hpp
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_EXPORT_GAUSS_NEWTON_RICCATI_HPP
+#define ACADO_TOOLKIT_EXPORT_GAUSS_NEWTON_RICCATI_HPP
+
+#include <acado/code_generation/export_gauss_newton_generic.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+class ExportRiccatiInterface;
+
+/**
+ *	\brief Gauss-Newton RTI solver with an in-tree Riccati-based QP solver
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *	The sparse QP of the multiple-shooting Gauss-Newton scheme is solved by
+ *	an exported primal-dual interior-point method, whose Newton steps are
+ *	computed by a Riccati recursion over the horizon. The computational cost
+ *	per iteration thus grows linearly with the horizon length, and the
+ *	exported code needs neither external libraries nor dynamic memory.
+ *
+ *	Only the NMPC case (fixed initial state) with bounds and path
+ *	constraints is supported.
+ */
+class ExportGaussNewtonRiccati : public ExportGaussNewtonGeneric
+{
+public:
+
+	/** Default constructor.
+	 *
+	 *	@param[in] _userInteraction		Pointer to corresponding user interface.
+	 *	@param[in] _commonHeaderName	Name of common header file to be included.
+	 */
+	ExportGaussNewtonRiccati(	UserInteraction* _userInteraction = 0,
+								const std::string& _commonHeaderName = ""
+								);
+
+	/** Destructor.
+	*/
+	virtual ~ExportGaussNewtonRiccati( )
+	{}
+
+	/** Initializes export of an algorithm.
+	 *
+	 *	\return SUCCESSFUL_RETURN, \n
+	 *	        RET_NOT_IMPLEMENTED_YET
+	 */
+	virtual returnValue setup( );
+
+	/** Exports source code of the auto-generated algorithm
+	 *  into the given directory.
+	 *
+	 *	@param[in] code				Code block containing the auto-generated algorithm.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	virtual returnValue getCode(	ExportStatementBlock& code
+									);
+
+protected:
+
+	/** Configures the exported QP solver.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue setupQPInterface( );
+
+	std::shared_ptr< ExportRiccatiInterface > qpInterface;
+};
+
+CLOSE_NAMESPACE_ACADO
+
+#endif  // ACADO_TOOLKIT_EXPORT_GAUSS_NEWTON_RICCATI_HPP
@@ -91,9 +91,12 @@ returnValue ExportModule::setupOptions( )
 	addOption( PRINTLEVEL,                  MEDIUM          );
 
 	addOption( CG_USE_C99,                       NO         );
+	addOption( CG_MULTIPLICATION_KERNEL,         MULTIPLICATION_LOOPS );
+	addOption( CG_REUSE_WORKSPACE_MEMORY,        NO         );
 	addOption( CG_USE_VARIABLE_WEIGHTING_MATRIX, NO         );
 	addOption( CG_COMPUTE_COVARIANCE_MATRIX,     NO         );
 	addOption( CG_USE_OPENMP,					 NO         );
+	addOption( CG_USE_SOLVER_CONTEXT,            NO         );
 	addOption( CG_HARDCODE_CONSTRAINT_VALUES,    YES        );
 	addOption( CG_USE_ARRIVAL_COST,              NO         );
 
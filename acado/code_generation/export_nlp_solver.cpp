@@ -184,7 +184,8 @@ returnValue ExportNLPSolver::setupInitialization()
 
 	initialize << (retInit == 0);
 	initialize.addLinebreak();
-	initialize	<< "memset(&" << moduleName << "Workspace, 0, sizeof( " << moduleName << "Workspace ));" << "\n";
+	string workspaceName = ExportStatement::contextName.empty() ? moduleName + "Workspace" : ExportStatement::contextName + "->workspace";
+	initialize	<< "memset(&" << workspaceName << ", 0, sizeof( " << workspaceName << " ));" << "\n";
 //	initialize	<< "memset(&" << moduleName << "Variables, 0, sizeof( " << moduleName << "Variables ));" << "\n";
 
 	return SUCCESSFUL_RETURN;
@@ -321,15 +322,15 @@ returnValue ExportNLPSolver::setupSimulation( void )
 	{
 		if( (ImplicitIntegratorMode)intMode == LIFTED || (ImplicitIntegratorMode)intMode == LIFTED_FEEDBACK ) {
 			loop	<< retSim.getFullName() << " = "
-					<< moduleName << "_integrate" << "(" << state.getFullName()
+					<< moduleName << "_integrate" << "(" << ExportStatement::getContextArgument(", ") << state.getFullName()
 					<< ", " << run.getFullName() << ");\n";
 		}
 		else if (performsSingleShooting() == false)
 			loop 	<< retSim.getFullName() << " = "
-				 	 << moduleName << "_integrate" << "(" << state.getFullName() << ", 1);\n";
+				 	 << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", 1);\n";
 		else
 			loop 	<< retSim.getFullName() << " = " << moduleName << "_integrate"
-					<< "(" << state.getFullName() << ", "
+					<< "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", "
 					<< run.getFullName() << " == 0"
 					<< ");\n";
 	}
@@ -338,11 +339,11 @@ returnValue ExportNLPSolver::setupSimulation( void )
 		if (performsSingleShooting() == false)
 			loop 	<< retSim.getFullName() << " = "
 					<< moduleName << "_integrate"
-					<< "(" << state.getFullName() << ", 1, " << run.getFullName() << ");\n";
+					<< "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", 1, " << run.getFullName() << ");\n";
 		else
 			loop	<< retSim.getFullName() << " = "
 					<< moduleName << "_integrate"
-					<< "(" << state.getFullName() << ", "
+					<< "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", "
 					<< run.getFullName() << " == 0"
 					<< ", " << run.getFullName() << ");\n";
 	}
@@ -444,12 +445,19 @@ returnValue ExportNLPSolver::setupSimulation( void )
 
 returnValue ExportNLPSolver::setObjective(const Objective& _objective)
 {
+	returnValue status;
 	if( _objective.getNumMayerTerms() == 0 && _objective.getNumLagrangeTerms() == 0 ) {
-		return setLSQObjective( _objective );
+		status = setLSQObjective( _objective );
 	}
 	else {
-		return setGeneralObjective( _objective );
+		status = setGeneralObjective( _objective );
 	}
+
+	// Arguments of the objective evaluation are refilled at each stage
+	objValueIn.setTemporary();
+	objValueOut.setTemporary();
+
+	return status;
 }
 
 
@@ -1706,11 +1714,11 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 
 	if ( integrator->equidistantControlGrid() )
 	{
-		shiftStates << moduleName << "_integrate" << "(" << state.getFullName() << ", 1);\n";
+		shiftStates << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", 1);\n";
 	}
 	else
 	{
-		shiftStates << moduleName << "_integrate" << "(" << state.getFullName() << ", 1, " << toString(N - 1) << ");\n";
+		shiftStates << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", 1, " << toString(N - 1) << ");\n";
 	}
 
 	shiftStates.addLinebreak( );
@@ -1750,14 +1758,14 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 	if ( integrator->equidistantControlGrid() )
 	{
 		iLoop << moduleName << "_integrate"
-				<< "(" << state.getFullName() << ", "
+				<< "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", "
 				<< index.getFullName() << " == 0"
 				<< ");\n";
 	}
 	else
 	{
 		iLoop << moduleName << "_integrate"
-				<< "(" << state.getFullName() << ", "
+				<< "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", "
 				<< index.getFullName() << " == 0"
 				<< ", " << index.getFullName() << ");\n";
 	}
@@ -2017,9 +2025,9 @@ returnValue ExportNLPSolver::setupArrivalCostCalculation()
 	updateArrivalCost.addStatement( state.getCols(indexU, indexNOD) == od.getRow( 0 ) );
 
 	if (integrator->equidistantControlGrid())
-		updateArrivalCost << moduleName << "_integrate" << "(" << state.getFullName() << ", 1);\n";
+		updateArrivalCost << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", 1);\n";
 	else
-		updateArrivalCost << moduleName << "_integrate" << "(" << state.getFullName() << ", 1, " << toString(0) << ");\n";
+		updateArrivalCost << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument(", ") << state.getFullName() << ", 1, " << toString(0) << ");\n";
 	updateArrivalCost.addLinebreak( );
 
 	//
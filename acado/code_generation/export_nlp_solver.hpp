@@ -363,6 +363,7 @@ enum ExportNLPType
 	GAUSS_NEWTON_QPDUNES,
 	GAUSS_NEWTON_HPMPC,
     GAUSS_NEWTON_GENERIC,
+	GAUSS_NEWTON_RICCATI,
 	EXACT_HESSIAN_CN2,
 	EXACT_HESSIAN_QPDUNES
 };
@@ -81,6 +81,10 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 
 	stringstream s, ctor;
 	string solverName;
+
+	// The number of working set recalculations is kept in the solver context, if any
+	string nWSR = ExportStatement::contextName.empty() ?
+			ExportStatement::fcnPrefix + _prefix + "_nWSR" : ExportStatement::contextName + "->nWSR";
 	if (ncmax > 0)
 	{
 		solverName = "QProblem";
@@ -89,7 +93,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 		if (_externalCholesky == false)
 			s << _qpR << ", ";
 		s	<< _qpg << ", " << _qpA << ", " << _qplb << ", " << _qpub << ", "
-			<< _qplbA << ", " << _qpubA << ", " << ExportStatement::fcnPrefix << _prefix << "_nWSR";
+			<< _qplbA << ", " << _qpubA << ", " << nWSR;
 
 		if ( (bool)_hotstartQP == true )
 			s << ", " << _dualSolution;
@@ -103,7 +107,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 		s	<< _qpH << ", ";
 		if (_externalCholesky == false)
 			s << _qpR << ", ";
-		s	<< _qpg << ", " << _qplb << ", " << _qpub << ", " << ExportStatement::fcnPrefix << _prefix << "_nWSR";
+		s	<< _qpg << ", " << _qplb << ", " << _qpub << ", " << nWSR;
 
 		if ( (bool)_hotstartQP == true )
 			s << ", " << _dualSolution;
@@ -120,6 +124,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 	qpoSource.dictionary[ "@DUAL_SOLUTION@" ] =  _dualSolution;
 	qpoSource.dictionary[ "@CTOR@" ] =  ctor.str();
 	qpoSource.dictionary[ "@SIGMA@" ] =  _sigma;
+	qpoSource.dictionary[ "@NWSR@" ] =  nWSR;
     qpoSource.dictionary[ "@MODULE_NAME@" ] = ExportStatement::fcnPrefix;
     qpoSource.dictionary[ "@MODULE_PREFIX@" ] = ExportStatement::varPrefix;
 
@@ -145,6 +150,9 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 
 	qpoHeader.dictionary[ "@PRINT_LEVEL@" ] =  _printLevel;
 
+	// Solvers with a context may run concurrently
+	qpoHeader.dictionary[ "@REENTRANT@" ] = ExportStatement::contextName.empty() ? "0" : "1";
+
 	double eps;
 	string realT;
 	if ( _useSinglePrecision )
@@ -0,0 +1,163 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file src/code_generation/export_riccati_interface.cpp
+ *    \date 2014
+ */
+
+#include <acado/code_generation/export_riccati_interface.hpp>
+#include <acado/code_generation/templates/templates.hpp>
+
+#include <sstream>
+#include <iomanip>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+ExportRiccatiInterface::ExportRiccatiInterface(	const std::string& _fileName,
+												const std::string& _commonHeaderName,
+												const std::string& _realString,
+												const std::string& _intString,
+												int _precision,
+												const std::string& _commentString
+						) : ExportTemplatedFile(RICCATI_INTERFACE, _fileName, _commonHeaderName, _realString, _intString, _precision, _commentString)
+{}
+
+returnValue ExportRiccatiInterface::configure(	const unsigned _maxIter,
+												const unsigned _printLevel,
+												const unsigned _NC,
+												const ExportVariable& _A,
+												const ExportVariable& _B,
+												const ExportVariable& _d,
+												const ExportVariable& _Q,
+												const ExportVariable& _S,
+												const ExportVariable& _R,
+												const ExportVariable& _Qf,
+												const ExportVariable& _q,
+												const ExportVariable& _r,
+												const ExportVariable& _qf,
+												const ExportVariable& _lb,
+												const ExportVariable& _ub,
+												const ExportVariable& _lbA,
+												const ExportVariable& _ubA,
+												const ExportVariable& _Hx,
+												const ExportVariable& _Hu,
+												const ExportVariable& _x,
+												const ExportVariable& _u,
+												const ExportVariable& _lambda,
+												const ExportVariable& _mu,
+												const ExportVariable& _nIt
+												)
+{
+	// All QP data has to live in the workspace; the solver addresses it stage-wise.
+	if (_A.isGiven() || _B.isGiven() || _Q.isGiven() || _S.isGiven() || _R.isGiven() || _Qf.isGiven())
+		return ACADOERRORTEXT(RET_INVALID_ARGUMENTS, "Riccati QP interface: QP matrices must not be hard-coded.");
+
+	// Configure the dictionary
+	dictionary[ "@MAX_ITER@" ] =  toString( _maxIter );
+	dictionary[ "@PRINT_LEVEL@" ] =  _printLevel == 0 ? toString( 0 ) : toString( 1 );
+	dictionary[ "@MODULE_NAME@" ] = ExportStatement::fcnPrefix;
+	dictionary[ "@MODULE_PREFIX@" ] = ExportStatement::varPrefix;
+	dictionary[ "@QP_NC@" ] = toString( _NC );
+
+	dictionary[ "@QP_A@" ] = _A.getFullName();
+	dictionary[ "@QP_B@" ] = _B.getFullName();
+	dictionary[ "@QP_D@" ] = _d.getFullName();
+	dictionary[ "@QP_Q@" ] = _Q.getFullName();
+	dictionary[ "@QP_S@" ] = _S.getFullName();
+	dictionary[ "@QP_R@" ] = _R.getFullName();
+	dictionary[ "@QP_QF@" ] = _Qf.getFullName();
+	dictionary[ "@QP_QV@" ] = _q.getFullName();
+	dictionary[ "@QP_RV@" ] = _r.getFullName();
+	dictionary[ "@QP_QFV@" ] = _qf.getFullName();
+	dictionary[ "@QP_LB@" ] = _lb.getFullName();
+	dictionary[ "@QP_UB@" ] = _ub.getFullName();
+	dictionary[ "@QP_LBA@" ] = _lbA.getFullName();
+	dictionary[ "@QP_UBA@" ] = _ubA.getFullName();
+	dictionary[ "@QP_X@" ] = _x.getFullName();
+	dictionary[ "@QP_U@" ] = _u.getFullName();
+	dictionary[ "@QP_LAMBDA@" ] = _lambda.getFullName();
+	dictionary[ "@QP_MU@" ] = _mu.getFullName();
+	dictionary[ "@QP_NIT@" ] = _nIt.getFullName();
+
+	if (_NC > 0)
+	{
+		setupJacobian(_Hx, "@QP_HX", "Hx", "NX");
+		setupJacobian(_Hu, "@QP_HU", "Hu", "NU");
+	}
+	else
+	{
+		dictionary[ "@QP_HX@" ] = dictionary[ "@QP_HU@" ] = "((const real_t*)0)";
+		dictionary[ "@QP_HX_DATA@" ] = dictionary[ "@QP_HU_DATA@" ] = "";
+	}
+
+	// And then fill a template file
+	fillTemplate();
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ExportRiccatiInterface::setupJacobian(	const ExportVariable& _H,
+													const std::string& _key,
+													const std::string& _name,
+													const std::string& _stride
+													)
+{
+	stringstream ss;
+
+	if (_H.getDim() == 0)
+	{
+		// Structurally zero Jacobian
+		dictionary[ _key + "@" ] = "((const real_t*)0)";
+		dictionary[ _key + "_DATA@" ] = "";
+	}
+	else if (_H.isGiven() == true)
+	{
+		// Constant Jacobian, identical on all stages
+		string arrayName = ExportStatement::fcnPrefix + "_riccati" + _name;
+		DMatrix values = _H.getGivenMatrix();
+
+		ss << "static const real_t " << arrayName << "[ " << values.getDim() << " ] = {";
+		ss << scientific << setprecision( 16 );
+		for (unsigned i = 0; i < values.getNumRows(); ++i)
+			for (unsigned j = 0; j < values.getNumCols(); ++j)
+				ss << (i + j > 0 ? ", " : " ") << values(i, j);
+		ss << " };";
+
+		dictionary[ _key + "@" ] = "(" + arrayName + ")";
+		dictionary[ _key + "_DATA@" ] = ss.str();
+	}
+	else
+	{
+		dictionary[ _key + "@" ] = "(" + _H.getFullName() + " + (k) * NC * " + _stride + ")";
+		dictionary[ _key + "_DATA@" ] = "";
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+CLOSE_NAMESPACE_ACADO
@@ -0,0 +1,125 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file include/acado/code_generation/export_riccati_interface.hpp
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_EXPORT_RICCATI_INTERFACE_HPP
+#define ACADO_TOOLKIT_EXPORT_RICCATI_INTERFACE_HPP
+
+
+#include <acado/code_generation/export_templated_file.hpp>
+#include <acado/code_generation/export_variable.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+/**
+ *	\brief Interface generator for the in-tree Riccati-based QP solver
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *	The generated file implements a primal-dual interior-point QP solver whose
+ *	Newton steps are computed by a Riccati recursion, with statically allocated
+ *	work memory of fixed dimensions.
+ */
+class ExportRiccatiInterface : public ExportTemplatedFile
+{
+public:
+	/** Default constructor.
+	 *
+	 *	@param[in] _fileName			Name of exported file.
+	 *	@param[in] _commonHeaderName	Name of common header file to be included.
+	 *	@param[in] _realString			std::string to be used to declare real variables.
+	 *	@param[in] _intString			std::string to be used to declare integer variables.
+	 *	@param[in] _precision			Number of digits to be used for exporting real values.
+	 *	@param[in] _commentString		std::string to be used for exporting comments.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	ExportRiccatiInterface(	const std::string& _fileName,
+							const std::string& _commonHeaderName = "",
+							const std::string& _realString = "real_t",
+							const std::string& _intString = "int",
+							int _precision = 16,
+							const std::string& _commentString = std::string()
+							);
+
+	/** Destructor. */
+	virtual ~ExportRiccatiInterface( )
+	{}
+
+	/** Configure the template
+	 *
+	 *	@param[in] _maxIter		Maximum number of interior-point iterations.
+	 *	@param[in] _printLevel	Print level; non-zero prints the iterations.
+	 *	@param[in] _NC			Number of path constraints per stage.
+	 *	@param[in] _Hx, _Hu		Jacobians of the path constraints; either time-varying
+	 *							(stacked over the stages), constant or empty.
+	 *
+	 *	The remaining arguments are the workspace variables holding the QP data
+	 *	and the solution.
+	 *
+	 *  \return SUCCESSFUL_RETURN
+	 */
+	returnValue configure(	const unsigned _maxIter,
+							const unsigned _printLevel,
+							const unsigned _NC,
+							const ExportVariable& _A,
+							const ExportVariable& _B,
+							const ExportVariable& _d,
+							const ExportVariable& _Q,
+							const ExportVariable& _S,
+							const ExportVariable& _R,
+							const ExportVariable& _Qf,
+							const ExportVariable& _q,
+							const ExportVariable& _r,
+							const ExportVariable& _qf,
+							const ExportVariable& _lb,
+							const ExportVariable& _ub,
+							const ExportVariable& _lbA,
+							const ExportVariable& _ubA,
+							const ExportVariable& _Hx,
+							const ExportVariable& _Hu,
+							const ExportVariable& _x,
+							const ExportVariable& _u,
+							const ExportVariable& _lambda,
+							const ExportVariable& _mu,
+							const ExportVariable& _nIt
+							);
+
+private:
+	/** Sets up the dictionary entries for a path constraint Jacobian. */
+	returnValue setupJacobian(	const ExportVariable& _H,
+								const std::string& _key,
+								const std::string& _name,
+								const std::string& _stride
+								);
+};
+
+CLOSE_NAMESPACE_ACADO
+
+#endif // ACADO_TOOLKIT_EXPORT_RICCATI_INTERFACE_HPP
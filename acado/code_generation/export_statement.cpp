@@ -38,6 +38,7 @@ BEGIN_NAMESPACE_ACADO
 
 std::string ExportStatement::fcnPrefix = "acado";
 std::string ExportStatement::varPrefix = "ACADO";
+std::string ExportStatement::contextName = "";
         
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -82,6 +83,16 @@ returnValue ExportStatement::exportDataDeclaration(	std::ostream& stream,
 }
 
 
+std::string ExportStatement::getContextArgument(	const std::string& _separator
+													)
+{
+	if ( contextName.empty() == true )
+		return std::string( );
+
+	return contextName + _separator;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -148,11 +148,20 @@ class ExportStatement
 		{
 			return *this;
 		}
+
+		/** Returns the name of the solver context pointer followed by the given
+		 *  separator, or an empty string if the exported code uses global data.
+		 *  Meant for function calls that are written as plain text.
+		 */
+		static std::string getContextArgument(	const std::string& _separator = ""
+												);
         
         
     public:
         static std::string fcnPrefix;
         static std::string varPrefix;
+        /** Name of the solver context pointer passed to the exported functions; empty if global data is used. */
+        static std::string contextName;
 };
 
 
@@ -253,6 +253,12 @@ uint ExportStatementBlock::getNumStatements( ) const
 }
 
 
+const ExportStatement::StatementPtrArray& ExportStatementBlock::getStatements( ) const
+{
+	return statements;
+}
+
+
 
 returnValue ExportStatementBlock::exportDataDeclaration(	std::ostream& stream,
 															const std::string& _realString,
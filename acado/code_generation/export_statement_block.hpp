@@ -237,6 +237,12 @@ class ExportStatementBlock : public ExportStatement
 		 */
 		uint getNumStatements( ) const;
 
+		/** Returns the statements within statement block.
+		 *
+		 *  \return Statements within statement block
+		 */
+		const StatementPtrArray& getStatements( ) const;
+
 
 		/** Exports data declaration of the statement block into given file. Its appearance can 
 		 *  can be adjusted by various options.
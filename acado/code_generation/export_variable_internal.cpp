@@ -498,6 +498,11 @@ bool ExportVariableInternal::isDiagonal() const
 	return (foo == bar);
 }
 
+bool ExportVariableInternal::isAccessedTransposed() const
+{
+	return doAccessTransposed;
+}
+
 
 CLOSE_NAMESPACE_ACADO
 
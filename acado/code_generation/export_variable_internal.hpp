@@ -270,6 +270,9 @@ class ExportVariableInternal : public ExportArgumentInternal
 		/** Check whether the matrix is diagonal. */
 		bool isDiagonal() const;
 
+		/** Check whether the matrix is accessed in a transposed manner. */
+		bool isAccessedTransposed() const;
+
 	//
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -72,11 +72,23 @@ returnValue ExplicitRungeKuttaExport::setup( )
 
 	LOG( LVL_DEBUG ) << "Preparing to export ExplicitRungeKuttaExport... " << endl;
 
+	// only the structurally nonzero sensitivities are propagated, if known
+	uint numSens = 0;
+	const bool SPARSE = DERIVATIVES && sensitivityPattern.getNumRows() == NX;
+	if( SPARSE ) {
+		for( uint i = 0; i < NX; i++ )
+			for( uint j = 0; j < NX+NU; j++ )
+				if( acadoIsExactlyZero( sensitivityPattern(i,j) ) == BT_FALSE ) numSens++;
+	}
+
 	// export RK scheme
 	uint rhsDim   = NX*(NX+NU+1);
+	if( SPARSE ) rhsDim = NX + numSens;
 	if( !DERIVATIVES ) rhsDim = NX;
 	inputDim = NX*(NX+NU+1) + NU + NOD;
 	if( !DERIVATIVES ) inputDim = NX + NU + NOD;
+	const uint xxxDim = rhsDim + NU + NOD;
+	const uint etaDim = inputDim - NU - NOD;
 	const uint rkOrder  = getNumStages();
 
 	double h = (grid.getLastTime() - grid.getFirstTime())/grid.getNumIntervals();    
@@ -96,8 +108,15 @@ returnValue ExplicitRungeKuttaExport::setup( )
 	uint timeDep = 0;
 	if( timeDependant ) timeDep = 1;
 	
-	rk_xxx.setup("rk_xxx", 1, inputDim+timeDep, REAL, structWspace);
+	rk_xxx.setup("rk_xxx", 1, xxxDim+timeDep, REAL, structWspace);
 	rk_kkk.setup("rk_kkk", rkOrder, rhsDim, REAL, structWspace);
+	if( SPARSE ) rk_diffsSparse.setup("rk_diffsSparse", 1, numSens, REAL, structWspace);
+	else rk_diffsSparse = ExportVariable();
+
+	// The stage values are refilled by every call of the integrator
+	rk_ttt.setTemporary();
+	rk_xxx.setTemporary();
+	rk_kkk.setTemporary();
 
 	if ( useOMP )
 	{
@@ -148,8 +167,21 @@ returnValue ExplicitRungeKuttaExport::setup( )
 		integrate.addStatement( rk_eta.getCols( NX*(1+NX),NX*(1+NX+NU) ) == zeroXU.makeVector().transpose() );
 	}
 
-	if( inputDim > rhsDim ) {
-		integrate.addStatement( rk_xxx.getCols( rhsDim,inputDim ) == rk_eta.getCols( rhsDim,inputDim ) );
+	if( SPARSE ) {
+		DMatrix idS = zeros<double>( 1,numSens );
+		uint k = 0;
+		for( uint i = 0; i < NX; i++ ) {
+			for( uint j = 0; j < NX+NU; j++ ) {
+				if( acadoIsExactlyZero( sensitivityPattern(i,j) ) == BT_TRUE ) continue;
+				if( i == j ) idS(0,k) = 1.0;
+				k++;
+			}
+		}
+		integrate.addStatement( rk_diffsSparse == idS );
+	}
+
+	if( inputDim > etaDim ) {
+		integrate.addStatement( rk_xxx.getCols( rhsDim,xxxDim ) == rk_eta.getCols( etaDim,inputDim ) );
 	}
 	integrate.addLinebreak( );
 
@@ -165,11 +197,23 @@ returnValue ExplicitRungeKuttaExport::setup( )
 
 	for( uint run1 = 0; run1 < rkOrder; run1++ )
 	{
-		loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + Ah.getRow(run1)*rk_kkk );
-		if( timeDependant ) loop.addStatement( rk_xxx.getCol( inputDim ) == rk_ttt + ((double)cc(run1))/grid.getNumIntervals() );
+		if( SPARSE ) {
+			loop.addStatement( rk_xxx.getCols( 0,NX ) == rk_eta.getCols( 0,NX ) + Ah.getRow(run1)*rk_kkk.getCols( 0,NX ) );
+			loop.addStatement( rk_xxx.getCols( NX,rhsDim ) == rk_diffsSparse + Ah.getRow(run1)*rk_kkk.getCols( NX,rhsDim ) );
+		}
+		else {
+			loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + Ah.getRow(run1)*rk_kkk );
+		}
+		if( timeDependant ) loop.addStatement( rk_xxx.getCol( xxxDim ) == rk_ttt + ((double)cc(run1))/grid.getNumIntervals() );
 		loop.addFunctionCall( getNameDiffsRHS(),rk_xxx,rk_kkk.getAddress(run1,0) );
 	}
-	loop.addStatement( rk_eta.getCols( 0,rhsDim ) += b4h^rk_kkk );
+	if( SPARSE ) {
+		loop.addStatement( rk_eta.getCols( 0,NX ) += b4h^rk_kkk.getCols( 0,NX ) );
+		loop.addStatement( rk_diffsSparse += b4h^rk_kkk.getCols( NX,rhsDim ) );
+	}
+	else {
+		loop.addStatement( rk_eta.getCols( 0,rhsDim ) += b4h^rk_kkk );
+	}
 	loop.addStatement( rk_ttt += DMatrix(1.0/grid.getNumIntervals()) );
     // end of integrator loop
 
@@ -178,6 +222,19 @@ returnValue ExplicitRungeKuttaExport::setup( )
 //		loop.unrollLoop();
 	}
 	integrate.addStatement( loop );
+
+	if( SPARSE ) {
+		// scatter the compressed sensitivities into the dense output:
+		uint k = 0;
+		for( uint i = 0; i < NX; i++ ) {
+			for( uint j = 0; j < NX+NU; j++ ) {
+				if( acadoIsExactlyZero( sensitivityPattern(i,j) ) == BT_TRUE ) continue;
+				if( j < NX ) integrate.addStatement( rk_eta.getCol( NX+i*NX+j ) == rk_diffsSparse.getCol( k ) );
+				else integrate.addStatement( rk_eta.getCol( NX*(1+NX)+i*NU+j-NX ) == rk_diffsSparse.getCol( k ) );
+				k++;
+			}
+		}
+	}
 	
 	integrate.addStatement( error_code == 0 );
 
@@ -223,7 +280,56 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 		return ACADOERRORTEXT( RET_INVALID_OPTION, "No implicit systems supported when using an explicit integration method!");
 	}
 
-	if( (ExportSensitivityType)sensGen == FORWARD ) {
+	int matlabInterface;
+	userInteraction->get(GENERATE_MATLAB_INTERFACE, matlabInterface);
+
+	sensitivityPattern = DMatrix();
+	if( !matlabInterface && (ExportSensitivityType)sensGen == FORWARD ) {
+		setupSensitivityPattern( rhs_ );
+	}
+
+	if( (ExportSensitivityType)sensGen == FORWARD && sensitivityPattern.getNumRows() > 0 ) {
+		// compressed VDE for the structurally nonzero sensitivities only
+		const Expression Jx = jacobian( rhs_, x );
+		const Expression Ju = NU > 0 ? jacobian( rhs_, u ) : Expression();
+		DMatrix depX = Jx.getSparsityPattern();
+		DMatrix depU;
+		if( NU > 0 ) depU = Ju.getSparsityPattern();
+
+		std::vector< std::vector<int> > sensIndex( NX, std::vector<int>( NX+NU,-1 ) );
+		uint numSens = 0;
+		uint i, j, k;
+		for( i = 0; i < NX; i++ ) {
+			for( j = 0; j < NX+NU; j++ ) {
+				if( acadoIsExactlyZero( sensitivityPattern(i,j) ) == BT_FALSE ) sensIndex[i][j] = numSens++;
+			}
+		}
+		const DifferentialState Gs("", numSens, 1);
+
+		f << rhs_;
+		for( i = 0; i < NX; i++ ) {
+			for( j = 0; j < NX+NU; j++ ) {
+				if( sensIndex[i][j] < 0 ) continue;
+
+				Expression vde;
+				bool empty = true;
+				for( k = 0; k < NX; k++ ) {
+					if( sensIndex[k][j] < 0 || acadoIsExactlyZero( depX(i,k) ) == BT_TRUE ) continue;
+					if( empty ) vde = Jx(i,k)*Gs(sensIndex[k][j]);
+					else vde = vde + Jx(i,k)*Gs(sensIndex[k][j]);
+					empty = false;
+				}
+				if( j >= NX && acadoIsExactlyZero( depU(i,j-NX) ) == BT_FALSE ) {
+					if( empty ) vde = Ju(i,j-NX);
+					else vde = vde + Ju(i,j-NX);
+					empty = false;
+				}
+				if( empty ) vde = Expression( 0.0 );
+				f << vde;
+			}
+		}
+	}
+	else if( (ExportSensitivityType)sensGen == FORWARD ) {
 		DifferentialState Gx("", NX,NX), Gu("", NX,NU);
 		// no free parameters yet!
 		// DifferentialState Gp(NX,NP);
@@ -252,14 +358,12 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 	}
 	if( f.getNT() > 0 ) timeDependant = true;
 
-	int matlabInterface;
-	userInteraction->get(GENERATE_MATLAB_INTERFACE, matlabInterface);
 	if( matlabInterface && (ExportSensitivityType)sensGen == FORWARD ) {
 		return rhs.init(f_ODE, "rhs", NX, 0, NU, NP, NDX, NOD)
 				& diffs_rhs.init(f, "rhs_ext", NX * (1 + NX + NU), 0, NU, NP, NDX, NOD);
 	}
 	else if( (ExportSensitivityType)sensGen == FORWARD ) {
-		return diffs_rhs.init(f, "rhs_forw", NX * (1 + NX + NU), 0, NU, NP, NDX, NOD);
+		return diffs_rhs.init(f, "rhs_forw", f.getDim(), 0, NU, NP, NDX, NOD);
 	}
 	else {
 		return diffs_rhs.init(f_ODE, "rhs", NX, 0, NU, NP, NDX, NOD);
@@ -297,6 +401,7 @@ returnValue ExplicitRungeKuttaExport::getDataDeclarations(	ExportStatementBlock&
 	declarations.addDeclaration( rk_ttt,dataStruct );
 	declarations.addDeclaration( rk_xxx,dataStruct );
 	declarations.addDeclaration( rk_kkk,dataStruct );
+	declarations.addDeclaration( rk_diffsSparse,dataStruct );
 
 //	declarations.addDeclaration( reset_int,dataStruct );
 
@@ -335,8 +440,10 @@ returnValue ExplicitRungeKuttaExport::getCode(	ExportStatementBlock& code
 				<< getAuxVariable().getFullName()  << ", "
 				<< rk_xxx.getFullName() << ", "
 				<< rk_ttt.getFullName() << ", "
-				<< rk_kkk.getFullName()
-				<< " )\n\n";
+				<< rk_kkk.getFullName();
+		if( rk_diffsSparse.getDim() > 0 )
+			code << ", " << rk_diffsSparse.getFullName();
+		code << " )\n\n";
 	}
 
 	int sensGen;
@@ -398,6 +505,17 @@ ExportVariable ExplicitRungeKuttaExport::getAuxVariable() const
 // PROTECTED:
 
 
+returnValue ExplicitRungeKuttaExport::copy(	const ExplicitRungeKuttaExport& arg
+											)
+{
+	RungeKuttaExport::copy( arg );
+
+	rk_diffsSparse = arg.rk_diffsSparse;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
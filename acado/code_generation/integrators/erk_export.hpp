@@ -209,8 +209,19 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 		virtual ExportVariable getAuxVariable() const;
 
 
+		/** Copies all class members from given object.
+		 *
+		 *	@param[in] arg		Right-hand side object.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue copy(	const ExplicitRungeKuttaExport& arg
+							);
+
+
     protected:
 
+		ExportVariable rk_diffsSparse;		/**< Variable containing the structurally nonzero sensitivities in compressed form. */
 
 };
 
@@ -496,7 +496,33 @@ returnValue IntegratorExport::propagateImplicitSystem(	ExportStatementBlock* blo
 																const ExportIndex& _index3, const ExportIndex& tmp_index )
 {
 	uint index3; // index3 instead of _index3 to unroll loops
-	if( NX2 > 0 ) {
+	if( NX2 > 0 && NX1 == 0 && NX3 == 0 && sensitivityPattern.getNumRows() == NX2 ) {
+		// unrolled chain rule, restricted to the structurally nonzero products:
+		uint row, col;
+		for( row = 0; row < NX2; row++ ) {
+			for( col = 0; col < NX2+NU; col++ ) {
+				if( acadoIsExactlyZero( sensitivityPattern(row,col) ) == BT_TRUE ) continue;
+
+				ExportVariable result;
+				bool first = true;
+				if( col < NX2 ) {
+					result = rk_eta.getCol( NX+NXA+row*NX+col );
+				}
+				else {
+					result = rk_eta.getCol( (NX+NXA)*(1+NX)+row*NU+col-NX2 );
+					block->addStatement( result == rk_diffsNew2.getSubMatrix( row,row+1,col,col+1 ) );
+					first = false;
+				}
+				for( index3 = 0; index3 < NX2; index3++ ) {
+					if( acadoIsExactlyZero( sensitivityPattern(row,index3) ) == BT_TRUE || acadoIsExactlyZero( sensitivityPattern(index3,col) ) == BT_TRUE ) continue;
+					if( first ) block->addStatement( result == rk_diffsNew2.getSubMatrix( row,row+1,index3,index3+1 )*rk_diffsPrev2.getSubMatrix( index3,index3+1,col,col+1 ) );
+					else block->addStatement( result += rk_diffsNew2.getSubMatrix( row,row+1,index3,index3+1 )*rk_diffsPrev2.getSubMatrix( index3,index3+1,col,col+1 ) );
+					first = false;
+				}
+			}
+		}
+	}
+	else if( NX2 > 0 ) {
 		ExportForLoop loop01( index1,NX1,NX1+NX2 );
 		if( NX1 > 0 ) {
 			ExportForLoop loop02( index2,0,NX1 );
@@ -638,10 +664,67 @@ DMatrix IntegratorExport::expandOutputMatrix( const DMatrix& A3 ) {
 }
 
 
+returnValue IntegratorExport::setupSensitivityPattern( const Expression& rhs_ )
+{
+	sensitivityPattern = DMatrix();
+
+	const uint nx = x.getDim();
+	const uint nu = u.getDim();
+	if( nx == 0 || rhs_.getDim() != nx ) return SUCCESSFUL_RETURN;
+
+	DMatrix depX = jacobian( rhs_, x ).getSparsityPattern();
+	DMatrix depU;
+	if( nu > 0 ) depU = jacobian( rhs_, u ).getSparsityPattern();
+
+	// The sensitivity of state i wrt state j is structurally nonzero iff
+	// j can be reached from i in the dependency graph of the right-hand side:
+	DMatrix closure = zeros<double>( nx,nx );
+	uint i, j, k;
+	for( i = 0; i < nx; i++ ) {
+		closure(i,i) = 1.0;
+		for( j = 0; j < nx; j++ ) {
+			if( acadoIsExactlyZero( depX(i,j) ) == BT_FALSE ) closure(i,j) = 1.0;
+		}
+	}
+	for( k = 0; k < nx; k++ ) {
+		for( i = 0; i < nx; i++ ) {
+			if( acadoIsExactlyZero( closure(i,k) ) == BT_TRUE ) continue;
+			for( j = 0; j < nx; j++ ) {
+				if( acadoIsExactlyZero( closure(k,j) ) == BT_FALSE ) closure(i,j) = 1.0;
+			}
+		}
+	}
+
+	DMatrix pattern = zeros<double>( nx,nx+nu );
+	uint numNonzeros = 0;
+	for( i = 0; i < nx; i++ ) {
+		for( j = 0; j < nx; j++ ) {
+			pattern(i,j) = closure(i,j);
+		}
+		for( j = 0; j < nu; j++ ) {
+			for( k = 0; k < nx; k++ ) {
+				if( acadoIsExactlyZero( closure(i,k) ) == BT_FALSE && acadoIsExactlyZero( depU(k,j) ) == BT_FALSE ) {
+					pattern(i,nx+j) = 1.0;
+					break;
+				}
+			}
+		}
+		for( j = 0; j < nx+nu; j++ ) {
+			if( acadoIsExactlyZero( pattern(i,j) ) == BT_FALSE ) numNonzeros++;
+		}
+	}
+
+	if( numNonzeros < nx*(nx+nu) ) sensitivityPattern = pattern;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue IntegratorExport::copy(	const IntegratorExport& arg
 									)
 {
 	exportRhs = arg.exportRhs;
+	sensitivityPattern = arg.sensitivityPattern;
 	crsFormat = arg.crsFormat;
 	grid = arg.grid;
 	numSteps = arg.numSteps;
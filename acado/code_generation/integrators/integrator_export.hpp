@@ -394,6 +394,18 @@ class IntegratorExport : public ExportAlgorithm
 		DMatrix expandOutputMatrix( const DMatrix& A3 );
 
 
+		/** Determines the structural sparsity pattern of the sensitivities of an explicit ODE
+		 *	with respect to the states and controls, i.e. the reflexive-transitive closure
+		 *	of the dependency graph of the right-hand side. The pattern is only stored when
+		 *	it contains structural zeros.
+		 *
+		 *	@param[in] rhs_			Right-hand side expression.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setupSensitivityPattern( const Expression& rhs_ );
+
+
 		/** Copies all class members from given object.
 		 *
 		 *	@param[in] arg		Right-hand side object.
@@ -443,6 +455,8 @@ class IntegratorExport : public ExportAlgorithm
 		DMatrix M11, A11, B11;
 		DMatrix A33, M33;
 
+		DMatrix sensitivityPattern;			/**< Structural nonzeros of the sensitivities wrt the states and controls (empty if dense). */
+
         bool exportRhs;						/**< True if the right-hand side and their derivatives should be exported too. */
         bool crsFormat;						/**< True if the CRS format is used for the jacobian of output functions. */
 
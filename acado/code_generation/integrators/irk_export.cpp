@@ -139,6 +139,9 @@ returnValue ImplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 		else if( NDX2 > 0 ) NDX2 = NX1+NX2;
 		dx = DifferentialStateDerivative("", NDX2, 1);
 
+		if( NXA == 0 && NDX2 == 0 ) setupSensitivityPattern( rhs_ );
+		else sensitivityPattern = DMatrix();
+
 		DifferentialEquation g;
 		for( uint i = 0; i < rhs_.getDim(); i++ ) {
 			g << forwardDerivative( rhs_(i), x );
@@ -532,8 +532,10 @@ returnValue ExportGaussElim::setup( )
 
 	int useOMP;
 	get(CG_USE_OPENMP, useOMP);
+	int useContext;
+	get(CG_USE_SOLVER_CONTEXT, useContext);
 	ExportStruct structWspace;
-	structWspace = useOMP ? ACADO_LOCAL : ACADO_WORKSPACE;
+	structWspace = (useOMP || useContext) ? ACADO_LOCAL : ACADO_WORKSPACE;
 
 	rk_swap = ExportVariable( std::string( "rk_" ) + identifier + "swap", 1, 1, REAL, structWspace, true );
 	A = ExportVariable( "A", dim, dim, REAL );
@@ -566,6 +568,21 @@ returnValue ExportGaussElim::setup( )
 		}
 	}
 	
+	// The functions only operate on their arguments and are called by name,
+	// hence they never take the solver context. In that case the auxiliary
+	// variables live on the stack of the function using them.
+	solve.setContextFree( );
+	solveTriangular.setContextFree( );
+	solveReuse.setContextFree( );
+	solveReuseTranspose.setContextFree( );
+	if ( useContext ) {
+		solve.addVariable( rk_swap );
+		if( REUSE ) {
+			solveReuse.addVariable( rk_bPerm );
+			if( TRANSPOSE ) solveReuseTranspose.addVariable( rk_bPerm_trans );
+		}
+	}
+
 	int unrollOpt;
 	userInteraction->get( UNROLL_LINEAR_SOLVER, unrollOpt );
 	UNROLLING = (bool) unrollOpt;
@@ -36,6 +36,7 @@
 #include <acado/code_generation/export_hessian_regularization.hpp>
 #include <acado/code_generation/export_common_header.hpp>
 #include <acado/code_generation/export_data_internal.hpp>
+#include <acado/code_generation/workspace_allocator.hpp>
 
 #include <acado/code_generation/export_gauss_newton_block_cn2.hpp>
 #include <acado/code_generation/export_gauss_newton_forces.hpp>
@@ -82,6 +83,21 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
     ExportStatement::fcnPrefix = moduleName;
     ExportStatement::varPrefix = modulePrefix;
 
+	// All solver data is either global or accessed through a context pointer
+	int useSolverContext;
+	get(CG_USE_SOLVER_CONTEXT, useSolverContext);
+	string contextName = (bool)useSolverContext == true ? moduleName + "Context" : "";
+	ExportDataInternal::contextName = contextName;
+	ExportStatement::contextName = contextName;
+
+	// Kernel for products of matrices; the vectorized ones support double precision only
+	int multiplicationKernel, useSinglePrecision;
+	get(CG_MULTIPLICATION_KERNEL, multiplicationKernel);
+	get(USE_SINGLE_PRECISION, useSinglePrecision);
+	if ((bool)useSinglePrecision == true && (ExportMultiplicationKernel)multiplicationKernel != MULTIPLICATION_LOOPS)
+		multiplicationKernel = MULTIPLICATION_BLOCKED;
+	ExportArithmeticStatement::multiplicationKernel = (ExportMultiplicationKernel)multiplicationKernel;
+
 	acadoPrintCopyrightNotice( "Code Generation Tool" );
 
 	//
@@ -101,44 +117,49 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	if ( setupStatus != SUCCESSFUL_RETURN )
 		return setupStatus;
 
-	//
-	// Export common header
-	//
-	if (exportAcadoHeader(dirName, commonHeaderName, _realString, _intString, _precision)
-			!= SUCCESSFUL_RETURN )
-		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+	if (integrator == 0 || solver == 0)
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
 	//
-	// Export integrator
+	// Collect the code of the integrator and the solver
 	//
-	if (integrator != 0)
-	{
-		ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
-				commonHeaderName, _realString, _intString, _precision);
+	ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
+			commonHeaderName, _realString, _intString, _precision);
 
-		integrator->getCode( integratorFile );
+	integrator->getCode( integratorFile );
 
-		if (integratorFile.exportCode( ) != SUCCESSFUL_RETURN)
+	ExportFile solverFile(dirName + "/" + moduleName + "_solver.c",
+			commonHeaderName, _realString, _intString, _precision);
+
+	solver->getCode( solverFile );
+
+	// Temporaries of the workspace share memory according to their lifetimes in the code
+	int reuseWorkspaceMemory;
+	get(CG_REUSE_WORKSPACE_MEMORY, reuseWorkspaceMemory);
+
+	WorkspaceAllocator workspaceAllocator( (bool)useSinglePrecision == true ? 16 : 8 );
+	if ((bool)reuseWorkspaceMemory == true)
+	{
+		if (workspaceAllocator.addCode(integratorFile, _realString, _intString, _precision) != SUCCESSFUL_RETURN ||
+			workspaceAllocator.addCode(solverFile, _realString, _intString, _precision) != SUCCESSFUL_RETURN)
 			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 	}
-	else
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
 	//
-	// Export solver
+	// Export common header
 	//
-	if( solver != 0 )
-	{
-		ExportFile solverFile(dirName + "/" + moduleName + "_solver.c",
-				commonHeaderName, _realString, _intString, _precision);
+	if (exportAcadoHeader(dirName, commonHeaderName, workspaceAllocator, _realString, _intString, _precision)
+			!= SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
-		solver->getCode( solverFile );
+	//
+	// Export integrator and solver
+	//
+	if (integratorFile.exportCode( ) != SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
-		if ( solverFile.exportCode( ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
-	}
-	else
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
+	if ( solverFile.exportCode( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	LOG( LVL_DEBUG ) << "Export templates" << endl;
 
@@ -225,6 +246,12 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 				//acadoCopyTemplateFile(MAKEFILE_HPMPC, str, "#", true);
                 makefile.setup( MAKEFILE_HPMPC,str,"","real_t","int",16,"#" );
                 makefile.configure();
+                makefile.exportCode();
+				break;
+
+			case QP_RICCATI:
+                makefile.setup( MAKEFILE_RICCATI,str,"","real_t","int",16,"#" );
+                makefile.configure();
                 makefile.exportCode();
 				break;
 
@@ -356,6 +383,7 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 			break;
 
         case QP_GENERIC:
+        case QP_RICCATI:
             break;
 		default:
 			ACADOWARNINGTEXT(RET_NOT_IMPLEMENTED_YET, "MEX interface is not yet available.");
@@ -389,10 +417,6 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 			else
 				qpSolverString = "HPMPC";
 
-			// Get options
-			int useSinglePrecision;
-			get(USE_SINGLE_PRECISION, useSinglePrecision);
-
 			ExportSimulinkInterface esi(makefileName, wrapperHeaderName, wrapperSourceName, moduleName, modulePrefix);
 			if( useSinglePrecision ) {
 				esi = ExportSimulinkInterface(makefileName, wrapperHeaderName, wrapperSourceName, moduleName, modulePrefix, "", "single");
@@ -591,9 +615,9 @@ returnValue OCPexport::setup( )
 			break;
 
 	case SPARSE_SOLVER:
-		if ((QPSolverName)qpSolver != QP_FORCES && (QPSolverName)qpSolver != QP_QPDUNES && (QPSolverName)qpSolver != QP_HPMPC && (QPSolverName)qpSolver != QP_GENERIC)
+		if ((QPSolverName)qpSolver != QP_FORCES && (QPSolverName)qpSolver != QP_QPDUNES && (QPSolverName)qpSolver != QP_HPMPC && (QPSolverName)qpSolver != QP_GENERIC && (QPSolverName)qpSolver != QP_RICCATI)
 			return ACADOERRORTEXT(RET_INVALID_ARGUMENTS,
-					"For sparse solution FORCES, qpDUNES and HPMPC QP solvers are supported");
+					"For sparse solution FORCES, qpDUNES, HPMPC and Riccati QP solvers are supported");
 		if ( (QPSolverName)qpSolver == QP_FORCES)
 			solver = ExportNLPSolverPtr(
 					NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, GAUSS_NEWTON_FORCES));
@@ -613,6 +637,9 @@ returnValue OCPexport::setup( )
         else if ((QPSolverName)qpSolver == QP_GENERIC)
             solver = ExportNLPSolverPtr(
                     NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, GAUSS_NEWTON_GENERIC));
+		else if ((QPSolverName)qpSolver == QP_RICCATI)
+			solver = ExportNLPSolverPtr(
+					NLPSolverFactory::instance().createAlgorithm(this, commonHeaderName, GAUSS_NEWTON_RICCATI));
 		break;
 
 	default:
@@ -696,6 +723,98 @@ returnValue OCPexport::checkConsistency( ) const
  			( (StateDiscretizationType)discretizationType != MULTIPLE_SHOOTING ) )
  		return ACADOERROR( RET_INVALID_OPTION );
 
+ 	int useSolverContext;
+ 	get( CG_USE_SOLVER_CONTEXT,useSolverContext );
+ 	if ( (bool)useSolverContext == true )
+ 	{
+ 		returnValue contextStatus = checkSolverContextConsistency( );
+ 		if ( contextStatus != SUCCESSFUL_RETURN )
+ 			return contextStatus;
+ 	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OCPexport::checkSolverContextConsistency( ) const
+{
+	//
+	// So far, only the condensed qpOASES based Gauss-Newton solvers together
+	// with plain explicit and implicit Runge-Kutta integrators are able to
+	// keep all of their data in a solver context. The embedded qpOASES 3
+	// relies on static work arrays and can therefore not be used.
+	//
+	int qpSolver;
+	get( QP_SOLVER,qpSolver );
+	int qpSolution;
+	get( SPARSE_QP_SOLUTION,qpSolution );
+	if ( (QPSolverName)qpSolver != QP_QPOASES ||
+			(SparseQPsolutionMethods)qpSolution == BLOCK_CONDENSING_N2 ||
+			(SparseQPsolutionMethods)qpSolution == SPARSE_SOLVER )
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"A solver context is only supported in combination with condensing and the qpOASES QP solver.");
+
+	int hessianApproximation;
+	get( HESSIAN_APPROXIMATION,hessianApproximation );
+	if ( (HessianApproximationMode)hessianApproximation != GAUSS_NEWTON )
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"A solver context is only supported in combination with the Gauss-Newton Hessian approximation.");
+
+	int integratorType;
+	get( INTEGRATOR_TYPE,integratorType );
+	int sensitivityProp;
+	get( DYNAMIC_SENSITIVITY,sensitivityProp );
+	int intMode;
+	get( IMPLICIT_INTEGRATOR_MODE,intMode );
+	int linSolver;
+	get( LINEAR_ALGEBRA_SOLVER,linSolver );
+	switch ( (ExportIntegratorType)integratorType )
+	{
+		case INT_EX_EULER:
+		case INT_RK2:
+		case INT_RK3:
+		case INT_RK4:
+		case INT_IRK_GL2:
+		case INT_IRK_GL4:
+		case INT_IRK_GL6:
+		case INT_IRK_GL8:
+		case INT_IRK_RIIA1:
+		case INT_IRK_RIIA3:
+		case INT_IRK_RIIA5:
+			break;
+
+		default:
+			return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+					"A solver context is only supported in combination with explicit and implicit Runge-Kutta integrators.");
+	}
+	if ( (ExportSensitivityType)sensitivityProp != FORWARD ||
+			(ImplicitIntegratorMode)intMode == LIFTED || (ImplicitIntegratorMode)intMode == LIFTED_FEEDBACK ||
+			(LinearAlgebraSolver)linSolver != GAUSS_LU )
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"A solver context is only supported in combination with forward sensitivities, unlifted integrators and the GAUSS_LU linear solver.");
+
+	int useOMP;
+	get( CG_USE_OPENMP,useOMP );
+	if ( (bool)useOMP == true )
+		return ACADOERRORTEXT(RET_INVALID_OPTION,
+				"A solver context can not be combined with OpenMP, independent solver instances shall be run in parallel instead.");
+
+	int useAC;
+	get( CG_USE_ARRIVAL_COST,useAC );
+	int covCalc;
+	get( CG_COMPUTE_COVARIANCE_MATRIX,covCalc );
+	if ( (bool)useAC == true || (bool)covCalc == true )
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"Arrival cost and covariance computation are not yet available with a solver context.");
+
+	int generateMexInterface;
+	get( GENERATE_MATLAB_INTERFACE,generateMexInterface );
+	int generateSimulinkInterface;
+	get( GENERATE_SIMULINK_INTERFACE,generateSimulinkInterface );
+	if ( (bool)generateMexInterface == true || (bool)generateSimulinkInterface == true )
+		return ACADOERRORTEXT(RET_NOT_IMPLEMENTED_YET,
+				"MATLAB and Simulink interfaces are not yet available with a solver context.");
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -732,6 +851,20 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 											const std::string& _intString,
 											int _precision
 											) const
+{
+	WorkspaceAllocator workspaceAllocator;
+
+	return exportAcadoHeader(_dirName, _fileName, workspaceAllocator, _realString, _intString, _precision);
+}
+
+
+returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
+											const std::string& _fileName,
+											WorkspaceAllocator& _workspaceAllocator,
+											const std::string& _realString,
+											const std::string& _intString,
+											int _precision
+											) const
 {
 	string moduleName, modulePrefix;
 	get(CG_MODULE_NAME, moduleName);
@@ -841,7 +974,9 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 
 	if (collectDataDeclarations(workspaceBlock, ACADO_WORKSPACE) != SUCCESSFUL_RETURN)
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
-	workspaceBlock.exportCode(workspace, _realString, _intString, _precision);
+	if (_workspaceAllocator.exportDataDeclaration(workspace, workspaceBlock, _realString, _intString, _precision)
+			!= SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	ExportStatementBlock functionsBlock;
 	stringstream functions;
@@ -850,8 +985,12 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 	functionsBlock.exportCode(functions, _realString);
 
+	int useSolverContext;
+	get(CG_USE_SOLVER_CONTEXT, useSolverContext);
+
 	ExportCommonHeader ech(fileName, "", _realString, _intString, _precision);
-	ech.configure( moduleName, modulePrefix, useSinglePrecision, useComplexArithmetic, (QPSolverName)qpSolver,
+	ech.configure( moduleName, modulePrefix, useSinglePrecision, useComplexArithmetic, (bool)useSolverContext,
+			ExportArithmeticStatement::multiplicationKernel, (QPSolverName)qpSolver,
 			options, variables.str(), workspace.str(), functions.str());
 
 	return ech.exportCode();
@@ -39,6 +39,7 @@ BEGIN_NAMESPACE_ACADO
 
 class IntegratorExport;
 class ExportNLPSolver;
+class WorkspaceAllocator;
 
 /** \brief A user class for auto-generation of OCP solvers.
  *
@@ -121,6 +122,15 @@ protected:
 	 */
 	returnValue checkConsistency() const;
 
+	/** Checks whether the chosen options allow all solver data to be kept in
+	 *	a solver context (see CG_USE_SOLVER_CONTEXT).
+	 *
+	 *	\return SUCCESSFUL_RETURN, \n
+	 *	        RET_NOT_IMPLEMENTED_YET, \n
+	 *	        RET_INVALID_OPTION
+	 */
+	returnValue checkSolverContextConsistency() const;
+
 	/** Collects all data declarations of the auto-generated sub-modules to given
 	 *	list of declarations.
 	 *
@@ -142,10 +152,28 @@ protected:
 	 */
 	returnValue collectFunctionDeclarations(ExportStatementBlock& declarations) const;
 
+	/** Exports main header file, with the workspace declared as it is.
+	 *
+	 *	@param[in] _dirName			Name of directory to be used to export file.
+	 *	@param[in] _fileName		Name of file to be exported.
+	 *	@param[in] _realString		std::string to be used to declare real variables.
+	 *	@param[in] _intString		std::string to be used to declare integer variables.
+	 *	@param[in] _precision		Number of digits to be used for exporting real values.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue exportAcadoHeader(	const std::string& _dirName,
+									const std::string& _fileName,
+									const std::string& _realString = "real_t",
+									const std::string& _intString = "int",
+									int _precision = 16
+									) const;
+
 	/** Exports main header file for using the exported MHE algorithm.
 	 *
 	 *	@param[in] _dirName			Name of directory to be used to export file.
 	 *	@param[in] _fileName		Name of file to be exported.
+	 *	@param[in] _workspaceAllocator	Allocator placing the workspace temporaries.
 	 *	@param[in] _realString		std::string to be used to declare real variables.
 	 *	@param[in] _intString		std::string to be used to declare integer variables.
 	 *	@param[in] _precision		Number of digits to be used for exporting real values.
@@ -154,6 +182,7 @@ protected:
 	 */
 	returnValue exportAcadoHeader(	const std::string& _dirName,
 									const std::string& _fileName,
+									WorkspaceAllocator& _workspaceAllocator,
 									const std::string& _realString = "real_t",
 									const std::string& _intString = "int",
 									int _precision = 16) const;
@@ -40,6 +40,7 @@
 #include <acado/code_generation/export_gauss_newton_qpdunes.hpp>
 #include <acado/code_generation/export_gauss_newton_hpmpc.hpp>
 #include <acado/code_generation/export_gauss_newton_generic.hpp>
+#include <acado/code_generation/export_gauss_newton_riccati.hpp>
 #include <acado/code_generation/export_exact_hessian_cn2.hpp>
 #include <acado/code_generation/export_exact_hessian_qpdunes.hpp>
 
@@ -112,6 +113,13 @@ ExportNLPSolver* createGaussNewtonGeneric(    UserInteraction* _userInteraction,
     return new ExportGaussNewtonGeneric(_userInteraction, _commonHeaderName);
 }
 
+ExportNLPSolver* createGaussNewtonRiccati(	UserInteraction* _userInteraction,
+											const std::string& _commonHeaderName
+											)
+{
+	return new ExportGaussNewtonRiccati(_userInteraction, _commonHeaderName);
+}
+
 ExportNLPSolver* createExactHessianCN2(	UserInteraction* _userInteraction,
 											const std::string& _commonHeaderName
 											)
@@ -137,6 +145,7 @@ RegisterNlpSolvers::RegisterNlpSolvers()
 	NLPSolverFactory::instance().registerAlgorithm(GAUSS_NEWTON_QPDUNES, createGaussNewtonQpDunes);
 	NLPSolverFactory::instance().registerAlgorithm(GAUSS_NEWTON_HPMPC, createGaussNewtonHpmpc);
     NLPSolverFactory::instance().registerAlgorithm(GAUSS_NEWTON_GENERIC, createGaussNewtonGeneric);
+	NLPSolverFactory::instance().registerAlgorithm(GAUSS_NEWTON_RICCATI, createGaussNewtonRiccati);
 	NLPSolverFactory::instance().registerAlgorithm(EXACT_HESSIAN_CN2, createExactHessianCN2);
 	NLPSolverFactory::instance().registerAlgorithm(EXACT_HESSIAN_QPDUNES, createExactHessianQpDunes);
 }
@@ -39,6 +39,7 @@
 #include <acado/code_generation/integrators/export_auxiliary_sim_functions.hpp>
 #include <acado/code_generation/export_algorithm_factory.hpp>
 #include <acado/code_generation/export_data_internal.hpp>
+#include <acado/code_generation/workspace_allocator.hpp>
 
 #ifdef WIN32
 #include <windows.h>
@@ -117,6 +118,17 @@ returnValue SIMexport::exportCode(	const std::string& dirName,
     ExportDataInternal::fcnPrefix = moduleName;
     ExportStatement::fcnPrefix = moduleName;
     ExportStatement::varPrefix = modulePrefix;
+    // Stand-alone integrators always work on global data
+    ExportDataInternal::contextName = "";
+    ExportStatement::contextName = "";
+
+	// Kernel for products of matrices; the vectorized ones support double precision only
+	int multiplicationKernel, useSinglePrecision;
+	get(CG_MULTIPLICATION_KERNEL, multiplicationKernel);
+	get(USE_SINGLE_PRECISION, useSinglePrecision);
+	if ((bool)useSinglePrecision == true && (ExportMultiplicationKernel)multiplicationKernel != MULTIPLICATION_LOOPS)
+		multiplicationKernel = MULTIPLICATION_BLOCKED;
+	ExportArithmeticStatement::multiplicationKernel = (ExportMultiplicationKernel)multiplicationKernel;
     
 	//
 	// Create the export folders
@@ -134,18 +146,32 @@ returnValue SIMexport::exportCode(	const std::string& dirName,
 	int printLevel;
 	get( PRINTLEVEL,printLevel );
 
+	std::string fileName( dirName );
+	fileName += "/" + moduleName + "_integrator.c";
+
+	ExportFile integratorFile( fileName,commonHeaderName,_realString,_intString,_precision );
+
+	// Temporaries of the workspace share memory according to their lifetimes in the code
+	int reuseWorkspaceMemory;
+	get( CG_REUSE_WORKSPACE_MEMORY,reuseWorkspaceMemory );
+
+	WorkspaceAllocator workspaceAllocator( (bool)useSinglePrecision == true ? 16 : 8 );
+
+	if( integrator != 0 )
+	{
+		integrator->getCode( integratorFile );
+
+		if ( (bool)reuseWorkspaceMemory == true &&
+				workspaceAllocator.addCode( integratorFile,_realString,_intString,_precision ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+	}
+
 	// export mandatory source code files
-	if ( exportAcadoHeader( dirName,commonHeaderName,_realString,_intString,_precision ) != SUCCESSFUL_RETURN )
+	if ( exportAcadoHeader( dirName,commonHeaderName,workspaceAllocator,_realString,_intString,_precision ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	if( integrator != 0 )
 	{
-		std::string fileName( dirName );
-		fileName += "/" + moduleName + "_integrator.c";
-
-		ExportFile integratorFile( fileName,commonHeaderName,_realString,_intString,_precision );
-		integrator->getCode( integratorFile );
-		
 		if ( integratorFile.exportCode( ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
@@ -806,6 +832,20 @@ returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
 											const std::string& _intString,
 											int _precision
 											) const
+{
+	WorkspaceAllocator workspaceAllocator;
+
+	return exportAcadoHeader(_dirName, _fileName, workspaceAllocator, _realString, _intString, _precision);
+}
+
+
+returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
+											const std::string& _fileName,
+											WorkspaceAllocator& _workspaceAllocator,
+											const std::string& _realString,
+											const std::string& _intString,
+											int _precision
+											) const
 {
 	string moduleName, modulePrefix;
 	get(CG_MODULE_NAME, moduleName);
@@ -857,7 +897,9 @@ returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
 
 	if (collectDataDeclarations(workspaceBlock, ACADO_WORKSPACE) != SUCCESSFUL_RETURN)
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
-	workspaceBlock.exportCode(workspace, _realString, _intString, _precision);
+	if (_workspaceAllocator.exportDataDeclaration(workspace, workspaceBlock, _realString, _intString, _precision)
+			!= SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	ExportStatementBlock functionsBlock;
 	stringstream functions;
@@ -867,7 +909,8 @@ returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
 	functionsBlock.exportCode(functions, _realString);
 
 	ExportCommonHeader ech(fileName, "", _realString, _intString, _precision);
-	ech.configure( moduleName, modulePrefix, useSinglePrecision, false, (QPSolverName)qpSolver,
+	ech.configure( moduleName, modulePrefix, useSinglePrecision, false, false,
+			ExportArithmeticStatement::multiplicationKernel, (QPSolverName)qpSolver,
 			options, variables.str(), workspace.str(), functions.str());
 
 	return ech.exportCode();
@@ -41,6 +41,7 @@
 BEGIN_NAMESPACE_ACADO
 
 class IntegratorExport;
+class WorkspaceAllocator;
 
 /** 
  *	\brief User-interface to automatically generate simulation algorithms for fast optimal control.
@@ -107,10 +108,28 @@ class SIMexport : public ExportModule, public ModelContainer
 										);
 
 
+		/** Exports main header file, with the workspace declared as it is.
+		 *
+		 *	@param[in] _dirName			Name of directory to be used to export file.
+		 *	@param[in] _fileName		Name of file to be exported.
+		 *	@param[in] _realString		std::string to be used to declare real variables.
+		 *	@param[in] _intString		std::string to be used to declare integer variables.
+		 *	@param[in] _precision		Number of digits to be used for exporting real values.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportAcadoHeader(	const std::string& _dirName,
+										const std::string& _fileName,
+										const std::string& _realString = "real_t",
+										const std::string& _intString = "int",
+										int _precision = 16
+										) const;
+
 		/** Exports main header file for using the exported algorithm.
 		 *
 		 *	@param[in] _dirName			Name of directory to be used to export file.
 		 *	@param[in] _fileName		Name of file to be exported.
+		 *	@param[in] _workspaceAllocator	Allocator placing the workspace temporaries.
 		 *	@param[in] _realString		std::string to be used to declare real variables.
 		 *	@param[in] _intString		std::string to be used to declare integer variables.
 		 *	@param[in] _precision		Number of digits to be used for exporting real values.
@@ -119,6 +138,7 @@ class SIMexport : public ExportModule, public ModelContainer
 		 */
 		returnValue exportAcadoHeader(	const std::string& _dirName,
 										const std::string& _fileName,
+										WorkspaceAllocator& _workspaceAllocator,
 										const std::string& _realString = "real_t",
 										const std::string& _intString = "int",
 										int _precision = 16
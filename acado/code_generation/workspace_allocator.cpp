@@ -0,0 +1,413 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file src/code_generation/workspace_allocator.cpp
+ *    \date 2014
+ */
+
+#include <acado/code_generation/workspace_allocator.hpp>
+#include <acado/code_generation/export_function.hpp>
+#include <acado/code_generation/export_data_declaration.hpp>
+#include <acado/code_generation/export_argument_internal.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+static bool isIdentifierChar( char c )
+{
+	return isalnum( (unsigned char)c ) || c == '_';
+}
+
+WorkspaceAllocator::WorkspaceAllocator(	uint _cacheLineLength
+										)
+	: cacheLineLength( _cacheLineLength ), arenaSize( 0 )
+{}
+
+returnValue WorkspaceAllocator::addCode(	const ExportStatementBlock& _code,
+											const std::string& _realString,
+											const std::string& _intString,
+											int _precision
+											)
+{
+	const ExportStatement::StatementPtrArray& statements = _code.getStatements();
+
+	for (unsigned i = 0; i < statements.size(); ++i)
+	{
+		const ExportFunction* f = dynamic_cast< const ExportFunction* >( statements[ i ].get() );
+
+		if (f == 0 || f->isDefined() == false)
+			continue;
+
+		// Exporting the whole function first sets up the memory allocators of its statements
+		stringstream ss;
+		if (f->exportCode(ss, _realString, _intString, _precision) != SUCCESSFUL_RETURN)
+			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+		vector< string >& body = code[ f->getName() ];
+		body.clear();
+
+		// Functions of symbolic expressions do not consist of statements
+		if (f->getNumStatements() == 0)
+		{
+			body.push_back( ss.str() );
+			continue;
+		}
+
+		const ExportStatement::StatementPtrArray& fStatements = f->getStatements();
+		for (unsigned j = 0; j < fStatements.size(); ++j)
+		{
+			stringstream s;
+			if (fStatements[ j ]->exportCode(s, _realString, _intString, _precision) != SUCCESSFUL_RETURN)
+				return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+			// Strings streamed into a function are added piecewise, so pieces are joined up to a line end
+			if (body.empty() == false && body.back().empty() == false && *body.back().rbegin() != '\n')
+				body.back() += s.str();
+			else
+				body.push_back( s.str() );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue WorkspaceAllocator::exportDataDeclaration(	std::ostream& stream,
+														const ExportStatementBlock& _declarations,
+														const std::string& _realString,
+														const std::string& _intString,
+														int _precision
+														)
+{
+	temporaries.clear();
+	arenaSize = 0;
+
+	if (code.empty() == true)
+		return _declarations.exportCode(stream, _realString, _intString, _precision);
+
+	//
+	// Collect the temporaries; they are restricted to real values, so that their
+	// offsets and sizes can be expressed in real values
+	//
+	const ExportStatement::StatementPtrArray& statements = _declarations.getStatements();
+	vector< bool > isTemporary(statements.size(), false);
+
+	for (unsigned i = 0; i < statements.size(); ++i)
+	{
+		const ExportDataDeclaration* decl = dynamic_cast< const ExportDataDeclaration* >( statements[ i ].get() );
+		if (decl == 0 || decl->getData().isTemporary() == false)
+			continue;
+
+		const ExportArgumentInternal* arg =
+				dynamic_cast< const ExportArgumentInternal* >( decl->getData().get() );
+		if (arg == 0 || arg->getType() != REAL || arg->isGiven() == true || arg->getDim() == 0)
+			continue;
+
+		Temporary tmp;
+		tmp.name = arg->getName();
+		tmp.fullName = arg->getFullName();
+		tmp.dim = arg->getDim();
+		tmp.offset = 0;
+
+		stringstream ss;
+		arg->exportDataDeclaration(ss, _realString, _intString, _precision);
+		tmp.declaration = ss.str();
+
+		temporaries.push_back( tmp );
+		isTemporary[ i ] = true;
+	}
+
+	if (temporaries.empty() == true)
+		return _declarations.exportCode(stream, _realString, _intString, _precision);
+
+	if (parseFunctions() != SUCCESSFUL_RETURN || allocate() != SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+	//
+	// The arena goes first, all other declarations follow in their original order
+	//
+	stream	<< "/** Arena of " << arenaSize << " values shared by temporaries with disjoint lifetimes, "
+			<< "which need " << getTemporariesSize() << " values otherwise. */\n";
+	stream << "union\n{\n";
+	for (unsigned i = 0; i < temporaries.size(); ++i)
+	{
+		stream << "struct\n{\n";
+		if (temporaries[ i ].offset > 0)
+			stream << _realString << " pad_" << temporaries[ i ].name << "[ " << temporaries[ i ].offset << " ];\n";
+		stream << temporaries[ i ].declaration;
+		stream << "};\n";
+	}
+	stream << "};\n\n";
+
+	for (unsigned i = 0; i < statements.size(); ++i)
+	{
+		if (isTemporary[ i ] == true)
+			continue;
+
+		if (statements[ i ]->exportCode(stream, _realString, _intString, _precision) != SUCCESSFUL_RETURN)
+			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+uint WorkspaceAllocator::getTemporariesSize( ) const
+{
+	uint size = 0;
+	for (unsigned i = 0; i < temporaries.size(); ++i)
+		size += temporaries[ i ].dim;
+
+	return size;
+}
+
+uint WorkspaceAllocator::getArenaSize( ) const
+{
+	return arenaSize;
+}
+
+returnValue WorkspaceAllocator::parseFunctions( )
+{
+	functions.clear();
+	uses.clear();
+
+	map< string, vector< string > >::const_iterator it;
+	for (it = code.begin(); it != code.end(); ++it)
+	{
+		StatementArray& body = functions[ it->first ];
+
+		for (unsigned i = 0; i < it->second.size(); ++i)
+		{
+			const string& text = it->second[ i ];
+			Statement st;
+
+			// References to temporaries, by their full names
+			for (unsigned t = 0; t < temporaries.size(); ++t)
+			{
+				const string& name = temporaries[ t ].fullName;
+
+				for (size_t pos = text.find( name ); pos != string::npos; pos = text.find(name, pos + 1))
+				{
+					size_t end = pos + name.size();
+
+					if ((pos > 0 && isIdentifierChar( text[pos - 1] ) == true) ||
+						(end < text.size() && isIdentifierChar( text[ end ] ) == true))
+						continue;
+
+					st.temporaries.insert( t );
+					break;
+				}
+			}
+
+			// Calls of exported functions
+			for (size_t pos = 0; pos < text.size(); )
+			{
+				if (isIdentifierChar( text[ pos ] ) == false || isdigit( (unsigned char)text[ pos ] ))
+				{
+					++pos;
+					continue;
+				}
+
+				size_t end = pos;
+				while (end < text.size() && isIdentifierChar( text[ end ] ) == true)
+					++end;
+
+				size_t next = end;
+				while (next < text.size() && isspace( (unsigned char)text[ next ] ))
+					++next;
+
+				string identifier = text.substr(pos, end - pos);
+				if (next < text.size() && text[ next ] == '(' && code.find( identifier ) != code.end())
+					st.callees.push_back( identifier );
+
+				pos = end;
+			}
+
+			// A statement on its own consists of a call only
+			size_t first = text.find_first_not_of( " \t\n" );
+			size_t last = text.find_last_not_of( " \t\n" );
+			st.isCall =
+					st.callees.size() == 1 && first != string::npos &&
+					text.compare(first, st.callees[ 0 ].size(), st.callees[ 0 ]) == 0 &&
+					text[ last ] == ';' && text.find( ';' ) == last && text.find( '{' ) == string::npos;
+
+			body.push_back( st );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+const std::set< uint >& WorkspaceAllocator::getUses(	const std::string& _function
+														)
+{
+	map< string, set< uint > >::const_iterator found = uses.find( _function );
+	if (found != uses.end())
+		return found->second;
+
+	// All temporaries used by the functions reachable in the call graph
+	set< uint > result;
+	set< string > visited;
+	vector< string > open( 1, _function );
+
+	while (open.empty() == false)
+	{
+		string name = open.back();
+		open.pop_back();
+
+		if (visited.insert( name ).second == false)
+			continue;
+
+		const StatementArray& body = functions[ name ];
+		for (unsigned i = 0; i < body.size(); ++i)
+		{
+			result.insert(body[ i ].temporaries.begin(), body[ i ].temporaries.end());
+			open.insert(open.end(), body[ i ].callees.begin(), body[ i ].callees.end());
+		}
+	}
+
+	return uses[ _function ] = result;
+}
+
+void WorkspaceAllocator::expand(	const std::string& _function,
+									const std::set< uint >& _live,
+									std::vector< std::string >& _stack,
+									std::vector< std::set< uint > >& _trace
+									)
+{
+	_stack.push_back( _function );
+
+	const StatementArray& body = functions[ _function ];
+	for (unsigned i = 0; i < body.size(); ++i)
+	{
+		const Statement& st = body[ i ];
+
+		set< uint > step( _live );
+		step.insert(st.temporaries.begin(), st.temporaries.end());
+
+		// Temporaries passed as arguments stay live during the whole call
+		if (st.isCall == true &&
+			find(_stack.begin(), _stack.end(), st.callees[ 0 ]) == _stack.end() &&
+			functions[ st.callees[ 0 ] ].empty() == false)
+		{
+			expand(st.callees[ 0 ], step, _stack, _trace);
+			continue;
+		}
+
+		for (unsigned j = 0; j < st.callees.size(); ++j)
+		{
+			const set< uint >& calleeUses = getUses( st.callees[ j ] );
+			step.insert(calleeUses.begin(), calleeUses.end());
+		}
+
+		_trace.push_back( step );
+	}
+
+	_stack.pop_back();
+}
+
+returnValue WorkspaceAllocator::allocate( )
+{
+	conflicts.clear();
+
+	//
+	// Lifetimes, with every function being a possible entry point of the user code
+	//
+	map< string, StatementArray >::const_iterator it;
+	for (it = functions.begin(); it != functions.end(); ++it)
+	{
+		vector< set< uint > > trace;
+		vector< string > stack;
+		expand(it->first, set< uint >(), stack, trace);
+
+		vector< int > first(temporaries.size(), -1);
+		vector< int > last(temporaries.size(), -1);
+
+		for (unsigned i = 0; i < trace.size(); ++i)
+			for (set< uint >::const_iterator t = trace[ i ].begin(); t != trace[ i ].end(); ++t)
+			{
+				if (first[ *t ] < 0)
+					first[ *t ] = i;
+				last[ *t ] = i;
+			}
+
+		for (unsigned t1 = 0; t1 < temporaries.size(); ++t1)
+			for (unsigned t2 = t1 + 1; t2 < temporaries.size(); ++t2)
+				if (first[ t1 ] >= 0 && first[ t2 ] >= 0 &&
+					first[ t1 ] <= last[ t2 ] && first[ t2 ] <= last[ t1 ])
+					conflicts.insert( make_pair(t1, t2) );
+	}
+
+	//
+	// First fit, largest temporaries first
+	//
+	vector< uint > order;
+	for (unsigned i = 0; i < temporaries.size(); ++i)
+		order.push_back( i );
+
+	for (unsigned i = 1; i < order.size(); ++i)
+		for (unsigned j = i; j > 0 && temporaries[ order[j - 1] ].dim < temporaries[ order[ j ] ].dim; --j)
+			swap(order[j - 1], order[ j ]);
+
+	arenaSize = 0;
+	vector< uint > placed;
+	for (unsigned i = 0; i < order.size(); ++i)
+	{
+		Temporary& tmp = temporaries[ order[ i ] ];
+		uint offset = 0;
+
+		bool moved = true;
+		while (moved == true)
+		{
+			moved = false;
+
+			for (unsigned j = 0; j < placed.size(); ++j)
+			{
+				const Temporary& other = temporaries[ placed[ j ] ];
+
+				if (conflicts.count( make_pair(min(order[ i ], placed[ j ]), max(order[ i ], placed[ j ])) ) == 0)
+					continue;
+
+				if (offset < other.offset + other.dim && other.offset < offset + tmp.dim)
+				{
+					offset = (other.offset + other.dim + cacheLineLength - 1) / cacheLineLength * cacheLineLength;
+					moved = true;
+				}
+			}
+		}
+
+		tmp.offset = offset;
+		placed.push_back( order[ i ] );
+
+		arenaSize = max(arenaSize, offset + tmp.dim);
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+CLOSE_NAMESPACE_ACADO
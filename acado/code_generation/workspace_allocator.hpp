@@ -0,0 +1,169 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file include/acado/code_generation/workspace_allocator.hpp
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_WORKSPACE_ALLOCATOR_HPP
+#define ACADO_TOOLKIT_WORKSPACE_ALLOCATOR_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/code_generation/export_statement_block.hpp>
+
+#include <map>
+#include <set>
+#include <vector>
+
+BEGIN_NAMESPACE_ACADO
+
+/**
+ *	\brief Shares the memory of temporaries of the exported workspace.
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *	The class WorkspaceAllocator performs a liveness analysis of the temporaries
+ *	of a data struct (see ExportData::setTemporary) over the exported functions.
+ *	Temporaries whose lifetimes do not overlap share the memory of an arena,
+ *	which is declared as a union at the beginning of the data struct. Offsets
+ *	within the arena are multiples of the cache line length.
+ *
+ *	A temporary is assumed to be dead whenever an exported function is entered
+ *	or left by the user code. Within a function, it is live from the first to the
+ *	last top-level statement which uses it, either directly or through called
+ *	functions. Statements consisting of a single function call are expanded into
+ *	the statements of the called function.
+ */
+class WorkspaceAllocator
+{
+public:
+	/** Default constructor.
+	 *
+	 *	@param[in] _cacheLineLength		Length of a cache line, in real values.
+	 */
+	WorkspaceAllocator(	uint _cacheLineLength = 8
+						);
+
+	~WorkspaceAllocator()
+	{}
+
+	/** Adds all functions of a block of exported code to the analysis.
+	 *
+	 *	@param[in] _code			Block of code containing the functions.
+	 *	@param[in] _realString		std::string to be used to declare real variables.
+	 *	@param[in] _intString		std::string to be used to declare integer variables.
+	 *	@param[in] _precision		Number of digits to be used for exporting real values.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue addCode(	const ExportStatementBlock& _code,
+							const std::string& _realString = "real_t",
+							const std::string& _intString = "int",
+							int _precision = 16
+							);
+
+	/** Exports the declarations of a data struct, with temporaries placed in the
+	 *  arena. In case no code was added, the declarations are exported unchanged.
+	 *
+	 *	@param[in] stream			Stream to be used for exporting.
+	 *	@param[in] _declarations	Block of data declarations.
+	 *	@param[in] _realString		std::string to be used to declare real variables.
+	 *	@param[in] _intString		std::string to be used to declare integer variables.
+	 *	@param[in] _precision		Number of digits to be used for exporting real values.
+	 *
+	 *	\return SUCCESSFUL_RETURN
+	 */
+	returnValue exportDataDeclaration(	std::ostream& stream,
+										const ExportStatementBlock& _declarations,
+										const std::string& _realString = "real_t",
+										const std::string& _intString = "int",
+										int _precision = 16
+										);
+
+	/** Returns the number of real values of all temporaries. */
+	uint getTemporariesSize( ) const;
+
+	/** Returns the number of real values of the arena. */
+	uint getArenaSize( ) const;
+
+private:
+	/** Temporary of the data struct. */
+	struct Temporary
+	{
+		std::string name;
+		std::string fullName;
+		std::string declaration;
+		uint dim;
+		uint offset;
+	};
+
+	/** Top-level statement of an exported function. */
+	struct Statement
+	{
+		/** Temporaries used directly. */
+		std::set< uint > temporaries;
+		/** Called functions. */
+		std::vector< std::string > callees;
+		/** Flag indicating whether the statement consists of a single call. */
+		bool isCall;
+	};
+
+	typedef std::vector< Statement > StatementArray;
+
+	/** Parses the code of all functions. */
+	returnValue parseFunctions( );
+
+	/** Returns the temporaries used by a function, including the called ones. */
+	const std::set< uint >& getUses(	const std::string& _function
+										);
+
+	/** Appends the temporaries used by each step of a function to a trace. */
+	void expand(	const std::string& _function,
+					const std::set< uint >& _live,
+					std::vector< std::string >& _stack,
+					std::vector< std::set< uint > >& _trace
+					);
+
+	/** Assigns the offsets of the temporaries within the arena. */
+	returnValue allocate( );
+
+	uint cacheLineLength;
+	uint arenaSize;
+
+	std::vector< Temporary > temporaries;
+
+	/** Code of the top-level statements of all functions. */
+	std::map< std::string, std::vector< std::string > > code;
+	std::map< std::string, StatementArray > functions;
+	std::map< std::string, std::set< uint > > uses;
+
+	/** Pairs of temporaries whose lifetimes overlap. */
+	std::set< std::pair< uint, uint > > conflicts;
+};
+
+CLOSE_NAMESPACE_ACADO
+
+#endif // ACADO_TOOLKIT_WORKSPACE_ALLOCATOR_HPP
@@ -101,6 +101,8 @@ void DenseCP::copy( const DenseCP& rhs ){
     lbA = rhs.lbA;
     ubA = rhs.ubA;
 
+    ABlocks = rhs.ABlocks;
+
 
     if( rhs.B != 0 ){
         B = (DMatrix**)calloc(nS,sizeof(DMatrix*));
@@ -197,6 +199,26 @@ returnValue DenseCP::init( uint nV_, uint nC_ ){
     H.init(nV_,nV_);
     A.init(nC_,nV_);
 
+    return clearBlockPattern();
+}
+
+
+returnValue DenseCP::addConstraintBlock( uint rowOffset, uint colOffset, uint nRows, uint nCols ){
+
+    ASSERT( rowOffset+nRows <= getNC() );
+    ASSERT( colOffset+nCols <= getNV() );
+
+    MatrixBlock block = { rowOffset, colOffset, nRows, nCols };
+    ABlocks.push_back( block );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue DenseCP::clearBlockPattern( ){
+
+    ABlocks.clear();
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -77,6 +77,23 @@ class DenseCP{
         returnValue init( uint nV_, uint nC_ );
 
 
+        /** Declares the (nRows x nCols)-block of the constraint matrix at   \n
+         *  the given offsets as possibly non-zero. As soon as a block has    \n
+         *  been declared, all entries of A outside of the declared blocks    \n
+         *  are known to be zero, which sparse QP solvers may exploit. The    \n
+         *  blocks must not overlap.                                          \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         */
+        returnValue addConstraintBlock( uint rowOffset, uint colOffset, uint nRows, uint nCols );
+
+
+        /** Forgets all declared blocks, i.e. A may be dense again.          \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         */
+        returnValue clearBlockPattern( );
+
 
 //         returnValue setBounds( const DVector &lb,
 //                                const DVector &ub  );
@@ -393,6 +410,21 @@ class DenseCP{
     DVector     *ubB;    /**< SDP upper bounds               */
 
 
+    // OPTIONAL BLOCK SPARSITY PATTERN OF A:
+    // -------------------------------------------------------
+
+    /** Block of a matrix which may contain non-zero entries. */
+    struct MatrixBlock{
+
+        uint rowOffset;    /**< First row of the block        */
+        uint colOffset;    /**< First column of the block     */
+        uint nRows;        /**< Number of rows of the block   */
+        uint nCols;        /**< Number of columns of the block */
+    };
+
+    std::vector< MatrixBlock > ABlocks;    /**< Non-zero blocks of A (empty if unknown) */
+
+
     // SOLUTION OF THE DENSE CP:
     // -------------------------------------------------------
     DVector       *x;    /**< Primal Solution                */
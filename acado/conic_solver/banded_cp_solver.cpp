@@ -134,6 +134,7 @@ returnValue BandedCPsolver::setupOptions( )
 	addOption( HESSIAN_PROJECTION_FACTOR   , defaultHessianProjectionFactor  );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation   );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling     );
+	addOption( QP_SOLVER                   , defaultQPsolver                 );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations       );
 
 	return SUCCESSFUL_RETURN;
@@ -0,0 +1,1509 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/conic_solver/block_condensing_based_cp_solver.cpp
+ *    \date 2014
+ */
+
+#include <acado/conic_solver/block_condensing_based_cp_solver.hpp>
+
+using namespace Eigen;
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Tolerances of the interior-point method on the KKT residuals (relative to the size \n
+ *  of the QP data) and on the duality measure. Weakly active rows keep slacks of     \n
+ *  about the square root of the duality measure, hence its small tolerance.          \n
+ */
+static const double blockQPresidualTolerance = 1.0e-8;
+static const double blockQPmuTolerance       = 1.0e-14;
+
+/** Fraction of the step to the boundary taken by the interior-point method. */
+static const double blockQPstepFraction      = 0.995;
+
+/** Regularisation of the multipliers of equality rows, which have no slacks. */
+static const double blockQPequalityRegularisation = 1.0e-8;
+
+
+/** Returns the largest absolute entry of a (possibly empty) vector. */
+static double getMaxAbs( const DVector& v )
+{
+	if ( v.getDim( ) == 0 )
+		return 0.0;
+
+	return v.lpNorm< Infinity >( );
+}
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+BlockCondensingBasedCPsolver::BlockCondensingBasedCPsolver( ) : CondensingBasedCPsolver( )
+{
+	blockSize = 0;
+	fixedBlockSize = 0;
+	barrierParameter = 0.0;
+	useBlockCondensing = BT_FALSE;
+	isFullCondensingReady = BT_FALSE;
+	nIneq = 0;
+}
+
+
+BlockCondensingBasedCPsolver::BlockCondensingBasedCPsolver(	UserInteraction* _userInteraction,
+																uint nConstraints_,
+																const DVector& blockDims_,
+																int fixedBlockSize_
+																) : CondensingBasedCPsolver( _userInteraction,nConstraints_,blockDims_ )
+{
+	blockSize = 0;
+	fixedBlockSize = fixedBlockSize_;
+	barrierParameter = 0.0;
+	useBlockCondensing = BT_FALSE;
+	isFullCondensingReady = BT_FALSE;
+	nIneq = 0;
+}
+
+
+BlockCondensingBasedCPsolver::BlockCondensingBasedCPsolver( const BlockCondensingBasedCPsolver& rhs )
+							:CondensingBasedCPsolver( rhs )
+{
+	blockSize = rhs.blockSize;
+	fixedBlockSize = rhs.fixedBlockSize;
+	barrierParameter = rhs.barrierParameter;
+	useBlockCondensing = rhs.useBlockCondensing;
+	isFullCondensingReady = rhs.isFullCondensingReady;
+
+	blocks = rhs.blocks;
+	nodeBlock = rhs.nodeBlock;
+	nodeMap = rhs.nodeMap;
+	nodeOffset = rhs.nodeOffset;
+	constraintNodes = rhs.constraintNodes;
+
+	nIneq = rhs.nIneq;
+	denseDual = rhs.denseDual;
+}
+
+
+BlockCondensingBasedCPsolver::~BlockCondensingBasedCPsolver( )
+{
+}
+
+
+BlockCondensingBasedCPsolver& BlockCondensingBasedCPsolver::operator=( const BlockCondensingBasedCPsolver& rhs )
+{
+	if ( this != &rhs )
+	{
+		CondensingBasedCPsolver::operator=( rhs );
+
+		blockSize = rhs.blockSize;
+		fixedBlockSize = rhs.fixedBlockSize;
+		barrierParameter = rhs.barrierParameter;
+		useBlockCondensing = rhs.useBlockCondensing;
+		isFullCondensingReady = rhs.isFullCondensingReady;
+
+		blocks = rhs.blocks;
+		nodeBlock = rhs.nodeBlock;
+		nodeMap = rhs.nodeMap;
+		nodeOffset = rhs.nodeOffset;
+		constraintNodes = rhs.constraintNodes;
+
+		nIneq = rhs.nIneq;
+		denseDual = rhs.denseDual;
+	}
+	return *this;
+}
+
+
+BandedCPsolver* BlockCondensingBasedCPsolver::clone() const
+{
+	return new BlockCondensingBasedCPsolver(*this);
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::init(	const OCPiterate &iter_
+												)
+{
+	iter = iter_;
+
+	if ( fixedBlockSize > 0 )
+		blockSize = fixedBlockSize;
+	else
+		get( CONDENSING_BLOCK_SIZE,blockSize );
+
+	uint N = getNumPoints( );
+
+	useBlockCondensing    = BT_FALSE;
+	isFullCondensingReady = BT_FALSE;
+
+	if ( blockSize > 0 )
+	{
+		if ( ( N >= 2 ) && ( getNX( ) > 0 ) && ( getNU( ) > 0 ) &&
+			 ( getNXA( ) == 0 ) && ( getNP( ) == 0 ) && ( getNW( ) == 0 ) )
+			useBlockCondensing = BT_TRUE;
+		else
+			ACADOWARNINGTEXT( RET_NOT_YET_IMPLEMENTED,
+					"Block condensing supports differential states and controls only, using full condensing instead." );
+	}
+
+	if ( useBlockCondensing == BT_FALSE )
+		return initializeFullCondensing( );
+
+
+	// DIVIDE THE SHOOTING INTERVALS INTO BLOCKS:
+	// -----------------------------------------
+	uint run1;
+	uint nBlocks = ( N - 1 + blockSize - 1 ) / blockSize;
+
+	blocks.clear( );
+	blocks.resize( nBlocks );
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		blocks[run1].firstNode  = run1*blockSize;
+		blocks[run1].nIntervals = (uint)acadoMin( blockSize,(int)( N - 1 - run1*blockSize ) );
+		blocks[run1].nV         = getNX( ) + blocks[run1].nIntervals*getNU( );
+	}
+
+	nodeBlock.resize( N );
+	for( run1 = 0; run1 < N; run1++ )
+		nodeBlock[run1] = (uint)acadoMin( (int)( run1/blockSize ),(int)nBlocks-1 );
+
+	nodeMap.clear( );
+	nodeMap.resize( N );
+	nodeOffset.clear( );
+	nodeOffset.resize( N );
+	constraintNodes.clear( );
+
+	condensingStatus = COS_INITIALIZED;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::prepareSolve(	BandedCP& cp
+														)
+{
+	if ( checkBlockStructure( cp ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_UNABLE_TO_CONDENSE );
+
+	if ( useBlockCondensing == BT_FALSE )
+		return CondensingBasedCPsolver::prepareSolve( cp );
+
+	return condenseBlocks( cp );
+}
+
+
+returnValue BlockCondensingBasedCPsolver::solve(	BandedCP& cp
+												)
+{
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+	{
+		if ( checkBlockStructure( cp ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+	if ( useBlockCondensing == BT_FALSE )
+		return CondensingBasedCPsolver::solve( cp );
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+	{
+		returnValue returnvalue = condenseBlocks( cp );
+		if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR( returnvalue );
+	}
+
+	// ADD THE BOUNDS INCLUDING THE FEEDBACK DATA (IF SPECIFIED):
+	// ----------------------------------------------------------
+	if ( setupBlockBounds( cp ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+
+
+    // SOLVE THE BLOCK CONDENSED QP:
+    // -----------------------------
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "--> Solving block condensed QP ...\n";
+
+	RealClock clock;
+	clock.start( );
+
+	returnValue returnvalue = solveBlockQP( );
+
+	clock.stop( );
+	setLast( LOG_TIME_QP,clock.getTime() );
+	setLast( LOG_TIME_RELAXED_QP,0.0 );
+	setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+
+	switch( returnvalue )
+	{
+		case SUCCESSFUL_RETURN:
+			break;
+
+		case RET_QP_SOLUTION_REACHED_LIMIT:
+			ACADOWARNING( RET_QP_SOLUTION_REACHED_LIMIT );
+			break;
+
+		default:
+			return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "<-- Solving block condensed QP done.\n";
+
+
+    // EXPAND THE KKT-SYSTEM IF NECCESSARY:
+    // ------------------------------------
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+		return finalizeSolve( cp );
+	else
+		return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::finalizeSolve(	BandedCP& cp
+														)
+{
+	if ( useBlockCondensing == BT_FALSE )
+		return CondensingBasedCPsolver::finalizeSolve( cp );
+
+	RealClock clock;
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "--> Expanding block condensed QP solution ...\n";
+
+	clock.reset( );
+	clock.start( );
+
+	returnValue returnvalue = expandBlocks( cp );
+	if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR( returnvalue );
+
+	clock.stop( );
+	setLast( LOG_TIME_EXPAND,clock.getTime() );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "<-- Expanding block condensed QP solution done.\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::getParameters( DVector &p_  ) const
+{
+	if ( useBlockCondensing == BT_FALSE )
+		return CondensingBasedCPsolver::getParameters( p_ );
+
+	if ( p_.getDim( ) != getNP( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::getFirstControl( DVector &u0_ ) const
+{
+	if ( useBlockCondensing == BT_FALSE )
+		return CondensingBasedCPsolver::getFirstControl( u0_ );
+
+	if ( u0_.getDim( ) != getNU( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( blocks[0].z.getDim( ) != blocks[0].nV )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	u0_ = blocks[0].z.segment( getNX( ),getNU( ) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::setBarrierParameter(	double barrierParameter_
+																	)
+{
+	barrierParameter = acadoMax( barrierParameter_,0.0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::getVarianceCovariance( DMatrix &var )
+{
+	if ( useBlockCondensing == BT_FALSE )
+		return CondensingBasedCPsolver::getVarianceCovariance( var );
+
+	return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue BlockCondensingBasedCPsolver::checkBlockStructure(	BandedCP& cp
+																)
+{
+	if ( ( useBlockCondensing == BT_FALSE ) || ( condensingStatus == COS_FROZEN ) )
+		return SUCCESSFUL_RETURN;
+
+	if ( hasBlockStructure( cp ) == BT_TRUE )
+		return SUCCESSFUL_RETURN;
+
+	ACADOWARNINGTEXT( RET_NOT_YET_IMPLEMENTED,
+			"Hessian or constraints couple different condensing blocks, using full condensing instead." );
+
+	useBlockCondensing = BT_FALSE;
+
+	return initializeFullCondensing( );
+}
+
+
+BooleanType BlockCondensingBasedCPsolver::hasBlockStructure(	BandedCP& cp
+																)
+{
+	uint run1, run2;
+	uint N = getNumPoints( );
+
+	DMatrix tmp;
+
+	// HESSIAN:
+	// --------
+	for( run1 = 0; run1 < N; run1++ )
+		for( run2 = 0; run2 < N; run2++ )
+			if ( ( nodeBlock[run1] != nodeBlock[run2] ) &&
+				 ( getNodeBlock( cp.hessian,run1,run2,tmp ) == BT_TRUE ) )
+				return BT_FALSE;
+
+	// CONSTRAINTS:
+	// ------------
+	constraintNodes.clear( );
+	constraintNodes.resize( cp.constraintGradient.getNumRows( ) );
+
+	for( run1 = 0; run1 < cp.constraintGradient.getNumRows( ); run1++ )
+		for( run2 = 0; run2 < N; run2++ )
+			if ( getNodeConstraint( cp.constraintGradient,run1,run2,tmp ) == BT_TRUE )
+			{
+				if ( ( constraintNodes[run1].empty( ) == false ) &&
+					 ( nodeBlock[ constraintNodes[run1][0] ] != nodeBlock[run2] ) )
+					return BT_FALSE;
+
+				constraintNodes[run1].push_back( run2 );
+			}
+
+	return BT_TRUE;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::initializeFullCondensing( )
+{
+	if ( isFullCondensingReady == BT_TRUE )
+		return SUCCESSFUL_RETURN;
+
+	if ( initializeCondensingOperator( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_BANDED_CP_INIT_FAILED );
+
+	int infeasibleQPhandling;
+	get( INFEASIBLE_QP_HANDLING,infeasibleQPhandling );
+
+	if ( initializeCPsolver( (InfeasibleQPhandling)infeasibleQPhandling ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_BANDED_CP_INIT_FAILED );
+
+	isFullCondensingReady = BT_TRUE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::condenseBlocks(	BandedCP& cp
+															)
+{
+	if ( ( condensingStatus != COS_INITIALIZED ) && ( condensingStatus != COS_FROZEN ) )
+		return ACADOERROR( RET_UNABLE_TO_CONDENSE );
+
+	RealClock clock;
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "--> Block condensing banded QP ...\n";
+
+	clock.reset( );
+	clock.start( );
+
+	uint run1, run2, run3;
+
+	uint nX = getNX( );
+	uint nU = getNU( );
+	uint N  = getNumPoints( );
+	uint nBlocks = getNumBlocks( );
+
+	BooleanType isFrozen = BT_FALSE;
+	if ( condensingStatus == COS_FROZEN )
+		isFrozen = BT_TRUE;
+
+	DMatrix Gx, Gu, tmp, lbTmp, ubTmp;
+
+
+	// CONDENSE THE DYNAMICS AND THE OBJECTIVE WITHIN EACH BLOCK:
+	// ----------------------------------------------------------
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+
+		uint nV     = blk.nV;
+		uint nNodes = blk.nIntervals;
+		if ( run1 == nBlocks-1 )
+			nNodes++;
+
+		// x_i = X z + x, with z = ( x_first, u_first, ..., u_last ):
+		DMatrix X( nX,nV );
+		DVector x( nX );
+		X.block( 0,0,nX,nX ).setIdentity( );
+
+		for( run2 = 0; run2 <= blk.nIntervals; run2++ )
+		{
+			uint node = blk.firstNode + run2;
+
+			if ( run2 > 0 )
+			{
+				cp.dynGradient.getSubBlock( node-1,0,Gx,nX,nX );
+				cp.dynResiduum.getSubBlock( node-1,0,tmp,nX,1 );
+
+				if ( isFrozen == BT_FALSE )
+				{
+					cp.dynGradient.getSubBlock( node-1,3,Gu,nX,nU );
+					X = Gx*X;
+					X.block( 0,nX+(run2-1)*nU,nX,nU ) += Gu;
+				}
+				x = Gx*x + tmp.col( 0 );
+			}
+
+			if ( run2 < nNodes )
+			{
+				if ( isFrozen == BT_FALSE )
+				{
+					DMatrix L( nX+nU,nV );
+					L.topRows( nX ) = X;
+					L.block( nX,nX+acadoMin( (int)run2,(int)blk.nIntervals-1 )*nU,nU,nU ).setIdentity( );
+					nodeMap[node] = L;
+				}
+
+				DVector l( nX+nU );
+				l.head( nX ) = x;
+				nodeOffset[node] = l;
+			}
+			else
+			{
+				if ( isFrozen == BT_FALSE )
+					blk.F = X;
+				blk.f = x;
+			}
+		}
+
+		if ( isFrozen == BT_FALSE )
+			blk.H = DMatrix( nV,nV );
+		blk.g = DVector( nV );
+
+		for( run2 = blk.firstNode; run2 < blk.firstNode+nNodes; run2++ )
+		{
+			DVector gn( nX+nU );
+
+			if ( cp.objectiveGradient.getNumCols( 0,run2 ) > 0 )
+			{
+				cp.objectiveGradient.getSubBlock( 0,run2,tmp );
+				gn.head( nX ) = tmp.transpose( );
+			}
+			if ( cp.objectiveGradient.getNumCols( 0,3*N+run2 ) > 0 )
+			{
+				cp.objectiveGradient.getSubBlock( 0,3*N+run2,tmp );
+				gn.tail( nU ) = tmp.transpose( );
+			}
+
+			for( run3 = blk.firstNode; run3 < blk.firstNode+nNodes; run3++ )
+			{
+				if ( getNodeBlock( cp.hessian,run2,run3,tmp ) == BT_TRUE )
+				{
+					if ( isFrozen == BT_FALSE )
+						blk.H += nodeMap[run2].transpose( )*tmp*nodeMap[run3];
+					gn += tmp*nodeOffset[run3];
+				}
+			}
+
+			blk.g += nodeMap[run2].transpose( )*gn;
+		}
+	}
+
+
+	// PROJECT AND REGULARISE THE HESSIAN IF DESIRED:
+	// ----------------------------------------------
+	if ( isFrozen == BT_FALSE )
+	{
+		int hessianMode;
+		get( HESSIAN_APPROXIMATION,hessianMode );
+
+		double hessianProjectionFactor;
+		get( HESSIAN_PROJECTION_FACTOR,hessianProjectionFactor );
+
+		double levenbergMarquard;
+		get( LEVENBERG_MARQUARDT,levenbergMarquard );
+
+		for( run1 = 0; run1 < nBlocks; run1++ )
+		{
+			DMatrix& H = blocks[run1].H;
+			H = 0.5*( H + H.transpose( ) );
+
+			if ( (HessianApproximationMode)hessianMode == EXACT_HESSIAN )
+				projectHessian( H,hessianProjectionFactor );
+
+			if ( levenbergMarquard > EPS )
+				H += eye<double>( H.rows() )*levenbergMarquard;
+		}
+	}
+
+
+	// CONDENSE THE CONSTRAINTS AND THE STATE BOUNDS INSIDE THE BLOCKS:
+	// ----------------------------------------------------------------
+	vector< uint > nRows( nBlocks,0 );
+	vector< uint > rowOffset( nBlocks,0 );
+
+	for( run1 = 0; run1 < constraintNodes.size( ); run1++ )
+		if ( constraintNodes[run1].empty( ) == false )
+			nRows[ nodeBlock[ constraintNodes[run1][0] ] ] += (uint)blockDims( run1 );
+
+	for( run1 = 1; run1 < N; run1++ )
+		if ( run1 != blocks[ nodeBlock[run1] ].firstNode )
+			nRows[ nodeBlock[run1] ] += nX;
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		if ( isFrozen == BT_FALSE )
+		{
+			blocks[run1].C = DMatrix( nRows[run1],blocks[run1].nV );
+			blocks[run1].constraintDual.resize( nRows[run1] );
+		}
+		blocks[run1].lbC = DVector( nRows[run1] );
+		blocks[run1].ubC = DVector( nRows[run1] );
+	}
+
+	uint dualOffset = getNF( );
+
+	for( run1 = 0; run1 < constraintNodes.size( ); run1++ )
+	{
+		uint nR = (uint)blockDims( run1 );
+
+		if ( constraintNodes[run1].empty( ) == false )
+		{
+			uint b = nodeBlock[ constraintNodes[run1][0] ];
+			CondensedBlock& blk = blocks[b];
+
+			DMatrix A( nR,blk.nV );
+			DVector a( nR );
+
+			for( run2 = 0; run2 < constraintNodes[run1].size( ); run2++ )
+			{
+				uint node = constraintNodes[run1][run2];
+				getNodeConstraint( cp.constraintGradient,run1,node,tmp );
+
+				if ( isFrozen == BT_FALSE )
+					A += tmp*nodeMap[node];
+				a += tmp*nodeOffset[node];
+			}
+
+			cp.lowerConstraintResiduum.getSubBlock( run1,0,lbTmp,nR,1 );
+			cp.upperConstraintResiduum.getSubBlock( run1,0,ubTmp,nR,1 );
+
+			for( run2 = 0; run2 < nR; run2++ )
+			{
+				if ( isFrozen == BT_FALSE )
+				{
+					blk.C.row( rowOffset[b]+run2 ) = A.row( run2 );
+					blk.constraintDual[ rowOffset[b]+run2 ] = dualOffset + run2;
+				}
+				blk.lbC( rowOffset[b]+run2 ) = lbTmp( run2,0 ) - a( run2 );
+				blk.ubC( rowOffset[b]+run2 ) = ubTmp( run2,0 ) - a( run2 );
+			}
+			rowOffset[b] += nR;
+		}
+		dualOffset += nR;
+	}
+
+	for( run1 = 1; run1 < N; run1++ )
+	{
+		uint b = nodeBlock[run1];
+		CondensedBlock& blk = blocks[b];
+
+		if ( run1 == blk.firstNode )
+			continue;
+
+		cp.lowerBoundResiduum.getSubBlock( run1,0,lbTmp,nX,1 );
+		cp.upperBoundResiduum.getSubBlock( run1,0,ubTmp,nX,1 );
+
+		for( run2 = 0; run2 < nX; run2++ )
+		{
+			if ( isFrozen == BT_FALSE )
+			{
+				blk.C.row( rowOffset[b]+run2 ) = nodeMap[run1].row( run2 );
+				blk.constraintDual[ rowOffset[b]+run2 ] = getNF( ) + getNC( ) + (run1-1)*nX + run2;
+			}
+			blk.lbC( rowOffset[b]+run2 ) = lbTmp( run2,0 ) - nodeOffset[run1]( run2 );
+			blk.ubC( rowOffset[b]+run2 ) = ubTmp( run2,0 ) - nodeOffset[run1]( run2 );
+		}
+		rowOffset[b] += nX;
+	}
+
+	if ( condensingStatus != COS_FROZEN )
+		condensingStatus = COS_CONDENSED;
+
+	clock.stop( );
+	setLast( LOG_TIME_CONDENSING,clock.getTime() );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "<-- Block condensing banded QP done.\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::setupBlockBounds(	BandedCP& cp
+															)
+{
+	uint run1, run2, run3;
+
+	uint nX = getNX( );
+	uint nU = getNU( );
+	uint N  = getNumPoints( );
+	uint nBlocks = getNumBlocks( );
+
+	DMatrix lbTmp, ubTmp;
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+
+		blk.boundIdx.clear( );
+		blk.boundDual.clear( );
+		blk.fixedIdx.clear( );
+		blk.fixedDual.clear( );
+
+		vector< double > lbB, ubB, fixedVal;
+
+		// BOUNDS OF THE STATE AT THE FIRST NODE:
+		if ( run1 == 0 )
+		{
+			if ( deltaX.isEmpty( ) == BT_FALSE )
+			{
+				lbTmp = deltaX;
+				ubTmp = deltaX;
+			}
+			else
+			{
+				cp.lowerBoundResiduum.getSubBlock( 0,0,lbTmp,nX,1 );
+				cp.upperBoundResiduum.getSubBlock( 0,0,ubTmp,nX,1 );
+			}
+
+			for( run2 = 0; run2 < nX; run2++ )
+			{
+				if ( ubTmp( run2,0 ) - lbTmp( run2,0 ) <= EQUALITY_EPS )
+				{
+					blk.fixedIdx.push_back( run2 );
+					blk.fixedDual.push_back( run2 );
+					fixedVal.push_back( lbTmp( run2,0 ) );
+				}
+				else
+				{
+					blk.boundIdx.push_back( run2 );
+					blk.boundDual.push_back( run2 );
+					lbB.push_back( lbTmp( run2,0 ) );
+					ubB.push_back( ubTmp( run2,0 ) );
+				}
+			}
+		}
+		else
+		{
+			cp.lowerBoundResiduum.getSubBlock( blk.firstNode,0,lbTmp,nX,1 );
+			cp.upperBoundResiduum.getSubBlock( blk.firstNode,0,ubTmp,nX,1 );
+
+			for( run2 = 0; run2 < nX; run2++ )
+			{
+				blk.boundIdx.push_back( run2 );
+				blk.boundDual.push_back( getNF( ) + getNC( ) + (blk.firstNode-1)*nX + run2 );
+				lbB.push_back( lbTmp( run2,0 ) );
+				ubB.push_back( ubTmp( run2,0 ) );
+			}
+		}
+
+		// BOUNDS OF THE CONTROLS:
+		for( run2 = 0; run2 < blk.nIntervals; run2++ )
+		{
+			uint node = blk.firstNode + run2;
+
+			cp.lowerBoundResiduum.getSubBlock( 2*N+1+node,0,lbTmp,nU,1 );
+			cp.upperBoundResiduum.getSubBlock( 2*N+1+node,0,ubTmp,nU,1 );
+
+			for( run3 = 0; run3 < nU; run3++ )
+			{
+				if ( ubTmp( run3,0 ) - lbTmp( run3,0 ) <= EQUALITY_EPS )
+				{
+					blk.fixedIdx.push_back( nX + run2*nU + run3 );
+					blk.fixedDual.push_back( nX + node*nU + run3 );
+					fixedVal.push_back( lbTmp( run3,0 ) );
+				}
+				else
+				{
+					blk.boundIdx.push_back( nX + run2*nU + run3 );
+					blk.boundDual.push_back( nX + node*nU + run3 );
+					lbB.push_back( lbTmp( run3,0 ) );
+					ubB.push_back( ubTmp( run3,0 ) );
+				}
+			}
+		}
+
+		// ALL ROWS: SIMPLE BOUNDS FOLLOWED BY GENERAL CONSTRAINTS
+		uint nB = (uint)lbB.size( );
+		uint nC = blk.lbC.getDim( );
+
+		blk.lb = DVector( nB+nC );
+		blk.ub = DVector( nB+nC );
+
+		for( run2 = 0; run2 < nB; run2++ )
+		{
+			blk.lb( run2 ) = lbB[run2];
+			blk.ub( run2 ) = ubB[run2];
+		}
+		if ( nC > 0 )
+		{
+			blk.lb.tail( nC ) = blk.lbC;
+			blk.ub.tail( nC ) = blk.ubC;
+		}
+
+		blk.fixedVal = DVector( fixedVal );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::solveBlockQP( )
+{
+	uint run1, run2;
+
+	uint nX = getNX( );
+	uint nBlocks = getNumBlocks( );
+
+	int maxQPiter;
+	get( MAX_NUM_QP_ITERATIONS,maxQPiter );
+
+
+	// STARTING POINT:
+	// ---------------
+	nIneq = 0;
+
+	double dataScale = 1.0;
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+		uint nRows = getNumRows( run1 );
+
+		dataScale = acadoMax( dataScale,getMaxAbs( blk.g ) );
+		dataScale = acadoMax( dataScale,getMaxAbs( blk.f ) );
+		dataScale = acadoMax( dataScale,blk.H.lpNorm< Infinity >( ) );
+
+		blk.z = DVector( blk.nV );
+		for( run2 = 0; run2 < blk.fixedIdx.size( ); run2++ )
+			blk.z( blk.fixedIdx[run2] ) = blk.fixedVal( run2 );
+
+		blk.pi  = DVector( nX );
+		blk.dz  = DVector( blk.nV );
+		blk.dpi = DVector( nX );
+
+		blk.sL = DVector( nRows );
+		blk.sU = DVector( nRows );
+		blk.yL = DVector( nRows );
+		blk.yU = DVector( nRows );
+		blk.dsL = DVector( nRows );
+		blk.dsU = DVector( nRows );
+		blk.dyL = DVector( nRows );
+		blk.dyU = DVector( nRows );
+		blk.rL = DVector( nRows );
+		blk.rU = DVector( nRows );
+		blk.rdFixed = DVector( (uint)blk.fixedIdx.size( ) );
+
+		for( run2 = 0; run2 < nRows; run2++ )
+		{
+			double a = getRowValue( run1,run2,blk.z );
+
+			blk.sL( run2 ) = 1.0;
+			blk.sU( run2 ) = 1.0;
+
+			// the multiplier of an equality row is kept in yL
+			if ( isEqualityRow( run1,run2 ) == BT_TRUE )
+				continue;
+
+			if ( hasLowerBound( run1,run2 ) == BT_TRUE )
+			{
+				blk.sL( run2 ) = acadoMax( a - blk.lb( run2 ),1.0 );
+				blk.yL( run2 ) = 1.0;
+				++nIneq;
+			}
+			if ( hasUpperBound( run1,run2 ) == BT_TRUE )
+			{
+				blk.sU( run2 ) = acadoMax( blk.ub( run2 ) - a,1.0 );
+				blk.yU( run2 ) = 1.0;
+				++nIneq;
+			}
+		}
+	}
+
+
+	// MEHROTRA PREDICTOR-CORRECTOR ITERATIONS:
+	// ----------------------------------------
+	returnValue returnvalue = RET_QP_SOLUTION_REACHED_LIMIT;
+
+	int nIter;
+	double res, mu, muAff, sigma, alpha;
+
+	for( nIter = 0; nIter < maxQPiter; nIter++ )
+	{
+		ipmResiduals( res );
+		mu = nIneq > 0 ? ipmComplementarity( 0.0 ) / nIneq : 0.0;
+
+		if ( ( res <= blockQPresidualTolerance*dataScale ) && ( mu <= acadoMax( blockQPmuTolerance,barrierParameter ) ) )
+		{
+			returnvalue = SUCCESSFUL_RETURN;
+			break;
+		}
+
+		if ( ipmFactorize( ) != SUCCESSFUL_RETURN )
+		{
+			returnvalue = RET_QP_SOLUTION_FAILED;
+			break;
+		}
+
+		// predictor (affine scaling) step
+		ipmSetRhs( 0.0,BT_FALSE );
+		ipmBacksolve( );
+		alpha = ipmRecover( 0.0,BT_FALSE );
+
+		sigma = 0.0;
+		if ( ( nIneq > 0 ) && ( mu > 0.0 ) )
+		{
+			muAff = ipmComplementarity( alpha ) / nIneq;
+			sigma = pow( muAff / mu,3 );
+		}
+
+		// corrector step
+		ipmSetRhs( sigma*mu,BT_TRUE );
+		ipmBacksolve( );
+		alpha = acadoMin( 1.0,blockQPstepFraction*ipmRecover( sigma*mu,BT_TRUE ) );
+
+		for( run1 = 0; run1 < nBlocks; run1++ )
+		{
+			CondensedBlock& blk = blocks[run1];
+
+			blk.z  += alpha*blk.dz;
+			blk.pi += alpha*blk.dpi;
+			blk.sL += alpha*blk.dsL;
+			blk.sU += alpha*blk.dsU;
+			blk.yL += alpha*blk.dyL;
+			blk.yU += alpha*blk.dyU;
+		}
+	}
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		ipmResiduals( res );
+
+	setLast( LOG_NUM_QP_ITERATIONS,nIter );
+
+
+	// DUAL SOLUTION IN THE LAYOUT OF THE FULLY CONDENSED QP:
+	// ------------------------------------------------------
+	denseDual = DVector( getNF( ) + getNA( ) );
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+		uint nB = (uint)blk.boundIdx.size( );
+
+		for( run2 = 0; run2 < getNumRows( run1 ); run2++ )
+		{
+			if ( run2 < nB )
+				denseDual( blk.boundDual[run2] ) = blk.yL( run2 ) - blk.yU( run2 );
+			else
+				denseDual( blk.constraintDual[run2-nB] ) = blk.yL( run2 ) - blk.yU( run2 );
+		}
+
+		for( run2 = 0; run2 < blk.fixedIdx.size( ); run2++ )
+			denseDual( blk.fixedDual[run2] ) = blk.rdFixed( run2 );
+	}
+
+	return returnvalue;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::expandBlocks(	BandedCP& cp
+														)
+{
+	if ( ( condensingStatus != COS_CONDENSED ) && ( condensingStatus != COS_FROZEN ) )
+		return ACADOERROR( RET_UNABLE_TO_EXPAND );
+
+	uint run1, run2;
+
+	uint nX = getNX( );
+	uint nU = getNU( );
+	uint N  = getNumPoints( );
+	uint nF = getNF( );
+
+	DMatrix tmp;
+
+
+	// PRIMAL SOLUTION AT THE NODES:
+	// -----------------------------
+	vector< DVector > primal( N );
+
+	cp.deltaX = BlockMatrix( 5*N,1 );
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		primal[run1] = nodeMap[run1]*blocks[ nodeBlock[run1] ].z + nodeOffset[run1];
+
+		cp.deltaX.setDense( run1    ,0,primal[run1].head( nX ) );
+		cp.deltaX.setDense( 3*N+run1,0,primal[run1].tail( nU ) );
+	}
+
+
+	// MULTIPLIERS OF THE DYNAMICS:
+	// ----------------------------
+	// gradient of the Lagrangian w.r.t. x_i without the dynamics
+	vector< DVector > aux( N,DVector( nX ) );
+
+	for( run1 = 1; run1 < N; run1++ )
+	{
+		const CondensedBlock& blk = blocks[ nodeBlock[run1] ];
+		uint lastNode = blk.firstNode + blk.nIntervals;
+		if ( lastNode == N-1 )
+			lastNode++;
+
+		if ( cp.objectiveGradient.getNumCols( 0,run1 ) > 0 )
+		{
+			cp.objectiveGradient.getSubBlock( 0,run1,tmp );
+			aux[run1] += tmp.transpose( );
+		}
+
+		for( run2 = blk.firstNode; run2 < lastNode; run2++ )
+			if ( getNodeBlock( cp.hessian,run2,run1,tmp ) == BT_TRUE )
+				aux[run1] += ( tmp.transpose( )*primal[run2] ).head( nX );
+
+		aux[run1] -= denseDual.segment( nF + getNC( ) + (run1-1)*nX,nX );
+	}
+
+	uint dualOffset = nF;
+
+	for( run1 = 0; run1 < constraintNodes.size( ); run1++ )
+	{
+		uint nR = (uint)blockDims( run1 );
+
+		for( run2 = 0; run2 < constraintNodes[run1].size( ); run2++ )
+		{
+			uint node = constraintNodes[run1][run2];
+
+			if ( ( node > 0 ) && ( getNodeConstraint( cp.constraintGradient,run1,node,tmp ) == BT_TRUE ) )
+				aux[node] -= ( tmp.transpose( )*denseDual.segment( dualOffset,nR ) ).head( nX );
+		}
+		dualOffset += nR;
+	}
+
+	cp.lambdaDynamic = BlockMatrix( N-1,1 );
+
+	DMatrix Gx;
+	DVector lambdaDyn( aux[N-1] );
+
+	cp.lambdaDynamic.setDense( N-2,0,lambdaDyn );
+
+	for( run1 = N-2; run1 >= 1; run1-- )
+	{
+		cp.dynGradient.getSubBlock( run1,0,Gx,nX,nX );
+		lambdaDyn = Gx.transpose( )*lambdaDyn + aux[run1];
+
+		cp.lambdaDynamic.setDense( run1-1,0,lambdaDyn );
+	}
+
+	int dynMode;
+	get( DYNAMIC_SENSITIVITY, dynMode );
+
+	if( dynMode == FORWARD_SENSITIVITY_LIFTED ){
+		for( run1 = 0; run1 < N-1; run1++ ){
+			tmp.init( nX, 1 );
+			tmp.setAll( 1.0/((double) nX) );
+			cp.lambdaDynamic.setDense( run1, 0, tmp );
+		}
+	}
+
+
+	// MULTIPLIERS OF THE CONSTRAINTS AND BOUNDS:
+	// ------------------------------------------
+	expandMultipliers( cp,denseDual );
+
+	if ( condensingStatus != COS_FROZEN )
+		condensingStatus = COS_INITIALIZED;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+BooleanType BlockCondensingBasedCPsolver::getNodeBlock(	const BlockMatrix& M,
+														uint i,
+														uint j,
+														DMatrix& value
+														) const
+{
+	uint nX = getNX( );
+	uint nU = getNU( );
+	uint N  = getNumPoints( );
+
+	uint idx[2][2] = { { i,3*N+i },{ j,3*N+j } };
+	uint dim[2]    = { nX,nU };
+	uint offset[2] = { 0,nX };
+
+	BooleanType isNonzero = BT_FALSE;
+	DMatrix tmp;
+
+	for( uint run1 = 0; run1 < 2; run1++ )
+		for( uint run2 = 0; run2 < 2; run2++ )
+		{
+			if ( M.getNumRows( idx[0][run1],idx[1][run2] ) == 0 )
+				continue;
+
+			M.getSubBlock( idx[0][run1],idx[1][run2],tmp );
+			if ( tmp.isZero( 0.0 ) == true )
+				continue;
+
+			if ( isNonzero == BT_FALSE )
+			{
+				value = DMatrix( nX+nU,nX+nU );
+				isNonzero = BT_TRUE;
+			}
+			value.block( offset[run1],offset[run2],dim[run1],dim[run2] ) = tmp;
+		}
+
+	return isNonzero;
+}
+
+
+BooleanType BlockCondensingBasedCPsolver::getNodeConstraint(	const BlockMatrix& A,
+																uint r,
+																uint i,
+																DMatrix& value
+																) const
+{
+	uint nX = getNX( );
+	uint nU = getNU( );
+	uint N  = getNumPoints( );
+
+	uint idx[2]    = { i,3*N+i };
+	uint dim[2]    = { nX,nU };
+	uint offset[2] = { 0,nX };
+
+	BooleanType isNonzero = BT_FALSE;
+	DMatrix tmp;
+
+	for( uint run1 = 0; run1 < 2; run1++ )
+	{
+		if ( A.getNumRows( r,idx[run1] ) == 0 )
+			continue;
+
+		A.getSubBlock( r,idx[run1],tmp );
+		if ( tmp.isZero( 0.0 ) == true )
+			continue;
+
+		if ( isNonzero == BT_FALSE )
+		{
+			value = DMatrix( tmp.getNumRows( ),nX+nU );
+			isNonzero = BT_TRUE;
+		}
+		value.block( 0,offset[run1],tmp.getNumRows( ),dim[run1] ) = tmp;
+	}
+
+	return isNonzero;
+}
+
+
+
+returnValue BlockCondensingBasedCPsolver::ipmResiduals( double& res )
+{
+	uint run1, run2;
+
+	uint nX = getNX( );
+	uint nBlocks = getNumBlocks( );
+
+	res = 0.0;
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+		uint nB = (uint)blk.boundIdx.size( );
+
+		// stationarity: H z + g - C' y + F' pi_next - [pi; 0]
+		blk.rd = blk.H*blk.z + blk.g;
+
+		for( run2 = 0; run2 < getNumRows( run1 ); run2++ )
+		{
+			double y = blk.yL( run2 ) - blk.yU( run2 );
+
+			if ( run2 < nB )
+				blk.rd( blk.boundIdx[run2] ) -= y;
+			else
+				blk.rd -= blk.C.row( run2-nB ).transpose( )*y;
+
+			double a = getRowValue( run1,run2,blk.z );
+
+			blk.rL( run2 ) = 0.0;
+			blk.rU( run2 ) = 0.0;
+
+			if ( isEqualityRow( run1,run2 ) == BT_TRUE )
+			{
+				blk.rL( run2 ) = a - blk.lb( run2 );
+				continue;
+			}
+
+			if ( hasLowerBound( run1,run2 ) == BT_TRUE )
+				blk.rL( run2 ) = a - blk.lb( run2 ) - blk.sL( run2 );
+			if ( hasUpperBound( run1,run2 ) == BT_TRUE )
+				blk.rU( run2 ) = blk.ub( run2 ) - a - blk.sU( run2 );
+		}
+
+		if ( run1+1 < nBlocks )
+		{
+			blk.rd += blk.F.transpose( )*blocks[run1+1].pi;
+
+			// link to the next block: x_next = F z + f
+			blk.re = blk.F*blk.z + blk.f - blocks[run1+1].z.head( nX );
+			res = acadoMax( res,getMaxAbs( blk.re ) );
+		}
+
+		if ( run1 > 0 )
+			blk.rd.head( nX ) -= blk.pi;
+
+		for( run2 = 0; run2 < blk.fixedIdx.size( ); run2++ )
+		{
+			blk.rdFixed( run2 ) = blk.rd( blk.fixedIdx[run2] );
+			blk.rd( blk.fixedIdx[run2] ) = 0.0;
+		}
+
+		res = acadoMax( res,getMaxAbs( blk.rd ) );
+		res = acadoMax( res,getMaxAbs( blk.rL ) );
+		res = acadoMax( res,getMaxAbs( blk.rU ) );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::ipmFactorize( )
+{
+	uint run2;
+
+	uint nX = getNX( );
+	uint nBlocks = getNumBlocks( );
+
+	for( int run1 = nBlocks-1; run1 >= 0; run1-- )
+	{
+		CondensedBlock& blk = blocks[run1];
+		uint nB = (uint)blk.boundIdx.size( );
+		uint nU = blk.nV - nX;
+
+		// Hessian of the barrier subproblem plus the cost-to-go
+		blk.Q = blk.H;
+
+		for( run2 = 0; run2 < getNumRows( run1 ); run2++ )
+		{
+			double D = 0.0;
+
+			if ( isEqualityRow( run1,run2 ) == BT_TRUE )
+				D = 1.0 / blockQPequalityRegularisation;
+			else
+			{
+				if ( hasLowerBound( run1,run2 ) == BT_TRUE )
+					D += blk.yL( run2 ) / blk.sL( run2 );
+				if ( hasUpperBound( run1,run2 ) == BT_TRUE )
+					D += blk.yU( run2 ) / blk.sU( run2 );
+			}
+
+			if ( D <= 0.0 )
+				continue;
+
+			if ( run2 < nB )
+				blk.Q( blk.boundIdx[run2],blk.boundIdx[run2] ) += D;
+			else
+				blk.Q += blk.C.row( run2-nB ).transpose( )*blk.C.row( run2-nB )*D;
+		}
+
+		if ( run1+1 < (int)nBlocks )
+			blk.Q += blk.F.transpose( )*blocks[run1+1].P*blk.F;
+
+		for( run2 = 0; run2 < blk.fixedIdx.size( ); run2++ )
+		{
+			blk.Q.row( blk.fixedIdx[run2] ).setZero( );
+			blk.Q.col( blk.fixedIdx[run2] ).setZero( );
+			blk.Q( blk.fixedIdx[run2],blk.fixedIdx[run2] ) = 1.0;
+		}
+
+		if ( run1 > 0 )
+		{
+			// eliminate the controls: u = -K x - k
+			blk.chol.compute( blk.Q.bottomRightCorner( nU,nU ) );
+			if ( blk.chol.info( ) != Success )
+				return RET_QP_SOLUTION_FAILED;
+
+			blk.K = blk.chol.solve( blk.Q.bottomLeftCorner( nU,nX ) );
+			blk.P = blk.Q.topLeftCorner( nX,nX ) - blk.Q.topRightCorner( nX,nU )*blk.K;
+			blk.P = 0.5*( blk.P + blk.P.transpose( ) );
+		}
+		else
+		{
+			blk.chol.compute( blk.Q );
+			if ( blk.chol.info( ) != Success )
+				return RET_QP_SOLUTION_FAILED;
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::ipmSetRhs( double sigmaMu, BooleanType corrector )
+{
+	uint run1, run2;
+
+	uint nBlocks = getNumBlocks( );
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+		uint nB = (uint)blk.boundIdx.size( );
+
+		blk.q = blk.rd;
+
+		for( run2 = 0; run2 < getNumRows( run1 ); run2++ )
+		{
+			double w = 0.0;
+			double target = ( corrector == BT_TRUE ) ? getCenteringTarget( sigmaMu ) : sigmaMu;
+
+			if ( isEqualityRow( run1,run2 ) == BT_TRUE )
+				w = -blk.rL( run2 ) / blockQPequalityRegularisation;
+			else
+			{
+				if ( hasLowerBound( run1,run2 ) == BT_TRUE )
+				{
+					double rc = target - blk.sL( run2 )*blk.yL( run2 );
+					if ( corrector == BT_TRUE )
+						rc -= blk.dsL( run2 )*blk.dyL( run2 );
+					w += ( rc - blk.yL( run2 )*blk.rL( run2 ) ) / blk.sL( run2 );
+				}
+				if ( hasUpperBound( run1,run2 ) == BT_TRUE )
+				{
+					double rc = target - blk.sU( run2 )*blk.yU( run2 );
+					if ( corrector == BT_TRUE )
+						rc -= blk.dsU( run2 )*blk.dyU( run2 );
+					w -= ( rc - blk.yU( run2 )*blk.rU( run2 ) ) / blk.sU( run2 );
+				}
+			}
+
+			if ( run2 < nB )
+				blk.q( blk.boundIdx[run2] ) -= w;
+			else
+				blk.q -= blk.C.row( run2-nB ).transpose( )*w;
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockCondensingBasedCPsolver::ipmBacksolve( )
+{
+	uint run2;
+
+	uint nX = getNX( );
+	uint nBlocks = getNumBlocks( );
+
+	// BACKWARD RECURSION:
+	// -------------------
+	for( int run1 = nBlocks-1; run1 >= 0; run1-- )
+	{
+		CondensedBlock& blk = blocks[run1];
+		uint nU = blk.nV - nX;
+
+		DVector qt( blk.q );
+
+		if ( run1+1 < (int)nBlocks )
+			qt += blk.F.transpose( )*( blocks[run1+1].P*blk.re + blocks[run1+1].p );
+
+		for( run2 = 0; run2 < blk.fixedIdx.size( ); run2++ )
+			qt( blk.fixedIdx[run2] ) = 0.0;
+
+		if ( run1 > 0 )
+		{
+			blk.k = blk.chol.solve( qt.tail( nU ) );
+			blk.p = qt.head( nX ) - blk.Q.topRightCorner( nX,nU )*blk.k;
+		}
+		else
+		{
+			blk.dz = blk.chol.solve( qt );
+			blk.dz = -blk.dz;
+		}
+	}
+
+	// FORWARD RECURSION:
+	// ------------------
+	for( uint run1 = 0; run1+1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk  = blocks[run1];
+		CondensedBlock& next = blocks[run1+1];
+
+		DVector dx( blk.F*blk.dz + blk.re );
+
+		next.dz.head( nX ) = dx;
+		next.dz.tail( next.nV-nX ) = -( next.K*dx + next.k );
+		next.dpi = next.P*dx + next.p;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+double BlockCondensingBasedCPsolver::ipmRecover( double sigmaMu, BooleanType corrector )
+{
+	uint run1, run2;
+
+	uint nBlocks = getNumBlocks( );
+
+	double alpha = 1.0;
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		CondensedBlock& blk = blocks[run1];
+		for( run2 = 0; run2 < getNumRows( run1 ); run2++ )
+		{
+			double da = getRowValue( run1,run2,blk.dz );
+			double ds;
+			double target = ( corrector == BT_TRUE ) ? getCenteringTarget( sigmaMu ) : sigmaMu;
+
+			// proximal multiplier update, which does not restrict the step
+			if ( isEqualityRow( run1,run2 ) == BT_TRUE )
+			{
+				blk.dyL( run2 ) = -( da + blk.rL( run2 ) ) / blockQPequalityRegularisation;
+				blk.dsL( run2 ) = 0.0;
+				blk.dsU( run2 ) = 0.0;
+				blk.dyU( run2 ) = 0.0;
+				continue;
+			}
+
+			if ( hasLowerBound( run1,run2 ) == BT_TRUE )
+			{
+				ds = da + blk.rL( run2 );
+				blk.dyL( run2 ) = ( target - ( corrector == BT_TRUE ? blk.dsL( run2 )*blk.dyL( run2 ) : 0.0 )
+									- blk.yL( run2 )*ds ) / blk.sL( run2 ) - blk.yL( run2 );
+				blk.dsL( run2 ) = ds;
+
+				if ( ( blk.dsL( run2 ) < 0.0 ) && ( -blk.sL( run2 ) / blk.dsL( run2 ) < alpha ) )
+					alpha = -blk.sL( run2 ) / blk.dsL( run2 );
+				if ( ( blk.dyL( run2 ) < 0.0 ) && ( -blk.yL( run2 ) / blk.dyL( run2 ) < alpha ) )
+					alpha = -blk.yL( run2 ) / blk.dyL( run2 );
+			}
+			else
+			{
+				blk.dsL( run2 ) = 0.0;
+				blk.dyL( run2 ) = 0.0;
+			}
+
+			if ( hasUpperBound( run1,run2 ) == BT_TRUE )
+			{
+				ds = -da + blk.rU( run2 );
+				blk.dyU( run2 ) = ( target - ( corrector == BT_TRUE ? blk.dsU( run2 )*blk.dyU( run2 ) : 0.0 )
+									- blk.yU( run2 )*ds ) / blk.sU( run2 ) - blk.yU( run2 );
+				blk.dsU( run2 ) = ds;
+
+				if ( ( blk.dsU( run2 ) < 0.0 ) && ( -blk.sU( run2 ) / blk.dsU( run2 ) < alpha ) )
+					alpha = -blk.sU( run2 ) / blk.dsU( run2 );
+				if ( ( blk.dyU( run2 ) < 0.0 ) && ( -blk.yU( run2 ) / blk.dyU( run2 ) < alpha ) )
+					alpha = -blk.yU( run2 ) / blk.dyU( run2 );
+			}
+			else
+			{
+				blk.dsU( run2 ) = 0.0;
+				blk.dyU( run2 ) = 0.0;
+			}
+		}
+	}
+
+	return alpha;
+}
+
+
+double BlockCondensingBasedCPsolver::ipmComplementarity( double alpha ) const
+{
+	double gap = 0.0;
+
+	for( uint run1 = 0; run1 < getNumBlocks( ); run1++ )
+	{
+		const CondensedBlock& blk = blocks[run1];
+
+		for( uint run2 = 0; run2 < getNumRows( run1 ); run2++ )
+		{
+			if ( isEqualityRow( run1,run2 ) == BT_TRUE )
+				continue;
+
+			gap += ( blk.sL( run2 ) + alpha*blk.dsL( run2 ) )*( blk.yL( run2 ) + alpha*blk.dyL( run2 ) );
+			gap += ( blk.sU( run2 ) + alpha*blk.dsU( run2 ) )*( blk.yU( run2 ) + alpha*blk.dyU( run2 ) );
+		}
+	}
+
+	return gap;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,292 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/conic_solver/block_condensing_based_cp_solver.hpp
+ *    \date 2014
+ */
+
+
+#ifndef ACADO_TOOLKIT_BLOCK_CONDENSING_BASED_CP_SOLVER_HPP
+#define ACADO_TOOLKIT_BLOCK_CONDENSING_BASED_CP_SOLVER_HPP
+
+#include <acado/conic_solver/condensing_based_cp_solver.hpp>
+
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Solves banded conic programs arising in optimal control using block condensing.
+ *
+ *	\ingroup NumericalAlgorithm
+ *
+ *  The class block condensing based CP solver condenses the banded QP
+ *  only within blocks of CONDENSING_BLOCK_SIZE shooting intervals. The
+ *  states at the block boundaries are kept as optimization variables,
+ *  such that the condensed QP is again banded. It is solved by a
+ *  primal-dual interior-point method, whose Newton steps are computed
+ *  by a Riccati recursion over the blocks. Both condensing and QP
+ *  solution thus scale linearly with the number of shooting intervals.
+ *
+ *  Block condensing is only applied to problems with differential states
+ *  and controls whose Hessian and constraints do not couple different
+ *  blocks; all other problems are fully condensed as in the base class.
+ */
+class BlockCondensingBasedCPsolver: public CondensingBasedCPsolver {
+
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+
+    public:
+
+        /** Default constructor. */
+        BlockCondensingBasedCPsolver( );
+
+        BlockCondensingBasedCPsolver(	UserInteraction* _userInteraction,
+										uint nConstraints_,
+										const DVector& blockDims_,
+										int fixedBlockSize_ = 0		/**< Number of intervals per block, taken from CONDENSING_BLOCK_SIZE if not positive. */
+										);
+
+        /** Copy constructor (deep copy). */
+        BlockCondensingBasedCPsolver( const BlockCondensingBasedCPsolver& rhs );
+
+        /** Destructor. */
+        virtual ~BlockCondensingBasedCPsolver( );
+
+        /** Assignment operator (deep copy). */
+        BlockCondensingBasedCPsolver& operator=( const BlockCondensingBasedCPsolver& rhs );
+
+
+        /** Assignment operator (deep copy). */
+        virtual BandedCPsolver* clone() const;
+
+
+        /** initializes the banded conic solver */
+        virtual returnValue init( const OCPiterate &iter_ );
+
+
+        /** Condenses a given banded conic program */
+        virtual returnValue prepareSolve(	BandedCP& cp
+											);
+
+        /** Solves a given banded conic program */
+        virtual returnValue solve(	BandedCP& cp
+									);
+
+        /** Expands the solution of a given banded conic program */
+        virtual returnValue finalizeSolve(	BandedCP& cp
+											);
+
+
+		virtual returnValue getParameters        ( DVector        &p_  ) const;
+		virtual returnValue getFirstControl      ( DVector        &u0_ ) const;
+
+
+        /** Sets the barrier parameter down to which the interior-point method \n
+         *  follows the central path. A positive value stops the method at an  \n
+         *  interior solution of the QP instead of its exact solution.         \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        returnValue setBarrierParameter(	double barrierParameter_
+											);
+
+
+        /** Returns a variance-covariance estimate if possible or an error message otherwise.
+         *
+         *  \return SUCCESSFUL_RETURN
+         *          RET_MEMBER_NOT_INITIALISED
+         *          RET_NOT_YET_IMPLEMENTED
+         */
+        virtual returnValue getVarianceCovariance( DMatrix &var );
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+
+    protected:
+
+        /** Data of one block of shooting intervals. The block variables   \n
+         *  are the state at the first node of the block followed by the   \n
+         *  controls of its intervals. The rows of the block are its simple \n
+         *  bounds followed by its general constraints.                    \n
+         */
+        struct CondensedBlock
+        {
+            uint firstNode;                     /**< First node of the block.                          */
+            uint nIntervals;                    /**< Number of shooting intervals of the block.        */
+            uint nV;                            /**< Number of block variables.                        */
+
+            DMatrix H;                          /**< Condensed Hessian.                                */
+            DVector g;                          /**< Condensed gradient.                               */
+            DMatrix F;                          /**< Map to the first state of the next block.         */
+            DVector f;                          /**< Offset of the first state of the next block.      */
+
+            DMatrix C;                          /**< Condensed general constraints.                    */
+            DVector lbC, ubC;                   /**< Bounds of the general constraints.                */
+            std::vector< uint > constraintDual; /**< Dual index of each general constraint.            */
+
+            std::vector< uint > boundIdx;       /**< Bounded block variables.                          */
+            std::vector< uint > boundDual;      /**< Dual index of each bound.                         */
+            DVector lb, ub;                     /**< Bounds of all rows.                               */
+
+            std::vector< uint > fixedIdx;       /**< Block variables fixed by equal bounds.            */
+            DVector fixedVal;                   /**< Values of the fixed block variables.              */
+            std::vector< uint > fixedDual;      /**< Dual index of each fixed variable.                */
+
+            DVector z, pi;                      /**< Primal iterate, multiplier of the incoming link.  */
+            DVector sL, sU, yL, yU;             /**< Slacks and multipliers of the rows.               */
+            DVector dz, dpi;                    /**< Newton step of the iterate.                       */
+            DVector dsL, dsU, dyL, dyU;         /**< Newton step of slacks and multipliers.            */
+            DVector rd, re, rL, rU;             /**< Residuals of stationarity, link and rows.         */
+            DVector rdFixed;                    /**< Stationarity residual of the fixed variables.     */
+            DVector q;                          /**< Gradient of the Newton step subproblem.           */
+
+            DMatrix Q;                          /**< Hessian of the Riccati stage.                     */
+            Eigen::LLT< Eigen::MatrixXd > chol; /**< Cholesky factor of the Riccati stage.             */
+            DMatrix K;                          /**< Feedback gain of the Riccati stage.               */
+            DMatrix P;                          /**< Cost-to-go Hessian in the block state.            */
+            DVector k, p;                       /**< Feedforward term and cost-to-go gradient.         */
+        };
+
+
+        /** Falls back to full condensing if the banded CP does not \n
+         *  decouple into blocks.                                   \n
+         */
+        returnValue checkBlockStructure(	BandedCP& cp
+											);
+
+        /** Determines whether the Hessian and the constraints of the \n
+         *  banded CP decouple into blocks.                           \n
+         */
+        BooleanType hasBlockStructure(	BandedCP& cp
+										);
+
+        /** Initializes the full condensing as fallback. */
+        returnValue initializeFullCondensing( );
+
+        /** Condenses the banded CP within each block. */
+        returnValue condenseBlocks(	BandedCP& cp
+									);
+
+        /** Sets up the simple bounds of the block condensed QP. */
+        returnValue setupBlockBounds(	BandedCP& cp
+										);
+
+        /** Solves the block condensed QP. */
+        returnValue solveBlockQP( );
+
+        /** Expands the solution of the block condensed QP. */
+        returnValue expandBlocks(	BandedCP& cp
+									);
+
+        /** Returns the (x,u)-by-(x,u) sub-block of a Hessian-like block \n
+         *  matrix at nodes i and j, or BT_FALSE if it is zero.         \n
+         */
+        BooleanType getNodeBlock(	const BlockMatrix& M,
+									uint i,
+									uint j,
+									DMatrix& value
+									) const;
+
+        /** Returns the (x,u) part of a constraint block at node i, or   \n
+         *  BT_FALSE if it is zero.                                      \n
+         */
+        BooleanType getNodeConstraint(	const BlockMatrix& A,
+										uint r,
+										uint i,
+										DMatrix& value
+										) const;
+
+
+        returnValue ipmResiduals( double& res );
+        returnValue ipmFactorize( );
+        returnValue ipmSetRhs( double sigmaMu, BooleanType corrector );
+        returnValue ipmBacksolve( );
+        double ipmRecover( double sigmaMu, BooleanType corrector );
+        double ipmComplementarity( double alpha ) const;
+
+
+        inline uint getNumBlocks( ) const;
+        inline uint getNumRows( uint b ) const;
+        inline double getRowValue( uint b, uint j, const DVector& z ) const;
+        inline BooleanType hasLowerBound( uint b, uint j ) const;
+        inline BooleanType hasUpperBound( uint b, uint j ) const;
+
+        /** Returns whether the lower and upper bound of a row coincide. Such  \n
+         *  rows have no slacks and a free, regularised multiplier.            \n
+         */
+        inline BooleanType isEqualityRow( uint b, uint j ) const;
+
+        /** Returns the complementarity the corrector step aims at for a row, \n
+         *  which is never centered below half the barrier parameter.          \n
+         */
+        inline double getCenteringTarget( double sigmaMu ) const;
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+
+    protected:
+
+        int blockSize;                         /**< Number of intervals per block.                 */
+        int fixedBlockSize;                    /**< Block size overriding CONDENSING_BLOCK_SIZE.   */
+        double barrierParameter;               /**< Barrier parameter the QP is solved for.        */
+        BooleanType useBlockCondensing;        /**< Whether the current CP is block condensed.     */
+        BooleanType isFullCondensingReady;     /**< Whether the full condensing is initialized.    */
+
+        std::vector< CondensedBlock > blocks;  /**< Blocks of shooting intervals.                  */
+        std::vector< uint > nodeBlock;         /**< Block of each node.                            */
+        std::vector< DMatrix > nodeMap;        /**< (x,u) of each node as map of block variables.  */
+        std::vector< DVector > nodeOffset;     /**< (x,u) offset of each node.                     */
+        std::vector< std::vector< uint > > constraintNodes;  /**< Nodes of each constraint block.  */
+
+        uint nIneq;                            /**< Number of one-sided inequalities.              */
+        DVector denseDual;                     /**< Dual solution in full condensing layout.       */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/conic_solver/block_condensing_based_cp_solver.ipp>
+
+
+#endif  // ACADO_TOOLKIT_BLOCK_CONDENSING_BASED_CP_SOLVER_HPP
+
+/*
+ *  end of file
+ */
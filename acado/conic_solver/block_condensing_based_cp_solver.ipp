@@ -0,0 +1,96 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/conic_solver/block_condensing_based_cp_solver.ipp
+ *    \date 2014
+ */
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+inline uint BlockCondensingBasedCPsolver::getNumBlocks( ) const
+{
+	return (uint)blocks.size( );
+}
+
+
+inline uint BlockCondensingBasedCPsolver::getNumRows( uint b ) const
+{
+	return (uint)blocks[b].boundIdx.size( ) + (uint)blocks[b].C.getNumRows( );
+}
+
+
+inline double BlockCondensingBasedCPsolver::getRowValue( uint b, uint j, const DVector& z ) const
+{
+	const CondensedBlock& blk = blocks[b];
+
+	if ( j < blk.boundIdx.size( ) )
+		return z( blk.boundIdx[j] );
+
+	return blk.C.row( j - blk.boundIdx.size( ) ).dot( z );
+}
+
+
+inline BooleanType BlockCondensingBasedCPsolver::hasLowerBound( uint b, uint j ) const
+{
+	if ( blocks[b].lb( j ) > -0.1*INFTY )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+inline BooleanType BlockCondensingBasedCPsolver::hasUpperBound( uint b, uint j ) const
+{
+	if ( blocks[b].ub( j ) < 0.1*INFTY )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+inline BooleanType BlockCondensingBasedCPsolver::isEqualityRow( uint b, uint j ) const
+{
+	if ( blocks[b].ub( j ) - blocks[b].lb( j ) <= EQUALITY_EPS )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+inline double BlockCondensingBasedCPsolver::getCenteringTarget( double sigmaMu ) const
+{
+	return acadoMax( sigmaMu,0.5*barrierParameter );
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
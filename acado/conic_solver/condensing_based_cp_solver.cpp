@@ -32,6 +32,7 @@
 
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
 #include <acado/bindings/acado_qpoases/qp_solver_qpoases.hpp>
+#include <acado/bindings/acado_qpoases/qp_solver_qpoases_sparse.hpp>
 
 using namespace Eigen;
 using namespace std;
@@ -52,6 +53,8 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( ) : BandedCPsolver( )
 
     cpSolver = 0;
     cpSolverRelaxed = 0;
+
+    settings.version = 0;
 }
 
 
@@ -65,8 +68,10 @@ CondensingBasedCPsolver::CondensingBasedCPsolver(	UserInteraction* _userInteract
 
 	condensingStatus = COS_NOT_INITIALIZED;
 
-    cpSolver = new QPsolver_qpOASES( _userInteraction );
-    cpSolverRelaxed = new QPsolver_qpOASES( _userInteraction );
+    cpSolver = allocateQPsolver( );
+    cpSolverRelaxed = allocateQPsolver( );
+
+    settings.version = 0;
 }
 
 
@@ -88,6 +93,8 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( const CondensingBasedCPsolver&
 	
 	deltaX = rhs.deltaX;
 	deltaP = rhs.deltaP;
+
+	settings = rhs.settings;
 }
 
 
@@ -122,6 +129,8 @@ CondensingBasedCPsolver& CondensingBasedCPsolver::operator=( const CondensingBas
 
 		deltaX = rhs.deltaX;
 		deltaP = rhs.deltaP;
+
+		settings = rhs.settings;
     }
     return *this;
 }
@@ -167,8 +176,8 @@ returnValue CondensingBasedCPsolver::prepareSolve(	BandedCP& cp
     // CONDENSE THE KKT-SYSTEM:
     // ------------------------
 
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	updateSettings( );
+	int printLevel = settings.printLevel;
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Condesing banded QP ...\n";
@@ -221,8 +230,8 @@ returnValue CondensingBasedCPsolver::solve(	BandedCP& cp
 
     // Solve QP subproblem
     // ------------------------------------
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	updateSettings( );
+	int printLevel = settings.printLevel;
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Solving condesed QP ...\n";
@@ -250,8 +259,8 @@ returnValue CondensingBasedCPsolver::finalizeSolve(	BandedCP& cp
 {
 	RealClock clock;
 
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	updateSettings( );
+	int printLevel = settings.printLevel;
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Expanding condensed QP solution ...\n";
@@ -401,20 +410,14 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 
     // PROJECT HESSIAN TO POSITIVE DEFINITE CONE IF NECESSARY:
     // -------------------------------------------------------
-	int hessianMode;
-	get( HESSIAN_APPROXIMATION,hessianMode );
+	updateSettings( );
 
-	if ( (HessianApproximationMode)hessianMode == EXACT_HESSIAN )
-	{
-		double hessianProjectionFactor;
-		get( HESSIAN_PROJECTION_FACTOR, hessianProjectionFactor );
-		projectHessian( denseCP.H, hessianProjectionFactor );
-	}
+	if ( (HessianApproximationMode)settings.hessianApproximation == EXACT_HESSIAN )
+		projectHessian( denseCP.H, settings.hessianProjectionFactor );
 
     // APPLY LEVENBERG-MARQUARD REGULARISATION IF DESIRED:
     // -------------------------------------------------------
-    double levenbergMarquard;
-    get(LEVENBERG_MARQUARDT, levenbergMarquard );
+    double levenbergMarquard = settings.levenbergMarquardt;
 
     if( levenbergMarquard > EPS )
     	denseCP.H += eye<double>( denseCP.H.rows() ) * levenbergMarquard;
@@ -440,8 +443,7 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 
     // SOLVE QP ALLOWING THE GIVEN NUMBER OF ITERATIONS:
     // -------------------------------------------------------
-    int maxQPiter;
-    get( MAX_NUM_QP_ITERATIONS, maxQPiter );
+    int maxQPiter = settings.maxNumQPiterations;
 
 
 	RealClock clock;
@@ -473,8 +475,7 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 			break;
 
 		default: //case: RET_QP_INFEASIBLE:
-			int infeasibleQPhandling;
-			get( INFEASIBLE_QP_HANDLING,infeasibleQPhandling );
+			int infeasibleQPhandling = settings.infeasibleQPhandling;
 
 			switch( (InfeasibleQPhandling) infeasibleQPhandling )
 			{
@@ -510,6 +511,39 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 
 
 
+DenseQPsolver* CondensingBasedCPsolver::allocateQPsolver( )
+{
+	int qpSolver;
+	get( QP_SOLVER,qpSolver );
+
+	if ( (QPSolverName)qpSolver == QP_QPOASES_SPARSE )
+		return new QPsolver_qpOASES_sparse( userInteraction );
+
+	return new QPsolver_qpOASES( userInteraction );
+}
+
+
+
+returnValue CondensingBasedCPsolver::updateSettings( )
+{
+	if ( settings.version == getOptionsVersion( ) )
+		return SUCCESSFUL_RETURN;
+
+	get( PRINTLEVEL               ,settings.printLevel );
+	get( HESSIAN_APPROXIMATION    ,settings.hessianApproximation );
+	get( HESSIAN_PROJECTION_FACTOR,settings.hessianProjectionFactor );
+	get( LEVENBERG_MARQUARDT      ,settings.levenbergMarquardt );
+	get( MAX_NUM_QP_ITERATIONS    ,settings.maxNumQPiterations );
+	get( INFEASIBLE_QP_HANDLING   ,settings.infeasibleQPhandling );
+	get( DYNAMIC_SENSITIVITY      ,settings.dynamicSensitivity );
+
+	settings.version = getOptionsVersion( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 												)
 {
@@ -534,8 +568,8 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 		if ( condensingStatus != COS_FROZEN )
 		{
 			// generate H
-			hT       = cp.hessian*T;
-			HDense   = T^hT;
+			cp.hessian.multiply( T, hT );
+			T.multiplyTransposed( hT, HDense );
 
 			if( getNX() != 0 ) generateHessianBlockLine( getNX(), rowOffset, rowOffset1 );
 			rowOffset++;
@@ -559,10 +593,11 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 			}
 
 
-			// generate A
-			ADense   = cp.constraintGradient*T;
+			// generate A, declaring its non-zero blocks
+			cp.constraintGradient.multiply( T, ADense );
 
 			denseCP.A.setZero();
+			denseCP.clearBlockPattern( );
 
 			rowOffset1 = 0;
 			for( run3 = 0; run3 < ADense.getNumRows(); run3++ ){
@@ -650,6 +685,7 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 
         denseCP.lb.init( nF );
         denseCP.ub.init( nF );
+        denseCP.clearBlockPattern( );
 
         DMatrix tmp;
 
@@ -776,6 +812,8 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
 
     if( getNX() != 0 ){
         ADense.getSubBlock( rowOffset, 0, tmp, nn, getNX() );
+        if( ADense.getNumRows( rowOffset, 0 ) > 0 )
+            denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNX() );
         for( run1 = 0; run1 < nn; run1++ )
             for( run2 = 0; run2 < getNX(); run2++ )
                 denseCP.A(rowOffset1+run1,run2) = tmp(run1,run2);
@@ -786,6 +824,8 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
             ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNXA() );
+            if( ADense.getNumRows( rowOffset, colOffset ) > 0 )
+                denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNXA() );
             for( run1 = 0; run1 < nn; run1++ )
                 for( run2 = 0; run2 < getNXA(); run2++ )
                     denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -796,6 +836,8 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
 
     if( getNP() != 0 ){
         ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNP() );
+        if( ADense.getNumRows( rowOffset, colOffset ) > 0 )
+            denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNP() );
         for( run1 = 0; run1 < nn; run1++ )
             for( run2 = 0; run2 < getNP(); run2++ )
                 denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -806,6 +848,8 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
              ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNU() );
+             if( ADense.getNumRows( rowOffset, colOffset ) > 0 )
+                 denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNU() );
              for( run1 = 0; run1 < nn; run1++ )
                  for( run2 = 0; run2 < getNU(); run2++ )
                      denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -817,6 +861,8 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
               ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNW() );
+              if( ADense.getNumRows( rowOffset, colOffset ) > 0 )
+                  denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNW() );
               for( run1 = 0; run1 < nn; run1++ )
                   for( run2 = 0; run2 < getNW(); run2++ )
                       denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -844,6 +890,8 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
 
     if( getNX() != 0 ){
         T.getSubBlock( rowOffset, 0, tmp, nn, getNX() );
+        if( T.getNumRows( rowOffset, 0 ) > 0 )
+            denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNX() );
         for( run1 = 0; run1 < nn; run1++ )
             for( run2 = 0; run2 < getNX(); run2++ )
                 denseCP.A(rowOffset1+run1,run2) = tmp(run1,run2);
@@ -854,6 +902,8 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
             T.getSubBlock( rowOffset, colOffset, tmp, nn, getNXA() );
+            if( T.getNumRows( rowOffset, colOffset ) > 0 )
+                denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNXA() );
             for( run1 = 0; run1 < nn; run1++ )
                 for( run2 = 0; run2 < getNXA(); run2++ )
                     denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -864,6 +914,8 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
 
     if( getNP() != 0 ){
         T.getSubBlock( rowOffset, colOffset, tmp, nn, getNP() );
+        if( T.getNumRows( rowOffset, colOffset ) > 0 )
+            denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNP() );
         for( run1 = 0; run1 < nn; run1++ )
             for( run2 = 0; run2 < getNP(); run2++ )
                 denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -874,6 +926,8 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
              T.getSubBlock( rowOffset, colOffset, tmp, nn, getNU() );
+             if( T.getNumRows( rowOffset, colOffset ) > 0 )
+                 denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNU() );
              for( run1 = 0; run1 < nn; run1++ )
                  for( run2 = 0; run2 < getNU(); run2++ )
                      denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -885,6 +939,8 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
               T.getSubBlock( rowOffset, colOffset, tmp, nn, getNW() );
+              if( T.getNumRows( rowOffset, colOffset ) > 0 )
+                  denseCP.addConstraintBlock( rowOffset1, colOffset1, nn, getNW() );
               for( run1 = 0; run1 < nn; run1++ )
                   for( run2 = 0; run2 < getNW(); run2++ )
                       denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
@@ -1230,8 +1286,8 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
         }
 
 
-        int dynMode;
-        get( DYNAMIC_SENSITIVITY, dynMode );
+        updateSettings( );
+        int dynMode = settings.dynamicSensitivity;
 
         if( dynMode == FORWARD_SENSITIVITY_LIFTED ){
             for( run1 = 0; run1 < N-1; run1++ ){
@@ -1255,6 +1311,28 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
     }
 
 
+    expandMultipliers( cp,denseDualSolution );
+
+	if ( condensingStatus != COS_FROZEN )
+		condensingStatus = COS_INITIALIZED;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue CondensingBasedCPsolver::expandMultipliers(	BandedCP& cp,
+															const DVector& denseDualSolution
+															) const
+{
+    uint run1, run2;
+
+    int rowCount  = 0;
+    int rowCount1 = 0;
+
+    uint nF = getNF();
+    uint N = getNumPoints();
+
     DMatrix tmp;
 
     cp.lambdaConstraint.init( blockDims.getDim(), 1 );
@@ -1337,9 +1415,6 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
         rowCount++;
     }
 
-	if ( condensingStatus != COS_FROZEN )
-		condensingStatus = COS_INITIALIZED;
-
     return SUCCESSFUL_RETURN;
 }
 
@@ -1659,7 +1734,7 @@ returnValue CondensingBasedCPsolver::solveQP(	uint maxIter,
 
 	/* ... and solve relaxed QP */
 	if ( cpSolverRelaxed == 0 )
-		cpSolverRelaxed = new QPsolver_qpOASES( userInteraction );
+		cpSolverRelaxed = allocateQPsolver( );
 
 	if ( ( cpSolverRelaxed->getNumberOfVariables( ) != denseCPrelaxed.getNV() ) ||
 	 	 ( cpSolverRelaxed->getNumberOfConstraints( ) != denseCPrelaxed.getNC() ) )
@@ -154,6 +154,11 @@ class CondensingBasedCPsolver: public BandedCPsolver {
     //
     protected:
 
+        /** Allocates a QP solver of the type given by the QP_SOLVER option.
+		 *  \return Pointer to new QP solver */
+        DenseQPsolver* allocateQPsolver( );
+
+
         /** Initializes QP objects.
 		 *  \return SUCCESSFUL_RETURN \n
 		 *          RET_QP_INIT_FAILED */
@@ -176,6 +181,15 @@ class CondensingBasedCPsolver: public BandedCPsolver {
         virtual returnValue solveCPsubproblem( );
 
 
+        /** Reads the options used in every iteration into the settings, \n
+         *  unless they have not been modified since they have been read  \n
+         *  last.                                                          \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue updateSettings( );
+
+
 
         /** Checks whether the Hessian is positive definite and projects \n
          *  the Hessian based on a heuristic damping factor. If this     \n
@@ -201,6 +215,13 @@ class CondensingBasedCPsolver: public BandedCPsolver {
         returnValue expand(		BandedCP& cp
 								);
 
+        /** Expands the multipliers of the constraints and bounds from the \n
+         *  dual solution of the condensed QP.                              \n
+         */
+        returnValue expandMultipliers(	BandedCP& cp,
+										const DVector& denseDualSolution
+										) const;
+
 
         returnValue generateHessianBlockLine   ( uint nn, uint rowOffset, uint& rowOffset1 );
         returnValue generateConstraintBlockLine( uint nn, uint rowOffset, uint& rowOffset1 );
@@ -275,6 +296,23 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 
 		DVector deltaX;
 		DVector deltaP;
+
+
+        // OPTIONS USED IN EVERY ITERATION:
+        // ----------------------------------------------------------------------
+        struct Settings
+        {
+            int    printLevel;               /**< PRINTLEVEL                          */
+            int    hessianApproximation;     /**< HESSIAN_APPROXIMATION               */
+            double hessianProjectionFactor;  /**< HESSIAN_PROJECTION_FACTOR           */
+            double levenbergMarquardt;       /**< LEVENBERG_MARQUARDT                 */
+            int    maxNumQPiterations;       /**< MAX_NUM_QP_ITERATIONS               */
+            int    infeasibleQPhandling;     /**< INFEASIBLE_QP_HANDLING              */
+            int    dynamicSensitivity;       /**< DYNAMIC_SENSITIVITY                 */
+            uint   version;                  /**< stamp of the options read           */
+        };
+
+        Settings settings;
 };
 
 
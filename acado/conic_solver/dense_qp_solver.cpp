@@ -47,6 +47,8 @@ DenseQPsolver::DenseQPsolver( ) : DenseCPsolver( )
 	
     qpStatus = QPS_NOT_INITIALIZED;
     numberOfSteps = 0;
+
+	settings.version = 0;
 }
 
 
@@ -56,6 +58,8 @@ DenseQPsolver::DenseQPsolver( UserInteraction* _userInteraction ) : DenseCPsolve
 	
     qpStatus = QPS_NOT_INITIALIZED;
     numberOfSteps = 0;
+
+	settings.version = 0;
 }
 
 
@@ -63,6 +67,8 @@ DenseQPsolver::DenseQPsolver( const DenseQPsolver& rhs ) : DenseCPsolver( rhs )
 {
     qpStatus = rhs.qpStatus;
     numberOfSteps = rhs.numberOfSteps;
+
+	settings = rhs.settings;
 }
 
 
@@ -78,6 +84,8 @@ DenseQPsolver& DenseQPsolver::operator=( const DenseQPsolver& rhs ){
         DenseCPsolver::operator=( rhs );
 
         qpStatus = rhs.qpStatus;
+
+		settings = rhs.settings;
     }
     return *this;
 }
@@ -111,11 +119,10 @@ returnValue DenseQPsolver::solve( DenseCP *cp )
 	if ( makeBoundsConsistent( cp ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_QP_HAS_INCONSISTENT_BOUNDS );
 
-	int maxNumQPiterations;
-	get( MAX_NUM_QP_ITERATIONS, maxNumQPiterations );
+	updateSettings( );
 
     returnValue returnvalue;
-    returnvalue = solve( &cp->H, &cp->A, &cp->g, &cp->lb, &cp->ub, &cp->lbA, &cp->ubA, maxNumQPiterations );
+    returnvalue = solve( &cp->H, &cp->A, &cp->g, &cp->lb, &cp->ub, &cp->lbA, &cp->ubA, settings.maxNumQPiterations );
 
 	if ( ( returnvalue != SUCCESSFUL_RETURN ) && ( returnvalue != RET_QP_SOLUTION_REACHED_LIMIT ) )
 		return returnvalue;
@@ -211,6 +218,20 @@ returnValue DenseQPsolver::makeBoundsConsistent(	DenseCP *cp
 }
 
 
+returnValue DenseQPsolver::updateSettings( )
+{
+	if ( settings.version == getOptionsVersion( ) )
+		return SUCCESSFUL_RETURN;
+
+	get( MAX_NUM_QP_ITERATIONS,settings.maxNumQPiterations );
+	get( HOTSTART_QP,settings.hotstartQP );
+
+	settings.version = getOptionsVersion( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -226,6 +226,11 @@ class DenseQPsolver : public DenseCPsolver
 		virtual returnValue makeBoundsConsistent(	DenseCP *cp
 													) const;
 
+		/** Reads the options used for every QP into the settings, unless
+		 *	they have not been modified since they have been read last.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue updateSettings( );
+
 
     //
     // DATA MEMBERS:
@@ -234,6 +239,16 @@ class DenseQPsolver : public DenseCPsolver
 
         QPStatus qpStatus;
         int numberOfSteps;
+
+		/** Options used for every QP. */
+		struct Settings
+		{
+			int  maxNumQPiterations;	/**< MAX_NUM_QP_ITERATIONS. */
+			int  hotstartQP;			/**< HOTSTART_QP. */
+			uint version;				/**< Stamp of the options the settings have been read from. */
+		};
+
+		Settings settings;
 };
 
 
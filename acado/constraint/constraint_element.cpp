@@ -153,10 +153,10 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
     if( rhs.t_index != 0 )  t_index = new int     [nFcn];
     else                    t_index = 0                 ;
 
-	if( rhs.z       != 0 )  z       = new EvaluationPoint( *(rhs.z) );
+	if( rhs.z       != 0 )  z       = new EvaluationPoint[nFcn];
 	else                    z       = 0                 ;
 
-	if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint( *(rhs.JJ) );
+	if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint[nFcn];
 	else                    JJ      = 0                 ;
 	
     nx      = rhs.nx;
@@ -170,6 +170,9 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
 
         fcn[run1] = rhs.fcn[run1];
 
+        if( z  != 0 ) z [run1] = rhs.z [run1];
+        if( JJ != 0 ) JJ[run1] = rhs.JJ[run1];
+
         if( ny > 0 ){
             y_index[run1] = new int[ny];
             for( run2 = 0; run2 < ny; run2++ )
@@ -381,10 +384,10 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
         if( rhs.t_index != 0 )  t_index = new int     [nFcn];
         else                    t_index = 0                 ;
 
-		if( rhs.z       != 0 )  z       = new EvaluationPoint( *(rhs.z) );
+		if( rhs.z       != 0 )  z       = new EvaluationPoint[nFcn];
 		else                    z       = 0                 ;
 
-		if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint( *(rhs.JJ) );
+		if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint[nFcn];
 		else                    JJ      = 0                 ;
 
         nx      = rhs.nx;
@@ -398,6 +401,9 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
 
             fcn[run1] = rhs.fcn[run1];
 
+            if( z  != 0 ) z [run1] = rhs.z [run1];
+            if( JJ != 0 ) JJ[run1] = rhs.JJ[run1];
+
             if( ny > 0 ){
                 y_index[run1] = new int[ny];
                 for( run2 = 0; run2 < ny; run2++ )
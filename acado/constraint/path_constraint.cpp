@@ -87,17 +87,19 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
     residuumL.init(T+1,1);
     residuumU.init(T+1,1);
 
+    // EVALUATE ALL GRID POINTS AT ONCE:
+    // ---------------------------------
+    DMatrix result;
+    ACADO_TRY( fcn[0].evaluateBatch( z[0], iter, T+1, result ) );
+
     for( run1 = 0; run1 <= T; run1++ ){
 
         DMatrix resL( nc, 1 );
         DMatrix resU( nc, 1 );
 
-		z[0].setZ( run1, iter );
-		DVector result = fcn[0].evaluate( z[0],run1 );
-
         for( run2 = 0; run2 < nc; run2++ ){
-             resL( run2, 0 ) = lb[run1][run2] - result(run2);
-             resU( run2, 0 ) = ub[run1][run2] - result(run2);
+             resL( run2, 0 ) = lb[run1][run2] - result(run1,run2);
+             resU( run2, 0 ) = ub[run1][run2] - result(run1,run2);
         }
 
         // STORE THE RESULTS:
@@ -95,6 +95,12 @@ returnValue LinearStateFeedback::init(	double startTime,
 										const VariablesGrid& _yRef
 										)
 {
+	// initialize control and parameter signals
+	u.init( getNU() );
+	u.setZero( );
+
+	p = p_;
+
 	setStatus( BS_READY );
 	return SUCCESSFUL_RETURN;
 }
@@ -458,6 +458,14 @@ returnValue Controller::feedbackStep(	double currentTime,
 	if ( controlLaw->feedbackStep( currentTime,xEst,pEst,yRef ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_CONTROLLER_STEP_FAILED );
 
+	/* 4) Pass the new controls to the estimator for its next prediction */
+	if ( estimator != 0 )
+	{
+		DVector uApplied;
+		controlLaw->getU( uApplied );
+		estimator->setU( uApplied );
+	}
+
 	controlLawClock.stop();
 	realClock.stop( );
 
@@ -340,6 +340,25 @@ class Controller : public SimulationBlock
 		inline BooleanType hasReferenceTrajectory( ) const;
 
 
+		/** Returns a pointer to the control law (0 if none has been assigned).
+		 *
+		 *  \return Pointer to control law
+		 */
+		inline ControlLaw* getControlLaw( ) const;
+
+		/** Returns a pointer to the estimator (0 if none has been assigned).
+		 *
+		 *  \return Pointer to estimator
+		 */
+		inline Estimator* getEstimator( ) const;
+
+		/** Returns a pointer to the build-in reference trajectory (0 if none has been assigned).
+		 *
+		 *  \return Pointer to build-in reference trajectory
+		 */
+		inline ReferenceTrajectory* getReferenceTrajectory( ) const;
+
+
 		/** Returns sampling time of control law.
 		 *
 		 *  \return Sampling time of control law.
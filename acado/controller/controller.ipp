@@ -128,6 +128,24 @@ inline BooleanType Controller::hasReferenceTrajectory( ) const
 }
 
 
+inline ControlLaw* Controller::getControlLaw( ) const
+{
+	return controlLaw;
+}
+
+
+inline Estimator* Controller::getEstimator( ) const
+{
+	return estimator;
+}
+
+
+inline ReferenceTrajectory* Controller::getReferenceTrajectory( ) const
+{
+	return referenceTrajectory;
+}
+
+
 
 inline double Controller::getSamplingTimeControlLaw( )
 {
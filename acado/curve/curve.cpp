@@ -313,7 +313,14 @@ returnValue Curve::add( double tStart, double tEnd, const Function &parameteriza
 
 returnValue Curve::evaluate( double t, double *result ) const{
 
-    uint        idx        ;
+    uint idx = 0;
+
+    return evaluate( t, result, idx );
+}
+
+
+returnValue Curve::evaluate( double t, double *result, uint &intervalIdx ) const{
+
     returnValue returnvalue;
 
     // CHECK WHETHER THE CURVE IS EMPTY:
@@ -337,14 +344,14 @@ returnValue Curve::evaluate( double t, double *result ) const{
     // OBTAIN THE INTERVAL INDEX:
     // --------------------------
 
-    idx = grid->getFloorIndex(t);
-    if( idx == nIntervals ) idx--;
+    grid->getFloorIndex(t,intervalIdx);
+    if( intervalIdx == nIntervals ) intervalIdx--;
 
 
     // EVALUATE THE FUNCTION ASSOCIATED WITH THIS INTERVAL:
     // ----------------------------------------------------
     double tt[1] = { t };
-    returnvalue = parameterization[idx]->evaluate(0,tt,result);
+    returnvalue = parameterization[intervalIdx]->evaluate(0,tt,result);
 
 
     if( returnvalue != SUCCESSFUL_RETURN )
@@ -392,13 +399,16 @@ returnValue Curve::evaluate( double tStart, double tEnd, VariablesGrid &result )
 returnValue Curve::discretize( const Grid &discretizationGrid, VariablesGrid &result ) const{
 
     uint        run1       ;
+    uint        idx = 0    ;
     returnValue returnvalue;
-    DVector      tmp        ;
+    DVector      tmp( dim ) ;
 
     result.init( dim, discretizationGrid );
 
+    // the grid points are ordered, so each search for the curve
+    // piece can start at the one found for the previous point
     for( run1 = 0; run1 < discretizationGrid.getNumPoints(); run1++ ){
-        returnvalue = evaluate( discretizationGrid.getTime(run1), tmp );
+        returnvalue = evaluate( discretizationGrid.getTime(run1), tmp.data(), idx );
         if( returnvalue != SUCCESSFUL_RETURN )
             return returnvalue;
         result.setVector(run1,tmp);
@@ -198,6 +198,25 @@ class Curve{
         returnValue evaluate( double t, double *result ) const;
 
 
+        /** Evaluates the curve at a given time point, starting the search for the     \n
+         *  curve piece containing t at the given interval index. On return, this      \n
+         *  index is set to the piece that has been evaluated, such that a sequence    \n
+         *  of evaluations at increasing time points costs amortised constant time     \n
+         *  for locating the pieces.                                                   \n
+         *                                                                              \n
+         *  \param  t           (input) the time at which the curve should be evaluated.\n
+         *  \param  result      (output) the result of the evaluation.                  \n
+         *  \param  intervalIdx (input/output) the index of the curve piece to start    \n
+         *                      searching from.                                         \n
+         *                                                                              \n
+         *  \return SUCCESSFUL_RETURN           (if the evaluation was successful.)     \n
+         *          RET_INVALID_ARGUMENTS       (if the double* result is NULL.)        \n
+         *          RET_INVALID_TIME_POINT      (if the time point t is out of range.)  \n
+         *          RET_MEMBER_NOT_INITIALISED  (if the curve is empty)                 \n
+         */
+        returnValue evaluate( double t, double *result, uint &intervalIdx ) const;
+
+
          /** Evaluates the curve at a given time point. This routine will store            \n
           *  the result of the evaluation into the DVector &result.                         \n
           *                                                                                \n
@@ -32,12 +32,25 @@
  */
 
 
+
 #include <acado/dynamic_discretization/collocation_method.hpp>
 
+#include <algorithm>
+
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#include <thread>
+#endif
+
+using namespace Eigen;
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Maximum number of Newton iterations for the collocation equations of a step. */
+static const int maxNumCollocationIterations = 25;
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -45,18 +58,26 @@ BEGIN_NAMESPACE_ACADO
 
 CollocationMethod::CollocationMethod( ) : DynamicDiscretization( )
 {
+    nSteps = defaultNumCollocationSteps;
+    tol    = defaultIntegratorTolerance;
+
+    schemeVersion = 0;
 }
 
 
 CollocationMethod::CollocationMethod( UserInteraction* _userInteraction ) : DynamicDiscretization( _userInteraction )
 {
+    nSteps = defaultNumCollocationSteps;
+    tol    = defaultIntegratorTolerance;
+
+    schemeVersion = 0;
 }
 
 
 CollocationMethod::CollocationMethod( const CollocationMethod& rhs )
                      :DynamicDiscretization ( rhs ){
 
-
+    CollocationMethod::copy( rhs );
 }
 
 
@@ -68,10 +89,34 @@ CollocationMethod::~CollocationMethod( ){
 
 CollocationMethod& CollocationMethod::operator=( const CollocationMethod& rhs ){
 
+    if ( this != &rhs ){
+        CollocationMethod::deleteAll();
+        DynamicDiscretization::operator=(rhs);
+        CollocationMethod::copy( rhs );
+    }
+
     return *this;
 }
 
 
+void CollocationMethod::copy( const CollocationMethod &arg ){
+
+    model        = arg.model       ;
+    transition   = arg.transition  ;
+    breakPoints  = arg.breakPoints ;
+
+    A            = arg.A           ;
+    b            = arg.b           ;
+    c            = arg.c           ;
+    nSteps       = arg.nSteps      ;
+    tol          = arg.tol         ;
+
+    schemeVersion = arg.schemeVersion;
+
+    intervalData = arg.intervalData;
+}
+
+
 DynamicDiscretization* CollocationMethod::clone() const{
 
     return new CollocationMethod(*this);
@@ -83,73 +128,884 @@ returnValue CollocationMethod::addStage( const DynamicSystem  &dynamicSystem_,
                                       const Grid           &stageIntervals,
                                       const IntegratorType &integratorType_ ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // LOAD THE DIFFERENTIAL EQUATION FROM THE DYNAMIC SYSTEM:
+    // -------------------------------------------------------
+    // (the integrator type is not needed, as no integrator is used)
+
+    DifferentialEquation differentialEquation_ = dynamicSystem_.getDifferentialEquation( );
+
+    if( differentialEquation_.isDiscretized() == BT_TRUE )
+        return ACADOERROR( RET_CANNOT_TREAT_DISCRETE_DE );
+
+    if( differentialEquation_.getNumAlgebraicEquations() != 0 )
+        return ACADOERROR( RET_CANNOT_TREAT_DAE );
+
+    if( differentialEquation_.isImplicit() == BT_TRUE )
+        return ACADOERROR( RET_CANNOT_TREAT_IMPLICIT_DE );
+
+    if( differentialEquation_.isSymbolic() == BT_FALSE )
+        return ACADOERROR( RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS );
+
+
+    // EACH INTERVAL GETS ITS OWN COPY OF THE MODEL:
+    // ---------------------------------------------
+    int run1 = N;
+    unionGrid = unionGrid & stageIntervals;
+    N         = unionGrid.getNumIntervals();
+
+    model.resize( N );
+    transition.resize( N );
+
+    while( run1 < N ){
+        model[run1] = differentialEquation_;
+        run1++;
+    }
+
+    // STORE THE INFORMATION ABOUT STAGE-BREAK POINTS AND START/END TIMES:
+    // -------------------------------------------------------------------
+    int tmp = 0;
+    if( breakPoints.getNumRows() > 0 ){
+        addOptionsList( );
+        tmp = (int) breakPoints( breakPoints.getNumRows()-1, 0 );
+    }
+
+    DMatrix stageIndices(1,5);
+
+    stageIndices(0,0) = stageIntervals.getNumIntervals() + tmp;
+    stageIndices(0,1) = differentialEquation_.getStartTimeIdx();
+    stageIndices(0,2) = differentialEquation_.getEndTimeIdx();
+    stageIndices(0,3) = differentialEquation_.getStartTime();
+    stageIndices(0,4) = differentialEquation_.getEndTime();
+
+    breakPoints.appendRows(stageIndices);
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 returnValue CollocationMethod::addTransition( const Transition& transition_ ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    if( transition_.getNXA() != 0 ) return ACADOERROR( RET_TRANSITION_DEPENDS_ON_ALGEBRAIC_STATES );
+    transition[N-1] = transition_;
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 returnValue CollocationMethod::clear(){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    deleteAllSeeds();
+    CollocationMethod::deleteAll();
+    breakPoints.init(0,0);
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 returnValue CollocationMethod::evaluate( OCPiterate &iter ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    ASSERT( iter.x != 0 );
+
+    int run1;
+    double tEnd;
+
+    DVector x ;  nx = iter.getNX ();
+    DVector xa;  na = iter.getNXA();
+    DVector p ;  np = iter.getNP ();
+    DVector u ;  nu = iter.getNU ();
+    DVector w ;  nw = iter.getNW ();
+
+    ACADO_TRY( setupScheme( ) );
+
+    residuum = *(iter.x);
+    residuum.setAll( 0.0 );
+
+    iter.getInitialData( x, xa, p, u, w );
+
+    intervalData.resize( N );
+
+    if( hasIndependentIntervals( iter ) == BT_TRUE ){
+
+        // COLLECT THE INITIAL VALUES OF ALL INTERVALS:
+        // --------------------------------------------
+        for( run1 = 0; run1 < N; run1++ ){
+
+            IntervalData &data = intervalData[run1];
+
+            data.x = x;
+            data.p = p;
+            data.u = u;
+            data.w = w;
+
+            DVector pOld = p;
+            tEnd = unionGrid.getTime( run1+1 );
+
+            iter.updateData( tEnd, x, xa, p, u, w );
+
+            p = pOld;
+            data.xNext = x;
+        }
+
+        // COLLOCATE ALL INTERVALS CONCURRENTLY:
+        // -------------------------------------
+        if ( runIntervalTasks( N, &CollocationMethod::simulateInterval ) != SUCCESSFUL_RETURN )
+            return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+    }
+    else{
+
+        // PROPAGATE THE STATES FROM ONE INTERVAL TO THE NEXT:
+        // ---------------------------------------------------
+        for( run1 = 0; run1 < N; run1++ ){
+
+            IntervalData &data = intervalData[run1];
+
+            data.x = x;
+            data.p = p;
+            data.u = u;
+            data.w = w;
+
+            if ( simulateInterval( run1 ) != SUCCESSFUL_RETURN )
+                return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+            DVector pOld = p;
+            tEnd = unionGrid.getTime( run1+1 );
+
+            x = data.xEnd;
+            iter.updateData( tEnd, x, xa, p, u, w );
+
+            if ( iter.isInSimulationMode( ) == BT_FALSE )
+                p = pOld;
+
+            data.xNext = x;
+        }
+    }
+
+    for( run1 = 0; run1 < N; run1++ )
+        residuum.setVector( run1, intervalData[run1].xEnd - intervalData[run1].xNext );
+
+    // LOG THE RESULTS:
+    // ----------------
+    return logTrajectory( iter );
 }
 
 
 
 returnValue CollocationMethod::evaluateSensitivities( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    int i, j;
+
+    const int n[5]      = { nx, 0, np, nu, nw };
+    const int offset[5] = { 0, 0, nx, nx+np, nx+np+nu };
+
+    intervalData.resize( N );
+
+    ACADO_TRY( runIntervalTasks( N, &CollocationMethod::differentiateInterval ) );
+
+    // COMPUTATION OF BACKWARD SENSITIVITIES:
+    // --------------------------------------
+
+    if( bSeed.isEmpty() == BT_FALSE ){
+
+        dBackward.init( N, 5 );
+
+        for( i = 0; i < N; i++ ){
+
+            DMatrix S, D;
+            bSeed.getSubBlock( 0, i, S );
+
+            for( j = 0; j < 5; j++ ){
+
+                if( n[j] == 0 ) continue;
+
+                if( S.getNumCols() == (uint) nx ) D = S * intervalData[i].G.block( 0, offset[j], nx, n[j] );
+                else                              D.init( S.getNumRows(), n[j] );
+
+                dBackward.setDense( i, j, D );
+            }
+        }
+        return SUCCESSFUL_RETURN;
+    }
+
+
+    // COMPUTATION OF FORWARD SENSITIVITIES:
+    // -------------------------------------
+
+    const BlockMatrix *seeds[5] = { &xSeed, 0, &pSeed, &uSeed, &wSeed };
+
+    dForward.init( N, 5 );
+
+    for( i = 0; i < N; i++ ){
+
+        for( j = 0; j < 5; j++ ){
+
+            if( n[j] == 0 ) continue;
+
+            DMatrix seed, D;
+            if( seeds[j]->isEmpty() == BT_FALSE ) seeds[j]->getSubBlock( i, 0, seed );
+
+            if( seed.getNumRows() == (uint) n[j] ) D = intervalData[i].G.block( 0, offset[j], nx, n[j] ) * seed;
+            else                                   D.init( nx, 0 );
+
+            dForward.setDense( i, j, D );
+        }
+    }
+    return SUCCESSFUL_RETURN;
 }
 
 
 returnValue CollocationMethod::evaluateSensitivitiesLifted( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // THE COLLOCATION STATES ARE ELIMINATED, SO THERE IS NOTHING TO LIFT:
+    // -------------------------------------------------------------------
+    return evaluateSensitivities( );
 }
 
 
 returnValue CollocationMethod::evaluateSensitivities( const BlockMatrix &seed, BlockMatrix &hessian ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
-}
+    const int NN = N+1;
+    const int n[5]      = { nx, 0, np, nu, nw };
+    const int offset[5] = { 0, 0, nx, nx+np, nx+np+nu };
 
+    const BlockMatrix *seeds[5] = { &xSeed, 0, &pSeed, &uSeed, &wSeed };
 
-returnValue CollocationMethod::deleteAllSeeds(){
+    int i, j, k;
+
+    dForward.init( N, 5 );
+    intervalData.resize( N );
+
+    for( i = 0; i < N; i++ )
+        seed.getSubBlock( i, 0, intervalData[i].S, nx, 1 );
+
+    ACADO_TRY( runIntervalTasks( N, &CollocationMethod::differentiateInterval2ndOrder ) );
+
+    // THE BLOCK ROW/COLUMN OF THE COMPONENT k OF INTERVAL i IS k*NN+i:
+    // ----------------------------------------------------------------
+
+    for( i = 0; i < N; i++ ){
+
+        IntervalData &data = intervalData[i];
+
+        for( j = 0; j < 5; j++ ){
+
+            if( n[j] == 0 ) continue;
+
+            DMatrix dir, D;
+            if( seeds[j]->isEmpty() == BT_FALSE ) seeds[j]->getSubBlock( i, 0, dir );
+
+            if( dir.getNumRows() != (uint) n[j] ){
 
-//     setForwardSeed(  0, 0, 0, 0, 1 );
-//     setForwardSeed(  0, 0, 0, 0, 2 );
-//     setBackwardSeed( 0, 1 );
-//     setBackwardSeed( 0, 2 );
+                D.init( nx, 0 );
+                dForward.setDense( i, j, D );
+                continue;
+            }
 
-    // delete seeds of member classes ...
+            D = data.G.block( 0, offset[j], nx, n[j] ) * dir;
+            dForward.setDense( i, j, D );
 
+            for( k = 0; k < 5; k++ ){
+
+                if( n[k] == 0 ) continue;
+
+                DMatrix Hjk = dir.transpose() * data.H.block( offset[j], offset[k], n[j], n[k] );
+                hessian.addDense( j*NN+i, k*NN+i, Hjk );
+            }
+        }
+    }
     return SUCCESSFUL_RETURN;
 }
 
 
+returnValue CollocationMethod::deleteAllSeeds(){
+
+    return DynamicDiscretization::deleteAllSeeds();
+}
+
+
 
 returnValue CollocationMethod::unfreeze( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // NOTHING IS FROZEN, THE COLLOCATION STATES ARE RECOMPUTED AT EACH EVALUATION:
+    // ----------------------------------------------------------------------------
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 BooleanType CollocationMethod::isAffine( ) const
 {
-    return BT_FALSE;
+    for( int run1 = 0; run1 < N; ++run1 ){
+
+        DifferentialEquation f( model[run1] );
+        if ( f.isAffine( ) == BT_FALSE )
+            return BT_FALSE;
+
+        Transition tr( transition[run1] );
+        if ( tr.getDim( ) > 0 && tr.isAffine( ) == BT_FALSE )
+            return BT_FALSE;
+    }
+
+    return BT_TRUE;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue CollocationMethod::deleteAll( ){
+
+    model.clear();
+    transition.clear();
+    intervalData.clear();
+
+    unionGrid.init();
+    DynamicDiscretization::initializeVariables( );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::setupScheme( ){
+
+    int scheme, s, run1, run2, run3;
+
+    if( schemeVersion == getOptionsVersion( ) )
+        return SUCCESSFUL_RETURN;
+
+    get( COLLOCATION_SCHEME   , scheme );
+    get( NUM_COLLOCATION_NODES, s      );
+    get( NUM_INTEGRATOR_STEPS , nSteps );
+    get( INTEGRATOR_TOLERANCE , tol    );
+
+    if( s < 1 || s > 9 || nSteps < 1 )
+        return ACADOERROR( RET_INVALID_OPTION );
+
+    // THE NODES ARE THE ROOTS OF P_s (GAUSS) OR P_s - P_{s-1} (RADAU) ON [-1,1]:
+    // ---------------------------------------------------------------------------
+    // (Newton's method with deflation of the roots already found)
+
+    DVector xi( s );
+
+    for( run1 = 0; run1 < s; run1++ ){
+
+        double z = cos( M_PI*( run1 + 0.75 )/( s + 0.5 ) );
+
+        for( run2 = 0; run2 < 100; run2++ ){
+
+            double P0 = 1.0, P1 = z, dP0 = 0.0, dP1 = 1.0;
+
+            for( run3 = 1; run3 < s; run3++ ){
+
+                double P2  = ( (2*run3+1)*z*P1 - run3*P0 )/( run3+1 );
+                double dP2 = dP0 + (2*run3+1)*P1;
+
+                P0 = P1;  P1 = P2;
+                dP0 = dP1; dP1 = dP2;
+            }
+
+            double g  = P1;
+            double dg = dP1;
+
+            if( scheme == CS_RADAU_IIA ){
+                g  -= P0;
+                dg -= dP0;
+            }
+
+            double deflation = 0.0;
+            for( run3 = 0; run3 < run1; run3++ )
+                deflation += 1.0/( z - xi(run3) );
+
+            double step = g/( dg - g*deflation );
+            z -= step;
+
+            if( fabs( step ) <= 10.0*EPS )
+                break;
+        }
+        xi(run1) = z;
+    }
+
+    c.init( s );
+    for( run1 = 0; run1 < s; run1++ )
+        c(run1) = 0.5*( xi(run1) + 1.0 );
+
+    std::sort( c.data(), c.data()+s );
+
+    if( scheme == CS_RADAU_IIA )
+        c(s-1) = 1.0;
+
+    // THE WEIGHTS INTEGRATE THE LAGRANGE POLYNOMIALS OF THE NODES EXACTLY:
+    // --------------------------------------------------------------------
+    // (sum_j A(i,j) c_j^k = c_i^(k+1)/(k+1) and sum_j b_j c_j^k = 1/(k+1))
+
+    DMatrix V( s,s ), rhs( s,s+1 );
+
+    for( run2 = 0; run2 < s; run2++ ){
+        for( run1 = 0; run1 < s; run1++ ){
+            V(run2,run1)   = pow( c(run1), run2 );
+            rhs(run2,run1) = pow( c(run1), run2+1 )/( run2+1 );
+        }
+        rhs(run2,s) = 1.0/( run2+1 );
+    }
+
+    DMatrix W = V.fullPivLu().solve( rhs );
+
+    A = W.block( 0,0,s,s ).transpose();
+    b = W.col( s );
+
+    schemeVersion = getOptionsVersion( );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::evaluateNodes( int idx, double t, double h,
+                                              const DVector &x, const DVector &p, const DVector &u, const DVector &w,
+                                              const DMatrix &K, DMatrix &F, DMatrix *J, int nDir ){
+
+    DifferentialEquation &f = model[idx];
+
+    const int s    = c.getDim();
+    const int nVar = f.getNumberOfVariables() + 1;  // (the last position collects all unused variables)
+
+    int i, j, k;
+
+    // THE POSITIONS OF (x, p, u, w) IN THE EVALUATION POINT:
+    // -------------------------------------------------------
+    std::vector<int> pos( nx+np+nu+nw );
+
+    for( j = 0; j < nx; j++ ) pos[j]          = f.getStateEnumerationIndex( j );
+    for( j = 0; j < np; j++ ) pos[nx+j]       = f.index( VT_PARAMETER  , j );
+    for( j = 0; j < nu; j++ ) pos[nx+np+j]    = f.index( VT_CONTROL    , j );
+    for( j = 0; j < nw; j++ ) pos[nx+np+nu+j] = f.index( VT_DISTURBANCE, j );
+
+    const int tIdx = f.index( VT_TIME, 0 );
+
+    // ALL NODES ARE EVALUATED BY ONE BATCHED CALL:
+    // --------------------------------------------
+    DMatrix Z( s, nVar );
+    Z.setZero();
+
+    for( i = 0; i < s; i++ ){
+
+        DVector xi = x;
+        for( j = 0; j < s; j++ )
+            xi += h*A(i,j)*K.row(j).transpose();
+
+        for( k = 0; k < nx; k++ ) Z(i,pos[k])          = xi(k);
+        for( k = 0; k < np; k++ ) Z(i,pos[nx+k])       = p(k);
+        for( k = 0; k < nu; k++ ) Z(i,pos[nx+np+k])    = u(k);
+        for( k = 0; k < nw; k++ ) Z(i,pos[nx+np+nu+k]) = w(k);
+
+        Z(i,tIdx) = t + c(i)*h;
+    }
+
+    F.init( s, nx );
+    if( f.evaluateBatch( 0, Z.data(), s, nVar, F.data() ) != SUCCESSFUL_RETURN )
+        return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    if( J == 0 )
+        return SUCCESSFUL_RETURN;
+
+    // JACOBIANS AT ALL NODES, ONE DIRECTION AT A TIME:
+    // ------------------------------------------------
+    DMatrix S( s, nVar ), dF( s, nx );
+
+    J->init( s*nx, nDir );
+
+    for( j = 0; j < nDir; j++ ){
+
+        S.setZero();
+        for( i = 0; i < s; i++ )
+            S(i,pos[j]) = 1.0;
+
+        if( f.AD_forwardBatch( 0, S.data(), s, nVar, dF.data() ) != SUCCESSFUL_RETURN )
+            return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+        for( i = 0; i < s; i++ )
+            for( k = 0; k < nx; k++ )
+                (*J)(i*nx+k,j) = dF(i,k);
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::simulate( int idx,
+                                         const DVector &x, const DVector &p, const DVector &u, const DVector &w,
+                                         DMatrix &K, DMatrix &X, DVector &xEnd ){
+
+    const int    s      = c.getDim();
+    const double tStart = unionGrid.getTime( idx   );
+    const double h      = ( unionGrid.getTime( idx+1 ) - tStart )/nSteps;
+
+    int step, iter, i, j;
+
+    // THE STAGE DERIVATIVES OF THE LAST EVALUATION ARE THE INITIAL GUESS:
+    // -------------------------------------------------------------------
+    if( (int) K.getNumRows() != nSteps*s || (int) K.getNumCols() != nx ){
+        K.init( nSteps*s, nx );
+        K.setZero();
+    }
+
+    X.init( nSteps+1, nx );
+    X.row(0) = x.transpose();
+
+    DVector xk = x;
+    DMatrix Kk, F, J, M( s*nx, s*nx );
+    DVector r( s*nx );
+
+    for( step = 0; step < nSteps; step++ ){
+
+        const double t = tStart + step*h;
+        Kk = K.block( step*s, 0, s, nx );
+
+        // NEWTON'S METHOD FOR THE COLLOCATION EQUATIONS  K = f( x + h A K ):
+        // -----------------------------------------------------------------
+        for( iter = 0; iter < maxNumCollocationIterations; iter++ ){
+
+            if( evaluateNodes( idx, t, h, xk, p, u, w, Kk, F, &J, nx ) != SUCCESSFUL_RETURN )
+                return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+            M.setIdentity();
+            for( i = 0; i < s; i++ ){
+                for( j = 0; j < s; j++ )
+                    M.block( i*nx, j*nx, nx, nx ) -= h*A(i,j)*J.block( i*nx, 0, nx, nx );
+                r.segment( i*nx, nx ) = ( Kk.row(i) - F.row(i) ).transpose();
+            }
+
+            DVector dK = M.partialPivLu().solve( r );
+
+            if( dK.allFinite() == false )
+                return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+            for( i = 0; i < s; i++ )
+                Kk.row(i) -= dK.segment( i*nx, nx ).transpose();
+
+            // (the error after the last step is of the order of |dK|^2)
+            if( dK.lpNorm<Infinity>() <= tol*( 1.0 + Kk.lpNorm<Infinity>() ) )
+                break;
+        }
+
+        if( iter == maxNumCollocationIterations )
+            return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+        K.block( step*s, 0, s, nx ) = Kk;
+
+        for( i = 0; i < s; i++ )
+            xk += h*b(i)*Kk.row(i).transpose();
+
+        X.row(step+1) = xk.transpose();
+    }
+
+    xEnd = xk;
+
+    return applyTransition( idx, p, u, w, xEnd, 0 );
+}
+
+
+returnValue CollocationMethod::differentiate( int idx,
+                                              const DVector &x, const DVector &p, const DVector &u, const DVector &w,
+                                              const DMatrix &K, DMatrix &G ){
+
+    const int    s      = c.getDim();
+    const int    nz     = nx+np+nu+nw;
+    const double tStart = unionGrid.getTime( idx   );
+    const double h      = ( unionGrid.getTime( idx+1 ) - tStart )/nSteps;
+
+    int step, i, j;
+
+    G.init( nx, nz );
+    G.setZero();
+    G.block( 0, 0, nx, nx ).setIdentity();
+
+    DVector xk = x;
+    DMatrix Kk, F, J, M( s*nx, s*nx ), R( s*nx, nz );
+
+    for( step = 0; step < nSteps; step++ ){
+
+        Kk = K.block( step*s, 0, s, nx );
+
+        if( evaluateNodes( idx, tStart + step*h, h, xk, p, u, w, Kk, F, &J, nz ) != SUCCESSFUL_RETURN )
+            return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+        // IMPLICIT FUNCTION THEOREM:  (I - h A J_x) dK = J_x G + J_z:
+        // ------------------------------------------------------------
+        M.setIdentity();
+        for( i = 0; i < s; i++ ){
+            for( j = 0; j < s; j++ )
+                M.block( i*nx, j*nx, nx, nx ) -= h*A(i,j)*J.block( i*nx, 0, nx, nx );
+
+            R.block( i*nx, 0, nx, nz ) = J.block( i*nx, 0, nx, nx )*G;
+            R.block( i*nx, nx, nx, nz-nx ) += J.block( i*nx, nx, nx, nz-nx );
+        }
+
+        DMatrix dK = M.partialPivLu().solve( R );
+
+        for( i = 0; i < s; i++ ){
+            G  += h*b(i)*dK.block( i*nx, 0, nx, nz );
+            xk += h*b(i)*Kk.row(i).transpose();
+        }
+    }
+
+    return applyTransition( idx, p, u, w, xk, &G );
+}
+
+
+returnValue CollocationMethod::applyTransition( int idx,
+                                                const DVector &p, const DVector &u, const DVector &w,
+                                                DVector &xEnd, DMatrix *G ){
+
+    Transition &tr = transition[idx];
+
+    if( tr.getDim() == 0 )
+        return SUCCESSFUL_RETURN;
+
+    int j;
+
+    EvaluationPoint z( tr, nx, 0, np, nu, nw );
+    z.setT( unionGrid.getTime( idx+1 ) );
+    z.setX( xEnd );
+    z.setP( p    );
+    z.setU( u    );
+    z.setW( w    );
+
+    DVector xNew = tr.evaluate( z );
+
+    if( G != 0 ){
+
+        const int nz = nx+np+nu+nw;
+        DMatrix T( nx, nz );
+
+        for( j = 0; j < nz; j++ ){
+
+            DVector dZ( nz );
+            dZ.setZero();
+            dZ(j) = 1.0;
+
+            EvaluationPoint d( tr, nx, 0, np, nu, nw );
+            d.setX( dZ.segment( 0, nx ) );
+            d.setP( dZ.segment( nx, np ) );
+            d.setU( dZ.segment( nx+np, nu ) );
+            d.setW( dZ.segment( nx+np+nu, nw ) );
+
+            T.col(j) = tr.AD_forward( d );
+        }
+
+        DMatrix Gnew = T.block( 0, 0, nx, nx )*(*G);
+        Gnew.block( 0, nx, nx, nz-nx ) += T.block( 0, nx, nx, nz-nx );
+        *G = Gnew;
+    }
+
+    xEnd = xNew;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::runIntervalTasks( int nTasks, IntervalTask task ){
+
+    int run1;
+    const int nThreads = getNumThreads( nTasks );
+
+    if( nThreads <= 1 ){
+
+        for( run1 = 0; run1 < nTasks; run1++ )
+            ACADO_TRY( (this->*task)( run1 ) );
+
+        return SUCCESSFUL_RETURN;
+    }
+
+#ifdef ACADO_HAS_CXX11
+
+    // EACH THREAD PICKS THE NEXT OPEN INTERVAL:
+    // -----------------------------------------
+    std::vector<returnValue> status( nTasks, SUCCESSFUL_RETURN );
+    std::vector<std::thread> workers;
+    std::atomic<int>         next( 0 );
+
+    for( run1 = 0; run1 < nThreads; run1++ )
+        workers.push_back( std::thread( [&](){
+            int idx;
+            while( ( idx = next++ ) < nTasks )
+                status[idx] = (this->*task)( idx );
+        } ) );
+
+    for( run1 = 0; run1 < nThreads; run1++ )
+        workers[run1].join();
+
+    // REPORT THE FIRST FAILING INTERVAL:
+    // ----------------------------------
+    for( run1 = 0; run1 < nTasks; run1++ )
+        if( status[run1] != SUCCESSFUL_RETURN )
+            return status[run1];
+
+#endif
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::simulateInterval( int idx ){
+
+    IntervalData &data = intervalData[idx];
+
+    return simulate( idx, data.x, data.p, data.u, data.w, data.K, data.X, data.xEnd );
+}
+
+
+returnValue CollocationMethod::differentiateInterval( int idx ){
+
+    IntervalData &data = intervalData[idx];
+
+    return differentiate( idx, data.x, data.p, data.u, data.w, data.K, data.G );
+}
+
+
+returnValue CollocationMethod::differentiateInterval2ndOrder( int idx ){
+
+    IntervalData &data = intervalData[idx];
+
+    const int nz = nx+np+nu+nw;
+    int j, k;
+
+    ACADO_TRY( differentiate( idx, data.x, data.p, data.u, data.w, data.K, data.G ) );
+
+    // CENTRAL DIFFERENCES OF THE EXACT GRADIENT  G^T S:
+    // --------------------------------------------------
+    DVector z( nz );
+    z.segment( 0       , nx ) = data.x;
+    z.segment( nx      , np ) = data.p;
+    z.segment( nx+np   , nu ) = data.u;
+    z.segment( nx+np+nu, nw ) = data.w;
+
+    DVector g[2];
+    data.H.init( nz, nz );
+
+    for( j = 0; j < nz; j++ ){
+
+        const double delta = 1e-5*( 1.0 + fabs( z(j) ) );
+
+        for( k = 0; k < 2; k++ ){
+
+            DVector zz = z;
+            zz(j) += ( k == 0 ) ? delta : -delta;
+
+            DVector xx = zz.segment( 0, nx ), pp = zz.segment( nx, np ),
+                    uu = zz.segment( nx+np, nu ), ww = zz.segment( nx+np+nu, nw );
+
+            DMatrix KK = data.K, XX, GG;
+            DVector xEnd;
+
+            ACADO_TRY( simulate( idx, xx, pp, uu, ww, KK, XX, xEnd ) );
+            ACADO_TRY( differentiate( idx, xx, pp, uu, ww, KK, GG ) );
+
+            g[k] = GG.transpose()*data.S;
+        }
+
+        data.H.col(j) = ( g[0] - g[1] )/( 2.0*delta );
+    }
+
+    DMatrix Ht = data.H.transpose();
+    data.H = 0.5*( data.H + Ht );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::logTrajectory( const OCPiterate &iter ){
+
+    if( N == 0 ) return SUCCESSFUL_RETURN;
+
+    int i, j, k;
+    double T = 0.0;
+    double t1 = 0.0, t2 = 0.0;
+    double h = 0.0;
+    BooleanType needToRescale = BT_FALSE;
+
+    VariablesGrid logX, logP, logU, logW, tmp, tmp2;
+
+    DMatrix intervalPoints(N+1,1);
+    intervalPoints(0,0) = 0.0;
+
+    j = 0;
+    for( i = 0; i < N; i++ ){
+
+        if( (int) breakPoints(j,0) <= i ) j++;
+
+        int i1 = (int) breakPoints(j,1);
+        int i2 = (int) breakPoints(j,2);
+
+        if( i1 >= 0 )  t1 = iter.p->operator()(0,i1);
+        else           t1 = breakPoints(j,3);
+
+        if( i2 >= 0 )  t2 = iter.p->operator()(0,i2);
+        else           t2 = breakPoints(j,4);
+
+        if( i == 0 ) T = t1;
+
+        // THE STATES AT THE STEP BOUNDARIES:
+        // ----------------------------------
+        const DMatrix &X = intervalData[i].X;
+        Grid stepGrid( unionGrid.getTime(i), unionGrid.getTime(i+1), X.getNumRows() );
+
+        tmp.init( nx, stepGrid );
+        for( k = 0; k < (int) X.getNumRows(); k++ )
+            tmp.setVector( k, X.getRow(k) );
+
+        intervalPoints(i+1,0) = intervalPoints(i,0) + tmp.getNumPoints();
+
+        if ( ( i1 >= 0 ) || ( i2 >= 0 ) )
+        {
+            if ( iter.isInSimulationMode() == BT_FALSE )
+            {
+                h = t2-t1;
+                needToRescale = BT_TRUE;
+            }
+        }
+        else
+        {
+            h = 1.0;
+            needToRescale = BT_FALSE;
+        }
+
+        if ( needToRescale == BT_TRUE ) rescale( &tmp, T, h );
+
+        if( nx > 0 ) logX.appendTimes( tmp );
+
+        if( np > 0 ){ tmp2.init( np, tmp.getFirstTime(),tmp.getLastTime(),2 );
+                      if ( iter.isInSimulationMode( ) == BT_FALSE )
+                          tmp2.setAllVectors( iter.p->getVector(0) );
+                      else
+                          tmp2.setAllVectors( iter.p->getVector(i) );
+                      logP .appendTimes( tmp2 );
+                    }
+        if( nu > 0 ){ tmp2.init( nu, tmp.getFirstTime(),tmp.getLastTime(),2 );
+                      tmp2.setAllVectors(iter.u->getVector(i));
+                      logU .appendTimes( tmp2 );
+                    }
+        if( nw > 0 ){ tmp2.init( nw, tmp );
+                      tmp2.setAllVectors(iter.w->getVector(i));
+                      logW .appendTimes( tmp2 );
+                    }
+        T = tmp.getLastTime();
+    }
+
+
+    // WRITE DATA TO THE LOG COLLECTION:
+    // ---------------------------------
+    if( nx > 0 ) setLast( LOG_DIFFERENTIAL_STATES, logX   );
+    if( np > 0 ) setLast( LOG_PARAMETERS         , logP   );
+    if( nu > 0 ) setLast( LOG_CONTROLS           , logU   );
+    if( nw > 0 ) setLast( LOG_DISTURBANCES       , logW   );
+
+    setLast( LOG_DISCRETIZATION_INTERVALS, intervalPoints );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
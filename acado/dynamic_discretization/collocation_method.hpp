@@ -36,6 +36,8 @@
 
 #include <acado/dynamic_discretization/dynamic_discretization.hpp>
 
+#include <vector>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -48,6 +50,22 @@ BEGIN_NAMESPACE_ACADO
  *  The class CollocationMethod allows to discretize a DifferentialEquation 
  *	for use in optimal control algorithms by means of a collocation scheme.
  *
+ *	Each interval of the union grid is divided into a fixed number of steps
+ *	(option NUM_INTEGRATOR_STEPS). On each step, the state is approximated by
+ *	a polynomial collocating the differential equation at the Radau IIA or
+ *	Gauss-Legendre nodes (options COLLOCATION_SCHEME and NUM_COLLOCATION_NODES).
+ *	The collocation equations of a step are solved by a Newton method, such
+ *	that the collocation states are eliminated and only the states at the
+ *	interval boundaries remain variables of the NLP. The sensitivities follow
+ *	from the implicit function theorem, hence their cost is fixed and does not
+ *	depend on any step size control. All nodes of a step are evaluated by one
+ *	batched call of the model.
+ *
+ *	As the intervals only depend on the values of the iterate, they are
+ *	evaluated concurrently if requested by the option NUM_THREADS.
+ *
+ *	\note Only explicit, symbolic ordinary differential equations are supported.
+ *
  *	\author Boris Houska, Hans Joachim Ferreau
  */
 class CollocationMethod : public DynamicDiscretization
@@ -141,9 +159,110 @@ public:
     virtual returnValue deleteAllSeeds();
 
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
 protected:
 
+    returnValue deleteAll( );
+
+    void copy( const CollocationMethod &arg );
+
+    /** Reads the options of the collocation and computes the    \n
+     *  nodes and weights of the collocation scheme according to \n
+     *  the options COLLOCATION_SCHEME and NUM_COLLOCATION_NODES.\n
+     *  Does nothing if the options have not been modified since \n
+     *  the scheme has been set up last.                         \n
+     *                                                           \n
+     *  \return SUCCESSFUL_RETURN                                \n
+     *          RET_INVALID_OPTION                               \n
+     */
+    returnValue setupScheme( );
+
+    /** Evaluates the differential equation of interval idx at the  \n
+     *  collocation nodes of a step. Optionally, the Jacobians with   \n
+     *  respect to the first nDir variables (x, p, u, w) are stored   \n
+     *  in J (one block row per node).                                \n
+     */
+    returnValue evaluateNodes( int idx, double t, double h,
+                               const DVector &x, const DVector &p, const DVector &u, const DVector &w,
+                               const DMatrix &K, DMatrix &F, DMatrix *J, int nDir );
+
+    /** Solves the collocation equations of all steps of interval idx, \n
+     *  starting from the stage derivatives K (if they fit).            \n
+     *                                                                  \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                          \n
+     */
+    returnValue simulate( int idx,
+                          const DVector &x, const DVector &p, const DVector &u, const DVector &w,
+                          DMatrix &K, DMatrix &X, DVector &xEnd );
+
+    /** Computes the Jacobian G of the state at the end of interval idx \n
+     *  with respect to (x, p, u, w) at the solution K.                  \n
+     */
+    returnValue differentiate( int idx,
+                               const DVector &x, const DVector &p, const DVector &u, const DVector &w,
+                               const DMatrix &K, DMatrix &G );
+
+    /** Applies the transition at the end of interval idx (if any). */
+    returnValue applyTransition( int idx,
+                                 const DVector &p, const DVector &u, const DVector &w,
+                                 DVector &xEnd, DMatrix *G );
+
+
+    /** Task that is executed for a single interval. */
+    typedef returnValue (CollocationMethod::*IntervalTask)( int idx );
+
+    /** Executes the given task for the intervals 0, ..., nTasks-1 \n
+     *  on the threads specified by the option NUM_THREADS.         \n
+     */
+    returnValue runIntervalTasks( int nTasks, IntervalTask task );
+
+    /** Interval tasks (working on intervalData[idx]). */
+    returnValue simulateInterval( int idx );
+    returnValue differentiateInterval( int idx );
+    returnValue differentiateInterval2ndOrder( int idx );
+
+
+    /** Writes the states at the step boundaries to the logging object. */
+    returnValue logTrajectory( const OCPiterate &iter );
+
+
+
+//
+// PROTECTED MEMBERS:
+//
+
+protected:
+
+    /** Input and output data of a single interval. */
+    struct IntervalData{
+
+        DVector  x, p, u, w;  /**< initial values of the interval                   */
+        DVector  xEnd      ;  /**< collocated state at the end                      */
+        DVector  xNext     ;  /**< state of the iterate at the end                  */
+        DMatrix  K         ;  /**< stage derivatives (one row per node and step)    */
+        DMatrix  X         ;  /**< states at the step boundaries                    */
+        DMatrix  G         ;  /**< Jacobian of xEnd w.r.t. (x, p, u, w)             */
+        DMatrix  S         ;  /**< backward seed for second order                   */
+        DMatrix  H         ;  /**< Hessian of S^T xEnd w.r.t. (x, p, u, w)          */
+    };
+
+    std::vector<DifferentialEquation> model     ;  /**< differential equation of each interval */
+    std::vector<Transition>           transition;  /**< transition at the end of each interval */
+    DMatrix                           breakPoints;
+
+    DMatrix  A;      /**< coefficients of the collocation scheme */
+    DVector  b;      /**< weights of the collocation scheme      */
+    DVector  c;      /**< nodes of the collocation scheme        */
+    int      nSteps; /**< number of steps per interval           */
+    double   tol   ; /**< tolerance of the Newton method         */
+
+    uint     schemeVersion;  /**< stamp of the options the scheme has been set up from */
 
+    std::vector<IntervalData> intervalData;  /**< work data of the intervals */
 };
 
 
@@ -191,6 +191,10 @@ returnValue DynamicDiscretization::setupOptions( ){
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
+	addOption( COLLOCATION_SCHEME          , defaultCollocationScheme       );
+	addOption( NUM_COLLOCATION_NODES       , defaultNumCollocationNodes     );
+	addOption( NUM_INTEGRATOR_STEPS        , defaultNumCollocationSteps     );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
 
@@ -205,8 +209,10 @@ returnValue DynamicDiscretization::setupOptions( ){
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_COLORING           , defaultJacobianColoring        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
+	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -287,6 +293,64 @@ uint DynamicDiscretization::getNumEvaluationPoints() const{
 }
 
 
+int DynamicDiscretization::getNumThreads( int nTasks ){
+
+    int nThreads = defaultNumThreads;
+    get( NUM_THREADS, nThreads );
+
+#ifndef ACADO_HAS_CXX11
+    nThreads = 1;
+#endif
+
+    if( nThreads > nTasks ) nThreads = nTasks;
+    if( nThreads < 1      ) nThreads = 1;
+
+    return nThreads;
+}
+
+
+BooleanType DynamicDiscretization::hasIndependentIntervals( const OCPiterate &iter ) const{
+
+    uint run1;
+    int  run2;
+
+    if( iter.isInSimulationMode() == BT_TRUE )
+        return BT_FALSE;
+
+    // NO VALUE OF THE ITERATE MAY BE INITIALIZED BY THE INTEGRATION:
+    // ---------------------------------------------------------------
+    const VariablesGrid *grids[5] = { iter.x, iter.xa, iter.p, iter.u, iter.w };
+
+    for( run2 = 0; run2 < 5; run2++ )
+        if( grids[run2] != 0 )
+            for( run1 = 0; run1 < grids[run2]->getNumPoints(); run1++ )
+                if( grids[run2]->getAutoInit( run1 ) == BT_TRUE )
+                    return BT_FALSE;
+
+    // THE STATES AT THE INTERVAL BOUNDARIES HAVE TO BE GIVEN:
+    // -------------------------------------------------------
+    for( run2 = 0; run2 < 2; run2++ )
+        if( grids[run2] != 0 )
+            for( run1 = 1; run1 <= unionGrid.getNumIntervals(); run1++ )
+                if( grids[run2]->hasTime( unionGrid.getTime( run1 ) ) == BT_FALSE )
+                    return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+returnValue DynamicDiscretization::rescale(	VariablesGrid* trajectory,
+												double tEndNew,
+												double newIntervalLength
+												) const
+{
+	trajectory->shiftTimes( -trajectory->getTime(0) );
+	trajectory->scaleTimes( newIntervalLength );
+	trajectory->shiftTimes( tEndNew  );
+	
+	return SUCCESSFUL_RETURN;
+}
+
 
 CLOSE_NAMESPACE_ACADO
 
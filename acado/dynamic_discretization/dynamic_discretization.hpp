@@ -259,6 +259,22 @@ class DynamicDiscretization : public AlgorithmicBase
 
         uint getNumEvaluationPoints() const;
 
+		/** Returns the number of threads that shall be used for nTasks \n
+		 *  interval tasks (according to the option NUM_THREADS).       \n
+		 */
+		int getNumThreads( int nTasks );
+
+		/** Returns whether the initial values of all intervals are     \n
+		 *  given by the iterate, i.e. whether the intervals can be      \n
+		 *  evaluated independently of each other.                      \n
+		 */
+		BooleanType hasIndependentIntervals( const OCPiterate &iter ) const;
+
+		returnValue rescale(	VariablesGrid* trajectory,
+								double tEndNew,
+								double newIntervalLength
+								) const;
+
 
 	//
 	// PROTECTED MEMBERS:
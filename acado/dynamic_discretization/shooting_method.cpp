@@ -34,6 +34,11 @@
 
 #include <acado/dynamic_discretization/shooting_method.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#include <thread>
+#endif
+
 
 
 BEGIN_NAMESPACE_ACADO
@@ -48,6 +53,8 @@ BEGIN_NAMESPACE_ACADO
 ShootingMethod::ShootingMethod() : DynamicDiscretization( ){
 
     integrator = 0;
+    integratorOptionsVersion = 0;
+    freezeIntegrator         = BT_FALSE;
 }
 
 
@@ -55,6 +62,8 @@ ShootingMethod::ShootingMethod( UserInteraction* _userInteraction )
                :DynamicDiscretization( _userInteraction ){
 
     integrator = 0;
+    integratorOptionsVersion = 0;
+    freezeIntegrator         = BT_FALSE;
 }
 
 ShootingMethod::ShootingMethod ( const ShootingMethod& arg ) : DynamicDiscretization( arg ){
@@ -94,6 +103,9 @@ void ShootingMethod::copy( const ShootingMethod &arg ){
     else integrator = 0;
 
     breakPoints = arg.breakPoints;
+
+    integratorOptionsVersion = 0;
+    freezeIntegrator         = arg.freezeIntegrator;
 }
 
 DynamicDiscretization* ShootingMethod::clone( ) const{
@@ -138,6 +150,7 @@ returnValue ShootingMethod::addStage( const DynamicSystem  &dynamicSystem_,
         integrator[run1]->init( differentialEquation_ );
         run1++;
     }
+    integratorOptionsVersion = 0;
 
     // STORE THE INFORMATION ABOUT STAGE-BREAK POINTS AND START/END TIMES:
     // -------------------------------------------------------------------
@@ -181,6 +194,22 @@ returnValue ShootingMethod::allocateIntegrator( uint idx, IntegratorType type_ )
 
 
 
+void ShootingMethod::updateIntegratorOptions( ){
+
+    if( integratorOptionsVersion == getOptionsVersion() )
+        return;
+
+    Options integratorOptions = getOptions( 0 );
+
+    for( int run1 = 0; run1 < N; run1++ )
+        integrator[run1]->setOptions( integratorOptions );
+
+    get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+    integratorOptionsVersion = getOptionsVersion();
+}
+
+
 returnValue ShootingMethod::addTransition( const Transition& transition_ ){
 
     if( transition_.getNXA() != 0 ) return ACADOERROR( RET_TRANSITION_DEPENDS_ON_ALGEBRAIC_STATES );
@@ -205,6 +234,105 @@ returnValue ShootingMethod::clear(){
 returnValue ShootingMethod::evaluate(	OCPiterate &iter
 										)
 {
+    ASSERT( iter.x != 0 );
+
+    const int nIntervals = unionGrid.getNumIntervals();
+
+    if( getNumThreads( nIntervals ) <= 1 || hasIndependentIntervals( iter ) == BT_FALSE )
+        return evaluateSequential( iter );
+
+    int run1;
+    uint run2;
+    double tStart, tEnd;
+
+    DVector x ;  nx = iter.getNX ();
+    DVector xa;  na = iter.getNXA();
+    DVector p ;  np = iter.getNP ();
+    DVector u ;  nu = iter.getNU ();
+    DVector w ;  nw = iter.getNW ();
+
+    residuum = *(iter.x);
+    residuum.setAll( 0.0 );
+
+    iter.getInitialData( x, xa, p, u, w );
+
+    updateIntegratorOptions( );
+
+    // COLLECT THE INITIAL VALUES OF ALL INTERVALS:
+    // --------------------------------------------
+    // (all values at the interval boundaries are given by the iterate, such
+    //  that the updates below do not depend on the integration results)
+
+    intervalData.resize( nIntervals );
+
+    for( run1 = 0; run1 < nIntervals; run1++ ){
+
+        IntervalData &data = intervalData[run1];
+
+        if ( (BooleanType)freezeIntegrator == BT_TRUE )
+            integrator[run1]->freezeAll();
+
+        tStart = unionGrid.getTime( run1   );
+        tEnd   = unionGrid.getTime( run1+1 );
+
+        data.evaluationGrid.init( );
+        iter.x->getSubGrid( tStart,tEnd,data.evaluationGrid );
+
+        if ( acadoIsNegative( integrator[run1]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
+            data.outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
+        else
+            data.outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[run1]->getDifferentialEquationSampleTime() ) );
+
+        data.x  = x ;
+        data.xa = xa;
+        data.p  = p ;
+        data.u  = u ;
+        data.w  = w ;
+
+        DVector pOld = p;
+
+        if ( data.evaluationGrid.getNumPoints( ) <= 2 )
+        {
+            iter.updateData( tEnd, x, xa, p, u, w );
+        }
+        else
+        {
+            // both grids are ordered, so each search starts at the last match
+            int evalIdx = 0;
+
+            for( run2 = 1; run2 < data.outputGrid.getNumPoints(); ++run2 )
+            {
+                int idx = data.evaluationGrid.findFirstTime( data.outputGrid.getTime(run2), evalIdx );
+
+                if ( idx >= 0 )
+                {
+                    evalIdx = idx;
+                    iter.updateData( data.outputGrid.getTime(run2), x, xa, p, u, w );
+                }
+            }
+        }
+
+        p = pOld;
+        data.xNext = x;
+    }
+
+    // INTEGRATE ALL INTERVALS CONCURRENTLY:
+    // -------------------------------------
+    if ( runIntervalTasks( nIntervals, &ShootingMethod::integrateInterval ) != SUCCESSFUL_RETURN )
+        return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+    for( run1 = 0; run1 < nIntervals; run1++ )
+        residuum.setVector( run1, intervalData[run1].xEnd - intervalData[run1].xNext );
+
+    // LOG THE RESULTS:
+    // ----------------
+    return logTrajectory( iter );
+}
+
+
+
+returnValue ShootingMethod::evaluateSequential( OCPiterate &iter ){
+
 // 	iter.print(); ASSERT( 1==0 );
 
     // INTRODUCE SOME AUXILIARY VARIABLES:
@@ -236,12 +364,9 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 // 	printf("unionGrid:\n");
 // 	unionGrid.print();
 
-    for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
-
-        integrator[run1]->setOptions( getOptions( 0 ) );  // ??
+    updateIntegratorOptions( );
 
-		int freezeIntegrator;
-		get( FREEZE_INTEGRATOR, freezeIntegrator );
+    for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
 
 		if ( (BooleanType)freezeIntegrator == BT_TRUE )
 			integrator[run1]->freezeAll();
@@ -299,10 +424,16 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 			xOld = xAll.getLastVector( );
 // 			xOld.print("x after");
 			
+			// both grids are ordered, so each search starts at the last match
+			int evalIdx = 0;
+
 			for( uint run2=1; run2<outputGrid.getNumPoints(); ++run2 )
 			{
-				if ( evaluationGrid.hasTime( outputGrid.getTime(run2) ) == BT_TRUE )
+				int idx = evaluationGrid.findFirstTime( outputGrid.getTime(run2), evalIdx );
+
+				if ( idx >= 0 )
 				{
+					evalIdx = idx;
 					x  =  xAll.getVector(run2);
 					xa = xaAll.getVector(run2);
 					iter.updateData( outputGrid.getTime(run2), x, xa, p, u, w );
@@ -468,6 +599,8 @@ returnValue ShootingMethod::evaluateSensitivities(){
 
     int i;
 
+    intervalData.resize( N );
+
     // COMPUTATION OF BACKWARD SENSITIVITIES:
     // --------------------------------------
 
@@ -475,17 +608,19 @@ returnValue ShootingMethod::evaluateSensitivities(){
 
         dBackward.init( N, 5 );
 
-        for( i = 0; i < N; i++ ){
+        for( i = 0; i < N; i++ )
+             bSeed.getSubBlock( 0, i, intervalData[i].S );
 
-             DMatrix seed, X, P, U, W;
-             bSeed.getSubBlock( 0, i, seed );
+        ACADO_TRY( runIntervalTasks( N, &ShootingMethod::differentiateBackwardInterval ) );
 
-             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W ) );
+        for( i = 0; i < N; i++ ){
+
+             IntervalData &data = intervalData[i];
 
-             if( nx > 0 ) dBackward.setDense( i, 0, X );
-             if( np > 0 ) dBackward.setDense( i, 2, P );
-             if( nu > 0 ) dBackward.setDense( i, 3, U );
-             if( nw > 0 ) dBackward.setDense( i, 4, W );
+             if( nx > 0 ) dBackward.setDense( i, 0, data.D[0] );
+             if( np > 0 ) dBackward.setDense( i, 2, data.D[2] );
+             if( nu > 0 ) dBackward.setDense( i, 3, data.D[3] );
+             if( nw > 0 ) dBackward.setDense( i, 4, data.D[4] );
         }
         return SUCCESSFUL_RETURN;
     }
@@ -498,17 +633,24 @@ returnValue ShootingMethod::evaluateSensitivities(){
 
     for( i = 0; i < N; i++ ){
 
-        DMatrix X, P, U, W, D, E;
+        IntervalData &data = intervalData[i];
 
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+        data.seed[0].init( 0, 0 ); if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, data.seed[0] );
+        data.seed[2].init( 0, 0 ); if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, data.seed[2] );
+        data.seed[3].init( 0, 0 ); if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, data.seed[3] );
+        data.seed[4].init( 0, 0 ); if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, data.seed[4] );
+    }
 
-        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
-        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
-        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+    ACADO_TRY( runIntervalTasks( N, &ShootingMethod::differentiateForwardInterval ) );
+
+    for( i = 0; i < N; i++ ){
+
+        IntervalData &data = intervalData[i];
+
+        if( nx > 0 ) dForward.setDense( i, 0, data.D[0] );
+        if( np > 0 ) dForward.setDense( i, 2, data.D[2] );
+        if( nu > 0 ) dForward.setDense( i, 3, data.D[3] );
+        if( nw > 0 ) dForward.setDense( i, 4, data.D[4] );
     }
     return SUCCESSFUL_RETURN;
 }
@@ -589,62 +731,42 @@ returnValue ShootingMethod::evaluateSensitivitiesLifted( ){
 returnValue ShootingMethod::evaluateSensitivities( const BlockMatrix &seed, BlockMatrix &hessian ){
 
     const int NN = N+1;
-    dForward.init( N, 5 );
-    int i;
+    const int n[5] = { nx, 0, np, nu, nw };
 
-    for( i = 0; i < N; i++ ){
-
-        DMatrix X, P, U, W, D, E, HX, HP, HU, HW, S;
-
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+    dForward.init( N, 5 );
+    intervalData.resize( N );
 
-        seed.getSubBlock( i, 0, S, nx, 1 );
+    int i, j, k;
 
-        if( nx > 0 ){
+    for( i = 0; i < N; i++ ){
 
-            ACADO_TRY( differentiateForwardBackward( i, X, E, E, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 0, D );
+        IntervalData &data = intervalData[i];
 
-            if( nx > 0 ) hessian.addDense( i,      i, HX );
-            if( np > 0 ) hessian.addDense( i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( i, 4*NN+i, HW );
-        }
+        data.seed[0].init( 0, 0 ); if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, data.seed[0] );
+        data.seed[2].init( 0, 0 ); if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, data.seed[2] );
+        data.seed[3].init( 0, 0 ); if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, data.seed[3] );
+        data.seed[4].init( 0, 0 ); if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, data.seed[4] );
 
-        if( np > 0 ){
+        seed.getSubBlock( i, 0, data.S, nx, 1 );
+    }
 
-            ACADO_TRY( differentiateForwardBackward( i, E, P, E, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 2, D );
+    ACADO_TRY( runIntervalTasks( N, &ShootingMethod::differentiateForwardBackwardInterval ) );
 
-            if( nx > 0 ) hessian.addDense( 2*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 2*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 2*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 2*NN+i, 4*NN+i, HW );
-        }
+    // THE BLOCK ROW/COLUMN OF THE COMPONENT k OF INTERVAL i IS k*NN+i:
+    // ----------------------------------------------------------------
 
-        if( nu > 0 ){
+    for( i = 0; i < N; i++ ){
 
-            ACADO_TRY( differentiateForwardBackward( i, E, E, U, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 3, D );
+        IntervalData &data = intervalData[i];
 
-            if( nx > 0 ) hessian.addDense( 3*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 3*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 3*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 3*NN+i, 4*NN+i, HW );
-        }
+        for( j = 0; j < 5; j++ ){
 
-        if( nw > 0 ){
+            if( n[j] == 0 ) continue;
 
-            ACADO_TRY( differentiateForwardBackward( i, E, E, E, W, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 4, D );
+            dForward.setDense( i, j, data.D[j] );
 
-            if( nx > 0 ) hessian.addDense( 4*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 4*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 4*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 4*NN+i, 4*NN+i, HW );
+            for( k = 0; k < 5; k++ )
+                if( n[k] > 0 ) hessian.addDense( j*NN+i, k*NN+i, data.H[j][k] );
         }
     }
     return SUCCESSFUL_RETURN;
@@ -795,16 +917,113 @@ returnValue ShootingMethod::logTrajectory( const OCPiterate &iter ){
 }
 
 
-returnValue ShootingMethod::rescale(	VariablesGrid* trajectory,
-										double tEndNew,
-										double newIntervalLength
-										) const
-{
-	trajectory->shiftTimes( -trajectory->getTime(0) );
-	trajectory->scaleTimes( newIntervalLength );
-	trajectory->shiftTimes( tEndNew  );
-	
-	return SUCCESSFUL_RETURN;
+returnValue ShootingMethod::runIntervalTasks( int nTasks, IntervalTask task ){
+
+    int run1;
+    const int nThreads = getNumThreads( nTasks );
+
+    if( nThreads <= 1 ){
+
+        for( run1 = 0; run1 < nTasks; run1++ )
+            ACADO_TRY( (this->*task)( run1 ) );
+
+        return SUCCESSFUL_RETURN;
+    }
+
+#ifdef ACADO_HAS_CXX11
+
+    // EACH THREAD PICKS THE NEXT OPEN INTERVAL:
+    // -----------------------------------------
+    std::vector<returnValue> status( nTasks, SUCCESSFUL_RETURN );
+    std::vector<std::thread> workers;
+    std::atomic<int>         next( 0 );
+
+    for( run1 = 0; run1 < nThreads; run1++ )
+        workers.push_back( std::thread( [&](){
+            int idx;
+            while( ( idx = next++ ) < nTasks )
+                status[idx] = (this->*task)( idx );
+        } ) );
+
+    for( run1 = 0; run1 < nThreads; run1++ )
+        workers[run1].join();
+
+    // REPORT THE FIRST FAILING INTERVAL:
+    // ----------------------------------
+    for( run1 = 0; run1 < nTasks; run1++ )
+        if( status[run1] != SUCCESSFUL_RETURN )
+            return status[run1];
+
+#endif
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::integrateInterval( int idx ){
+
+    IntervalData &data = intervalData[idx];
+
+    if ( integrator[idx]->integrate( data.outputGrid&data.evaluationGrid, data.x, data.xa, data.p, data.u, data.w ) != SUCCESSFUL_RETURN )
+        return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    if ( data.evaluationGrid.getNumPoints( ) <= 2 )
+    {
+        integrator[idx]->getX( data.xEnd );
+    }
+    else
+    {
+        VariablesGrid xAll;
+        integrator[idx]->getX( xAll );
+        data.xEnd = xAll.getLastVector( );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::differentiateBackwardInterval( int idx ){
+
+    IntervalData &data = intervalData[idx];
+
+    return differentiateBackward( idx, data.S, data.D[0], data.D[2], data.D[3], data.D[4] );
+}
+
+
+returnValue ShootingMethod::differentiateForwardInterval( int idx ){
+
+    IntervalData &data = intervalData[idx];
+    DMatrix E;
+
+    if( nx > 0 ) ACADO_TRY( differentiateForward( idx, data.seed[0], E, E, E, data.D[0] ) );
+    if( np > 0 ) ACADO_TRY( differentiateForward( idx, E, data.seed[2], E, E, data.D[2] ) );
+    if( nu > 0 ) ACADO_TRY( differentiateForward( idx, E, E, data.seed[3], E, data.D[3] ) );
+    if( nw > 0 ) ACADO_TRY( differentiateForward( idx, E, E, E, data.seed[4], data.D[4] ) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::differentiateForwardBackwardInterval( int idx ){
+
+    IntervalData &data = intervalData[idx];
+    DMatrix E;
+    int k;
+
+    const int n[5] = { nx, 0, np, nu, nw };
+
+    for( k = 0; k < 5; k++ ){
+
+        if( n[k] == 0 ) continue;
+
+        ACADO_TRY( differentiateForwardBackward( idx, k == 0 ? data.seed[0] : E,
+                                                      k == 2 ? data.seed[2] : E,
+                                                      k == 3 ? data.seed[3] : E,
+                                                      k == 4 ? data.seed[4] : E,
+                                                      data.S, data.D[k],
+                                                      data.H[k][0], data.H[k][2], data.H[k][3], data.H[k][4] ) );
+    }
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -159,6 +159,11 @@ class ShootingMethod : public DynamicDiscretization
 
             returnValue allocateIntegrator( uint idx, IntegratorType type_ );
 
+            /** Passes the options to the integrators, unless they have not \n
+             *  been modified since they have been passed last.              \n
+             */
+            void updateIntegratorOptions( );
+
 
             returnValue differentiateBackward( const int    &idx ,
                                                const DMatrix &seed,
@@ -191,6 +196,32 @@ class ShootingMethod : public DynamicDiscretization
             returnValue update( DMatrix &G, const DMatrix &A, const DMatrix &B );
 
 
+			/** Task that is executed for a single shooting interval. */
+			typedef returnValue (ShootingMethod::*IntervalTask)( int idx );
+
+			/** Executes the given task for the intervals 0, ..., nTasks-1. \n
+			 *  The tasks are distributed over the threads specified by the \n
+			 *  option NUM_THREADS. As each task only works on its own      \n
+			 *  integrator and interval data, the results do not depend on  \n
+			 *  the number of threads.                                      \n
+			 *                                                              \n
+			 *  \return SUCCESSFUL_RETURN or the error of the first failing \n
+			 *          interval                                            \n
+			 */
+			returnValue runIntervalTasks( int nTasks, IntervalTask task );
+
+			/** Sequential version of evaluate, propagating the states from \n
+			 *  one interval to the next.                                   \n
+			 */
+			returnValue evaluateSequential( OCPiterate &iter );
+
+			/** Interval tasks (working on intervalData[idx]). */
+			returnValue integrateInterval( int idx );
+			returnValue differentiateBackwardInterval( int idx );
+			returnValue differentiateForwardInterval( int idx );
+			returnValue differentiateForwardBackwardInterval( int idx );
+
+
 			/**< Writes the continous integrator output to the logging object, if this     \n
 			*   is requested. Please note, that this routine converts the VariablesGrids  \n
 			*   from the integration routine into a large matrix. Consequently, the break \n
@@ -200,19 +231,33 @@ class ShootingMethod : public DynamicDiscretization
 			*/
 			returnValue logTrajectory( const OCPiterate &iter );
 
-			returnValue rescale(	VariablesGrid* trajectory,
-									double tEndNew,
-									double newIntervalLength
-									) const;
-
         //
         // PROTECTED MEMBERS:
         //
 
         protected:
 
+			/** Input and output data of a single shooting interval. */
+			struct IntervalData{
+
+				Grid        evaluationGrid;  /**< points of the iterate within the interval */
+				Grid        outputGrid    ;  /**< output grid of the integrator             */
+				DVector     x, xa, p, u, w;  /**< initial values of the interval            */
+				DVector     xEnd          ;  /**< integrated state at the end               */
+				DVector     xNext         ;  /**< state of the iterate at the end           */
+				DMatrix     seed[5]       ;  /**< seeds (per block column of the iterate)   */
+				DMatrix     S             ;  /**< backward seed for second order            */
+				DMatrix     D[5]          ;  /**< first order sensitivities                 */
+				DMatrix     H[5][5]       ;  /**< second order sensitivities                */
+			};
+
             Integrator **integrator;
             DMatrix       breakPoints;
+
+            uint integratorOptionsVersion;  /**< stamp of the options passed to the integrators */
+            int  freezeIntegrator        ;  /**< value of the option FREEZE_INTEGRATOR          */
+
+			std::vector<IntervalData> intervalData;  /**< work data of the intervals */
 };
 
 
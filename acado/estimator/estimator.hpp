@@ -119,6 +119,11 @@ class Estimator : public SimulationBlock
 									) const;
 
 
+		/** Sets the controls which have been applied since the last estimate. */
+        inline returnValue setU(	const DVector& _u	/**< INPUT: applied controls. */
+									);
+
+
 		/** Returns number of estimated differential states.
 		 *  \return Number of estimated differential states */
 		inline uint getNX( ) const;
@@ -141,7 +146,7 @@ class Estimator : public SimulationBlock
 
 		/** Returns number of process outputs.
 		 *  \return Number of process outputs */
-		inline uint getNY( ) const;
+		virtual uint getNY( ) const;
 
 
     //
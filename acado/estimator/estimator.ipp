@@ -95,6 +95,14 @@ inline returnValue Estimator::getW(	DVector& _w
 }
 
 
+inline returnValue Estimator::setU(	const DVector& _u
+									)
+{
+	u = _u;
+	return SUCCESSFUL_RETURN;
+}
+
+
 inline uint Estimator::getNX( ) const
 {
 	return x.getDim( );
@@ -34,6 +34,7 @@
 #include <acado/estimator/kalman_filter.hpp>
 
 
+using namespace Eigen;
 
 BEGIN_NAMESPACE_ACADO
 
@@ -46,17 +47,73 @@ BEGIN_NAMESPACE_ACADO
 KalmanFilter::KalmanFilter(	double _samplingTime
 							) : Estimator( _samplingTime )
 {
+	setupOptions( );
+
+	dynamicSystem = 0;
+	integrator    = 0;
+
+	filterType = KFT_EXTENDED;
+	lastTime   = 0.0;
+
+	setStatus( BS_NOT_INITIALIZED );
+}
+
+
+KalmanFilter::KalmanFilter(	const DynamicSystem& _dynamicSystem,
+							double _samplingTime,
+							KalmanFilterType _filterType,
+							IntegratorType _integratorType
+							) : Estimator( _samplingTime )
+{
+	setupOptions( );
+
+	dynamicSystem = 0;
+	integrator    = 0;
+
+	filterType = _filterType;
+	lastTime   = 0.0;
+
+	if ( _dynamicSystem.getNumDynamicEquations( ) > 0 )
+	{
+		returnValue returnvalue = setDynamicSystem( _dynamicSystem,_integratorType );
+		ASSERT( returnvalue == SUCCESSFUL_RETURN );
+	}
+
 	setStatus( BS_NOT_INITIALIZED );
 }
 
 
 KalmanFilter::KalmanFilter( const KalmanFilter& rhs ) : Estimator( rhs )
 {
+	if ( rhs.dynamicSystem != 0 )
+		dynamicSystem = new DynamicSystem( *(rhs.dynamicSystem) );
+	else
+		dynamicSystem = 0;
+
+	if ( rhs.integrator != 0 )
+		integrator = rhs.integrator->clone( );
+	else
+		integrator = 0;
+
+	outputFcn  = rhs.outputFcn;
+	filterType = rhs.filterType;
+
+	sqrtQ  = rhs.sqrtQ;
+	sqrtR  = rhs.sqrtR;
+	sqrtP0 = rhs.sqrtP0;
+	S      = rhs.S;
+
+	lastTime = rhs.lastTime;
 }
 
 
 KalmanFilter::~KalmanFilter( )
 {
+	if ( dynamicSystem != 0 )
+		delete dynamicSystem;
+
+	if ( integrator != 0 )
+		delete integrator;
 }
 
 
@@ -64,9 +121,33 @@ KalmanFilter& KalmanFilter::operator=( const KalmanFilter& rhs )
 {
 	if ( this != &rhs )
 	{
+		if ( dynamicSystem != 0 )
+			delete dynamicSystem;
+
+		if ( integrator != 0 )
+			delete integrator;
 
 		Estimator::operator=( rhs );
 
+		if ( rhs.dynamicSystem != 0 )
+			dynamicSystem = new DynamicSystem( *(rhs.dynamicSystem) );
+		else
+			dynamicSystem = 0;
+
+		if ( rhs.integrator != 0 )
+			integrator = rhs.integrator->clone( );
+		else
+			integrator = 0;
+
+		outputFcn  = rhs.outputFcn;
+		filterType = rhs.filterType;
+
+		sqrtQ  = rhs.sqrtQ;
+		sqrtR  = rhs.sqrtR;
+		sqrtP0 = rhs.sqrtP0;
+		S      = rhs.S;
+
+		lastTime = rhs.lastTime;
 	}
 
     return *this;
@@ -80,11 +161,139 @@ Estimator* KalmanFilter::clone( ) const
 
 
 
+returnValue KalmanFilter::setDynamicSystem(	const DynamicSystem& _dynamicSystem,
+											IntegratorType _integratorType
+											)
+{
+	if ( ( _dynamicSystem.getNumDynamicEquations( ) == 0 ) ||
+		 ( _dynamicSystem.getNumAlgebraicEquations( ) > 0 ) )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	if ( _dynamicSystem.hasImplicitSwitches( ) == BT_TRUE )
+		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+
+	// switch to the discrete time integrator if necessary
+	if ( _dynamicSystem.isDiscretized( ) == BT_TRUE )
+		_integratorType = INT_DISCRETE;
+	else if ( _integratorType == INT_DISCRETE )
+		return ACADOERROR( RET_CANNOT_TREAT_CONTINUOUS_DE );
+
+	if ( dynamicSystem != 0 )
+		delete dynamicSystem;
+
+	if ( integrator != 0 )
+		delete integrator;
+
+	dynamicSystem = new DynamicSystem( _dynamicSystem );
+	outputFcn     = _dynamicSystem.getOutputFcn( );
+
+	if ( allocateIntegrator( _integratorType ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	if ( integrator->init( _dynamicSystem.getDifferentialEquation( ) ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	setStatus( BS_NOT_INITIALIZED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::setProcessNoiseCovariance(	const DMatrix& _Q
+														)
+{
+	return getSquareRoot( _Q,sqrtQ );
+}
+
+
+returnValue KalmanFilter::setMeasurementNoiseCovariance(	const DMatrix& _R
+															)
+{
+	return getSquareRoot( _R,sqrtR );
+}
+
+
+returnValue KalmanFilter::setInitialCovariance(	const DMatrix& _P0
+												)
+{
+	if ( getSquareRoot( _P0,sqrtP0 ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	setStatus( BS_NOT_INITIALIZED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::getCovariance(	DMatrix& _P
+											) const
+{
+	_P = S * S.transpose( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue KalmanFilter::init(	double startTime,
 								const DVector &x0_,
 								const DVector &p_
 								)
 {
+	if ( dynamicSystem == 0 )
+		return ACADOERROR( RET_ESTIMATOR_INIT_FAILED );
+
+	const uint nx = dynamicSystem->getNumDynamicEquations( );
+	const uint nu = dynamicSystem->getNumControls( );
+	const uint np = dynamicSystem->getNumParameters( );
+	const uint ny = dynamicSystem->getNumOutputs( );
+
+	if ( ( x0_.getDim( ) != nx ) || ( ( p_.isEmpty( ) == false ) && ( p_.getDim( ) != np ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	// the covariances default to zero
+	if ( sqrtQ.isEmpty( ) == true )
+		sqrtQ.init( nx,nx );
+
+	if ( sqrtR.isEmpty( ) == true )
+		sqrtR.init( ny,ny );
+
+	if ( sqrtP0.isEmpty( ) == true )
+		sqrtP0.init( nx,nx );
+
+	if ( ( sqrtQ.getNumRows( ) != nx ) || ( sqrtR.getNumRows( ) != ny ) || ( sqrtP0.getNumRows( ) != nx ) )
+		return ACADOERROR( RET_ESTIMATOR_INIT_FAILED );
+
+	// forward the integrator options
+	int    maxNumSteps, printLevel;
+	double tolerance, absoluteTolerance;
+
+	get( MAX_NUM_INTEGRATOR_STEPS,maxNumSteps );
+	get( INTEGRATOR_TOLERANCE,tolerance );
+	get( ABSOLUTE_TOLERANCE,absoluteTolerance );
+	get( INTEGRATOR_PRINTLEVEL,printLevel );
+
+	integrator->set( MAX_NUM_INTEGRATOR_STEPS,maxNumSteps );
+	integrator->set( INTEGRATOR_TOLERANCE,tolerance );
+	integrator->set( ABSOLUTE_TOLERANCE,absoluteTolerance );
+	integrator->set( INTEGRATOR_PRINTLEVEL,printLevel );
+
+	x = x0_;
+	S = sqrtP0;
+
+	u.init( nu );
+	u.setZero( );
+
+	if ( p_.isEmpty( ) == false )
+		p = p_;
+	else
+	{
+		p.init( np );
+		p.setZero( );
+	}
+
+	lastTime = startTime;
+
 	setStatus( BS_READY );
 
 	return SUCCESSFUL_RETURN;
@@ -95,16 +304,436 @@ returnValue KalmanFilter::step(	double currentTime,
 								const DVector& _y
 								)
 {
+	if ( getStatus( ) != BS_READY )
+		return ACADOERROR( RET_BLOCK_NOT_READY );
+
+	if ( _y.getDim( ) != getNY( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	returnValue returnvalue;
+
+	if ( filterType == KFT_UNSCENTED )
+		returnvalue = stepUnscented( currentTime,_y );
+	else
+		returnvalue = stepExtended( currentTime,_y );
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ESTIMATOR_STEP_FAILED );
+
+	lastTime = currentTime;
+
 	return SUCCESSFUL_RETURN;
 }
 
 
 
+uint KalmanFilter::getNY( ) const
+{
+	if ( dynamicSystem != 0 )
+		return dynamicSystem->getNumOutputs( );
+
+	return 0;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
 
 
+returnValue KalmanFilter::setupOptions( )
+{
+	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
+	addOption( INTEGRATOR_TOLERANCE        , defaultIntegratorTolerance     );
+	addOption( ABSOLUTE_TOLERANCE          , defaultAbsoluteTolerance       );
+	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::allocateIntegrator(	IntegratorType _integratorType
+												)
+{
+	switch( _integratorType )
+	{
+		case INT_DISCRETE: integrator = new IntegratorDiscretizedODE(); break;
+		case INT_RK12    : integrator = new IntegratorRK12          (); break;
+		case INT_RK23    : integrator = new IntegratorRK23          (); break;
+		case INT_RK45    : integrator = new IntegratorRK45          (); break;
+		case INT_RK78    : integrator = new IntegratorRK78          (); break;
+		case INT_BDF     : integrator = new IntegratorBDF           (); break;
+		case INT_UNKNOWN : integrator = new IntegratorBDF           (); break;
+
+		default: integrator = 0; return ACADOERROR( RET_UNKNOWN_BUG );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::predictState(	double _t0,
+										double _t1,
+										const DVector& _x0,
+										DVector& _x1,
+										DMatrix* _A
+										)
+{
+	const uint nx = _x0.getDim( );
+
+	integrator->unfreeze( );
+
+	if ( _A != 0 )
+		integrator->freezeAll( );
+
+	if ( integrator->integrate( _t0,_t1,_x0,emptyVector,p,u ) != SUCCESSFUL_RETURN )
+		return RET_ESTIMATOR_STEP_FAILED;
+
+	integrator->getX( _x1 );
+
+	if ( _A == 0 )
+		return SUCCESSFUL_RETURN;
+
+	// the columns of the Jacobian are the sensitivities w.r.t. the unit directions
+	DVector seed( nx ), Dx( nx );
+	_A->init( nx,nx );
+
+	for( uint j=0; j<nx; ++j )
+	{
+		seed.setZero( );
+		seed( j ) = 1.0;
+
+		if ( ( integrator->setForwardSeed( 1,seed ) != SUCCESSFUL_RETURN ) ||
+			 ( integrator->integrateSensitivities( ) != SUCCESSFUL_RETURN ) )
+			return RET_ESTIMATOR_STEP_FAILED;
+
+		integrator->getForwardSensitivities( Dx,1 );
+		_A->col( j ) = Dx;
+	}
+
+	integrator->deleteAllSeeds( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::evaluateOutput(	double _t,
+											const DVector& _x,
+											DVector& _y,
+											DMatrix* _H
+											)
+{
+	const uint nx = _x.getDim( );
+
+	// without output function, the full state is measured
+	if ( outputFcn.isDefined( ) == BT_FALSE )
+	{
+		_y = _x;
+
+		if ( _H != 0 )
+			*_H = DMatrix::Identity( nx,nx );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	const uint ny = outputFcn.getDim( );
+	const uint nz = outputFcn.getNumberOfVariables( ) + 1;
+
+	// variables which do not enter the output function are mapped onto the last entry
+	DVector z( nz ), seed( nz );
+	z.setZero( );
+
+	z( outputFcn.index( VT_TIME,0 ) ) = _t;
+
+	for( uint i=0; i<nx; ++i )
+		z( outputFcn.index( VT_DIFFERENTIAL_STATE,i ) ) = _x( i );
+
+	for( uint i=0; i<p.getDim( ); ++i )
+		z( outputFcn.index( VT_PARAMETER,i ) ) = p( i );
+
+	for( uint i=0; i<u.getDim( ); ++i )
+		z( outputFcn.index( VT_CONTROL,i ) ) = u( i );
+
+	_y.init( ny );
+
+	if ( outputFcn.evaluate( z.data( ),_y.data( ) ) != SUCCESSFUL_RETURN )
+		return RET_ESTIMATOR_STEP_FAILED;
+
+	if ( _H == 0 )
+		return SUCCESSFUL_RETURN;
+
+	DVector dy( ny );
+	_H->init( ny,nx );
+
+	for( uint j=0; j<nx; ++j )
+	{
+		int idx = outputFcn.index( VT_DIFFERENTIAL_STATE,j );
+
+		if ( idx == (int) nz-1 )
+			continue;
+
+		seed.setZero( );
+		seed( idx ) = 1.0;
+
+		if ( outputFcn.AD_forward( 0,seed.data( ),dy.data( ) ) != SUCCESSFUL_RETURN )
+			return RET_ESTIMATOR_STEP_FAILED;
+
+		_H->col( j ) = dy;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::stepExtended(	double currentTime,
+										const DVector& _y
+										)
+{
+	const uint nx = x.getDim( );
+	const uint ny = _y.getDim( );
+
+	// 1) Prediction: the covariance factor follows from a QR factorisation of [A*S, sqrt(Q)]
+	if ( currentTime > lastTime )
+	{
+		DVector xPred;
+		DMatrix A;
+
+		if ( predictState( lastTime,currentTime,x,xPred,&A ) != SUCCESSFUL_RETURN )
+			return RET_ESTIMATOR_STEP_FAILED;
+
+		DMatrix M( nx,2*nx );
+		M.leftCols( nx )  = A * S;
+		M.rightCols( nx ) = sqrtQ;
+
+		x = xPred;
+		triangularise( M,S );
+	}
+
+	// 2) Measurement update by the square-root array algorithm:
+	//    the lower triangular factor of [sqrt(R), H*S; 0, S] is [Sy, 0; Kbar, S+]
+	DVector yPred;
+	DMatrix H;
+
+	if ( evaluateOutput( currentTime,x,yPred,&H ) != SUCCESSFUL_RETURN )
+		return RET_ESTIMATOR_STEP_FAILED;
+
+	DMatrix pre( ny+nx,ny+nx ), post;
+	pre.block( 0,0,ny,ny )   = sqrtR;
+	pre.block( 0,ny,ny,nx )  = H * S;
+	pre.block( ny,ny,nx,nx ) = S;
+
+	triangularise( pre,post );
+
+	DMatrix Sy   = post.block( 0,0,ny,ny );
+	DMatrix Kbar = post.block( ny,0,nx,ny );
+
+	for( uint i=0; i<ny; ++i )
+		if ( fabs( Sy( i,i ) ) <= EPS )
+			return RET_MATRIX_NOT_SPD;
+
+	DVector innovation = _y - yPred;
+	DVector yScaled = Sy.triangularView<Lower>( ).solve( innovation );
+
+	x += Kbar * yScaled;
+	S  = post.block( ny,ny,nx,nx );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::stepUnscented(	double currentTime,
+											const DVector& _y
+											)
+{
+	const uint nx = x.getDim( );
+	const uint ny = _y.getDim( );
+	const uint nSigma = 2*nx+1;
+
+	// weights of the sigma points for alpha = 1, beta = 2 and kappa = 0,
+	// which are all nonnegative
+	const double gamma = sqrt( (double) nx );
+	const double wMean0 = 0.0;
+	const double wCov0  = 2.0;
+	const double wi     = 0.5 / (double) nx;
+
+	DMatrix X( nx,nSigma );
+	DVector xi;
+
+	// 1) Prediction of the sigma points around the current estimate
+	if ( currentTime > lastTime )
+	{
+		for( uint i=0; i<nSigma; ++i )
+		{
+			xi = x;
+
+			if ( ( i > 0 ) && ( i <= nx ) )
+				xi += gamma * S.col( i-1 );
+			if ( i > nx )
+				xi -= gamma * S.col( i-1-nx );
+
+			DVector xNext;
+			if ( predictState( lastTime,currentTime,xi,xNext ) != SUCCESSFUL_RETURN )
+				return RET_ESTIMATOR_STEP_FAILED;
+
+			X.col( i ) = xNext;
+		}
+
+		DVector xPred = wMean0 * X.col( 0 ) + wi * X.rightCols( nSigma-1 ).rowwise( ).sum( );
+
+		DMatrix M( nx,nSigma+nx );
+		for( uint i=1; i<nSigma; ++i )
+			M.col( i-1 ) = sqrt( wi ) * ( X.col( i ) - xPred );
+		M.col( nSigma-1 ) = sqrt( wCov0 ) * ( X.col( 0 ) - xPred );
+		M.rightCols( nx ) = sqrtQ;
+
+		x = xPred;
+		triangularise( M,S );
+	}
+
+	// 2) Measurement update with new sigma points around the prediction
+	DMatrix Y( ny,nSigma );
+	DVector yi;
+
+	for( uint i=0; i<nSigma; ++i )
+	{
+		xi = x;
+
+		if ( ( i > 0 ) && ( i <= nx ) )
+			xi += gamma * S.col( i-1 );
+		if ( i > nx )
+			xi -= gamma * S.col( i-1-nx );
+
+		if ( evaluateOutput( currentTime,xi,yi ) != SUCCESSFUL_RETURN )
+			return RET_ESTIMATOR_STEP_FAILED;
+
+		X.col( i ) = xi;
+		Y.col( i ) = yi;
+	}
+
+	DVector yPred = wMean0 * Y.col( 0 ) + wi * Y.rightCols( nSigma-1 ).rowwise( ).sum( );
+
+	DMatrix M( ny,nSigma+ny ), Sy;
+	DMatrix Pxy( nx,ny );
+
+	for( uint i=1; i<nSigma; ++i )
+	{
+		M.col( i-1 ) = sqrt( wi ) * ( Y.col( i ) - yPred );
+		Pxy += wi * ( X.col( i ) - x ) * ( Y.col( i ) - yPred ).transpose( );
+	}
+	M.col( nSigma-1 ) = sqrt( wCov0 ) * ( Y.col( 0 ) - yPred );
+	M.rightCols( ny ) = sqrtR;
+	Pxy += wCov0 * ( X.col( 0 ) - x ) * ( Y.col( 0 ) - yPred ).transpose( );
+
+	triangularise( M,Sy );
+
+	for( uint i=0; i<ny; ++i )
+		if ( fabs( Sy( i,i ) ) <= EPS )
+			return RET_MATRIX_NOT_SPD;
+
+	// K = Pxy * (Sy*Sy')^{-1}, hence U = K*Sy = Pxy * Sy^{-T}
+	DMatrix U = Sy.triangularView<Lower>( ).solve( Pxy.transpose( ) ).transpose( );
+	DVector innovation = _y - yPred;
+
+	x += U * Sy.triangularView<Lower>( ).solve( innovation );
+
+	// the covariance shrinks by U*U', one downdate per column
+	for( uint j=0; j<ny; ++j )
+		if ( updateCholesky( S,U.col( j ),-1.0 ) != SUCCESSFUL_RETURN )
+			return RET_MATRIX_NOT_SPD;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::getSquareRoot(	const DMatrix& _M,
+											DMatrix& _sqrtM
+											)
+{
+	if ( _M.isEmpty( ) == true )
+	{
+		_sqrtM.init( 0,0 );
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( ( _M.getNumRows( ) != _M.getNumCols( ) ) || ( _M.isSymmetric( ) == false ) )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	SelfAdjointEigenSolver< MatrixXd > es( _M );
+	VectorXd D = es.eigenvalues( );
+
+	for( int i=0; i<D.size( ); ++i )
+	{
+		if ( D( i ) < -1.0e3*EPS*D.cwiseAbs( ).maxCoeff( ) )
+			return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+		D( i ) = sqrt( acadoMax( D( i ),0.0 ) );
+	}
+
+	return triangularise( es.eigenvectors( ) * D.asDiagonal( ),_sqrtM );
+}
+
+
+returnValue KalmanFilter::triangularise(	const DMatrix& _M,
+											DMatrix& _L
+											)
+{
+	const uint n = _M.getNumRows( );
+	const uint k = acadoMin( (int) n,(int) _M.getNumCols( ) );
+
+	// M' = Q*R implies M*M' = R'*R
+	HouseholderQR< MatrixXd > qr( _M.transpose( ) );
+	MatrixXd R = qr.matrixQR( ).topRows( k ).triangularView<Upper>( );
+
+	_L.init( n,n );
+	_L.leftCols( k ) = R.transpose( );
+
+	// normalise to a nonnegative diagonal
+	for( uint j=0; j<k; ++j )
+		if ( _L( j,j ) < 0.0 )
+			_L.col( j ) *= -1.0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue KalmanFilter::updateCholesky(	DMatrix& _L,
+											DVector _v,
+											double sign
+											)
+{
+	const uint n = _L.getNumRows( );
+
+	for( uint k=0; k<n; ++k )
+	{
+		// a vanishing pivot leaves the direction unchanged
+		if ( _L( k,k ) <= EPS )
+		{
+			if ( fabs( _v( k ) ) > sqrt( EPS ) )
+				return RET_MATRIX_NOT_SPD;
+			continue;
+		}
+
+		double r2 = _L( k,k )*_L( k,k ) + sign*_v( k )*_v( k );
+
+		if ( r2 <= 0.0 )
+			return RET_MATRIX_NOT_SPD;
+
+		double r = sqrt( r2 );
+		double c = r / _L( k,k );
+		double s = _v( k ) / _L( k,k );
+
+		_L( k,k ) = r;
+
+		for( uint i=k+1; i<n; ++i )
+		{
+			_L( i,k ) = ( _L( i,k ) + sign*s*_v( i ) ) / c;
+			_v( i )   = c*_v( i ) - s*_L( i,k );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
 
 
 CLOSE_NAMESPACE_ACADO
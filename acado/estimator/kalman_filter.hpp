@@ -36,6 +36,8 @@
 
 #include <acado/utils/acado_utils.hpp>
 #include <acado/estimator/estimator.hpp>
+#include <acado/dynamic_system/dynamic_system.hpp>
+#include <acado/integrator/integrator.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -46,7 +48,24 @@ BEGIN_NAMESPACE_ACADO
  *
  *	\ingroup UserInterfaces
  *
- *  The class KalmanFilter provides a Kalman filter for state estimation.
+ *  The class KalmanFilter provides an extended or unscented Kalman filter for
+ *	estimating the differential states of a DynamicSystem from its outputs.
+ *
+ *	The states are predicted by integrating the DifferentialEquation of the
+ *	dynamic system over each sampling interval, using the controls which have
+ *	been passed via setU( ) (the Controller does so after each feedback step).
+ *	The extended Kalman filter linearises the prediction by the forward
+ *	sensitivities of the integrator and the measurement by automatic
+ *	differentiation of the OutputFcn; the unscented Kalman filter propagates
+ *	2*nx+1 sigma points instead. The output function defaults to the full state
+ *	if the dynamic system does not define one.
+ *
+ *	The covariance of the estimate is kept in square-root form P = S*S',
+ *	with S lower triangular, and is updated by orthogonal transformations
+ *	(and Cholesky downdates for the unscented filter) only.
+ *
+ *	\note The process noise covariance is added once per sampling interval.
+ *	\note Algebraic states are not supported.
  *
  *	\author Hans Joachim Ferreau, Boris Houska
  */
@@ -60,6 +79,19 @@ class KalmanFilter : public Estimator
         KalmanFilter(	double _samplingTime = DEFAULT_SAMPLING_TIME
 						);
 
+		/** Constructor taking the dynamic system whose states are estimated.
+		 *
+		 *	@param[in] _dynamicSystem		Dynamic system (without algebraic states).
+		 *	@param[in] _samplingTime		Sampling time.
+		 *	@param[in] _filterType			Variant of the Kalman filter.
+		 *	@param[in] _integratorType		Integrator used for the prediction.
+		 */
+        KalmanFilter(	const DynamicSystem& _dynamicSystem,
+						double _samplingTime = DEFAULT_SAMPLING_TIME,
+						KalmanFilterType _filterType = KFT_EXTENDED,
+						IntegratorType _integratorType = INT_RK45
+						);
+
         /** Copy constructor (deep copy). */
         KalmanFilter( const KalmanFilter& rhs );
 
@@ -72,6 +104,52 @@ class KalmanFilter : public Estimator
 		virtual Estimator* clone( ) const;
 
 
+		/** Sets the dynamic system whose states are estimated.
+		 *
+		 *	@param[in] _dynamicSystem		Dynamic system (without algebraic states).
+		 *	@param[in] _integratorType		Integrator used for the prediction.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue setDynamicSystem(	const DynamicSystem& _dynamicSystem,
+										IntegratorType _integratorType = INT_RK45
+										);
+
+		/** Sets the covariance of the process noise, accumulated over one sampling interval.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue setProcessNoiseCovariance(	const DMatrix& _Q
+												);
+
+		/** Sets the covariance of the measurement noise.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue setMeasurementNoiseCovariance(	const DMatrix& _R
+													);
+
+		/** Sets the covariance of the initial state estimate.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue setInitialCovariance(	const DMatrix& _P0
+											);
+
+		/** Returns the covariance of the current state estimate.
+		 *
+		 *	@param[out] _P		Covariance of the state estimate.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue getCovariance(	DMatrix& _P
+									) const;
+
+
         /** Initialization. */
         virtual returnValue init(	double startTime = 0.0,
 									const DVector &x0_ = emptyConstVector,
@@ -84,17 +162,88 @@ class KalmanFilter : public Estimator
 									);
 
 
+		/** Returns number of process outputs.
+		 *  \return Number of process outputs */
+		virtual uint getNY( ) const;
+
+
    //
     // PROTECTED MEMBER FUNCTIONS:
     //
     protected:
 
+		/** Sets-up default options.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue setupOptions( );
+
+		/** Allocates the integrator of the given type. */
+		returnValue allocateIntegrator(	IntegratorType _integratorType
+										);
+
+		/** Integrates the differential equation from _t0 to _t1, using the
+		 *	current controls and parameters, and optionally returns the
+		 *	Jacobian of the final state w.r.t. the initial one. */
+		returnValue predictState(	double _t0,
+									double _t1,
+									const DVector& _x0,
+									DVector& _x1,
+									DMatrix* _A = 0
+									);
+
+		/** Evaluates the output function at the given state and optionally
+		 *	returns its Jacobian w.r.t. the state. */
+		returnValue evaluateOutput(	double _t,
+									const DVector& _x,
+									DVector& _y,
+									DMatrix* _H = 0
+									);
+
+		/** Prediction and measurement update of the extended Kalman filter. */
+		returnValue stepExtended(	double currentTime,
+									const DVector& _y
+									);
+
+		/** Prediction and measurement update of the unscented Kalman filter. */
+		returnValue stepUnscented(	double currentTime,
+									const DVector& _y
+									);
+
+		/** Returns the lower square-root factor of a positive semi-definite matrix. */
+		static returnValue getSquareRoot(	const DMatrix& _M,
+											DMatrix& _sqrtM
+											);
+
+		/** Returns the lower triangular factor L of L*L' = M*M'. */
+		static returnValue triangularise(	const DMatrix& _M,
+											DMatrix& _L
+											);
+
+		/** Replaces L by the Cholesky factor of L*L' + sign*v*v'. */
+		static returnValue updateCholesky(	DMatrix& _L,
+											DVector _v,
+											double sign
+											);
+
 
 
     //
     // DATA MEMBERS:
     //
     protected:
+		DynamicSystem* dynamicSystem;		/**< Dynamic system whose states are estimated. */
+		OutputFcn outputFcn;				/**< Output function of the dynamic system. */
+		Integrator* integrator;				/**< Integrator used for the prediction. */
+
+		KalmanFilterType filterType;		/**< Variant of the Kalman filter. */
+
+		DMatrix sqrtQ;						/**< Square-root of the process noise covariance. */
+		DMatrix sqrtR;						/**< Square-root of the measurement noise covariance. */
+		DMatrix sqrtP0;						/**< Square-root of the initial covariance. */
+		DMatrix S;							/**< Lower square-root factor of the current covariance. */
+
+		double lastTime;					/**< Time of the last estimate. */
 };
 
 
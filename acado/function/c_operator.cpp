@@ -41,7 +41,6 @@
 BEGIN_NAMESPACE_ACADO
 
 
-int COperator::counter = 0;
 
 COperator::COperator( ) :SmoothOperator( )
 {
@@ -54,7 +53,7 @@ COperator::COperator( ) :SmoothOperator( )
     idx          =  0;
 
     first        = BT_FALSE;
-    globalTypeID = counter ;
+    globalTypeID = SymbolicContext::current().getCOperatorID();
 
     nCount = 0;
 }
@@ -71,7 +70,7 @@ COperator::COperator( const CFunction &fcn, const Expression &arg, int component
     component = component_;
 
     first         = BT_FALSE;
-    globalTypeID  =  counter;
+    globalTypeID  =  SymbolicContext::current().getCOperatorID();
 
     idx =  new int[cFunction.getDim()];
 
@@ -113,7 +112,7 @@ COperator& COperator::operator=( const COperator &arg ){
 }
 
 
-int COperator::increaseID(){ return counter++; }
+int COperator::increaseID(){ return SymbolicContext::current().increaseCOperatorID(); }
 
 
 void COperator::copy( const COperator &arg ){
@@ -471,8 +471,7 @@ protected:
     BooleanType      first;   /**< Whether this compontent is evaluated first */
 
     int               *idx;   /**< variable index list                        */
-    int       globalTypeID;   /**< global ID of the C-Operator              */
-    static int     counter;   /**< counter of the C-Operators               */
+    int       globalTypeID;   /**< global ID of the C-Operator (within the symbolic context) */
 };
 
 
@@ -181,8 +181,8 @@ void EvaluationPoint::copyIdx( const uint &dim, const int *idx1, int **idx2 ){
 
     uint i;
     *idx2 = new int[dim];
-    for( i = 0; i < N; i++ )
-        *idx2[i] = idx1[i];
+    for( i = 0; i < dim; i++ )
+        (*idx2)[i] = idx1[i];
 }
 
 
@@ -287,6 +287,36 @@ returnValue Function::evaluate( int number, double *x, double *_result ){
 
 
 
+returnValue Function::evaluateBatch( int number, const double *X, int nPoints, int ldx, double *F ){
+
+    return evaluationTree.evaluateBatch( number+memoryOffset, X, nPoints, ldx, F );
+}
+
+
+returnValue Function::evaluateBatch( const double *X, int nPoints, int ldx, double *F ){
+
+    return evaluateBatch( 0, X, nPoints, ldx, F );
+}
+
+
+returnValue Function::evaluateBatch( EvaluationPoint &x, const OCPiterate &iter, int nPoints,
+                                     DMatrix &F, int number ){
+
+    int run1;
+
+    const int N = (int) x.N;
+    std::vector<double> X( nPoints*N );
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        x.setZ( run1, iter );
+        memcpy( &X[run1*N], x.getEvaluationPointer(), N*sizeof(double) );
+    }
+
+    F.init( nPoints, getDim() );
+    return evaluateBatch( number, X.empty() ? 0 : &X[0], nPoints, N, F.data() );
+}
+
+
 returnValue Function::substitute( VariableType variableType_, int index_,
                                   double sub_ ){
 
@@ -316,6 +346,15 @@ BooleanType Function::isDependingOn( const Expression     &variable ){
     return evaluationTree.isDependingOn( variable );
 }
 
+returnValue Function::getDependencyPattern( int nn, VariableType *varType,
+                                            int *component, BooleanType *dependency ){
+
+    if( isSymbolic() == BT_FALSE )
+        return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+
+    return evaluationTree.getDependencyPattern( nn, varType, component, dependency );
+}
+
 BooleanType Function::isLinearIn( const Expression     &variable ){
 
     return evaluationTree.isLinearIn( variable );
@@ -438,6 +477,18 @@ returnValue Function::AD_backward( int number, double *seed, double  *df ){
 }
 
 
+returnValue Function::AD_forwardBatch( int number, const double *S, int nPoints, int lds, double *dF ){
+
+    return evaluationTree.AD_forwardBatch( number+memoryOffset, S, nPoints, lds, dF );
+}
+
+
+returnValue Function::AD_backwardBatch( int number, const double *seed, int nPoints, double *dX, int ldx ){
+
+    return evaluationTree.AD_backwardBatch( number+memoryOffset, seed, nPoints, dX, ldx );
+}
+
+
 returnValue Function::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
@@ -602,6 +653,11 @@ unsigned Function::getGlobalExportVariableSize( ) const
 	return evaluationTree.getGlobalExportVariableSize( );
 }
 
+returnValue Function::setTapeEnabled( BooleanType tapeEnabled_ )
+{
+	return evaluationTree.setTapeEnabled( tapeEnabled_ );
+}
+
 
 CLOSE_NAMESPACE_ACADO
 
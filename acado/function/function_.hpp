@@ -42,6 +42,7 @@ BEGIN_NAMESPACE_ACADO
 
 
 class EvaluationPoint;
+class OCPiterate;
 template <typename T> class TevaluationPoint;
 
 
@@ -239,6 +240,46 @@ public:
 
 
 
+    /** Evaluates the function at nPoints points, the i-th point   \n
+     *  being stored at X[i*ldx]. The results are stored in        \n
+     *  F[i*getDim()] and the intermediate results at the storage  \n
+     *  positions number, ..., number+nPoints-1, such that the     \n
+     *  AD routines can be called for each of these positions.     \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     * */
+    returnValue evaluateBatch( int           number  /**< first storage position */,
+                               const double *X       /**< the input points       */,
+                               int           nPoints /**< number of points       */,
+                               int           ldx     /**< leading dimension of X */,
+                               double       *F       /**< the results            */ );
+
+
+    /** Evaluates the function at nPoints points, storing the      \n
+     *  intermediate results at the positions 0, ..., nPoints-1.   \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     * */
+    returnValue evaluateBatch( const double *X       /**< the input points       */,
+                               int           nPoints /**< number of points       */,
+                               int           ldx     /**< leading dimension of X */,
+                               double       *F       /**< the results            */ );
+
+
+    /** Evaluates the function at the first nPoints points of an   \n
+     *  OCP iterate (using x as the evaluation point) and stores   \n
+     *  the results in F, one row per point. The intermediate      \n
+     *  results are stored at the positions number, ...,           \n
+     *  number+nPoints-1.                                          \n
+     *                                                             \n
+     *  \return SUCCESFUL_RETURN or the error of the evaluation    \n
+     */
+    returnValue evaluateBatch( EvaluationPoint  &x           ,
+                               const OCPiterate &iter        ,
+                               int               nPoints     ,
+                               DMatrix          &F           ,
+                               int               number = 0   );
+
+
+
     /** Substitutes var(index) with the double sub.               \n
      *  \return The substituted expression.                       \n
      *
@@ -268,6 +309,20 @@ public:
      BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Determines for every component of the function whether   \n
+     *  it is structurally depending on (at least one of) the     \n
+     *  specified variables. The array dependency must have the   \n
+     *  dimension getDim().                                       \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS         \n
+     *
+     */
+     returnValue getDependencyPattern( int           nn        ,
+                                       VariableType *varType   ,
+                                       int          *component ,
+                                       BooleanType  *dependency );
+
+
 
     /** Checks whether the function is linear in                  \n
      *  (or not depending on)  var(index)                         \n
@@ -395,6 +450,33 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode at the storage   \n
+     *  positions number, ..., number+nPoints-1 (cf. evaluateBatch). \n
+     *  The seed of the i-th point is stored at S[i*lds], the result \n
+     *  at dF[i*getDim()].                                           \n
+     *  \return SUCCESFUL_RETURN                                     \n
+     */
+     returnValue AD_forwardBatch( int           number  /**< first storage position */,
+                                  const double *S       /**< the seeds              */,
+                                  int           nPoints /**< number of points       */,
+                                  int           lds     /**< leading dimension of S */,
+                                  double       *dF      /**< the results            */ );
+
+
+    /** Automatic Differentiation in backward mode at the storage   \n
+     *  positions number, ..., number+nPoints-1 (cf. evaluateBatch). \n
+     *  The seed of the i-th point is stored at seed[i*getDim()],    \n
+     *  the result is added to dX[i*ldx].                            \n
+     *  \return SUCCESFUL_RETURN                                     \n
+     */
+     returnValue AD_backwardBatch( int           number  /**< first storage position */,
+                                   const double *seed    /**< the seeds              */,
+                                   int           nPoints /**< number of points       */,
+                                   double       *dX      /**< the results            */,
+                                   int           ldx     /**< leading dimension of dX */ );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -511,6 +593,9 @@ public:
      /** Get size of the variable that holds intermediate values. */
      unsigned getGlobalExportVariableSize( ) const;
 
+     /** Enables (default) or disables the instruction tape of symbolic functions. */
+     returnValue setTapeEnabled( BooleanType tapeEnabled_ );
+
 // PROTECTED MEMBERS:
 // ------------------
 
@@ -0,0 +1,1097 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file   src/function/function_evaluation_tape.cpp
+ *    \date   2014
+ */
+
+
+#include <acado/function/function_evaluation_tape.hpp>
+#include <acado/symbolic_operator/operator.hpp>
+
+#include <cmath>
+#include <sstream>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Number of storage positions which are processed together by the \n
+ *  batched routines (one stripe of the structure-of-arrays storage). */
+static const int STRIPE = 8;
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+FunctionEvaluationTape::FunctionEvaluationTape( ){
+
+    nVariables = 0;
+    nSlots     = 0;
+    bufferSize = 0;
+    res        = -1;
+    compiled   = BT_FALSE;
+}
+
+
+FunctionEvaluationTape::~FunctionEvaluationTape( ){
+
+}
+
+
+returnValue FunctionEvaluationTape::compile( int nVariables_, int n_, Operator **sub, const int *subIndex,
+                                             int dim_, Operator **f ){
+
+    int run1;
+
+    instructions.clear();
+    input       .clear();
+    intermediate.clear();
+    output      .clear();
+    constantSlot.clear();
+    constant    .clear();
+    instructionCache.clear();
+    constantCache   .clear();
+    clearBuffer();
+
+    nVariables = nVariables_;
+    nSlots     = nVariables_;
+    compiled   = BT_TRUE;
+
+    constantIndex.assign( nVariables, -1 );
+
+    std::vector<BooleanType> isInput( nVariables, BT_FALSE );
+    std::vector<BooleanType> isIntermediate( nVariables, BT_FALSE );
+
+    for( run1 = 0; run1 < n_; run1++ ){
+
+        if( subIndex[run1] < 0 || subIndex[run1] >= nVariables ){
+            compiled = BT_FALSE;
+            break;
+        }
+
+        int tmp = record( *sub[run1] );
+        if( compiled == BT_FALSE )
+            break;
+
+        instructions.push_back( TapeInstruction() );
+        instructions.back().op   = TO_COPY;
+        instructions.back().res  = subIndex[run1];
+        instructions.back().arg1 = tmp;
+        instructions.back().arg2 = 0;
+
+        intermediate.push_back( subIndex[run1] );
+        isIntermediate[subIndex[run1]] = BT_TRUE;
+    }
+
+    for( run1 = 0; run1 < dim_ && compiled == BT_TRUE; run1++ )
+        output.push_back( record( *f[run1] ) );
+
+    instructionCache.clear();
+    constantCache   .clear();
+
+    if( compiled == BT_FALSE ){
+        instructions.clear();
+        output.clear();
+        intermediate.clear();
+        return RET_NOT_IMPLEMENTED_YET;
+    }
+
+    // collect the variables which are actually read by the tape:
+    for( run1 = 0; run1 < (int) instructions.size(); run1++ ){
+
+        const TapeInstruction &I = instructions[run1];
+
+        if( I.arg1 < nVariables && isIntermediate[I.arg1] == BT_FALSE )
+            isInput[I.arg1] = BT_TRUE;
+        if( I.op != TO_POWER_INT && I.op != TO_COPY && I.op < TO_ACOS &&
+            I.arg2 < nVariables && isIntermediate[I.arg2] == BT_FALSE )
+            isInput[I.arg2] = BT_TRUE;
+    }
+    for( run1 = 0; run1 < (int) output.size(); run1++ )
+        if( output[run1] < nVariables && isIntermediate[output[run1]] == BT_FALSE )
+            isInput[output[run1]] = BT_TRUE;
+
+    for( run1 = 0; run1 < nVariables; run1++ )
+        if( isInput[run1] == BT_TRUE )
+            input.push_back( run1 );
+
+    dvalues.assign( nSlots*STRIPE, 0.0 );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::evaluate( int number, double *x, double *result ){
+
+    int run1;
+
+    allocateStorage( number );
+    evaluatePosition( number, x, result );
+
+    const double *v = getValues( number );
+    for( run1 = 0; run1 < (int) intermediate.size(); run1++ )
+        x[intermediate[run1]] = v[intermediate[run1]*STRIPE];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::evaluate( int number, const double *X, int nPoints, int ldx, double *F ){
+
+    int run1 = 0;
+    const int dim = (int) output.size();
+
+    if( nPoints <= 0 )
+        return SUCCESSFUL_RETURN;
+
+    allocateStorage( number+nPoints-1 );
+
+    while( run1 < nPoints ){
+
+        if( (number+run1) % STRIPE == 0 && nPoints-run1 >= STRIPE ){
+            evaluateStripe( number+run1, &X[run1*ldx], ldx, &F[run1*dim] );
+            run1 += STRIPE;
+        }
+        else{
+            evaluatePosition( number+run1, &X[run1*ldx], &F[run1*dim] );
+            run1++;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, double *seed, double *df ){
+
+    int run1;
+
+    if( number >= bufferSize )
+        return ACADOERROR( RET_INDEX_OUT_OF_RANGE );
+
+    forwardPosition( number, seed, df );
+
+    const double *dv = &dvalues[0];
+    for( run1 = 0; run1 < (int) intermediate.size(); run1++ )
+        seed[intermediate[run1]] = dv[intermediate[run1]];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, const double *S, int nPoints, int lds, double *dF ){
+
+    int run1 = 0;
+    const int dim = (int) output.size();
+
+    if( number+nPoints > bufferSize )
+        return ACADOERROR( RET_INDEX_OUT_OF_RANGE );
+
+    while( run1 < nPoints ){
+
+        if( (number+run1) % STRIPE == 0 && nPoints-run1 >= STRIPE ){
+            forwardStripe( number+run1, &S[run1*lds], lds, &dF[run1*dim] );
+            run1 += STRIPE;
+        }
+        else{
+            forwardPosition( number+run1, &S[run1*lds], &dF[run1*dim] );
+            run1++;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_backward( int number, double *seed, double *df ){
+
+    int run1;
+
+    if( number >= bufferSize )
+        return ACADOERROR( RET_INDEX_OUT_OF_RANGE );
+
+    double *bv = &dvalues[0];
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        bv[run1] = 0.0;
+
+    for( run1 = 0; run1 < (int) intermediate.size(); run1++ )
+        bv[intermediate[run1]] = df[intermediate[run1]];
+
+    backwardPosition( number, seed );
+
+    for( run1 = 0; run1 < (int) intermediate.size(); run1++ )
+        df[intermediate[run1]] = bv[intermediate[run1]];
+
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        df[input[run1]] += bv[input[run1]];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_backward( int number, const double *seed, int nPoints, double *dX, int ldx ){
+
+    int run1 = 0, run2;
+    const int dim = (int) output.size();
+
+    if( number+nPoints > bufferSize )
+        return ACADOERROR( RET_INDEX_OUT_OF_RANGE );
+
+    double *bv = &dvalues[0];
+
+    while( run1 < nPoints ){
+
+        if( (number+run1) % STRIPE == 0 && nPoints-run1 >= STRIPE ){
+            backwardStripe( number+run1, &seed[run1*dim], &dX[run1*ldx], ldx );
+            run1 += STRIPE;
+        }
+        else{
+            for( run2 = 0; run2 < nSlots; run2++ )
+                bv[run2] = 0.0;
+
+            backwardPosition( number+run1, &seed[run1*dim] );
+
+            for( run2 = 0; run2 < (int) input.size(); run2++ )
+                dX[run1*ldx + input[run2]] += bv[input[run2]];
+            run1++;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType FunctionEvaluationTape::needsReplay( int number, double *x, double *seed, BooleanType &hasSeed ){
+
+    int run1;
+
+    hasSeed = BT_FALSE;
+
+    if( number >= bufferSize || treeValid[number] == BT_TRUE )
+        return BT_FALSE;
+
+    const double *v = getValues( number );
+    for( run1 = 0; run1 < nVariables; run1++ )
+        x[run1] = v[run1*STRIPE];
+
+    if( fseedValid[number] == BT_TRUE ){
+        const double *s = &fseed[number*nVariables];
+        for( run1 = 0; run1 < nVariables; run1++ )
+            seed[run1] = s[run1];
+        hasSeed = BT_TRUE;
+    }
+
+    treeValid[number] = BT_TRUE;
+
+    return BT_TRUE;
+}
+
+
+returnValue FunctionEvaluationTape::clearBuffer( ){
+
+    values       .clear();
+    partials     .clear();
+    partialsValid.clear();
+    fseed        .clear();
+    fseedValid   .clear();
+    treeValid    .clear();
+    bufferSize = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue FunctionEvaluationTape::exportCode( std::ostream &stream, const std::vector<std::string> &variableNames,
+                                                const char *auxName, const char *outName ) const{
+
+    int run1;
+
+    if( compiled == BT_FALSE )
+        return RET_UNABLE_TO_EXPORT_CODE;
+
+    std::vector<int> source, nUses, auxIndex;
+    analyzeExport( source, nUses, auxIndex );
+
+    for( run1 = 0; run1 < nVariables; run1++ )
+        if( nUses[run1] > 0 && source[run1] == run1 &&
+            ( run1 >= (int) variableNames.size() || variableNames[run1].empty() == true ) )
+            return RET_UNABLE_TO_EXPORT_CODE;
+
+    // C expression of each slot; the expressions of inlined results are
+    // moved into the (single) operation which uses them:
+    std::vector<std::string> expression( nSlots );
+
+    for( run1 = 0; run1 < nVariables; run1++ )
+        if( nUses[run1] > 0 && source[run1] == run1 )
+            expression[run1] = variableNames[run1];
+
+    for( run1 = 0; run1 < (int) constant.size(); run1++ ){
+        if( nUses[constantSlot[run1]] > 0 ){
+            std::stringstream ss;
+            ss.copyfmt( stream );
+            ss << "(real_t)(" << constant[run1] << ")";
+            expression[constantSlot[run1]] = ss.str();
+        }
+    }
+
+    for( run1 = 0; run1 < (int) instructions.size(); run1++ ){
+
+        const TapeInstruction &I = instructions[run1];
+
+        if( I.op == TO_COPY || nUses[I.res] == 0 )
+            continue;
+
+        std::string a, b;
+        const int   sa = source[I.arg1];
+
+        if( auxIndex[sa] >= 0 || constantIndex[sa] >= 0 || sa < nVariables ) a = expression[sa];
+        else a.swap( expression[sa] );
+
+        if( I.op < TO_ACOS && I.op != TO_POWER_INT ){
+            const int sb = source[I.arg2];
+            if( auxIndex[sb] >= 0 || constantIndex[sb] >= 0 || sb < nVariables ) b = expression[sb];
+            else b.swap( expression[sb] );
+        }
+
+        std::stringstream ss;
+
+        switch( I.op ){
+
+            case TO_ADDITION   : ss << "(" << a << "+" << b << ")"; break;
+            case TO_SUBTRACTION: ss << "(" << a << "-" << b << ")"; break;
+            case TO_PRODUCT    : ss << "(" << a << "*" << b << ")"; break;
+            case TO_QUOTIENT   : ss << "(" << a << "/" << b << ")"; break;
+
+            case TO_POWER:
+                 if( constantIndex[source[I.arg2]] >= 0 && acadoIsEqual( constant[constantIndex[source[I.arg2]]], 0.5 ) == BT_TRUE )
+                     ss << "(sqrt(" << a << "))";
+                 else if( constantIndex[source[I.arg2]] >= 0 && acadoIsEqual( constant[constantIndex[source[I.arg2]]], -0.5 ) == BT_TRUE )
+                     ss << "(1.0/sqrt(" << a << "))";
+                 else
+                     ss << "(pow(" << a << "," << b << "))";
+                 break;
+
+            case TO_POWER_INT:
+                 if( I.arg2 == 2 && ( sa < nVariables || auxIndex[sa] >= 0 ) )
+                     ss << "((" << a << ")*(" << a << "))";
+                 else
+                     ss << "(pow(" << a << "," << I.arg2 << "))";
+                 break;
+
+            case TO_ACOS: ss << "(acos(" << a << "))"; break;
+            case TO_ASIN: ss << "(asin(" << a << "))"; break;
+            case TO_ATAN: ss << "(atan(" << a << "))"; break;
+            case TO_COS : ss << "(cos("  << a << "))"; break;
+            case TO_EXP : ss << "(exp("  << a << "))"; break;
+            case TO_LOG : ss << "(log("  << a << "))"; break;
+            case TO_SIN : ss << "(sin("  << a << "))"; break;
+            case TO_TAN : ss << "(tan("  << a << "))"; break;
+
+            default: break;
+        }
+
+        if( auxIndex[I.res] >= 0 ){
+            stream << auxName << "[" << auxIndex[I.res] << "] = " << ss.str() << ";" << endl;
+
+            std::stringstream name;
+            name << auxName << "[" << auxIndex[I.res] << "]";
+            expression[I.res] = name.str();
+        }
+        else
+            expression[I.res] = ss.str();
+    }
+
+    stream << endl << "/* Compute outputs: */" << endl;
+
+    for( run1 = 0; run1 < (int) output.size(); run1++ )
+        stream << outName << "[" << run1 << "] = " << expression[source[output[run1]]] << ";" << endl;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int FunctionEvaluationTape::getNumberOfAuxiliaryVariables( ) const{
+
+    if( compiled == BT_FALSE )
+        return 0;
+
+    std::vector<int> source, nUses, auxIndex;
+    return analyzeExport( source, nUses, auxIndex );
+}
+
+
+void FunctionEvaluationTape::addition( Operator &arg1, Operator &arg2 ){
+
+    int a = record( arg1 );
+    int b = record( arg2 );
+    res = addInstruction( TO_ADDITION, a, b );
+}
+
+void FunctionEvaluationTape::subtraction( Operator &arg1, Operator &arg2 ){
+
+    int a = record( arg1 );
+    int b = record( arg2 );
+    res = addInstruction( TO_SUBTRACTION, a, b );
+}
+
+void FunctionEvaluationTape::product( Operator &arg1, Operator &arg2 ){
+
+    int a = record( arg1 );
+    int b = record( arg2 );
+    res = addInstruction( TO_PRODUCT, a, b );
+}
+
+void FunctionEvaluationTape::quotient( Operator &arg1, Operator &arg2 ){
+
+    int a = record( arg1 );
+    int b = record( arg2 );
+    res = addInstruction( TO_QUOTIENT, a, b );
+}
+
+void FunctionEvaluationTape::power( Operator &arg1, Operator &arg2 ){
+
+    int a = record( arg1 );
+    int b = record( arg2 );
+    res = addInstruction( TO_POWER, a, b );
+}
+
+void FunctionEvaluationTape::powerInt( Operator &arg1, int &arg2 ){
+
+    int a = record( arg1 );
+    res = addInstruction( TO_POWER_INT, a, arg2 );
+}
+
+void FunctionEvaluationTape::project( int &idx ){
+
+    if( idx < 0 || idx >= nVariables ){
+        compiled = BT_FALSE;
+        res = 0;
+        return;
+    }
+    res = idx;
+}
+
+void FunctionEvaluationTape::set( double &arg ){
+
+    res = addConstant( arg );
+}
+
+void FunctionEvaluationTape::Acos( Operator &arg ){ res = addInstruction( TO_ACOS, record( arg ), 0 ); }
+void FunctionEvaluationTape::Asin( Operator &arg ){ res = addInstruction( TO_ASIN, record( arg ), 0 ); }
+void FunctionEvaluationTape::Atan( Operator &arg ){ res = addInstruction( TO_ATAN, record( arg ), 0 ); }
+void FunctionEvaluationTape::Cos ( Operator &arg ){ res = addInstruction( TO_COS , record( arg ), 0 ); }
+void FunctionEvaluationTape::Exp ( Operator &arg ){ res = addInstruction( TO_EXP , record( arg ), 0 ); }
+void FunctionEvaluationTape::Log ( Operator &arg ){ res = addInstruction( TO_LOG , record( arg ), 0 ); }
+void FunctionEvaluationTape::Sin ( Operator &arg ){ res = addInstruction( TO_SIN , record( arg ), 0 ); }
+void FunctionEvaluationTape::Tan ( Operator &arg ){ res = addInstruction( TO_TAN , record( arg ), 0 ); }
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+int FunctionEvaluationTape::record( Operator &arg ){
+
+    if( compiled == BT_FALSE )
+        return 0;
+
+    // operators which do not support the visitor (e.g. nonsmooth
+    // operators) leave the result slot untouched:
+    res = -1;
+    arg.evaluate( this );
+
+    if( res < 0 ){
+        compiled = BT_FALSE;
+        return 0;
+    }
+    return res;
+}
+
+
+int FunctionEvaluationTape::addInstruction( TapeOperation op, int arg1, int arg2 ){
+
+    const BooleanType isBinary = ( op < TO_ACOS && op != TO_POWER_INT ) ? BT_TRUE : BT_FALSE;
+
+    const int ca = constantIndex[arg1];
+    const int cb = ( isBinary == BT_TRUE ) ? constantIndex[arg2] : -1;
+
+    // fold operations on constants:
+    if( ca >= 0 && ( isBinary == BT_FALSE || cb >= 0 ) )
+        return addConstant( evaluateOperation( op, constant[ca], cb >= 0 ? constant[cb] : 0.0, arg2 ) );
+
+    // eliminate neutral elements:
+    const NeutralElement a = isOneOrZero( arg1 );
+    const NeutralElement b = ( isBinary == BT_TRUE ) ? isOneOrZero( arg2 ) : NE_NEITHER_ONE_NOR_ZERO;
+
+    switch( op ){
+
+        case TO_ADDITION:
+             if( a == NE_ZERO ) return arg2;
+             if( b == NE_ZERO ) return arg1;
+             break;
+
+        case TO_SUBTRACTION:
+             if( b == NE_ZERO ) return arg1;
+             break;
+
+        case TO_PRODUCT:
+             if( a == NE_ZERO || b == NE_ZERO ) return addConstant( 0.0 );
+             if( a == NE_ONE ) return arg2;
+             if( b == NE_ONE ) return arg1;
+             break;
+
+        case TO_QUOTIENT:
+             if( a == NE_ZERO ) return addConstant( 0.0 );
+             if( b == NE_ONE  ) return arg1;
+             break;
+
+        case TO_POWER:
+             if( b == NE_ZERO ) return addConstant( 1.0 );
+             if( b == NE_ONE  ) return arg1;
+             break;
+
+        case TO_POWER_INT:
+             if( arg2 == 0 ) return addConstant( 1.0 );
+             if( arg2 == 1 ) return arg1;
+             break;
+
+        default:
+             break;
+    }
+
+    // merge common subexpressions (the arguments of commutative
+    // operations are sorted):
+    InstructionKey key( (int) op, std::pair<int,int>( arg1, arg2 ) );
+
+    if( ( op == TO_ADDITION || op == TO_PRODUCT ) && arg2 < arg1 )
+        key.second = std::pair<int,int>( arg2, arg1 );
+
+    std::map<InstructionKey,int>::const_iterator it = instructionCache.find( key );
+    if( it != instructionCache.end() )
+        return it->second;
+
+    TapeInstruction I;
+
+    I.op   = op;
+    I.res  = nSlots++;
+    I.arg1 = arg1;
+    I.arg2 = arg2;
+
+    instructions .push_back( I  );
+    constantIndex.push_back( -1 );
+    instructionCache[key] = I.res;
+
+    return I.res;
+}
+
+
+int FunctionEvaluationTape::addConstant( double value ){
+
+    // NaN and negative zero are never merged:
+    const BooleanType isMergeable = ( acadoIsNaN( value ) == BT_FALSE &&
+                                      ( acadoIsExactlyZero( value ) == BT_FALSE || 1.0/value > 0.0 ) ) ? BT_TRUE : BT_FALSE;
+
+    if( isMergeable == BT_TRUE ){
+
+        std::map<double,int>::const_iterator it = constantCache.find( value );
+        if( it != constantCache.end() )
+            return it->second;
+        constantCache[value] = nSlots;
+    }
+
+    constantSlot .push_back( nSlots );
+    constant     .push_back( value  );
+    constantIndex.push_back( (int) constant.size()-1 );
+
+    return nSlots++;
+}
+
+
+NeutralElement FunctionEvaluationTape::isOneOrZero( int slot ) const{
+
+    if( constantIndex[slot] < 0 )
+        return NE_NEITHER_ONE_NOR_ZERO;
+
+    const double value = constant[constantIndex[slot]];
+
+    if( acadoIsExactlyZero( value     ) == BT_TRUE ) return NE_ZERO;
+    if( acadoIsExactlyZero( value-1.0 ) == BT_TRUE ) return NE_ONE ;
+
+    return NE_NEITHER_ONE_NOR_ZERO;
+}
+
+
+double FunctionEvaluationTape::evaluateOperation( TapeOperation op, double a, double b, int exponent ){
+
+    switch( op ){
+
+        case TO_COPY       : return a;
+        case TO_ADDITION   : return a + b;
+        case TO_SUBTRACTION: return a - b;
+        case TO_PRODUCT    : return a * b;
+        case TO_QUOTIENT   : return a / b;
+        case TO_POWER      : return pow( a, b );
+        case TO_POWER_INT  : return pow( a, exponent );
+        case TO_ACOS       : return acos( a );
+        case TO_ASIN       : return asin( a );
+        case TO_ATAN       : return atan( a );
+        case TO_COS        : return cos ( a );
+        case TO_EXP        : return exp ( a );
+        case TO_LOG        : return log ( a );
+        case TO_SIN        : return sin ( a );
+        case TO_TAN        : return tan ( a );
+    }
+    return 0.0;
+}
+
+
+int FunctionEvaluationTape::analyzeExport( std::vector<int> &source, std::vector<int> &nUses,
+                                           std::vector<int> &auxIndex ) const{
+
+    int run1;
+    int nAux = 0;
+
+    source  .resize( nSlots );
+    nUses   .assign( nSlots, 0  );
+    auxIndex.assign( nSlots, -1 );
+
+    // intermediate states are replaced by the slots they are copied from:
+    for( run1 = 0; run1 < nSlots; run1++ )
+        source[run1] = run1;
+
+    for( run1 = 0; run1 < (int) instructions.size(); run1++ )
+        if( instructions[run1].op == TO_COPY )
+            source[instructions[run1].res] = source[instructions[run1].arg1];
+
+    // count the uses of all results which contribute to the outputs:
+    for( run1 = 0; run1 < (int) output.size(); run1++ )
+        nUses[source[output[run1]]]++;
+
+    for( run1 = (int) instructions.size()-1; run1 >= 0; run1-- ){
+
+        const TapeInstruction &I = instructions[run1];
+
+        if( I.op == TO_COPY || nUses[I.res] == 0 )
+            continue;
+
+        nUses[source[I.arg1]]++;
+        if( I.op < TO_ACOS && I.op != TO_POWER_INT )
+            nUses[source[I.arg2]]++;
+    }
+
+    // results which are used more than once are stored:
+    for( run1 = 0; run1 < (int) instructions.size(); run1++ ){
+
+        const TapeInstruction &I = instructions[run1];
+
+        if( I.op != TO_COPY && nUses[I.res] > 1 )
+            auxIndex[I.res] = nAux++;
+    }
+
+    return nAux;
+}
+
+
+void FunctionEvaluationTape::allocateStorage( int number ){
+
+    int run1, run2;
+
+    if( number < bufferSize )
+        return;
+
+    // the storage is organized in stripes of STRIPE consecutive positions,
+    // each slot of a stripe being contiguous (structure of arrays):
+    int oldSize = bufferSize;
+    bufferSize  = ( (bufferSize+number)/STRIPE + 1 )*STRIPE;
+
+    values       .resize( bufferSize*nSlots, 0.0 );
+    partials     .resize( 2*bufferSize*instructions.size(), 0.0 );
+    partialsValid.resize( bufferSize, BT_FALSE );
+    fseed        .resize( bufferSize*nVariables, 0.0 );
+    fseedValid   .resize( bufferSize, BT_FALSE );
+    treeValid    .resize( bufferSize, BT_FALSE );
+
+    for( run1 = oldSize; run1 < bufferSize; run1++ ){
+        double *v = getValues( run1 );
+        for( run2 = 0; run2 < (int) constant.size(); run2++ )
+            v[constantSlot[run2]*STRIPE] = constant[run2];
+    }
+
+    if( (int) dvalues.size() < nSlots*STRIPE )
+        dvalues.assign( nSlots*STRIPE, 0.0 );
+}
+
+
+double* FunctionEvaluationTape::getValues( int number ){
+
+    return &values[ (number/STRIPE)*nSlots*STRIPE + number%STRIPE ];
+}
+
+
+double* FunctionEvaluationTape::getPartials( int number ){
+
+    if( instructions.empty() == true )
+        return 0;
+
+    return &partials[ (number/STRIPE)*2*instructions.size()*STRIPE + number%STRIPE ];
+}
+
+
+void FunctionEvaluationTape::evaluatePosition( int number, const double *x, double *result ){
+
+    int run1;
+
+    double *v = getValues( number );
+
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        v[input[run1]*STRIPE] = x[input[run1]];
+
+    const TapeInstruction *I    = instructions.empty() ? 0 : &instructions[0];
+    const int              nIns = (int) instructions.size();
+
+    for( run1 = 0; run1 < nIns; run1++ ){
+
+        const double a = v[I[run1].arg1*STRIPE];
+        double      &r = v[I[run1].res *STRIPE];
+
+        switch( I[run1].op ){
+
+            case TO_COPY       : r = a;                               break;
+            case TO_ADDITION   : r = a + v[I[run1].arg2*STRIPE];      break;
+            case TO_SUBTRACTION: r = a - v[I[run1].arg2*STRIPE];      break;
+            case TO_PRODUCT    : r = a * v[I[run1].arg2*STRIPE];      break;
+            case TO_QUOTIENT   : r = a / v[I[run1].arg2*STRIPE];      break;
+            case TO_POWER      : r = pow( a, v[I[run1].arg2*STRIPE] ); break;
+            case TO_POWER_INT  : r = pow( a, I[run1].arg2 );          break;
+            case TO_ACOS       : r = acos( a );                       break;
+            case TO_ASIN       : r = asin( a );                       break;
+            case TO_ATAN       : r = atan( a );                       break;
+            case TO_COS        : r = cos ( a );                       break;
+            case TO_EXP        : r = exp ( a );                       break;
+            case TO_LOG        : r = log ( a );                       break;
+            case TO_SIN        : r = sin ( a );                       break;
+            case TO_TAN        : r = tan ( a );                       break;
+        }
+    }
+
+    for( run1 = 0; run1 < (int) output.size(); run1++ )
+        result[run1] = v[output[run1]*STRIPE];
+
+    partialsValid[number] = BT_FALSE;
+    fseedValid   [number] = BT_FALSE;
+    treeValid    [number] = BT_FALSE;
+}
+
+
+void FunctionEvaluationTape::evaluateStripe( int number, const double *X, int ldx, double *F ){
+
+    int run1, run2;
+
+    const int dim = (int) output.size();
+    double   *v   = getValues( number );
+
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        for( run2 = 0; run2 < STRIPE; run2++ )
+            v[input[run1]*STRIPE+run2] = X[run2*ldx + input[run1]];
+
+    const TapeInstruction *I    = instructions.empty() ? 0 : &instructions[0];
+    const int              nIns = (int) instructions.size();
+
+    for( run1 = 0; run1 < nIns; run1++ ){
+
+        const double *a = &v[I[run1].arg1*STRIPE];
+        const double *b = &v[( I[run1].op == TO_POWER_INT ? I[run1].arg1 : I[run1].arg2 )*STRIPE];
+        double       *r = &v[I[run1].res *STRIPE];
+
+        switch( I[run1].op ){
+
+            case TO_COPY       : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = a[run2];                   break;
+            case TO_ADDITION   : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = a[run2] + b[run2];         break;
+            case TO_SUBTRACTION: for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = a[run2] - b[run2];         break;
+            case TO_PRODUCT    : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = a[run2] * b[run2];         break;
+            case TO_QUOTIENT   : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = a[run2] / b[run2];         break;
+            case TO_POWER      : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = pow( a[run2], b[run2] );   break;
+            case TO_POWER_INT  : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = pow( a[run2], I[run1].arg2 ); break;
+            case TO_ACOS       : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = acos( a[run2] );           break;
+            case TO_ASIN       : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = asin( a[run2] );           break;
+            case TO_ATAN       : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = atan( a[run2] );           break;
+            case TO_COS        : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = cos ( a[run2] );           break;
+            case TO_EXP        : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = exp ( a[run2] );           break;
+            case TO_LOG        : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = log ( a[run2] );           break;
+            case TO_SIN        : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = sin ( a[run2] );           break;
+            case TO_TAN        : for( run2 = 0; run2 < STRIPE; run2++ ) r[run2] = tan ( a[run2] );           break;
+        }
+    }
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 < STRIPE; run2++ )
+            F[run2*dim + run1] = v[output[run1]*STRIPE+run2];
+
+    for( run2 = 0; run2 < STRIPE; run2++ ){
+        partialsValid[number+run2] = BT_FALSE;
+        fseedValid   [number+run2] = BT_FALSE;
+        treeValid    [number+run2] = BT_FALSE;
+    }
+}
+
+
+void FunctionEvaluationTape::forwardPosition( int number, const double *seed, double *df ){
+
+    int run1;
+
+    determinePartials( number );
+
+    double       *dv = &dvalues[0];
+    const double *p  = getPartials( number );
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        dv[run1] = 0.0;
+
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        dv[input[run1]] = seed[input[run1]];
+
+    const TapeInstruction *I    = instructions.empty() ? 0 : &instructions[0];
+    const int              nIns = (int) instructions.size();
+
+    for( run1 = 0; run1 < nIns; run1++ ){
+
+        if( I[run1].op == TO_COPY ){
+            dv[I[run1].res] = dv[I[run1].arg1];
+        }
+        else if( I[run1].op < TO_POWER_INT ){
+            dv[I[run1].res] = p[2*run1*STRIPE]*dv[I[run1].arg1] + p[(2*run1+1)*STRIPE]*dv[I[run1].arg2];
+        }
+        else{
+            dv[I[run1].res] = p[2*run1*STRIPE]*dv[I[run1].arg1];
+        }
+    }
+
+    for( run1 = 0; run1 < (int) output.size(); run1++ )
+        df[run1] = dv[output[run1]];
+
+    // the tree needs the first order direction for its second order sweeps:
+    double *s = &fseed[number*nVariables];
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        s[input[run1]] = seed[input[run1]];
+
+    fseedValid[number] = BT_TRUE;
+    treeValid [number] = BT_FALSE;
+}
+
+
+void FunctionEvaluationTape::forwardStripe( int number, const double *S, int lds, double *dF ){
+
+    int run1, run2;
+
+    const int dim = (int) output.size();
+
+    for( run2 = 0; run2 < STRIPE; run2++ )
+        determinePartials( number+run2 );
+
+    double       *dv = &dvalues[0];
+    const double *p  = getPartials( number );
+
+    for( run1 = 0; run1 < nSlots*STRIPE; run1++ )
+        dv[run1] = 0.0;
+
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        for( run2 = 0; run2 < STRIPE; run2++ )
+            dv[input[run1]*STRIPE+run2] = S[run2*lds + input[run1]];
+
+    const TapeInstruction *I    = instructions.empty() ? 0 : &instructions[0];
+    const int              nIns = (int) instructions.size();
+
+    for( run1 = 0; run1 < nIns; run1++ ){
+
+        const double *da = &dv[I[run1].arg1*STRIPE];
+        const double *db = &dv[( I[run1].op == TO_POWER_INT ? I[run1].arg1 : I[run1].arg2 )*STRIPE];
+        double       *dr = &dv[I[run1].res *STRIPE];
+        const double *p1 = &p[ 2*run1   *STRIPE];
+        const double *p2 = &p[(2*run1+1)*STRIPE];
+
+        if( I[run1].op == TO_COPY ){
+            for( run2 = 0; run2 < STRIPE; run2++ ) dr[run2] = da[run2];
+        }
+        else if( I[run1].op < TO_POWER_INT ){
+            for( run2 = 0; run2 < STRIPE; run2++ ) dr[run2] = p1[run2]*da[run2] + p2[run2]*db[run2];
+        }
+        else{
+            for( run2 = 0; run2 < STRIPE; run2++ ) dr[run2] = p1[run2]*da[run2];
+        }
+    }
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 < STRIPE; run2++ )
+            dF[run2*dim + run1] = dv[output[run1]*STRIPE+run2];
+
+    for( run2 = 0; run2 < STRIPE; run2++ ){
+        double *s = &fseed[(number+run2)*nVariables];
+        for( run1 = 0; run1 < (int) input.size(); run1++ )
+            s[input[run1]] = S[run2*lds + input[run1]];
+        fseedValid[number+run2] = BT_TRUE;
+        treeValid [number+run2] = BT_FALSE;
+    }
+}
+
+
+void FunctionEvaluationTape::backwardPosition( int number, const double *seed ){
+
+    int run1;
+
+    determinePartials( number );
+
+    double       *bv = &dvalues[0];
+    const double *p  = getPartials( number );
+
+    for( run1 = 0; run1 < (int) output.size(); run1++ )
+        bv[output[run1]] += seed[run1];
+
+    const TapeInstruction *I = instructions.empty() ? 0 : &instructions[0];
+
+    for( run1 = (int) instructions.size()-1; run1 >= 0; run1-- ){
+
+        const double b = bv[I[run1].res];
+        if( acadoIsExactlyZero( b ) == BT_TRUE ) continue;
+
+        if( I[run1].op == TO_COPY ){
+            bv[I[run1].arg1] += b;
+        }
+        else if( I[run1].op < TO_POWER_INT ){
+            bv[I[run1].arg1] += p[ 2*run1   *STRIPE]*b;
+            bv[I[run1].arg2] += p[(2*run1+1)*STRIPE]*b;
+        }
+        else{
+            bv[I[run1].arg1] += p[2*run1*STRIPE]*b;
+        }
+    }
+}
+
+
+void FunctionEvaluationTape::backwardStripe( int number, const double *seed, double *dX, int ldx ){
+
+    int run1, run2;
+
+    const int dim = (int) output.size();
+
+    for( run2 = 0; run2 < STRIPE; run2++ )
+        determinePartials( number+run2 );
+
+    double       *bv = &dvalues[0];
+    const double *p  = getPartials( number );
+
+    for( run1 = 0; run1 < nSlots*STRIPE; run1++ )
+        bv[run1] = 0.0;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 < STRIPE; run2++ )
+            bv[output[run1]*STRIPE+run2] += seed[run2*dim + run1];
+
+    const TapeInstruction *I = instructions.empty() ? 0 : &instructions[0];
+
+    for( run1 = (int) instructions.size()-1; run1 >= 0; run1-- ){
+
+        double       *ba = &bv[I[run1].arg1*STRIPE];
+        double       *bb = &bv[( I[run1].op == TO_POWER_INT ? I[run1].arg1 : I[run1].arg2 )*STRIPE];
+        const double *br = &bv[I[run1].res *STRIPE];
+        const double *p1 = &p[ 2*run1   *STRIPE];
+        const double *p2 = &p[(2*run1+1)*STRIPE];
+
+        if( I[run1].op == TO_COPY ){
+            for( run2 = 0; run2 < STRIPE; run2++ ) ba[run2] += br[run2];
+        }
+        else if( I[run1].op < TO_POWER_INT ){
+            for( run2 = 0; run2 < STRIPE; run2++ ) ba[run2] += p1[run2]*br[run2];
+            for( run2 = 0; run2 < STRIPE; run2++ ) bb[run2] += p2[run2]*br[run2];
+        }
+        else{
+            for( run2 = 0; run2 < STRIPE; run2++ ) ba[run2] += p1[run2]*br[run2];
+        }
+    }
+
+    for( run1 = 0; run1 < (int) input.size(); run1++ )
+        for( run2 = 0; run2 < STRIPE; run2++ )
+            dX[run2*ldx + input[run1]] += bv[input[run1]*STRIPE+run2];
+}
+
+
+void FunctionEvaluationTape::determinePartials( int number ){
+
+    int run1;
+
+    if( partialsValid[number] == BT_TRUE )
+        return;
+
+    const double          *v    = getValues( number );
+    double                *p    = getPartials( number );
+    const TapeInstruction *I    = instructions.empty() ? 0 : &instructions[0];
+    const int              nIns = (int) instructions.size();
+
+    for( run1 = 0; run1 < nIns; run1++ ){
+
+        const double a  = v[I[run1].arg1*STRIPE];
+        const double r  = v[I[run1].res *STRIPE];
+        double      &p1 = p[ 2*run1   *STRIPE];
+        double      &p2 = p[(2*run1+1)*STRIPE];
+
+        switch( I[run1].op ){
+
+            case TO_COPY       : p1 = 1.0; p2 =  0.0;                                     break;
+            case TO_ADDITION   : p1 = 1.0; p2 =  1.0;                                     break;
+            case TO_SUBTRACTION: p1 = 1.0; p2 = -1.0;                                     break;
+            case TO_PRODUCT    : p1 = v[I[run1].arg2*STRIPE]; p2 = a;                     break;
+            case TO_QUOTIENT   : p1 = 1.0/v[I[run1].arg2*STRIPE];
+                                 p2 = -r/v[I[run1].arg2*STRIPE];                          break;
+            case TO_POWER      : p1 = v[I[run1].arg2*STRIPE]*pow( a, v[I[run1].arg2*STRIPE]-1.0 );
+                                 p2 = r*log( a );                                         break;
+            case TO_POWER_INT  : p1 = I[run1].arg2*pow( a, I[run1].arg2-1 );              break;
+            case TO_ACOS       : p1 = -1.0/sqrt( 1.0-a*a );                               break;
+            case TO_ASIN       : p1 =  1.0/sqrt( 1.0-a*a );                               break;
+            case TO_ATAN       : p1 =  1.0/( 1.0+a*a );                                   break;
+            case TO_COS        : p1 = -sin( a );                                          break;
+            case TO_EXP        : p1 =  r;                                                 break;
+            case TO_LOG        : p1 =  1.0/a;                                             break;
+            case TO_SIN        : p1 =  cos( a );                                          break;
+            case TO_TAN        : p1 =  1.0+r*r;                                           break;
+        }
+    }
+
+    partialsValid[number] = BT_TRUE;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,365 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/function_evaluation_tape.hpp
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+#define ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/evaluation_base.hpp>
+
+#include <vector>
+#include <map>
+#include <string>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *  \brief Flat instruction tape for the numeric evaluation of a FunctionEvaluationTree.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class FunctionEvaluationTape linearizes the intermediate expressions and
+ *  the components of a FunctionEvaluationTree into a topologically sorted list of
+ *  scalar instructions which operate on a contiguous array of slots. The first
+ *  slots coincide with the variables of the tree, such that the tape can be
+ *  evaluated on the same argument vectors as the tree. Forward and backward
+ *  automatic differentiation are single sweeps over the same instruction list.
+ *
+ *  As the tree, the tape stores its intermediate results for several storage
+ *  positions. The storage grows on demand, but no memory is allocated once all
+ *  storage positions have been visited. Consecutive positions are stored as
+ *  structure of arrays, such that several points can be evaluated and
+ *  differentiated with one pass over the tape.
+ *
+ *  While recording, common subexpressions are merged (hash-consing on the
+ *  operation and the argument slots), operations on constants are folded
+ *  and neutral elements (x+0, x*1, x*0, ...) are eliminated. The same tape
+ *  is used to export compact C code for the function.
+ */
+class FunctionEvaluationTape : public EvaluationBase{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    FunctionEvaluationTape( );
+
+    /** Destructor. */
+    virtual ~FunctionEvaluationTape( );
+
+
+    /** Records the tape for the given intermediate expressions and     \n
+     *  function components.                                            \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_NOT_IMPLEMENTED_YET (if an operator can not be taped) \n
+     */
+    returnValue compile( int        nVariables_ /**< number of variables          */,
+                         int        n_          /**< number of intermediates      */,
+                         Operator **sub         /**< the intermediate expressions */,
+                         const int *subIndex    /**< variable index of each intermediate */,
+                         int        dim_        /**< number of components         */,
+                         Operator **f           /**< the function components      */ );
+
+
+    /** Evaluates the tape and stores the intermediate results at the   \n
+     *  given storage position. The values of the intermediate states   \n
+     *  are written to x (as done by the tree).                         \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue evaluate( int     number    /**< storage position     */,
+                          double *x         /**< the input variable x */,
+                          double *result    /**< the result           */ );
+
+
+    /** Evaluates the tape at nPoints points, the i-th point being stored \n
+     *  at X[i*ldx]. The results are stored in F[i*dim] and the           \n
+     *  intermediate results at the positions number, ..., number+nPoints-1. \n
+     *  Aligned groups of points are processed together.                  \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     */
+    returnValue evaluate( int           number  /**< first storage position */,
+                          const double *X       /**< the input points       */,
+                          int           nPoints /**< number of points       */,
+                          int           ldx     /**< leading dimension of X */,
+                          double       *F       /**< the results            */ );
+
+
+    /** Forward sweep based on the results stored at the given position. \n
+     *  The directional derivatives of the intermediate states are       \n
+     *  written to seed (as done by the tree).                           \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     */
+    returnValue AD_forward( int     number  /**< storage position */,
+                            double *seed    /**< the seed         */,
+                            double *df      /**< the result       */ );
+
+
+    /** Forward sweeps at the positions number, ..., number+nPoints-1,    \n
+     *  the seed of the i-th point being stored at S[i*lds]. The results  \n
+     *  are stored in dF[i*dim].                                          \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     */
+    returnValue AD_forward( int           number  /**< first storage position */,
+                            const double *S       /**< the seeds              */,
+                            int           nPoints /**< number of points       */,
+                            int           lds     /**< leading dimension of S */,
+                            double       *dF      /**< the results            */ );
+
+
+    /** Backward sweep based on the results stored at the given position. \n
+     *  The result is added to df.                                        \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     */
+    returnValue AD_backward( int     number /**< storage position */,
+                             double *seed   /**< the seed         */,
+                             double *df     /**< the result       */ );
+
+
+    /** Backward sweeps at the positions number, ..., number+nPoints-1,   \n
+     *  the seed of the i-th point being stored at seed[i*dim]. The       \n
+     *  derivatives w.r.t. the variables are added to dX[i*ldx].          \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     */
+    returnValue AD_backward( int           number  /**< first storage position */,
+                             const double *seed    /**< the seeds              */,
+                             int           nPoints /**< number of points       */,
+                             double       *dX      /**< the results            */,
+                             int           ldx     /**< leading dimension of dX */ );
+
+
+    /** Returns whether the operator buffers of the tree have to be      \n
+     *  refilled before second order derivatives can be evaluated at    \n
+     *  the given position. In this case, the stored argument and the   \n
+     *  stored forward seed (if any) are copied to x and seed.          \n
+     */
+    BooleanType needsReplay( int          number  /**< storage position            */,
+                             double      *x       /**< output: the stored argument */,
+                             double      *seed    /**< output: the stored seed     */,
+                             BooleanType &hasSeed /**< output: seed available      */ );
+
+
+    /** Frees the storage of the intermediate results.  \n
+     *  \return SUCCESSFUL_RETURN                       \n
+     */
+    returnValue clearBuffer( );
+
+
+    /** Exports C code which evaluates the tape. Intermediate results  \n
+     *  which are used more than once are stored in auxiliary variables \n
+     *  auxName[0], auxName[1], ..., all other operations are inlined.  \n
+     *  Unused intermediate states are not exported.                     \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNABLE_TO_EXPORT_CODE (if a variable has no name)    \n
+     */
+    returnValue exportCode( std::ostream                   &stream        /**< the output stream        */,
+                            const std::vector<std::string> &variableNames /**< C name of each variable  */,
+                            const char                     *auxName       /**< auxiliary variable array */,
+                            const char                     *outName       /**< output array             */ ) const;
+
+
+    /** Returns the number of auxiliary variables of the exported code. */
+    int getNumberOfAuxiliaryVariables( ) const;
+
+
+    /** Returns whether the tape has been recorded successfully. */
+    inline BooleanType isCompiled( ) const;
+
+    /** Returns the number of instructions of the tape. */
+    inline int getNumberOfInstructions( ) const;
+
+
+    // VISITOR INTERFACE USED FOR RECORDING:
+    // -------------------------------------
+    virtual void addition   ( Operator &arg1, Operator &arg2 );
+    virtual void subtraction( Operator &arg1, Operator &arg2 );
+    virtual void product    ( Operator &arg1, Operator &arg2 );
+    virtual void quotient   ( Operator &arg1, Operator &arg2 );
+    virtual void power      ( Operator &arg1, Operator &arg2 );
+    virtual void powerInt   ( Operator &arg1, int      &arg2 );
+
+    virtual void project    ( int      &idx );
+    virtual void set        ( double   &arg );
+    virtual void Acos       ( Operator &arg );
+    virtual void Asin       ( Operator &arg );
+    virtual void Atan       ( Operator &arg );
+    virtual void Cos        ( Operator &arg );
+    virtual void Exp        ( Operator &arg );
+    virtual void Log        ( Operator &arg );
+    virtual void Sin        ( Operator &arg );
+    virtual void Tan        ( Operator &arg );
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Operation codes of the tape. */
+    enum TapeOperation{
+
+        TO_COPY,
+        TO_ADDITION,
+        TO_SUBTRACTION,
+        TO_PRODUCT,
+        TO_QUOTIENT,
+        TO_POWER,
+        TO_POWER_INT,
+        TO_ACOS,
+        TO_ASIN,
+        TO_ATAN,
+        TO_COS,
+        TO_EXP,
+        TO_LOG,
+        TO_SIN,
+        TO_TAN
+    };
+
+    /** A single instruction: slot[res] = op( slot[arg1], slot[arg2] ). */
+    struct TapeInstruction{
+
+        TapeOperation op  ;
+        int           res ;
+        int           arg1;
+        int           arg2;  /**< second argument slot or integer exponent */
+    };
+
+
+    /** Records the given operator and returns the slot of its result. */
+    int record( Operator &arg );
+
+    /** Key of an instruction for merging common subexpressions. */
+    typedef std::pair< int, std::pair<int,int> > InstructionKey;
+
+
+    /** Appends an instruction writing to a new slot and returns this slot. \n
+     *  If the instruction has been recorded before, can be evaluated at    \n
+     *  compile time or is trivial, no instruction is added.                \n
+     */
+    int addInstruction( TapeOperation op, int arg1, int arg2 );
+
+    /** Returns a slot holding the given constant. */
+    int addConstant( double value );
+
+    /** Returns whether the given slot holds the constant zero or one. */
+    NeutralElement isOneOrZero( int slot ) const;
+
+    /** Evaluates a single operation (used for constant folding). */
+    static double evaluateOperation( TapeOperation op, double a, double b, int exponent );
+
+    /** Determines for the code export the slot which actually holds the  \n
+     *  value of each slot (copies of intermediate states are resolved),   \n
+     *  the number of uses of each result and the auxiliary variable of    \n
+     *  each result (or -1 if it is inlined).                              \n
+     *  \return number of auxiliary variables                             \n
+     */
+    int analyzeExport( std::vector<int> &source,
+                       std::vector<int> &nUses,
+                       std::vector<int> &auxIndex ) const;
+
+    /** Makes sure that the given storage position is available. */
+    void allocateStorage( int number );
+
+    /** Returns the slot values of the given position (slot i is at index i*STRIPE). */
+    double* getValues( int number );
+
+    /** Returns the partials of the given position (same layout as the values). */
+    double* getPartials( int number );
+
+    /** Evaluates the tape at a single position. */
+    void evaluatePosition( int number, const double *x, double *result );
+
+    /** Evaluates the tape at a full stripe of positions starting at number. */
+    void evaluateStripe( int number, const double *X, int ldx, double *F );
+
+    /** Forward sweep at a single position (directions are kept in dvalues). */
+    void forwardPosition( int number, const double *seed, double *df );
+
+    /** Forward sweep at a full stripe of positions starting at number. */
+    void forwardStripe( int number, const double *S, int lds, double *dF );
+
+    /** Backward sweep at a single position; adds to the adjoints in dvalues. */
+    void backwardPosition( int number, const double *seed );
+
+    /** Backward sweep at a full stripe of positions starting at number. */
+    void backwardStripe( int number, const double *seed, double *dX, int ldx );
+
+    /** Evaluates the local partial derivatives of all instructions at the \n
+     *  given storage position (on demand).                                 \n
+     */
+    void determinePartials( int number );
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    std::vector<TapeInstruction> instructions;  /**< the instruction list                      */
+    std::vector<int>             input       ;  /**< variable slots read by the tape           */
+    std::vector<int>             intermediate;  /**< variable slots of the intermediate states */
+    std::vector<int>             output      ;  /**< result slot of each component             */
+    std::vector<int>             constantSlot;  /**< slots holding constants                   */
+    std::vector<double>          constant    ;  /**< values of the constants                   */
+    std::vector<int>             constantIndex; /**< index of the constant of each slot, or -1 */
+
+    std::map<InstructionKey,int> instructionCache;  /**< recorded instructions (only while recording) */
+    std::map<double,int>         constantCache   ;  /**< recorded constants (only while recording)    */
+
+    int          nVariables ;  /**< number of variable slots                */
+    int          nSlots     ;  /**< total number of slots                   */
+    int          bufferSize ;  /**< number of available storage positions   */
+    int          res        ;  /**< result slot of the last recorded operator */
+    BooleanType  compiled   ;  /**< whether the tape is valid               */
+
+    std::vector<double>      values       ;  /**< slot values, nSlots per position (striped) */
+    std::vector<double>      partials     ;  /**< two partials per instruction and position */
+    std::vector<BooleanType> partialsValid;  /**< whether the partials are up to date       */
+    std::vector<double>      fseed        ;  /**< last forward seed, nVariables per position */
+    std::vector<BooleanType> fseedValid   ;  /**< whether a forward seed has been stored    */
+    std::vector<BooleanType> treeValid    ;  /**< whether the tree buffers are up to date   */
+    std::vector<double>      dvalues      ;  /**< workspace for the AD sweeps               */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/function/function_evaluation_tape.ipp>
+
+
+#endif  // ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+
+// end of file.
@@ -53,6 +53,8 @@ FunctionEvaluationTree::FunctionEvaluationTree( ){
     indexList = new SymbolicIndexList();
     dim       =  0;
     n         =  0;
+    tape      =  0;
+    tapeEnabled = BT_TRUE;
 
     globalExportVariableName = "acado_aux";
 }
@@ -61,8 +63,10 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
 
     int run1;
 
-    dim = arg.dim;
-    n   = arg.n  ;
+    dim  = arg.dim;
+    n    = arg.n  ;
+    tape = 0      ;
+    tapeEnabled = arg.tapeEnabled;
 
     globalExportVariableName = arg.globalExportVariableName;
 
@@ -122,6 +126,7 @@ FunctionEvaluationTree::~FunctionEvaluationTree( ){
     }
 
     delete indexList;
+    clearTape();
 }
 
 
@@ -150,9 +155,11 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
         }
 
         delete indexList;
+        clearTape();
 
         dim = arg.dim;
         n   = arg.n  ;
+        tapeEnabled = arg.tapeEnabled;
 
         globalExportVariableName = arg.globalExportVariableName;
 
@@ -198,6 +205,8 @@ returnValue FunctionEvaluationTree::getExpression( Expression& expression ) cons
 
 returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
+    clearTape();
+
     safeCopy << arg;
 
     uint run1;
@@ -239,6 +248,9 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape->evaluate( 0, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
 
         sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
@@ -285,6 +297,9 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape->evaluate( number, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
                                                              lhs_comp[run1]         ) ] );
@@ -486,6 +501,24 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 }
 
 
+returnValue FunctionEvaluationTree::getDependencyPattern( int nn, VariableType *varType,
+                                                          int *component, BooleanType *dependency ){
+
+    int run1;
+    BooleanType *implicit_dep = new BooleanType[n];
+
+    for( run1 = 0; run1 < n; run1++ ){
+        implicit_dep[run1] = sub[run1]->isDependingOn( nn, varType, component, implicit_dep );
+    }
+    for( run1 = 0; run1 < dim; run1++ ){
+        dependency[run1] = f[run1]->isDependingOn( nn, varType, component, implicit_dep );
+    }
+
+    delete[] implicit_dep;
+    return SUCCESSFUL_RETURN;
+}
+
+
 BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
     int nn = variable.getDim();
@@ -716,11 +749,40 @@ CurvatureType FunctionEvaluationTree::getCurvature( ){
 
 
 
+returnValue FunctionEvaluationTree::evaluateBatch( int number, const double *X, int nPoints, int ldx, double *F ){
+
+    int run1, run2;
+
+    if( useTape() == BT_TRUE )
+        return tape->evaluate( number, X, nPoints, ldx, F );
+
+    const int nVars = indexList->getNumberOfVariables();
+    double   *x     = new double[nVars];
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < nPoints && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+        for( run2 = 0; run2 < nVars; run2++ )
+            x[run2] = X[run1*ldx+run2];
+        returnvalue = evaluate( number+run1, x, &F[run1*dim] );
+    }
+    delete[] x;
+
+    return returnvalue;
+}
+
+
+
 returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double *ff,
                                             double *df  ){
 
     int run1;
 
+    if( useTape() == BT_TRUE ){
+        tape->evaluate( 0, x, ff );
+        return tape->AD_forward( 0, seed, df );
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( 0, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -740,6 +802,11 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *s
 
     int run1;
 
+    if( useTape() == BT_TRUE ){
+        tape->evaluate( number, x, ff );
+        return tape->AD_forward( number, seed, df );
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -757,6 +824,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape->AD_forward( number, seed, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, seed,
                          &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
@@ -773,6 +843,9 @@ returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape->AD_backward( 0, seed, df );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( 0, seed[run1], df );
     }
@@ -794,6 +867,9 @@ returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, doubl
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape->AD_backward( number, seed, df );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( number, seed[run1], df );
     }
@@ -808,12 +884,55 @@ returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, doubl
 }
 
 
+returnValue FunctionEvaluationTree::AD_forwardBatch( int number, const double *S, int nPoints, int lds, double *dF ){
+
+    int run1, run2;
+
+    if( useTape() == BT_TRUE )
+        return tape->AD_forward( number, S, nPoints, lds, dF );
+
+    const int nVars = indexList->getNumberOfVariables();
+    double   *seed  = new double[nVars];
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        for( run2 = 0; run2 < nVars; run2++ )
+            seed[run2] = S[run1*lds+run2];
+        AD_forward( number+run1, seed, &dF[run1*dim] );
+    }
+    delete[] seed;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backwardBatch( int number, const double *seed, int nPoints, double *dX, int ldx ){
+
+    int run1, run2;
+
+    if( useTape() == BT_TRUE )
+        return tape->AD_backward( number, seed, nPoints, dX, ldx );
+
+    double *seed_ = new double[dim];
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        for( run2 = 0; run2 < dim; run2++ )
+            seed_[run2] = seed[run1*dim+run2];
+        AD_backward( number+run1, seed_, &dX[run1*ldx] );
+    }
+    delete[] seed_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
                                              double *dseed, double *df,
                                              double *ddf ){
 
     int run1;
 
+    synchronizeBuffers( number );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward2( number, seed, dseed,
                          &seed [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -832,6 +951,8 @@ returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, dou
 
     int run1;
 
+    synchronizeBuffers( number );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward2( number, seed1[run1], seed2[run1], df, ddf );
     }
@@ -955,9 +1076,18 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 		stream << "const " << realString << "* t = in + " << offset << ";" << endl;
 	offset += getNT();
 
-    if (n > 0)
+	// The tape merges common subexpressions and removes unused
+	// intermediate quantities; trees which can not be taped are
+	// exported directly.
+	const FunctionEvaluationTape* exportTape = getRecordedTape();
+	int nAux = n;
+
+	if ( exportTape != 0 )
+		nAux = exportTape->getNumberOfAuxiliaryVariables();
+
+    if (nAux > 0)
     {
-    	stream << "/* Vector of auxiliary variables; number of elements: " << n << ". */" << endl;
+    	stream << "/* Vector of auxiliary variables; number of elements: " << nAux << ". */" << endl;
 
     	if ( allocateMemory )
     	{
@@ -965,7 +1095,7 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
     		{
     			stream << "static ";
     		}
-    		stream << realString << " a[" << n << "];";
+    		stream << realString << " a[" << nAux << "];";
     	}
     	else
     		stream << realString << "* a = " << globalExportVariableName << ";";
@@ -974,6 +1104,25 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
     	stream << "/* Compute intermediate quantities: */" << endl;
     }
 
+	IoFormatter iof( stream );
+	iof.set(16, iof.width, ios::scientific);
+
+	if ( exportTape != 0 )
+	{
+		vector< string > variableNames;
+		getExportVariableNames( variableNames );
+
+		returnValue returnvalue = exportTape->exportCode(stream, variableNames, "a", "out");
+
+		iof.reset();
+		stream << "}" << endl << endl;
+
+		if ( returnvalue != SUCCESSFUL_RETURN )
+			return ACADOERROR( returnvalue );
+
+		return SUCCESSFUL_RETURN;
+	}
+
     vector< string > auxVarIndividualNames;
     auxVarIndividualNames.resize( nni );
 	for (run1 = 0; run1 < n; run1++)
@@ -983,9 +1132,6 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 		auxVarIndividualNames[ lhs_comp[ run1 ] ] = ss.str();
 	}
 
-	IoFormatter iof( stream );
-	iof.set(16, iof.width, ios::scientific);
-
 	// Export intermediate quantities
 	for (run1 = 0; run1 < n; run1++)
 	{
@@ -1013,11 +1159,42 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 }
 
 
+returnValue FunctionEvaluationTree::getExportVariableNames( std::vector< std::string >& names ) const
+{
+	const VariableType types[] = { VT_DIFFERENTIAL_STATE, VT_ALGEBRAIC_STATE, VT_CONTROL, VT_INTEGER_CONTROL,
+								   VT_PARAMETER, VT_ONLINE_DATA, VT_INTEGER_PARAMETER, VT_DISTURBANCE,
+								   VT_DDIFFERENTIAL_STATE, VT_TIME };
+	const char* prefix[] = { "xd", "xa", "u", "v", "p", "od", "q", "w", "dx", "t" };
+	const int number[] = { getNX(), getNXA(), getNU(), getNUI(), getNP(), getNOD(), getNPI(), getNW(), getNDX(), getNT() };
+
+	names.clear();
+	names.resize( getNumberOfVariables() );
+
+	for (unsigned i = 0; i < sizeof( types ) / sizeof( VariableType ); ++i)
+		for (int j = 0; j < number[ i ]; ++j)
+		{
+			int idx = index(types[ i ], j);
+
+			if (idx >= 0 && idx < (int)names.size())
+			{
+				stringstream ss;
+				ss << prefix[ i ] << "[" << j << "]";
+				names[ idx ] = ss.str();
+			}
+		}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue FunctionEvaluationTree::clearBuffer(){
 
     int run1;
     returnValue returnvalue;
 
+    if( tape != 0 )
+        tape->clearBuffer();
+
     for( run1 = 0; run1 < n; run1++ ){
         returnvalue = sub[run1]->clearBuffer();
         if( returnvalue != SUCCESSFUL_RETURN ){
@@ -1046,6 +1223,8 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
     int run1;
     int var_counter = indexList->makeImplicit(dim_);
 
+    clearTape();
+
     for( run1 = 0; run1 < dim_; run1++ ){
 
         Operator *tmp = f[run1]->clone();
@@ -1175,9 +1354,120 @@ std::string FunctionEvaluationTree::getGlobalExportVariableName() const
 
 unsigned FunctionEvaluationTree::getGlobalExportVariableSize() const
 {
+	// the exported code stores the common subexpressions of the tape:
+	const FunctionEvaluationTape* exportTape = getRecordedTape();
+
+	if ( exportTape != 0 )
+		return exportTape->getNumberOfAuxiliaryVariables();
+
 	return n;
 }
 
+returnValue FunctionEvaluationTree::setTapeEnabled( BooleanType tapeEnabled_ ){
+
+    tapeEnabled = tapeEnabled_;
+    clearTape();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+BooleanType FunctionEvaluationTree::useTape( ){
+
+    if( getRecordedTape() == 0 )
+        return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+const FunctionEvaluationTape* FunctionEvaluationTree::getRecordedTape( ) const{
+
+    if( tapeEnabled == BT_FALSE )
+        return 0;
+
+    if( tape == 0 ){
+
+        tape = new FunctionEvaluationTape();
+
+        if( isSymbolic() == BT_TRUE )
+            recordTape( *tape );
+    }
+
+    if( tape->isCompiled() == BT_FALSE )
+        return 0;
+
+    return tape;
+}
+
+
+void FunctionEvaluationTree::clearTape( ){
+
+    if( tape != 0 )
+        delete tape;
+    tape = 0;
+}
+
+
+returnValue FunctionEvaluationTree::recordTape( FunctionEvaluationTape &tape_ ) const{
+
+    int run1;
+
+    int *subIndex = new int[n];
+    for( run1 = 0; run1 < n; run1++ )
+        subIndex[run1] = indexList->index( VT_INTERMEDIATE_STATE, lhs_comp[run1] );
+
+    returnValue returnvalue = tape_.compile( indexList->getNumberOfVariables(), n, sub, subIndex, dim, f );
+    delete[] subIndex;
+
+    return returnvalue;
+}
+
+
+returnValue FunctionEvaluationTree::synchronizeBuffers( int number ){
+
+    int run1;
+
+    if( tape == 0 || tape->isCompiled() == BT_FALSE )
+        return SUCCESSFUL_RETURN;
+
+    // the scratch memory grows once and is kept for later calls
+    const int nVars = indexList->getNumberOfVariables();
+
+    if( (int) replayBuffer.size() < 2*nVars+1 )
+        replayBuffer.resize( 2*nVars+1 );
+
+    double      *x       = &replayBuffer[0];
+    double      *seed    = &replayBuffer[nVars];
+    double       result;
+    BooleanType  hasSeed;
+
+    if( tape->needsReplay( number, x, seed, hasSeed ) == BT_TRUE ){
+
+        for( run1 = 0; run1 < n; run1++ )
+            sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
+                                                                 lhs_comp[run1]         ) ] );
+        for( run1 = 0; run1 < dim; run1++ )
+            f[run1]->evaluate( number, x, &result );
+
+        if( hasSeed == BT_TRUE ){
+
+            for( run1 = 0; run1 < n; run1++ )
+                sub[run1]->AD_forward( number, seed,
+                                 &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
+            for( run1 = 0; run1 < dim; run1++ )
+                f[run1]->AD_forward( number, seed, &result );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
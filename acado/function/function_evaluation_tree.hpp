@@ -37,6 +37,7 @@
 #include <acado/symbolic_expression/expression.hpp>
 #include <acado/symbolic_operator/evaluation_template.hpp>
 #include <acado/symbolic_operator/symbolic_index_list.hpp>
+#include <acado/function/function_evaluation_tape.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -204,6 +205,19 @@ public:
 
 
 
+    /** Evaluates the expression at nPoints points, the i-th point \n
+     *  being stored at X[i*ldx]. The results are stored in        \n
+     *  F[i*dim] and the intermediate results at the storage       \n
+     *  positions number, ..., number+nPoints-1.                   \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     * */
+    virtual returnValue evaluateBatch( int           number  /**< first storage position */,
+                                       const double *X       /**< the input points       */,
+                                       int           nPoints /**< number of points       */,
+                                       int           ldx     /**< leading dimension of X */,
+                                       double       *F       /**< the results            */ );
+
+
     /** Returns the derivative of the expression with respect     \n
      *  to the variable var(index).                               \n
      *  \return The symbolic expression for the derivative.       \n
@@ -241,6 +255,19 @@ public:
      virtual BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Determines for every component of the symbolic expression \n
+     *  whether it is structurally depending on (at least one of)  \n
+     *  the specified variables. The result is written into the   \n
+     *  array dependency, which must have the dimension getDim().  \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *
+     */
+     virtual returnValue getDependencyPattern( int           nn        ,  /**< number of variables   */
+                                               VariableType *varType   ,  /**< the variable types    */
+                                               int          *component ,  /**< and their components  */
+                                               BooleanType  *dependency   /**< the result            */ );
+
+
     /** Checks whether the symbolic expression is linear in       \n
      *  a specified variable.                                     \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -364,6 +391,34 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode at the storage   \n
+     *  positions number, ..., number+nPoints-1 (cf. evaluateBatch). \n
+     *  The seed of the i-th point is stored at S[i*lds], the result \n
+     *  at dF[i*dim].                                                \n
+     *  \return SUCCESFUL_RETURN                                     \n
+     */
+     virtual returnValue AD_forwardBatch( int           number  /**< first storage position */,
+                                          const double *S       /**< the seeds              */,
+                                          int           nPoints /**< number of points       */,
+                                          int           lds     /**< leading dimension of S */,
+                                          double       *dF      /**< the results            */ );
+
+
+
+    /** Automatic Differentiation in backward mode at the storage   \n
+     *  positions number, ..., number+nPoints-1 (cf. evaluateBatch). \n
+     *  The seed of the i-th point is stored at seed[i*dim], the     \n
+     *  result is added to dX[i*ldx].                                \n
+     *  \return SUCCESFUL_RETURN                                     \n
+     */
+     virtual returnValue AD_backwardBatch( int           number  /**< first storage position */,
+                                           const double *seed    /**< the seeds              */,
+                                           int           nPoints /**< number of points       */,
+                                           double       *dX      /**< the results            */,
+                                           int           ldx     /**< leading dimension of dX */ );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -466,6 +521,52 @@ public:
 
      unsigned getGlobalExportVariableSize() const;
 
+     /** Enables (default) or disables the instruction tape. If it is  \n
+      *  disabled, the function is evaluated, differentiated and         \n
+      *  exported on the tree directly.                                  \n
+      *  \return SUCCESSFUL_RETURN                                      \n
+      */
+     returnValue setTapeEnabled( BooleanType tapeEnabled_ );
+
+     //
+     // PROTECTED MEMBER FUNCTIONS:
+     //
+protected:
+
+     /** Returns whether the numeric evaluation and the first order      \n
+      *  derivatives are computed on the instruction tape. The tape is   \n
+      *  recorded on first use; functions which can not be taped (e.g.   \n
+      *  C-functions or nonsmooth operators) are evaluated on the tree.  \n
+      */
+     BooleanType useTape( );
+
+     /** Returns the instruction tape, which is recorded on first use,  \n
+      *  or 0 if the tape is disabled or the tree can not be taped.     \n
+      *  The evaluation and the code export share the same tape.        \n
+      */
+     const FunctionEvaluationTape* getRecordedTape( ) const;
+
+     /** Deletes the tape (needs to be called whenever the tree changes). */
+     void clearTape( );
+
+     /** Records the given tape for the intermediate expressions and the \n
+      *  components of the tree.                                         \n
+      *  \return SUCCESSFUL_RETURN                                       \n
+      *          RET_NOT_IMPLEMENTED_YET (if the tree can not be taped)  \n
+      */
+     returnValue recordTape( FunctionEvaluationTape &tape_ ) const;
+
+     /** Determines the C name of each variable of the exported code. */
+     returnValue getExportVariableNames( std::vector< std::string >& names ) const;
+
+     /** Refills the operator buffers of the tree at the given storage   \n
+      *  position if they have been bypassed by the tape (needed for     \n
+      *  the second order derivatives).                                  \n
+      *  \return SUCCESSFUL_RETURN                                       \n
+      */
+     returnValue synchronizeBuffers( int number );
+
+
      //
      // DATA MEMBERS:
      //
@@ -480,6 +581,11 @@ protected:
 
      Expression           safeCopy ;
 
+     mutable FunctionEvaluationTape *tape;   /**< The instruction tape (0 if not recorded yet) */
+     BooleanType      tapeEnabled  ;   /**< Whether the instruction tape may be used */
+
+     std::vector< double > replayBuffer; /**< Scratch memory for refilling the tree buffers */
+
      /** Name of the variable that holds intermediate expressions. */
      std::string		globalExportVariableName;
 };
@@ -378,6 +378,26 @@ returnValue OCPiterate::applyStep(	const BlockMatrix& bm,
 
 
 
+returnValue OCPiterate::assignStep(	const OCPiterate& rhs,
+									const BlockMatrix& bm,
+									double alpha
+									)
+{
+    if( this != &rhs ){
+
+        assignValues( x , rhs.x  );
+        assignValues( xa, rhs.xa );
+        assignValues( p , rhs.p  );
+        assignValues( u , rhs.u  );
+        assignValues( w , rhs.w  );
+
+        inSimulationMode = rhs.inSimulationMode;
+    }
+
+    return applyStep( bm,alpha );
+}
+
+
 returnValue OCPiterate::enableSimulationMode(){
 
     if( x  != 0 ) x ->enableAutoInit ();
@@ -451,6 +471,33 @@ void OCPiterate::copy( const OCPiterate& rhs ){
 
 
 
+void OCPiterate::assignValues( VariablesGrid*& z, const VariablesGrid* const rhs ) const{
+
+    uint run1, run2;
+
+    if( rhs == 0 ){
+        if( z != 0 ){ delete z; z = 0; }
+        return;
+    }
+
+    if( z == 0 || z->getNumPoints() != rhs->getNumPoints() || z->getNumValues() != rhs->getNumValues() ){
+        if( z != 0 ) delete z;
+        z = new VariablesGrid(*rhs);
+        return;
+    }
+
+    for( run1 = 0; run1 < rhs->getNumPoints(); run1++ ){
+
+        z->setTime( run1, rhs->getTime(run1) );
+        z->setAutoInit( run1, rhs->getAutoInit(run1) );
+
+        for( run2 = 0; run2 < rhs->getNumValues(); run2++ )
+            z->operator()(run1,run2) = rhs->operator()(run1,run2);
+    }
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
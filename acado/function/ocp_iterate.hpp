@@ -159,6 +159,16 @@ class OCPiterate{
         						double alpha
 								);
 
+		/** Sets this iterate to rhs + alpha*bm. Grids that match the dimensions \n
+		 *  of rhs are re-used, i.e. only their times, values and auto-init     \n
+		 *  flags are overwritten, such that repeated trial iterates do not     \n
+		 *  allocate memory.                                                    \n
+		 */
+		returnValue assignStep(	const OCPiterate& rhs,
+								const BlockMatrix& bm,
+								double alpha
+								);
+
 
         returnValue enableSimulationMode( );
 
@@ -197,6 +207,8 @@ class OCPiterate{
 
 		void copy (const OCPiterate& rhs);
 
+		void assignValues( VariablesGrid*& z, const VariablesGrid* const rhs ) const;
+
 		inline DVector copy ( const VariablesGrid *z, const uint &idx ) const;
 
 		inline uint getDim( VariablesGrid *z ) const;
@@ -82,6 +82,13 @@ Integrator::Integrator( )
 
     tune  = 0.5      ;
     TOL   = 0.000001 ;
+    atol  = defaultAbsoluteTolerance;
+
+    jacobianColoring    = defaultJacobianColoring;
+    relaxationType      = defaultAlgebraicRelaxation;
+    relaxationParameter = defaultRelaxationParameter;
+    printProfile        = defaultprintIntegratorProfile;
+    optionsVersion      = 0;
 
 
     // INTERNAL INDEX LISTS:
@@ -133,6 +140,8 @@ Integrator::Integrator( const Integrator &arg )
 
     if( arg.transition == 0 )  transition = 0;
     else                       transition = new Transition( *arg.transition );
+
+    optionsVersion = 0;
 }
 
 
@@ -575,6 +584,7 @@ returnValue Integrator::setupOptions( )
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_COLORING           , defaultJacobianColoring        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
@@ -586,14 +596,79 @@ returnValue Integrator::setupOptions( )
 
 void Integrator::initializeOptions(){
 
+    if( optionsVersion == getOptionsVersion() )
+        return;
+
     get( MAX_NUM_INTEGRATOR_STEPS         , maxNumberOfSteps  );
     get( INTEGRATOR_TOLERANCE  , TOL               );
+    get( ABSOLUTE_TOLERANCE    , atol              );
     get( INITIAL_INTEGRATOR_STEPSIZE      , hini              );
     get( MIN_INTEGRATOR_STEPSIZE          , hmin              );
     get( MAX_INTEGRATOR_STEPSIZE          , hmax              );
     get( STEPSIZE_TUNING       , tune              );
     get( INTEGRATOR_PRINTLEVEL , PrintLevel        );
     get( LINEAR_ALGEBRA_SOLVER , las               );
+    get( JACOBIAN_COLORING     , jacobianColoring  );
+    get( ALGEBRAIC_RELAXATION  , relaxationType    );
+    get( RELAXATION_PARAMETER  , relaxationParameter );
+    get( PRINT_INTEGRATOR_PROFILE, printProfile    );
+
+    optionsVersion = getOptionsVersion();
+}
+
+
+int Integrator::determineColumnColoring( int nRows, int nCols, int nEntries,
+                                         const int *rowIdx, const int *colIdx,
+                                         int *color ) const{
+
+    int run1, run2, run3;
+
+    // row-wise storage of the pattern:
+    std::vector<int> rowStart( nRows+1, 0 );
+    std::vector<int> rowCols ( nEntries   );
+    std::vector<int> colStart( nCols+1, 0 );
+
+    for( run1 = 0; run1 < nEntries; run1++ ){
+        ASSERT( run1 == 0 || colIdx[run1-1] <= colIdx[run1] );
+        rowStart[rowIdx[run1]+1]++;
+        colStart[colIdx[run1]+1]++;
+    }
+    for( run1 = 0; run1 < nRows; run1++ )
+        rowStart[run1+1] += rowStart[run1];
+    for( run1 = 0; run1 < nCols; run1++ )
+        colStart[run1+1] += colStart[run1];
+
+    std::vector<int> fill( rowStart.begin(), rowStart.end()-1 );
+    for( run1 = 0; run1 < nEntries; run1++ )
+        rowCols[fill[rowIdx[run1]]++] = colIdx[run1];
+
+    // greedy coloring: a column gets the smallest color which is not
+    // used by any other column sharing a non-zero row with it
+    std::vector<int> forbidden( nCols+1, -1 );
+    int nColors = 0;
+
+    for( run1 = 0; run1 < nCols; run1++ )
+        color[run1] = -1;
+
+    for( run1 = 0; run1 < nCols; run1++ ){
+
+        for( run2 = colStart[run1]; run2 < colStart[run1+1]; run2++ ){
+            const int row = rowIdx[run2];
+            for( run3 = rowStart[row]; run3 < rowStart[row+1]; run3++ ){
+                if( color[rowCols[run3]] >= 0 )
+                    forbidden[color[rowCols[run3]]] = run1;
+            }
+        }
+
+        int c = 0;
+        while( forbidden[c] == run1 )
+            c++;
+
+        color[run1] = c;
+        if( c == nColors ) nColors++;
+    }
+
+    return nColors;
 }
 
 returnValue Integrator::setupLogging( ){
@@ -608,6 +683,7 @@ returnValue Integrator::setupLogging( ){
     tmp.addItem( LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS,         "TIME FOR RHS EVALUATIONS         [sec]:  ");
     tmp.addItem( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,      "TIME FOR JACOBIAN EVALUATIONS    [sec]:  ");
     tmp.addItem( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,   "TIME FOR JACOBIAN DECOMPOSITIONS [sec]:  ");
+    tmp.addItem( LOG_NUMBER_OF_INTEGRATOR_JACOBIAN_SEEDS,          "FORWARD SEEDS PER JACOBIAN            :  ");
 
     outputLoggingIdx = addLogRecord( tmp );
 
@@ -599,12 +599,39 @@ class Integrator : public AlgorithmicBase
 		*  hmax
 		*  tune
 		*  TOL
+		*  atol
 		*  las
+		*  jacobianColoring
+		*  relaxationType
+		*  relaxationParameter
+		*  printProfile
 		*  (cf. SETTINGS  for more details)
+		*
+		*  The options are only read again after they have been modified. \n
 		*/
 		void initializeOptions();
 
 
+		/** Partitions the columns of a sparse Jacobian into groups of     \n
+		*  structurally orthogonal columns, i.e. columns which do not have \n
+		*  a non-zero entry in the same row (greedy Curtis-Powell-Reid     \n
+		*  coloring). All columns of one group can be evaluated by a single\n
+		*  forward sweep with a seed vector that is one in each of them.   \n
+		*  The sparsity pattern is given in triplet form. The entries MUST \n
+		*  be sorted by their column indices (in any order within a column),\n
+		*  since the entries of each column are located by counting only. \n
+		*
+		*  \return the number of colors (forward sweeps per Jacobian)      \n
+		*/
+		int determineColumnColoring( int nRows,          /**< number of rows            */
+		                             int nCols,          /**< number of columns         */
+		                             int nEntries,       /**< number of non-zeros       */
+		                             const int *rowIdx,  /**< row indices of non-zeros  */
+		                             const int *colIdx,  /**< col indices of non-zeros  */
+		                             int *color          /**< output: color per column  */
+		                             ) const;
+
+
 		virtual returnValue setupLogging( );
 
 
@@ -643,7 +670,13 @@ class Integrator : public AlgorithmicBase
 		double   hmax                ;  /**< the maximum step size                              */
 		double   tune                ;  /**< tuning parameter for the step size control.        */
 		double   TOL                 ;  /**< the integration tolerance                          */
+		double   atol                ;  /**< the absolute integration tolerance                 */
 		int      las                 ;  /** the type of linear algebra solver to be used        */
+		int      jacobianColoring    ;  /**< whether Jacobians are evaluated in compressed form */
+		int      relaxationType      ;  /**< the relaxation of algebraic residuals              */
+		double   relaxationParameter ;  /**< the parameter of the algebraic relaxation          */
+		int      printProfile        ;  /**< whether the run-time profile is printed            */
+		uint     optionsVersion      ;  /**< stamp of the options the settings were read from   */
 
 		Grid     timeInterval        ;  /**< the time interval                                  */
 
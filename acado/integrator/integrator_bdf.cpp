@@ -425,6 +425,9 @@ void IntegratorBDF::initializeVariables(){
     nOfNewtonSteps = 0;
     maxNM = 0; M = 0; M_index = 0; nOfM = 0;
 
+    jacRowIdx = 0; jacColIdx = 0; jacColStart = 0; jacColor = 0;
+    jacEntries = 0; nJacEntries = -1; nJacColors = 0;
+
     F  = 0; F2 = 0;
 
     initial_guess = 0;
@@ -447,6 +450,8 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
 
     int run1, run2, run3;
 
+    optionsVersion = 0;
+
     rhs = new DifferentialEquation( *arg.rhs );
 
     m   = arg.m;
@@ -588,6 +593,10 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
     nOfM       = 0;
 
     las = arg.las;
+    jacobianColoring = arg.jacobianColoring;
+
+    jacRowIdx = 0; jacColIdx = 0; jacColStart = 0; jacColor = 0;
+    jacEntries = 0; nJacEntries = -1; nJacColors = 0;
 
     for( run1 = 0; run1 < 4; run1++ ){
         eta [run1] = new double[m];
@@ -613,6 +622,8 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
     tune  = 0.5      ;
     TOL   = 0.000001 ;
 
+    optionsVersion = 0;
+
 
     // INTERNAL INDEX LISTS:
     // ---------------------
@@ -926,6 +937,23 @@ void IntegratorBDF::deleteAll(){
         free(M_index);
     }
 
+    for( run1 = 0; run1 < (int) sparseLU.size(); run1++ ){
+         if( sparseLU[run1] != 0 )
+             delete sparseLU[run1];
+    }
+    sparseLU.clear();
+
+    if( jacRowIdx != NULL )
+        delete[] jacRowIdx;
+    if( jacColIdx != NULL )
+        delete[] jacColIdx;
+    if( jacColStart != NULL )
+        delete[] jacColStart;
+    if( jacColor != NULL )
+        delete[] jacColor;
+    if( jacEntries != NULL )
+        delete[] jacEntries;
+
     if( F != NULL )
         delete[] F;
     if( F2 != NULL )
@@ -1219,9 +1247,6 @@ returnValue IntegratorBDF::evaluate( const DVector &x0  ,
      // initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
             diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
 
@@ -1311,6 +1336,7 @@ returnValue IntegratorBDF::evaluate( const DVector &x0  ,
        setLast( LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS         , functionEvaluation.getTime()  );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION      , jacComputation.getTime()      );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION   , jacDecomposition.getTime()    );
+       setLast( LOG_NUMBER_OF_INTEGRATOR_JACOBIAN_SEEDS          , nJacColors                    );
 
     // ----------------------------------------------------------------------------------------
 
@@ -1339,10 +1365,7 @@ returnValue IntegratorBDF::evaluate( const DVector &x0  ,
             printBDFfinalResults();
         }
 		
-	int printIntegratorProfile = 0;
-	get( PRINT_INTEGRATOR_PROFILE,printIntegratorProfile );
-	
-	if ( (BooleanType)printIntegratorProfile == BT_TRUE )
+	if ( (BooleanType)printProfile == BT_TRUE )
 	{
 		printRunTimeProfile( );
 	}
@@ -1925,10 +1948,10 @@ returnValue IntegratorBDF::step(int number_){
          }
 
          if( soa == SOA_FREEZING_ALL || soa == SOA_EVERYTHING_FROZEN ){
-             determineBDFEtaGForward(number_);
+             ACADO_TRY( determineBDFEtaGForward(number_) );
          }
          else{
-             determineBDFEtaGForward(7);
+             ACADO_TRY( determineBDFEtaGForward(7) );
          }
      }
      if( nBDirs > 0 ){
@@ -1939,7 +1962,7 @@ returnValue IntegratorBDF::step(int number_){
          if( nFDirs != 0 || nBDirs2 != 0 || nFDirs2 != 0 ){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
-         determineBDFEtaHBackward(number_);
+         ACADO_TRY( determineBDFEtaHBackward(number_) );
      }
      if( nFDirs2 > 0 ){
 
@@ -1949,7 +1972,7 @@ returnValue IntegratorBDF::step(int number_){
          if( nBDirs != 0 || nBDirs2 != 0 || nFDirs != 1 ){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
-         determineBDFEtaGForward2(number_);
+         ACADO_TRY( determineBDFEtaGForward2(number_) );
      }
      if( nBDirs2 > 0 ){
 
@@ -1960,7 +1983,7 @@ returnValue IntegratorBDF::step(int number_){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
 
-         determineBDFEtaHBackward2(number_);
+         ACADO_TRY( determineBDFEtaHBackward2(number_) );
      }
 
 
@@ -2042,9 +2065,6 @@ returnValue IntegratorBDF::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
             diff_scale(run1) = fabs(nablaY(0,run1)) + atol/TOL;
 
@@ -2416,38 +2436,16 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = gamma[stepnumber][4];
-               iseed[ diff_index[run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                        k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
+           if( evaluateIterationMatrix( 3*stepnumber+newtonsteps, 1.0, gamma[stepnumber][4],
+                                        *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN ){
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
            }
 
            nJacEvaluations++;
            jacComputation.stop();
            jacDecomposition.start();
 
-           if( decomposeJacobian(M_index[stepnumber], *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
-               return ACADOERROR(RET_THE_DAE_INDEX_IS_TOO_LARGE);
+           ACADO_TRY( decomposeJacobian(M_index[stepnumber], *M[M_index[stepnumber]] ) );
 
            jacDecomposition.stop();
 
@@ -2455,11 +2453,11 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
            COMPUTE_JACOBIAN  = BT_FALSE;
        }
 
-       norm1 = applyNewtonStep( M_index[stepnumber],
-    		   	   	   	   	   	   eta[newtonsteps+1],
-                                eta[newtonsteps],
-                               *M[M_index[stepnumber]],
-                                F );
+       ACADO_TRY( applyNewtonStep( M_index[stepnumber],
+               		   	   	   	   	   	   eta[newtonsteps+1],
+                                           eta[newtonsteps],
+                                          *M[M_index[stepnumber]],
+                                           F, &norm1 ) );
 
        if( soa == SOA_MESH_FROZEN || soa == SOA_EVERYTHING_FROZEN ){
            if( newtonsteps == nOfNewtonSteps[stepnumber] ){
@@ -2704,7 +2702,7 @@ returnValue IntegratorBDF::rk_start(){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
 
-         determineRKEtaGForward();
+         ACADO_TRY( determineRKEtaGForward() );
      }
 
      if( nBDirs > 0 ){
@@ -2715,7 +2713,7 @@ returnValue IntegratorBDF::rk_start(){
          if( nFDirs != 0 || nBDirs2 != 0 || nFDirs2 != 0 ){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
-         determineRKEtaHBackward();
+         ACADO_TRY( determineRKEtaHBackward() );
      }
      if( nFDirs2 > 0 ){
 
@@ -2725,7 +2723,7 @@ returnValue IntegratorBDF::rk_start(){
          if( nBDirs != 0 || nBDirs2 != 0 || nFDirs != 1 ){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
-         determineRKEtaGForward2();
+         ACADO_TRY( determineRKEtaGForward2() );
      }
      if( nBDirs2 > 0 ){
 
@@ -2736,7 +2734,7 @@ returnValue IntegratorBDF::rk_start(){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
 
-         determineRKEtaHBackward2();
+         ACADO_TRY( determineRKEtaHBackward2() );
      }
 
     // Printing:
@@ -2924,39 +2922,16 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = 1.0;
-               iseed[ diff_index[run1]] = ise;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
+           if( evaluateIterationMatrix( 3*stepnumber+newtonsteps, ise, 1.0,
+                                        *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN ){
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
            }
 
            nJacEvaluations++;
            jacComputation.stop();
            jacDecomposition.start();
 
-           if( decomposeJacobian(M_index[stepnumber], *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
-                   return ACADOERROR(RET_THE_DAE_INDEX_IS_TOO_LARGE);
+           ACADO_TRY( decomposeJacobian(M_index[stepnumber], *M[M_index[stepnumber]] ) );
 
            jacDecomposition.stop();
 
@@ -2964,11 +2939,11 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
            COMPUTE_JACOBIAN  = BT_FALSE;
        }
 
-       norm1 = applyNewtonStep( M_index[stepnumber],
-    		   	   	   	   	   k[newtonsteps+1][stepnumber],
-                                k[newtonsteps][stepnumber]  ,
-                               *M[M_index[stepnumber]],
-                                F );
+       ACADO_TRY( applyNewtonStep( M_index[stepnumber],
+               		   	   	   	   	   k[newtonsteps+1][stepnumber],
+                                           k[newtonsteps][stepnumber]  ,
+                                          *M[M_index[stepnumber]],
+                                           F, &norm1 ) );
 
        if( soa == SOA_MESH_FROZEN || soa == SOA_EVERYTHING_FROZEN ){
            if( newtonsteps == nOfNewtonSteps[stepnumber] ){
@@ -3026,7 +3001,7 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
 }
 
 
-void IntegratorBDF::determineRKEtaGForward(){
+returnValue IntegratorBDF::determineRKEtaGForward(){
 
     int run1, run2, run3, newtonsteps;
 
@@ -3067,16 +3042,15 @@ void IntegratorBDF::determineRKEtaGForward(){
 
                if( rhs[0].AD_forward( 3*run1+newtonsteps, G, F )
                                       != SUCCESSFUL_RETURN ){
-                   ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-                   return;
+                   return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
                }
 
 
-               applyNewtonStep( M_index[run1],
-            		   	   	   	   k[newtonsteps+1][run1],
-                                k[newtonsteps][run1]  ,
-                               *M[M_index[run1]],
-                                F );
+               ACADO_TRY( applyNewtonStep( M_index[run1],
+                       		   	   	   	   k[newtonsteps+1][run1],
+                                           k[newtonsteps][run1]  ,
+                                          *M[M_index[run1]],
+                                           F ) );
 
                newtonsteps++;
            }
@@ -3097,15 +3071,17 @@ void IntegratorBDF::determineRKEtaGForward(){
                nablaG(nstep-2-run1,md+run2) = k[nOfNewtonSteps[run1+3]][run1+3][md+run2];
            }
         }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
-void IntegratorBDF::determineRKEtaHBackward(){
+returnValue IntegratorBDF::determineRKEtaHBackward(){
 
     int run1, run2, run3, newtonsteps;
     const double hhh = c[3]*h[0];
     int number_;
-    double *Hstore = new double[ndir];
+    std::vector<double> Hstore( ndir );
 
     const double scalT = rel_time_scale/hhh;
 
@@ -3151,9 +3127,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3198,9 +3174,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3251,9 +3227,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3310,9 +3286,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3374,9 +3350,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3443,9 +3419,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3517,9 +3493,9 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H ) );
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3560,11 +3536,11 @@ void IntegratorBDF::determineRKEtaHBackward(){
                nablaH(0,run1) -= l[run3][6][run1];
         }
 
-    delete[] Hstore;
+    return SUCCESSFUL_RETURN;
 }
 
 
-void IntegratorBDF::determineRKEtaGForward2(){
+returnValue IntegratorBDF::determineRKEtaGForward2(){
 
     int run1, run2, run3, newtonsteps;
 
@@ -3614,19 +3590,18 @@ void IntegratorBDF::determineRKEtaGForward2(){
 
                if( rhs[0].AD_forward2( 3*run1+newtonsteps, G2, G3, F, F2 )
                                       != SUCCESSFUL_RETURN ){
-                   ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-                   return;
+                   return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
                }
 
 
-               applyNewtonStep( M_index[run1], k[newtonsteps+1][run1],
-                                k[newtonsteps][run1]  ,
-                               *M[M_index[run1]],
-                                F );
-               applyNewtonStep( M_index[run1], k2[newtonsteps+1][run1],
-                                k2[newtonsteps][run1]  ,
-                               *M[M_index[run1]],
-                                F2 );
+               ACADO_TRY( applyNewtonStep( M_index[run1], k[newtonsteps+1][run1],
+                                           k[newtonsteps][run1]  ,
+                                          *M[M_index[run1]],
+                                           F ) );
+               ACADO_TRY( applyNewtonStep( M_index[run1], k2[newtonsteps+1][run1],
+                                           k2[newtonsteps][run1]  ,
+                                          *M[M_index[run1]],
+                                           F2 ) );
 
                newtonsteps++;
            }
@@ -3651,17 +3626,19 @@ void IntegratorBDF::determineRKEtaGForward2(){
                nablaG3(nstep-2-run1,md+run2) = k2[nOfNewtonSteps[run1+3]][run1+3][md+run2];
            }
         }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
-void IntegratorBDF::determineRKEtaHBackward2(){
+returnValue IntegratorBDF::determineRKEtaHBackward2(){
 
     int run1, run2, run3, run4, newtonsteps;
     const double hhh = c[3]*h[0];
     int number_;
 
-    double *H1store = new double[ndir];
-    double *H2store = new double[ndir];
+    std::vector<double> H1store( ndir );
+    std::vector<double> H2store( ndir );
 
     const double scalT = rel_time_scale/hhh;
 
@@ -3727,13 +3704,13 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
 
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
@@ -3794,12 +3771,12 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -3872,12 +3849,12 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -3962,12 +3939,12 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4062,12 +4039,12 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4172,12 +4149,12 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4292,12 +4269,12 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH2[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
+            ACADO_TRY( applyMTranspose( M_index[number_], kH3[number_][newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4344,13 +4321,13 @@ void IntegratorBDF::determineRKEtaHBackward2(){
         }
 
     }
-    delete[] H1store;
-    delete[] H2store;
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
-void IntegratorBDF::determineBDFEtaGForward( int number_ ){
+returnValue IntegratorBDF::determineBDFEtaGForward( int number_ ){
 
     int run1, run2, run4;
     int newtonsteps;
@@ -4420,10 +4397,10 @@ void IntegratorBDF::determineBDFEtaGForward( int number_ ){
                 ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
             }
 
-            applyNewtonStep( M_index[number_], eta[newtonsteps+1],
-                             eta[newtonsteps],
-                            *M[M_index[number_]],
-                             F );
+            ACADO_TRY( applyNewtonStep( M_index[number_], eta[newtonsteps+1],
+                                        eta[newtonsteps],
+                                       *M[M_index[number_]],
+                                        F ) );
 
             newtonsteps++;
         }
@@ -4438,10 +4415,12 @@ void IntegratorBDF::determineBDFEtaGForward( int number_ ){
 
         nablaG = nablaY_;
     }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
-void IntegratorBDF::determineBDFEtaHBackward( int number_ ){
+returnValue IntegratorBDF::determineBDFEtaHBackward( int number_ ){
 
     int run1, run2;
     int newtonsteps;
@@ -4472,7 +4451,7 @@ void IntegratorBDF::determineBDFEtaHBackward( int number_ ){
     newtonsteps--;
     while( newtonsteps >= 0 ){
 
-        applyMTranspose( M_index[number_], etaH[newtonsteps+1], M[M_index[number_]][0], H );
+        ACADO_TRY( applyMTranspose( M_index[number_], etaH[newtonsteps+1], M[M_index[number_]][0], H ) );
 
         if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][0] ) != SUCCESSFUL_RETURN )
             ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
@@ -4525,11 +4504,13 @@ void IntegratorBDF::determineBDFEtaHBackward( int number_ ){
     for( run1 = 0; run1 < ndir; run1++ ){
         nablaH(4,run1) =  pp*etaH[0][run1];
     }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
-void IntegratorBDF::determineBDFEtaGForward2( int number_ ){
+returnValue IntegratorBDF::determineBDFEtaGForward2( int number_ ){
 
     int run1, run2, run4;
     int newtonsteps;
@@ -4632,15 +4613,15 @@ void IntegratorBDF::determineBDFEtaGForward2( int number_ ){
                 ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
             }
 
-            applyNewtonStep( M_index[number_], eta[newtonsteps+1],
-                             eta[newtonsteps],
-                            *M[M_index[number_]],
-                             F );
+            ACADO_TRY( applyNewtonStep( M_index[number_], eta[newtonsteps+1],
+                                        eta[newtonsteps],
+                                       *M[M_index[number_]],
+                                        F ) );
 
-            applyNewtonStep( M_index[number_], eta2[newtonsteps+1],
-                             eta2[newtonsteps],
-                            *M[M_index[number_]],
-                             F2 );
+            ACADO_TRY( applyNewtonStep( M_index[number_], eta2[newtonsteps+1],
+                                        eta2[newtonsteps],
+                                       *M[M_index[number_]],
+                                        F2 ) );
 
             newtonsteps++;
         }
@@ -4664,11 +4645,13 @@ void IntegratorBDF::determineBDFEtaGForward2( int number_ ){
         }
         nablaG3 = nablaY_;
     }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
-void IntegratorBDF::determineBDFEtaHBackward2( int number_ ){
+returnValue IntegratorBDF::determineBDFEtaHBackward2( int number_ ){
 
     int run1, run2, run4;
     int newtonsteps;
@@ -4710,13 +4693,13 @@ void IntegratorBDF::determineBDFEtaHBackward2( int number_ ){
         newtonsteps--;
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( M_index[number_], etaH2[newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
+            ACADO_TRY( applyMTranspose( M_index[number_], etaH2[newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H2 ) );
 
-            applyMTranspose( M_index[number_], etaH3[newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            ACADO_TRY( applyMTranspose( M_index[number_], etaH3[newtonsteps+1],
+                                       *M[M_index[number_]],
+                                        H3 ) );
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][0], l2[newtonsteps][0] )
@@ -4795,6 +4778,8 @@ void IntegratorBDF::determineBDFEtaHBackward2( int number_ ){
             nablaH3(4,run1) =  pp*etaH3[0][run1];
         }
     }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -5113,21 +5098,34 @@ void IntegratorBDF::printRKIntermediateResults(){
 
 returnValue IntegratorBDF::decomposeJacobian(int index, DMatrix &J){
 
-//	ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
+    int run1;
 
     switch( las ){
 
         case HOUSEHOLDER_METHOD:
-//        	ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
         	break;
 //        	ASSERT( index < qr.size() );
 //        	qr[ index ] = Eigen::HouseholderQR< DMatrix::Base >( J );
 //        	return SUCCESSFUL_RETURN;
 
         case SPARSE_LU:
-        		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-        		break;
-//             return J.computeSparseLUdecomposition();
+             if( sparseLU.empty() == true )
+                 ACADO_TRY( setupSparseLU() );
+
+             // all factorizations share the symbolic analysis of the first one. The
+             // indices are handed out in increasing order (see determineCorrector),
+             // hence sparseLU[0] has been factored before it is cloned for index > 0:
+             if( index >= (int) sparseLU.size() )
+                 sparseLU.resize( index+1, 0 );
+             if( sparseLU[index] == 0 ){
+                 ASSERT( sparseLU[index-1] != 0 );
+                 sparseLU[index] = sparseLU[0]->clone();
+             }
+
+             for( run1 = 0; run1 < nJacEntries; run1++ )
+                 jacEntries[run1] = J( jacRowIdx[run1], jacColIdx[run1] );
+
+             return sparseLU[index]->setMatrix( jacEntries );
 
         default:
              return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
@@ -5137,7 +5135,156 @@ returnValue IntegratorBDF::decomposeJacobian(int index, DMatrix &J){
 }
 
 
-double IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF ){
+returnValue IntegratorBDF::determineJacobianPattern( ){
+
+    int run1, run2;
+
+    VariableType  varType  [2];
+    int           component[2];
+    BooleanType  *dependency = new BooleanType[m];
+    BooleanType   isSparse   = BT_FALSE;
+
+    if( jacobianColoring == BT_TRUE || las == SPARSE_LU )
+        isSparse = rhs->isSymbolic();
+
+    DVector diffComponents = rhs->getDifferentialStateComponents();
+
+    if( jacRowIdx   != 0 ) delete[] jacRowIdx  ;
+    if( jacColIdx   != 0 ) delete[] jacColIdx  ;
+    if( jacColStart != 0 ) delete[] jacColStart;
+    if( jacColor    != 0 ) delete[] jacColor   ;
+    if( jacEntries  != 0 ) delete[] jacEntries ;
+
+    jacRowIdx   = new int[m*m];
+    jacColIdx   = new int[m*m];
+    jacColStart = new int[m+1];
+    jacColor    = new int[m  ];
+    nJacEntries = 0;
+
+    // column j of M is the derivative of the implicit rhs w.r.t. the
+    // j-th differential state (together with its derivative) or the
+    // (j-md)-th algebraic state, respectively:
+    for( run1 = 0; run1 < m; run1++ ){
+
+        jacColStart[run1] = nJacEntries;
+
+        int nn = 1;
+        if( run1 < md ){
+            varType  [0] = VT_DIFFERENTIAL_STATE ;
+            component[0] = (int) diffComponents(run1);
+            varType  [1] = VT_DDIFFERENTIAL_STATE;
+            component[1] = run1;
+            nn = 2;
+        }
+        else{
+            varType  [0] = VT_ALGEBRAIC_STATE;
+            component[0] = run1-md;
+        }
+
+        if( isSparse == BT_FALSE ||
+            rhs->getDependencyPattern( nn, varType, component, dependency ) != SUCCESSFUL_RETURN ){
+            for( run2 = 0; run2 < m; run2++ )
+                dependency[run2] = BT_TRUE;
+        }
+
+        for( run2 = 0; run2 < m; run2++ ){
+            if( dependency[run2] == BT_TRUE ){
+                jacRowIdx[nJacEntries] = run2;
+                jacColIdx[nJacEntries] = run1;
+                nJacEntries++;
+            }
+        }
+    }
+    jacColStart[m] = nJacEntries;
+    delete[] dependency;
+
+    jacEntries = new double[nJacEntries];
+
+    if( jacobianColoring == BT_TRUE && isSparse == BT_TRUE ){
+        nJacColors = determineColumnColoring( m, m, nJacEntries, jacRowIdx, jacColIdx, jacColor );
+    }
+    else{
+        for( run1 = 0; run1 < m; run1++ )
+            jacColor[run1] = run1;
+        nJacColors = m;
+    }
+
+    if( PrintLevel == HIGH ){
+        cout << "BDF: " << nJacEntries << " structural non-zeros in the " << m << " x " << m
+             << " iteration matrix, " << nJacColors << " forward sweeps per Jacobian.\n";
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorBDF::evaluateIterationMatrix( int number_, double diffSeed, double ddiffSeed, DMatrix &J ){
+
+    int run1, run2, run3;
+
+    if( nJacEntries < 0 )
+        determineJacobianPattern();
+
+    J.setZero();
+
+    for( run1 = 0; run1 < nJacColors; run1++ ){
+
+        for( run2 = 0; run2 < m; run2++ ){
+            if( jacColor[run2] == run1 ){
+                if( run2 < md ){
+                    iseed[ddiff_index[run2]] = ddiffSeed;
+                    iseed[ diff_index[run2]] = diffSeed;
+                }
+                else{
+                    iseed[ diff_index[run2]] = 1.0;
+                }
+            }
+        }
+
+        if( rhs[0].AD_forward( number_, iseed, k2[0][0] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+
+        for( run2 = 0; run2 < m; run2++ ){
+            if( jacColor[run2] == run1 ){
+                if( run2 < md )
+                    iseed[ddiff_index[run2]] = 0.0;
+                iseed[diff_index[run2]] = 0.0;
+
+                for( run3 = jacColStart[run2]; run3 < jacColStart[run2+1]; run3++ )
+                    J( jacRowIdx[run3], run2 ) = k2[0][0][jacRowIdx[run3]];
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorBDF::setupSparseLU( ){
+
+    int run1;
+
+    if( nJacEntries < 0 )
+        determineJacobianPattern();
+
+    if( nJacEntries == 0 )
+        return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
+
+    for( run1 = 0; run1 < (int) sparseLU.size(); run1++ ){
+         if( sparseLU[run1] != 0 )
+             delete sparseLU[run1];
+    }
+    sparseLU.assign( 1, new ACADOcsparse() );
+
+    sparseLU[0]->setDimension( m );
+    sparseLU[0]->setNumberOfEntries( nJacEntries );
+    sparseLU[0]->setTolerance( 1e-3 );
+
+    return sparseLU[0]->setIndices( jacRowIdx, jacColIdx );
+}
+
+
+returnValue IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF, double *norm ){
 
     int run1;
     DVector bb(m,FFF);
@@ -5150,8 +5297,8 @@ double IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const doubl
 //		deltaX = qr[ index ].solve(bb);
 		break;
 	case SPARSE_LU:
-		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-//		deltaX = J.solveSparseLU(bb);
+		deltaX = bb;
+		ACADO_TRY( sparseLU[index]->solve( deltaX.data() ) );
 		break;
 	default:
 		deltaX.setZero();
@@ -5161,11 +5308,14 @@ double IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const doubl
     for( run1 = 0; run1 < m; run1++ )
         etakplus1[run1] = etak[run1] - deltaX(run1);
 
-    return deltaX.getNorm( VN_LINF, diff_scale );
+    if( norm != 0 )
+        *norm = deltaX.getNorm( VN_LINF, diff_scale );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
-void IntegratorBDF::applyMTranspose( int index, double *seed1, DMatrix &J, double *seed2 ){
+returnValue IntegratorBDF::applyMTranspose( int index, double *seed1, DMatrix &J, double *seed2 ){
 
     int run1;
     DVector bb(m);
@@ -5185,8 +5335,8 @@ void IntegratorBDF::applyMTranspose( int index, double *seed1, DMatrix &J, doubl
 //			triangularView<Eigen::Upper>().transpose().solve( bb );
 		break;
 	case SPARSE_LU:
-		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-//		deltaX = J.solveTransposeSparseLU(bb);
+		deltaX = bb;
+		ACADO_TRY( sparseLU[index]->solveTranspose( deltaX.data() ) );
 		break;
 	default:
 		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
@@ -5196,25 +5346,20 @@ void IntegratorBDF::applyMTranspose( int index, double *seed1, DMatrix &J, doubl
 
     for( run1 = 0; run1 < m; run1++ )
         seed2[run1] = deltaX(run1);
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 void IntegratorBDF::relaxAlgebraic( double *residuum, double timePoint ){
 
-    int           relaxationType  ;
-    double        relaxationPar   ;
-
-    get( RELAXATION_PARAMETER, relaxationPar );
-
-    const double  a = relaxationPar*(timeInterval.getIntervalLength());
+    const double  a = relaxationParameter*(timeInterval.getIntervalLength());
     const double  b = 1.0;
     double        damping = 1.0;
     int           run1   ;
     double        normRES;
 
-    get( ALGEBRAIC_RELAXATION, relaxationType );
-
     switch( relaxationType ){
 
         case ART_EXPONENTIAL:
@@ -35,6 +35,7 @@
 #define ACADO_TOOLKIT_INTEGRATOR_BDF_HPP
 
 #include <acado/integrator/integrator_fwd.hpp>
+#include <acado/bindings/acado_csparse/acado_csparse.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -383,17 +384,46 @@ protected:
     returnValue decomposeJacobian(int index, DMatrix &J );
 
 
-    /** applies a newton step                                              \n
-     *  \return the norm of the increment                                  \n
+    /** Determines the structural sparsity pattern of the iteration matrix \n
+     *  from the symbolic right-hand side (a dense pattern is used if the  \n
+     *  rhs is not symbolic) together with a coloring of its columns.      \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     */
+    returnValue determineJacobianPattern( );
+
+
+    /** Evaluates the iteration matrix  J = diffSeed*dF/dx + ddiffSeed*dF/dxdot \n
+     *  (the algebraic columns are dF/dz) at the given storage position,   \n
+     *  using one forward sweep per color of the sparsity pattern.         \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF                \n
      */
-    double applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF );
+    returnValue evaluateIterationMatrix( int number_, double diffSeed, double ddiffSeed, DMatrix &J );
+
+
+    /** Sets up the sparse LU solver for the sparsity pattern of the       \n
+     *  iteration matrix (only for LINEAR_ALGEBRA_SOLVER = SPARSE_LU).     \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                     \n
+     */
+    returnValue setupSparseLU( );
+
+
+    /** applies a newton step and stores the norm of the increment in     \n
+     *  norm (if not 0)                                                    \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                     \n
+     */
+    returnValue applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF,
+                                 double *norm = 0 );
 
 
     /** applies the transpose of M (needed for automatic differentiation   \n
      *  in backward mode)                                                  \n
-     *  \return (void)                                                     \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                     \n
      */
-    void applyMTranspose( int index, double *seed1, DMatrix &J, double *seed2 );
+    returnValue applyMTranspose( int index, double *seed1, DMatrix &J, double *seed2 );
 
 
     /** Initializes a second forward seed. (only for internal use)         \n
@@ -416,39 +446,39 @@ protected:
 
     /** Differentiation of the RK-Starter: \n
      */
-    void determineRKEtaGForward();
+    returnValue determineRKEtaGForward();
 
 
     /** Differentiation of the RK-Starter: \n
      */
-    void determineRKEtaHBackward();
+    returnValue determineRKEtaHBackward();
 
 
     /** Differentiation of the RK-Starter: \n
      */
-    void determineRKEtaGForward2();
+    returnValue determineRKEtaGForward2();
 
 
     /** Differentiation of the RK-Starter: \n
      */
-    void determineRKEtaHBackward2();
+    returnValue determineRKEtaHBackward2();
 
 
     /** Differentiation of the BDF step:   \n
      */
-    void determineBDFEtaGForward( int number );
+    returnValue determineBDFEtaGForward( int number );
 
     /** Differentiation of the BDF step:   \n
      */
-    void determineBDFEtaHBackward( int number );
+    returnValue determineBDFEtaHBackward( int number );
 
     /** Differentiation of the BDF step:   \n
      */
-    void determineBDFEtaGForward2( int number );
+    returnValue determineBDFEtaGForward2( int number );
 
     /** Differentiation of the BDF step:   \n
      */
-    void determineBDFEtaHBackward2( int number );
+    returnValue determineBDFEtaHBackward2( int number );
 
 
     /** Delete everything.                 \n
@@ -552,6 +582,19 @@ protected:
     int      nOfM              ; /**< number of distinct inverse Jacobian approximations  */
     int      maxNM             ; /**< number of allocated Jacobian storage positions      */
 
+    std::vector< ACADOcsparse* > sparseLU; /**< sparse LU factorizations of the Jacobians    \n
+                                            *   (only for SPARSE_LU, same indexing as M);    \n
+                                            *   all entries are clones of sparseLU[0], which \n
+                                            *   has to be factored first to share its        \n
+                                            *   symbolic analysis                            */
+    int     *jacRowIdx         ; /**< row indices of the structural non-zeros of M       */
+    int     *jacColIdx         ; /**< column indices of the structural non-zeros of M    */
+    int     *jacColStart       ; /**< first non-zero of each column of M                 */
+    int     *jacColor          ; /**< the color of each column of M                      */
+    double  *jacEntries        ; /**< the structural non-zeros of M (auxiliary storage)  */
+    int      nJacEntries       ; /**< number of structural non-zeros of M (-1: unknown)  */
+    int      nJacColors        ; /**< number of forward sweeps needed to evaluate M      */
+
     int     *nOfNewtonSteps    ; /**< the number of newton steps (for each BDF-step)      */
     double **eta               ; /**< the predictor and corrector approximations          */
     double **eta2              ; /**< the predictor and corrector approximations          */
@@ -452,6 +452,8 @@ void IntegratorLYAPUNOV::constructAll( const IntegratorLYAPUNOV& arg ){
 
     int run1, run2;
 
+    optionsVersion = 0;
+
     rhs = new DifferentialEquation( *arg.rhs );
 
     m   = arg.m              ;
@@ -808,9 +810,6 @@ returnValue IntegratorLYAPUNOV::evaluate( const DVector &x0  ,
      // Initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
             diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
 
@@ -866,6 +865,7 @@ returnValue IntegratorLYAPUNOV::evaluate( const DVector &x0  ,
        setLast( LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS         , functionEvaluation.getTime()  );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION      , 0.0                           );
        setLast( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION   , 0.0                           );
+       setLast( LOG_NUMBER_OF_INTEGRATOR_JACOBIAN_SEEDS          , 0                             );
 
     // ----------------------------------------------------------------------------------------
 
@@ -885,10 +885,7 @@ returnValue IntegratorLYAPUNOV::evaluate( const DVector &x0  ,
             printIntermediateResults();
         }
 	
-	int printIntegratorProfile = 0;
-	get( PRINT_INTEGRATOR_PROFILE,printIntegratorProfile );
-	
-	if ( (BooleanType)printIntegratorProfile == BT_TRUE )
+	if ( (BooleanType)printProfile == BT_TRUE )
 	{
 		printRunTimeProfile( );
 	}
@@ -1541,9 +1538,6 @@ returnValue IntegratorLYAPUNOV::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
             diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
 
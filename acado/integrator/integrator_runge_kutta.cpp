@@ -143,6 +143,11 @@ void IntegratorRK::initializeVariables(){
     H = 0; etaH = 0; H2 = 0; H3 = 0;
     etaH2 = 0; etaH3 = 0;
 
+    sensVarIndex = 0; sensColStart = 0; sensRowIdx = 0; sensColor = 0;
+    sensSeed = 0; sensResult = 0;
+    nSensCols = 0; nSensEntries = -1; nSensColors = 0;
+    forwardCompressed = BT_FALSE;
+
     maxAlloc  = 0;
     err_power = 1.0;
 }
@@ -281,6 +286,22 @@ void IntegratorRK::allocateMemory( ){
     etaH3      = NULL;
 
 
+    // COMPRESSED SENSITIVITIES:
+    // -------------------------
+    sensVarIndex = NULL;
+    sensColStart = NULL;
+    sensRowIdx   = NULL;
+    sensColor    = NULL;
+    sensSeed     = NULL;
+    sensResult   = NULL;
+
+    nSensCols    =  0;
+    nSensEntries = -1;
+    nSensColors  =  0;
+
+    forwardCompressed = BT_FALSE;
+
+
     // STORAGE:
     // --------
     maxAlloc = 1;
@@ -389,6 +410,27 @@ void IntegratorRK::deleteAll(){
 
     if( etaH3  != NULL )
         delete[] etaH3;
+
+
+    // ----------------------------------------
+
+    if( sensVarIndex != NULL )
+        delete[] sensVarIndex;
+
+    if( sensColStart != NULL )
+        delete[] sensColStart;
+
+    if( sensRowIdx != NULL )
+        delete[] sensRowIdx;
+
+    if( sensColor != NULL )
+        delete[] sensColor;
+
+    if( sensSeed != NULL )
+        delete[] sensSeed;
+
+    if( sensResult != NULL )
+        delete[] sensResult;
 }
 
 
@@ -408,6 +450,8 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
 
     int run1, run2;
 
+    optionsVersion = 0;
+
     rhs = new DifferentialEquation( *arg.rhs );
 
     m   = arg.m              ;
@@ -591,6 +635,24 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
     etaH3      = NULL;
 
 
+    // COMPRESSED SENSITIVITIES:
+    // -------------------------
+    sensVarIndex = NULL;
+    sensColStart = NULL;
+    sensRowIdx   = NULL;
+    sensColor    = NULL;
+    sensSeed     = NULL;
+    sensResult   = NULL;
+
+    nSensCols    =  0;
+    nSensEntries = -1;
+    nSensColors  =  0;
+
+    forwardCompressed = BT_FALSE;
+
+    jacobianColoring = arg.jacobianColoring;
+
+
     // THE STATE OF AGGREGATION:
     // -------------------------
     soa        = arg.soa;
@@ -664,6 +726,8 @@ returnValue IntegratorRK::evaluate( const DVector &x0  ,
 
     timeInterval  = t_;
 
+    stageJacobianValid.assign( stageJacobianValid.size(), BT_FALSE );
+
     xStore.init(  m, timeInterval );
     iStore.init( mn, timeInterval );
 
@@ -738,9 +802,6 @@ returnValue IntegratorRK::evaluate( const DVector &x0  ,
      // Initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
             diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
 
@@ -814,10 +875,7 @@ returnValue IntegratorRK::evaluate( const DVector &x0  ,
             printIntermediateResults();
         }
 	
-	int printIntegratorProfile = 0;
-	get( PRINT_INTEGRATOR_PROFILE,printIntegratorProfile );
-	
-	if ( (BooleanType)printIntegratorProfile == BT_TRUE )
+	if ( (BooleanType)printProfile == BT_TRUE )
 	{
 		printRunTimeProfile( );
 	}
@@ -1086,6 +1144,41 @@ returnValue IntegratorRK::evaluateSensitivities(){
     }
 
 
+    // THE SECOND ORDER SWEEPS RELY ON THE FIRST ORDER DIRECTION STORED BY THE
+    // PRECEDING FORWARD SWEEP. IF THAT SWEEP HAS USED THE CACHED JACOBIANS,
+    // IT IS REPEATED WITHOUT COMPRESSION FIRST:
+    // -----------------------------------------------------------------------
+    if( forwardCompressed == BT_TRUE && ( nFDirs2 != 0 || nBDirs2 != 0 ) ){
+
+        int nFDirs2_ = nFDirs2;
+        int nBDirs2_ = nBDirs2;
+        int coloring = jacobianColoring;
+
+        nFDirs2 = 0; nBDirs2 = 0; jacobianColoring = BT_FALSE;
+        returnvalue = evaluateSensitivities();
+        nFDirs2 = nFDirs2_; nBDirs2 = nBDirs2_; jacobianColoring = coloring;
+
+        if( returnvalue != SUCCESSFUL_RETURN && returnvalue != RET_FINAL_STEP_NOT_PERFORMED_YET )
+            return returnvalue;
+    }
+
+    forwardCompressed = BT_FALSE;
+
+    if( jacobianColoring == BT_TRUE && nFDirs != 0 && nBDirs2 == 0 && nFDirs2 == 0 ){
+
+        if( nSensEntries < 0 )
+            determineSensitivityPattern();
+
+        if( nSensEntries > 0 && nSensColors < nSensCols )
+            forwardCompressed = BT_TRUE;
+    }
+
+    if( nFDirs != 0 && nBDirs2 == 0 && nFDirs2 == 0 ){
+        if( forwardCompressed == BT_TRUE ) setLast( LOG_NUMBER_OF_INTEGRATOR_JACOBIAN_SEEDS, nSensColors );
+        else                               setLast( LOG_NUMBER_OF_INTEGRATOR_JACOBIAN_SEEDS, m+mp+mu+mw );
+    }
+
+
     if( nFDirs != 0 ){
         t = timeInterval.getFirstTime();
         dxStore.init( m, timeInterval );
@@ -1288,7 +1381,10 @@ returnValue IntegratorRK::step(int number_){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
 
-         if( soa == SOA_FREEZING_ALL || soa == SOA_EVERYTHING_FROZEN ){
+         if( forwardCompressed == BT_TRUE ){
+             determineEtaGForwardCompressed(dim*number_);
+         }
+         else if( soa == SOA_FREEZING_ALL || soa == SOA_EVERYTHING_FROZEN ){
              determineEtaGForward(dim*number_);
          }
          else{
@@ -1413,9 +1509,6 @@ returnValue IntegratorRK::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
             diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
 
@@ -1776,6 +1869,180 @@ void IntegratorRK::determineEtaGForward( int number_ ){
 
 
 
+void IntegratorRK::determineEtaGForwardCompressed( int number_ ){
+
+    int run1, run2, run3;
+
+    // determine k:
+    // -----------------------------------------------
+       for( run1 = 0; run1 < dim; run1++ ){
+
+           if( (int) stageJacobianValid.size() <= number_+run1 ||
+               stageJacobianValid[number_+run1] == BT_FALSE ){
+               if( evaluateStageJacobian( number_+run1 ) != SUCCESSFUL_RETURN ){
+                   ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+                   return;
+               }
+           }
+
+           for( run2 = 0; run2 < m; run2++ ){
+               G[diff_index[run2]] = etaG[run2];
+               for( run3 = 0; run3 < run1; run3++ ){
+                   G[diff_index[run2]] = G[diff_index[run2]] +
+                                               A[run1][run3]*h[0]*k[run3][run2];
+               }
+               k[run1][run2] = 0.0;
+           }
+
+           const double *J = &stageJacobian[(number_+run1)*nSensEntries];
+
+           for( run2 = 0; run2 < nSensCols; run2++ ){
+               const double g = G[sensVarIndex[run2]];
+               if( acadoIsExactlyZero( g ) == BT_TRUE ) continue;
+               for( run3 = sensColStart[run2]; run3 < sensColStart[run2+1]; run3++ )
+                   k[run1][sensRowIdx[run3]] += J[run3]*g;
+           }
+       }
+
+    // determine etaG:
+    // ----------------------------------------------
+       for( run1 = 0; run1 < dim; run1++ ){
+           for( run2 = 0; run2 < m; run2++ ){
+               etaG[run2] = etaG[run2] + b4[run1]*h[0]*k[run1][run2];
+           }
+       }
+}
+
+
+returnValue IntegratorRK::determineSensitivityPattern( ){
+
+    int run1, run2;
+
+    const int nVars = rhs->getNumberOfVariables()+1+m;
+
+    VariableType  varType  ;
+    int           component;
+    BooleanType  *dependency = new BooleanType[m];
+    BooleanType   isSparse   = rhs->isSymbolic();
+
+    DVector diffComponents = rhs->getDifferentialStateComponents();
+
+    if( sensVarIndex != 0 ) delete[] sensVarIndex;
+    if( sensColStart != 0 ) delete[] sensColStart;
+    if( sensRowIdx   != 0 ) delete[] sensRowIdx  ;
+    if( sensColor    != 0 ) delete[] sensColor   ;
+    if( sensSeed     != 0 ) delete[] sensSeed    ;
+    if( sensResult   != 0 ) delete[] sensResult  ;
+
+    nSensCols    = m + mp + mu + mw;
+    nSensEntries = 0;
+
+    sensVarIndex = new int[nSensCols  ];
+    sensColStart = new int[nSensCols+1];
+    sensRowIdx   = new int[nSensCols*m];
+    sensColor    = new int[nSensCols  ];
+    sensSeed     = new double[nVars];
+    sensResult   = new double[m];
+
+    for( run1 = 0; run1 < nVars; run1++ )
+        sensSeed[run1] = 0.0;
+
+    int *colIdx = new int[nSensCols*m];
+
+    for( run1 = 0; run1 < nSensCols; run1++ ){
+
+        if( run1 < m ){
+            varType   = VT_DIFFERENTIAL_STATE;
+            component = (int) diffComponents(run1);
+            sensVarIndex[run1] = diff_index[run1];
+        }
+        else if( run1 < m+mp ){
+            varType   = VT_PARAMETER;
+            component = run1-m;
+            sensVarIndex[run1] = parameter_index[component];
+        }
+        else if( run1 < m+mp+mu ){
+            varType   = VT_CONTROL;
+            component = run1-m-mp;
+            sensVarIndex[run1] = control_index[component];
+        }
+        else{
+            varType   = VT_DISTURBANCE;
+            component = run1-m-mp-mu;
+            sensVarIndex[run1] = disturbance_index[component];
+        }
+
+        if( isSparse == BT_FALSE ||
+            rhs->getDependencyPattern( 1, &varType, &component, dependency ) != SUCCESSFUL_RETURN ){
+            for( run2 = 0; run2 < m; run2++ )
+                dependency[run2] = BT_TRUE;
+        }
+
+        sensColStart[run1] = nSensEntries;
+        for( run2 = 0; run2 < m; run2++ ){
+            if( dependency[run2] == BT_TRUE ){
+                sensRowIdx[nSensEntries] = run2;
+                colIdx    [nSensEntries] = run1;
+                nSensEntries++;
+            }
+        }
+    }
+    sensColStart[nSensCols] = nSensEntries;
+
+    if( isSparse == BT_TRUE ){
+        nSensColors = determineColumnColoring( m, nSensCols, nSensEntries, sensRowIdx, colIdx, sensColor );
+    }
+    else{
+        for( run1 = 0; run1 < nSensCols; run1++ )
+            sensColor[run1] = run1;
+        nSensColors = nSensCols;
+    }
+
+    delete[] colIdx;
+    delete[] dependency;
+
+    stageJacobian.clear();
+    stageJacobianValid.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorRK::evaluateStageJacobian( int number_ ){
+
+    int run1, run2, run3;
+
+    if( (int) stageJacobianValid.size() <= number_ ){
+        stageJacobian.resize( (number_+1)*nSensEntries );
+        stageJacobianValid.resize( number_+1, BT_FALSE );
+    }
+
+    double *J = &stageJacobian[number_*nSensEntries];
+
+    for( run1 = 0; run1 < nSensColors; run1++ ){
+
+        for( run2 = 0; run2 < nSensCols; run2++ )
+            if( sensColor[run2] == run1 )
+                sensSeed[sensVarIndex[run2]] = 1.0;
+
+        if( rhs[0].AD_forward( number_, sensSeed, sensResult ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+
+        for( run2 = 0; run2 < nSensCols; run2++ ){
+            if( sensColor[run2] == run1 ){
+                sensSeed[sensVarIndex[run2]] = 0.0;
+                for( run3 = sensColStart[run2]; run3 < sensColStart[run2+1]; run3++ )
+                    J[run3] = sensResult[sensRowIdx[run3]];
+            }
+        }
+    }
+
+    stageJacobianValid[number_] = BT_TRUE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 void IntegratorRK::determineEtaGForward2( int number_ ){
 
     int run1, run2, run3;
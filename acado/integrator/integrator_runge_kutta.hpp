@@ -375,6 +375,28 @@ protected:
     void determineEtaGForward( int number );
 
 
+    /** computes etaG in forward direction from the cached stage Jacobians \n
+     *  (only for internal use)                                           \n
+     */
+    void determineEtaGForwardCompressed( int number );
+
+
+    /** Determines the sparsity pattern of the stage Jacobians w.r.t. the  \n
+     *  states, parameters, controls and disturbances together with a     \n
+     *  coloring of its columns (only for internal use).                  \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     */
+    returnValue determineSensitivityPattern( );
+
+
+    /** Evaluates the stage Jacobian at the given storage position by one  \n
+     *  forward sweep per color (only for internal use).                  \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45              \n
+     */
+    returnValue evaluateStageJacobian( int number );
+
+
     /** computes etaG and etaG2 in forward direction                       \n
      *  (only for internal use)                                            \n
      */
@@ -479,6 +501,24 @@ protected:
     double    *etaH3           ;  /**< Sensitivity matrix (only internal use)             */
 
 
+    // COMPRESSED SENSITIVITIES:
+    // -------------------------
+    int       *sensVarIndex    ;  /**< variable index of each column of the stage Jacobian */
+    int       *sensColStart    ;  /**< first non-zero of each column                       */
+    int       *sensRowIdx      ;  /**< row indices of the structural non-zeros             */
+    int       *sensColor       ;  /**< the color of each column                            */
+    int        nSensCols       ;  /**< number of columns of the stage Jacobian             */
+    int        nSensEntries    ;  /**< number of structural non-zeros (-1: unknown)        */
+    int        nSensColors     ;  /**< number of forward sweeps per stage Jacobian         */
+    double    *sensSeed        ;  /**< seed of the colored sweeps (only internal use)      */
+    double    *sensResult      ;  /**< result of the colored sweeps (only internal use)    */
+
+    std::vector<double>      stageJacobian     ;  /**< the cached stage Jacobians          */
+    std::vector<BooleanType> stageJacobianValid;  /**< validity of the cached Jacobians    */
+
+    BooleanType forwardCompressed;  /**< whether the last forward sweep used the cache     */
+
+
     // STORAGE:
     // --------
     int maxAlloc                ;  /**< size of the memory that is allocated to store      \n
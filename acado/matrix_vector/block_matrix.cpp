@@ -42,19 +42,19 @@ BEGIN_NAMESPACE_ACADO
 
 BlockMatrix::BlockMatrix( )
 {
-	nRows = nCols = 0;
+	reset(0, 0);
 }
 
 BlockMatrix::BlockMatrix( uint _nRows, uint _nCols )
 {
-	init(_nRows, _nCols);
+	reset(_nRows, _nCols);
 }
 
 
 BlockMatrix::BlockMatrix(	const DMatrix& value
 							)
 {
-	init(1, 1);
+	reset(1, 1);
 
 	setDense(0, 0, value);
 }
@@ -64,16 +64,7 @@ BlockMatrix::~BlockMatrix( )
 
 returnValue BlockMatrix::init( uint _nRows, uint _nCols )
 {
-	nRows = _nRows;
-	nCols = _nCols;
-
-	vector< DMatrix > foo(nCols, DMatrix());
-	for (unsigned row = 0; row < nRows; ++row)
-		elements.push_back( foo );
-
-	vector< SubBlockMatrixType > bar(nCols, SBMT_ZERO);
-	for (unsigned row = 0; row < nRows; ++row)
-		types.push_back( bar );
+	reset(_nRows, _nCols);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -83,27 +74,8 @@ BlockMatrix BlockMatrix::operator+( const BlockMatrix& arg ) const{
 
 	ASSERT( ( getNumRows( ) == arg.getNumRows( ) ) && ( getNumCols( ) == arg.getNumCols( ) ) );
 
-	uint i,j;
-
 	BlockMatrix tmp( arg );
-
-	for( i=0; i < getNumRows(); i++ ){
-        for( j=0; j < getNumCols(); j++ ){
-
-            if( tmp.types[i][j] == SBMT_ZERO ){
-
-                tmp.types    [i][j] = types    [i][j];
-                tmp.elements [i][j] = elements [i][j];
-            }
-            else{
-                if( types[i][j] != SBMT_ZERO ){
-
-                   tmp.types    [i][j]  = SBMT_DENSE     ;
-                   tmp.elements [i][j] += elements [i][j];
-                }
-            }
-        }
-    }
+	tmp += *this;
 
 	return tmp;
 }
@@ -113,25 +85,42 @@ BlockMatrix& BlockMatrix::operator+=( const BlockMatrix& arg ){
 
 	ASSERT( ( getNumRows( ) == arg.getNumRows( ) ) && ( getNumCols( ) == arg.getNumCols( ) ) );
 
-	uint i, j;
+	if( &arg == this ){
+
+		BlockMatrix tmp( arg );
+		return operator+=( tmp );
+	}
+
+	uint i, run1;
+	int idx;
 
 	for( i = 0; i < getNumRows(); i++ ){
-        for( j = 0; j < getNumCols(); j++ ){
 
-            if( types[i][j] == SBMT_ZERO ){
+		// zero blocks without counterpart in arg become empty
+		for( run1 = rowStart[i+1]; run1 > rowStart[i]; run1-- ){
 
-                types    [i][j] = arg.types    [i][j];
-                elements [i][j] = arg.elements [i][j];
-            }
-            else{
-                if( arg.types[i][j] != SBMT_ZERO ){
+			if( blocks[run1-1].type == SBMT_ZERO && arg.findBlock( i, blocks[run1-1].col ) < 0 )
+				eraseBlock( i, run1-1 );
+		}
+
+		for( run1 = arg.rowStart[i]; run1 < arg.rowStart[i+1]; run1++ ){
+
+			idx = findBlock( i, arg.blocks[run1].col );
+
+			if( idx < 0 || blocks[idx].type == SBMT_ZERO ){
+
+				assignBlock( i, arg.blocks[run1].col, arg, run1 );
+			}
+			else{
+				if( arg.blocks[run1].type != SBMT_ZERO ){
+
+					makeDense( idx );
+					addBlock( idx, 1.0, arg, run1 );
+				}
+			}
+		}
+	}
 
-                   types    [i][j]  = SBMT_DENSE         ;
-                   elements [i][j] += arg.elements [i][j];
-                }
-            }
-        }
-    }
 	return *this;
 }
 
@@ -140,32 +129,46 @@ BlockMatrix BlockMatrix::operator-( const BlockMatrix& arg ) const{
 
     ASSERT( ( getNumRows( ) == arg.getNumRows( ) ) && ( getNumCols( ) == arg.getNumCols( ) ) );
 
-    uint i,j;
+    uint i, j, a, b;
+    int idxA, idxB;
+    uint idx;
 
     BlockMatrix tmp( getNumRows(), getNumCols() );
 
-    for( i=0; i < getNumRows(); i++ ){
-        for( j=0; j < getNumCols(); j++ ){
+    for( i = 0; i < getNumRows(); i++ ){
+
+        a = rowStart[i];
+        b = arg.rowStart[i];
+
+        // merge the sorted block columns of both rows
+        while( a < rowStart[i+1] || b < arg.rowStart[i+1] ){
+
+            if( b == arg.rowStart[i+1] || ( a < rowStart[i+1] && blocks[a].col < arg.blocks[b].col ) )
+                j = blocks[a].col;
+            else
+                j = arg.blocks[b].col;
+
+            idxA = ( a < rowStart[i+1]     && blocks[a].col     == j ) ? (int) a++ : -1;
+            idxB = ( b < arg.rowStart[i+1] && arg.blocks[b].col == j ) ? (int) b++ : -1;
 
-            if( arg.types[i][j] == SBMT_ZERO ){
+            if( idxB < 0 || arg.blocks[idxB].type == SBMT_ZERO ){
 
-                tmp.types    [i][j] = types    [i][j];
-                tmp.elements [i][j] = elements [i][j];
+                tmp.assignBlock( i, j, *this, idxA );
             }
             else{
-                if( types[i][j] != SBMT_ZERO ){
+                if( idxA >= 0 && blocks[idxA].type != SBMT_ZERO ){
 
-                   tmp.types    [i][j]  = SBMT_DENSE;
-                   tmp.elements [i][j]  = elements [i][j] - arg.elements[i][j];
+                    tmp.assignBlock( i, j, *this, idxA );
+                    idx = tmp.findBlock( i, j );
+                    tmp.makeDense( idx );
                 }
                 else{
 
-                   DMatrix nn(arg.elements[i][j].getNumRows(),arg.elements[i][j].getNumCols());
-                   nn.setZero();
-
-                   tmp.types    [i][j]  = SBMT_DENSE;
-                   tmp.elements [i][j]  = nn - arg.elements[i][j];
+                    idx = tmp.insertBlock( i, j );
+                    tmp.allocateBlock( idx, arg.blocks[idxB].nRows, arg.blocks[idxB].nCols );
+                    tmp.getBlock( idx ).setZero();
                 }
+                tmp.addBlock( idx, -1.0, arg, idxB );
             }
         }
     }
@@ -175,171 +178,99 @@ BlockMatrix BlockMatrix::operator-( const BlockMatrix& arg ) const{
 
 BlockMatrix BlockMatrix::operator*=( double scalar ){
 
-	uint i,j;
-
- 	for( i=0; i < getNumRows(); i++ ){
-        for( j=0; j < getNumCols(); j++ ){
-            if( types[i][j] != SBMT_ZERO ){
-                types   [i][j]  = SBMT_DENSE;
-                elements[i][j] *= scalar    ;
-            }
-        }
-    }
+	for( uint run1 = 0; run1 < blocks.size(); run1++ ){
+		if( blocks[run1].type != SBMT_ZERO ){
+			makeDense( run1 );
+			getBlock( run1 ) *= scalar;
+		}
+	}
 	return *this;
 }
 
 
 BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
 
-    ASSERT( getNumCols( ) == arg.getNumRows( ) );
-
-    uint i,j,k;
-
-    uint newNumRows = getNumRows( );
-    uint newNumCols = arg.getNumCols( );
-    BlockMatrix result( newNumRows,newNumCols );
-
-    for( i=0; i<newNumRows; ++i ){
-        for( k=0; k<getNumCols( ); ++k ){
-
-            switch( types[i][k] ){
+    BlockMatrix result;
+    multiply( arg, result );
 
-                case SBMT_DENSE:
-
-                    for( j=0; j<newNumCols; ++j ){
-
-                        if( arg.types[k][j] == SBMT_DENSE ){
+    return result;
+}
 
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[i][k] * arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[i][k] * arg.elements[k][j];
-                        }
 
-                        if( arg.types[k][j] == SBMT_ONE ){
+BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
 
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[i][k];
-                            else  result.elements[i][j]  = elements[i][k];
-                        }
+	BlockMatrix result;
+	multiplyTransposed( arg, result );
 
-                        if( arg.types[k][j] != SBMT_ZERO )
-                            result.types[i][j]  = SBMT_DENSE;
-                    }
-                    break;
+	return result;
+}
 
 
-                case SBMT_ONE:
+returnValue BlockMatrix::multiply( const BlockMatrix& arg, BlockMatrix& result ) const{
 
-                    for( j=0; j<newNumCols; ++j ){
+    ASSERT( getNumCols( ) == arg.getNumRows( ) );
 
-                         if( arg.types[k][j] == SBMT_DENSE ){
+    if( ( &result == this ) || ( &result == &arg ) ){
 
-                             if( result.types[i][j] != SBMT_ZERO )
-                                   result.elements[i][j] += arg.elements[k][j];
-                             else  result.elements[i][j]  = arg.elements[k][j];
+        BlockMatrix tmp;
+        multiply( arg, tmp );
+        result = tmp;
 
-                             result.types[i][j]  = SBMT_DENSE;
-                         }
+        return SUCCESSFUL_RETURN;
+    }
 
-                         if( arg.types[k][j] == SBMT_ONE ){
+    uint i, k, ik, kj;
 
-                             if( result.types[i][j] == SBMT_ZERO ){
-                                   result.elements[i][j]  = elements[i][k];
-                                   result.types   [i][j]  = SBMT_ONE      ;
-                             }
-                             else{
-                                   result.elements[i][j] += elements[i][k];
-                                   result.types   [i][j]  = SBMT_DENSE    ;
-                             }
-                         }
-                     }
-                     break;
+    result.reset( getNumRows( ), arg.getNumCols( ) );
 
-                case SBMT_ZERO:
+    for( i = 0; i < getNumRows( ); ++i ){
+        for( ik = rowStart[i]; ik < rowStart[i+1]; ++ik ){
 
-                     break;
+            if( blocks[ik].type == SBMT_ZERO )
+                continue;
 
-                default:
-                     break;
-            }
+            k = blocks[ik].col;
+            for( kj = arg.rowStart[k]; kj < arg.rowStart[k+1]; ++kj )
+                if( arg.blocks[kj].type != SBMT_ZERO )
+                    result.addBlockProduct( i, arg.blocks[kj].col, *this, ik, BT_FALSE, arg, kj );
         }
     }
 
-    return result;
+    return SUCCESSFUL_RETURN;
 }
 
 
-BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
-
-	ASSERT( getNumRows( ) == arg.getNumRows( ) );
-
-	uint i,j,k;
-
-	uint newNumRows = getNumCols( );
-	uint newNumCols = arg.getNumCols( );
-	BlockMatrix result( newNumRows,newNumCols );
-
-    for( i=0; i<newNumRows; ++i ){
-        for( k=0; k<getNumRows( ); ++k ){
-
-            switch( types[k][i] ){
+returnValue BlockMatrix::multiplyTransposed( const BlockMatrix& arg, BlockMatrix& result ) const{
 
-                case SBMT_DENSE:
+    ASSERT( getNumRows( ) == arg.getNumRows( ) );
 
-                    for( j=0; j<newNumCols; ++j ){
+    if( ( &result == this ) || ( &result == &arg ) ){
 
-                        if( arg.types[k][j] == SBMT_DENSE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[k][i].transpose() * arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[k][i].transpose() * arg.elements[k][j];
-                        }
+        BlockMatrix tmp;
+        multiplyTransposed( arg, tmp );
+        result = tmp;
 
-                        if( arg.types[k][j] == SBMT_ONE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[k][i].transpose();
-                            else  result.elements[i][j]  = elements[k][i].transpose();
-                        }
-
-                        if( arg.types[k][j] != SBMT_ZERO )
-                             result.types[i][j]  = SBMT_DENSE;
-                    }
-                    break;
-
-
-                case SBMT_ONE:
-
-                    for( j=0; j<newNumCols; ++j ){
+        return SUCCESSFUL_RETURN;
+    }
 
-                        if( arg.types[k][j] == SBMT_DENSE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += arg.elements[k][j];
-                            else  result.elements[i][j]  = arg.elements[k][j];
-                            result.types[i][j]  = SBMT_DENSE;
-                        }
+    uint k, ki, kj;
 
-                        if( arg.types[k][j] == SBMT_ONE ){
+    result.reset( getNumCols( ), arg.getNumCols( ) );
 
-                            if( result.types[i][j] == SBMT_ZERO ){
-                                  result.elements[i][j]  = elements[k][i];
-                                  result.types   [i][j]  = SBMT_ONE      ;
-                            }
-                            else{
-                                  result.elements[i][j] += elements[k][i];
-                                  result.types   [i][j]  = SBMT_DENSE    ;
-                            }
-                        }
-                    }
-                    break;
+    // products are accumulated in increasing order of k, as for the untransposed case
+    for( k = 0; k < getNumRows( ); ++k ){
+        for( ki = rowStart[k]; ki < rowStart[k+1]; ++ki ){
 
-                case SBMT_ZERO:
-                     break;
+            if( blocks[ki].type == SBMT_ZERO )
+                continue;
 
-                default:
-                     break;
-            }
+            for( kj = arg.rowStart[k]; kj < arg.rowStart[k+1]; ++kj )
+                if( arg.blocks[kj].type != SBMT_ZERO )
+                    result.addBlockProduct( blocks[ki].col, arg.blocks[kj].col, *this, ki, BT_TRUE, arg, kj );
         }
     }
-	return result;
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -347,12 +278,23 @@ BlockMatrix BlockMatrix::transpose() const{
 
      BlockMatrix result( getNumCols(), getNumRows() );
 
-     uint i,j;
+     uint i, run1, idx;
 
      for( i = 0; i < getNumRows(); i++ ){
-         for( j = 0; j < getNumCols(); j++ ){
-             result.elements[j][i] = elements[i][j].transpose();
-             result.types   [j][i] = types   [i][j]            ;
+         for( run1 = rowStart[i]; run1 < rowStart[i+1]; run1++ ){
+
+             const BlockEntry& block = blocks[run1];
+             idx = result.insertBlock( block.col, i );
+
+             if( block.type == SBMT_DENSE ){
+                 result.allocateBlock( idx, block.nCols, block.nRows );
+                 result.getBlock( idx ) = getBlock( run1 ).transpose();
+             }
+             else{
+                 result.blocks[idx].type  = block.type;
+                 result.blocks[idx].nRows = block.nCols;
+                 result.blocks[idx].nCols = block.nRows;
+             }
          }
      }
 
@@ -366,13 +308,13 @@ BlockMatrix BlockMatrix::getAbsolute() const{
     BlockMatrix result( nRows, nCols );
 
     for( run1 = 0; run1 < nRows; run1++ ){
-        for( run2 = 0; run2 < nCols; run2++ ){
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
 
-            if( types[run1][run2] == SBMT_ONE )
-                result.setIdentity( run1, run2, elements[run1][run2].getNumRows() );
+            if( blocks[run2].type == SBMT_ONE )
+                result.setIdentity( run1, blocks[run2].col, blocks[run2].nRows );
 
-            if( types[run1][run2] == SBMT_DENSE )
-                result.setDense( run1, run2, elements[run1][run2].absolute() );
+            if( blocks[run2].type == SBMT_DENSE )
+                result.setDense( run1, blocks[run2].col, DMatrix( getBlock( run2 ) ).absolute() );
         }
     }
 
@@ -386,13 +328,13 @@ BlockMatrix BlockMatrix::getPositive() const{
     BlockMatrix result( nRows, nCols );
 
     for( run1 = 0; run1 < nRows; run1++ ){
-        for( run2 = 0; run2 < nCols; run2++ ){
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
 
-            if( types[run1][run2] == SBMT_ONE )
-                result.setIdentity( run1, run2, elements[run1][run2].getNumRows() );
+            if( blocks[run2].type == SBMT_ONE )
+                result.setIdentity( run1, blocks[run2].col, blocks[run2].nRows );
 
-            if( types[run1][run2] == SBMT_DENSE )
-                result.setDense( run1, run2, elements[run1][run2].positive() );
+            if( blocks[run2].type == SBMT_DENSE )
+                result.setDense( run1, blocks[run2].col, DMatrix( getBlock( run2 ) ).positive() );
         }
     }
 
@@ -406,10 +348,10 @@ BlockMatrix BlockMatrix::getNegative() const{
     BlockMatrix result( nRows, nCols );
 
     for( run1 = 0; run1 < nRows; run1++ ){
-        for( run2 = 0; run2 < nCols; run2++ ){
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
 
-            if( types[run1][run2] == SBMT_DENSE )
-                result.setDense( run1, run2, elements[run1][run2].negative() );
+            if( blocks[run2].type == SBMT_DENSE )
+                result.setDense( run1, blocks[run2].col, DMatrix( getBlock( run2 ) ).negative() );
         }
     }
 
@@ -426,15 +368,15 @@ returnValue BlockMatrix::print( std::ostream& stream) const
 		stream << "Row " << i << endl;
 		for (unsigned j = 0; j < getNumCols(); ++j)
 		{
-            if(nRows * nCols)
-            {
-                if( types[i][j] == SBMT_DENSE ) stream << elements[i][j] << endl;
-                if( types[i][j] == SBMT_ONE   ) stream << "ONE " << endl;
-                if( types[i][j] == SBMT_ZERO  ) stream << "ZERO " <<  endl;
-            }
-            else
-            	stream << "ZERO " << endl;
-            stream << endl;
+			int idx = findBlock(i, j);
+
+			if (idx >= 0 && blocks[ idx ].type == SBMT_DENSE)
+				stream << DMatrix( getBlock( idx ) ) << endl;
+			else if (idx >= 0 && blocks[ idx ].type == SBMT_ONE)
+				stream << "ONE " << endl;
+			else
+				stream << "ZERO " << endl;
+			stream << endl;
 		}
 		stream << endl << endl;
 	}
@@ -448,8 +390,10 @@ returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, const DMatrix& valu
 	ASSERT( rowIdx < getNumRows( ) );
 	ASSERT( colIdx < getNumCols( ) );
 
-    elements[rowIdx][colIdx] = value     ;
-    types   [rowIdx][colIdx] = SBMT_DENSE;
+    uint idx = insertBlock( rowIdx, colIdx );
+
+    allocateBlock( idx, value.getNumRows( ), value.getNumCols( ) );
+    getBlock( idx ) = value;
 
     return SUCCESSFUL_RETURN;
 }
@@ -460,9 +404,11 @@ returnValue BlockMatrix::addDense( uint rowIdx, uint colIdx, const DMatrix& valu
 	ASSERT( rowIdx < getNumRows( ) );
 	ASSERT( colIdx < getNumCols( ) );
 
-    if( types[rowIdx][colIdx] == SBMT_DENSE || types[rowIdx][colIdx] == SBMT_ONE ){
-        types[rowIdx][colIdx] = SBMT_DENSE;
-        elements[rowIdx][colIdx] += value;
+    int idx = findBlock( rowIdx, colIdx );
+
+    if( idx >= 0 && blocks[idx].type != SBMT_ZERO ){
+        makeDense( idx );
+        getBlock( idx ) += value;
         return SUCCESSFUL_RETURN;
     }
 
@@ -477,22 +423,286 @@ returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx,
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
+    int idx = findBlock( rowIdx, colIdx );
 
-    if( types[rowIdx][colIdx] != SBMT_ZERO ){
+    if( idx >= 0 && blocks[idx].type != SBMT_ZERO ){
 
-        ASSERT( nR == elements[rowIdx][colIdx].getNumRows( ) );
-        ASSERT( nC == elements[rowIdx][colIdx].getNumCols( ) );
+        ASSERT( nR == blocks[idx].nRows );
+        ASSERT( nC == blocks[idx].nCols );
 
-        value = elements[rowIdx][colIdx];
-    }
-    else{
-        value.resize(nR, nC);
-        value.setZero();
+        return getSubBlock( rowIdx, colIdx, value );
     }
 
+    value.resize(nR, nC);
+    value.setZero();
+
     return SUCCESSFUL_RETURN;
 }
 
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void BlockMatrix::reset( uint _nRows, uint _nCols )
+{
+	nRows = _nRows;
+	nCols = _nCols;
+
+	rowStart.assign(nRows + 1, 0);
+	blocks.clear();
+	values.clear();
+	nGarbage = 0;
+}
+
+
+int BlockMatrix::findBlock( uint rowIdx, uint colIdx ) const
+{
+	uint lo = rowStart[ rowIdx ];
+	uint hi = rowStart[rowIdx + 1];
+
+	while (lo < hi)
+	{
+		uint mid = (lo + hi) / 2;
+
+		if (blocks[ mid ].col < colIdx)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < rowStart[rowIdx + 1] && blocks[ lo ].col == colIdx)
+		return (int)lo;
+
+	return -1;
+}
+
+
+uint BlockMatrix::insertBlock( uint rowIdx, uint colIdx )
+{
+	uint lo = rowStart[ rowIdx ];
+	uint hi = rowStart[rowIdx + 1];
+
+	while (lo < hi)
+	{
+		uint mid = (lo + hi) / 2;
+
+		if (blocks[ mid ].col < colIdx)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < rowStart[rowIdx + 1] && blocks[ lo ].col == colIdx)
+		return lo;
+
+	BlockEntry block;
+	block.col = colIdx;
+	block.type = SBMT_ZERO;
+	block.nRows = block.nCols = 0;
+	block.offset = block.capacity = 0;
+
+	blocks.insert(blocks.begin() + lo, block);
+	for (uint row = rowIdx + 1; row <= nRows; ++row)
+		++rowStart[ row ];
+
+	return lo;
+}
+
+
+void BlockMatrix::eraseBlock( uint rowIdx, uint blockIdx )
+{
+	nGarbage += blocks[ blockIdx ].capacity;
+
+	blocks.erase(blocks.begin() + blockIdx);
+	for (uint row = rowIdx + 1; row <= nRows; ++row)
+		--rowStart[ row ];
+}
+
+
+void BlockMatrix::allocateBlock( uint blockIdx, uint nR, uint nC )
+{
+	BlockEntry& block = blocks[ blockIdx ];
+
+	if (block.capacity < nR * nC)
+	{
+		// values of the block are moved to the end of the buffer
+		nGarbage += block.capacity;
+		block.capacity = 0;
+
+		if (2 * nGarbage > values.size())
+			compact();
+
+		block.offset = values.size();
+		block.capacity = nR * nC;
+		values.resize(values.size() + nR * nC);
+	}
+
+	block.type = SBMT_DENSE;
+	block.nRows = nR;
+	block.nCols = nC;
+}
+
+
+void BlockMatrix::makeDense( uint blockIdx )
+{
+	SubBlockMatrixType type = blocks[ blockIdx ].type;
+
+	if (type == SBMT_DENSE)
+		return;
+
+	allocateBlock(blockIdx, blocks[ blockIdx ].nRows, blocks[ blockIdx ].nCols);
+
+	if (type == SBMT_ONE)
+		getBlock( blockIdx ).setIdentity();
+	else
+		getBlock( blockIdx ).setZero();
+}
+
+
+void BlockMatrix::assignBlock( uint rowIdx, uint colIdx, const BlockMatrix& arg, int blockIdx )
+{
+	ASSERT( &arg != this );
+
+	if (blockIdx < 0)
+	{
+		int idx = findBlock(rowIdx, colIdx);
+		if (idx >= 0)
+			eraseBlock(rowIdx, idx);
+
+		return;
+	}
+
+	const BlockEntry& block = arg.blocks[ blockIdx ];
+	uint idx = insertBlock(rowIdx, colIdx);
+
+	if (block.type == SBMT_DENSE)
+	{
+		allocateBlock(idx, block.nRows, block.nCols);
+		getBlock( idx ) = arg.getBlock( blockIdx );
+	}
+	else
+	{
+		blocks[ idx ].type = block.type;
+		blocks[ idx ].nRows = block.nRows;
+		blocks[ idx ].nCols = block.nCols;
+	}
+}
+
+
+void BlockMatrix::addBlock( uint blockIdx, double alpha, const BlockMatrix& arg, uint argIdx )
+{
+	ASSERT( blocks[ blockIdx ].type == SBMT_DENSE );
+
+	switch ( arg.blocks[ argIdx ].type )
+	{
+	case SBMT_DENSE:
+		getBlock( blockIdx ) += alpha * arg.getBlock( argIdx );
+		break;
+
+	case SBMT_ONE:
+		getBlock( blockIdx ).diagonal().array() += alpha;
+		break;
+
+	default:
+		break;
+	}
+}
+
+
+void BlockMatrix::addBlockProduct(	uint rowIdx, uint colIdx,
+									const BlockMatrix& lhs, uint lhsIdx, BooleanType transposeLhs,
+									const BlockMatrix& rhs, uint rhsIdx
+									)
+{
+	const BlockEntry& left  = lhs.blocks[ lhsIdx ];
+	const BlockEntry& right = rhs.blocks[ rhsIdx ];
+
+	int idx = findBlock(rowIdx, colIdx);
+	BooleanType isZero = ( idx < 0 || blocks[ idx ].type == SBMT_ZERO ) ? BT_TRUE : BT_FALSE;
+
+	if (idx < 0)
+		idx = insertBlock(rowIdx, colIdx);
+
+	if (left.type == SBMT_ONE)
+	{
+		if (right.type == SBMT_ONE && isZero == BT_TRUE)
+		{
+			blocks[ idx ].type = SBMT_ONE;
+			blocks[ idx ].nRows = blocks[ idx ].nCols = left.nRows;
+		}
+		else if (isZero == BT_TRUE)
+		{
+			assignBlock(rowIdx, colIdx, rhs, rhsIdx);
+		}
+		else
+		{
+			makeDense( idx );
+			addBlock(idx, 1.0, rhs, rhsIdx);
+		}
+
+		return;
+	}
+
+	uint nR = transposeLhs == BT_TRUE ? left.nCols : left.nRows;
+	uint nC = right.type == SBMT_ONE ? ( transposeLhs == BT_TRUE ? left.nRows : left.nCols ) : right.nCols;
+
+	if (isZero == BT_TRUE)
+	{
+		allocateBlock(idx, nR, nC);
+		BlockMap result = getBlock( idx );
+
+		if (right.type == SBMT_ONE && transposeLhs == BT_TRUE)
+			result = lhs.getBlock( lhsIdx ).transpose();
+		else if (right.type == SBMT_ONE)
+			result = lhs.getBlock( lhsIdx );
+		else if (transposeLhs == BT_TRUE)
+			result.noalias() = lhs.getBlock( lhsIdx ).transpose() * rhs.getBlock( rhsIdx );
+		else
+			result.noalias() = lhs.getBlock( lhsIdx ) * rhs.getBlock( rhsIdx );
+	}
+	else
+	{
+		makeDense( idx );
+		BlockMap result = getBlock( idx );
+
+		if (right.type == SBMT_ONE && transposeLhs == BT_TRUE)
+			result += lhs.getBlock( lhsIdx ).transpose();
+		else if (right.type == SBMT_ONE)
+			result += lhs.getBlock( lhsIdx );
+		else if (transposeLhs == BT_TRUE)
+			result.noalias() += lhs.getBlock( lhsIdx ).transpose() * rhs.getBlock( rhsIdx );
+		else
+			result.noalias() += lhs.getBlock( lhsIdx ) * rhs.getBlock( rhsIdx );
+	}
+}
+
+
+void BlockMatrix::compact( )
+{
+	std::vector< double > compacted;
+	compacted.reserve(values.size() - nGarbage);
+
+	for (uint run1 = 0; run1 < blocks.size(); ++run1)
+	{
+		BlockEntry& block = blocks[ run1 ];
+
+		// only dense blocks keep their values
+		if (block.type != SBMT_DENSE)
+			block.capacity = 0;
+
+		if (block.capacity == 0)
+			continue;
+
+		compacted.insert(compacted.end(), values.begin() + block.offset, values.begin() + block.offset + block.capacity);
+		block.offset = compacted.size() - block.capacity;
+	}
+
+	values.swap( compacted );
+	nGarbage = 0;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 /*
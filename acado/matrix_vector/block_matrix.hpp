@@ -42,10 +42,16 @@ BEGIN_NAMESPACE_ACADO
  *
  *	\ingroup BasicDataStructures
  *	
- *  The class BlockMatrix is a very rudimentary block sparse matrix class. It is only
+ *  The class BlockMatrix is a very rudimentary block sparse matrix class. It is
  *  intended to provide a convenient way to deal with linear algebra objects
- *  and to provide a wrapper for more efficient implementations. It should
- *  not be used for efficiency-critical operations.
+ *  and to provide a wrapper for more efficient implementations.
+ *
+ *  Blocks are stored in block-compressed-row format: only non-empty blocks
+ *  are stored, ordered by block row and block column. Zero and identity
+ *  blocks are kept as tags without values, while the values of all dense
+ *  blocks live in one contiguous buffer. The methods multiply() and
+ *  multiplyTransposed() compute block products into a preallocated result,
+ *  reusing its memory from previous calls.
  *
  *	 \author Boris Houska, Hans Joachim Ferreau, Milan Vukov
  */
@@ -129,6 +135,20 @@ class BlockMatrix
 		 *  \return Temporary object containing result of multiplication. */
 		BlockMatrix operator^( const BlockMatrix& arg	/**< Block DMatrix Factor. */ ) const;
 
+		/** Multiplies a matrix from the right to the matrix object and stores
+		 *  the result into a given block matrix, reusing its memory.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue multiply(	const BlockMatrix& arg,	/**< Block DMatrix Factor. */
+								BlockMatrix& result		/**< Output: Result of multiplication. */
+								) const;
+
+		/** Multiplies a matrix from the right to the transposed matrix object and
+		 *  stores the result into a given block matrix, reusing its memory.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue multiplyTransposed(	const BlockMatrix& arg,	/**< Block DMatrix Factor. */
+										BlockMatrix& result		/**< Output: Result of multiplication. */
+										) const;
+
 		/** Returns number of block rows of the block matrix object.
 		 *  \return Number of rows. */
 		inline uint getNumRows( ) const;
@@ -203,6 +223,66 @@ class BlockMatrix
 		returnValue print(	std::ostream& stream = std::cout
 							) const;
 
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+		/** Sparsity information of a stored block. */
+		struct BlockEntry
+		{
+			uint col;					/**< Block column index. */
+			SubBlockMatrixType type;	/**< Type of the block. */
+			uint nRows;					/**< Number of rows of the block. */
+			uint nCols;					/**< Number of columns of the block. */
+			uint offset;				/**< Offset of the block values within the value buffer. */
+			uint capacity;				/**< Number of values reserved for the block. */
+		};
+
+		typedef Eigen::Map< DMatrix::Base > BlockMap;
+		typedef Eigen::Map< const DMatrix::Base > ConstBlockMap;
+
+		/** Removes all blocks and sets the block dimensions, keeping allocated memory. */
+		void reset( uint _nRows, uint _nCols );
+
+		/** Returns the index of a stored block, or -1 if the block is not stored. */
+		int findBlock( uint rowIdx, uint colIdx ) const;
+
+		/** Returns the index of a stored block, inserting an empty zero block if needed. */
+		uint insertBlock( uint rowIdx, uint colIdx );
+
+		/** Removes a stored block. */
+		void eraseBlock( uint rowIdx, uint blockIdx );
+
+		/** Makes a block a dense (nR x nC)-block, reusing its values if possible.
+		 *  Block values are left uninitialised. */
+		void allocateBlock( uint blockIdx, uint nR, uint nC );
+
+		/** Turns a zero or identity block into an equivalent dense block. */
+		void makeDense( uint blockIdx );
+
+		/** Copies a block of another block matrix (or removes the block if blockIdx < 0). */
+		void assignBlock( uint rowIdx, uint colIdx, const BlockMatrix& arg, int blockIdx );
+
+		/** Adds a multiple of a block of another block matrix to a dense block. */
+		void addBlock( uint blockIdx, double alpha, const BlockMatrix& arg, uint argIdx );
+
+		/** Adds the product of two blocks of other block matrices to a block;
+		 *  the left factor is optionally transposed. */
+		void addBlockProduct(	uint rowIdx, uint colIdx,
+								const BlockMatrix& lhs, uint lhsIdx, BooleanType transposeLhs,
+								const BlockMatrix& rhs, uint rhsIdx
+								);
+
+		/** Moves the values of all dense blocks to the front of the value buffer. */
+		void compact( );
+
+		/** Returns the values of a dense block. */
+		inline BlockMap getBlock( uint blockIdx );
+
+		/** Returns the values of a dense block. */
+		inline ConstBlockMap getBlock( uint blockIdx ) const;
+
     //
     // DATA MEMBERS:
     //
@@ -211,8 +291,10 @@ class BlockMatrix
 		uint nRows;			/**< Number of rows. */
 		uint nCols;			/**< Number of columns. */
 
-        std::vector< std::vector< DMatrix > > elements;
-        std::vector< std::vector< SubBlockMatrixType > > types;
+		std::vector< uint > rowStart;		/**< Index of the first stored block of each block row. */
+		std::vector< BlockEntry > blocks;	/**< Stored blocks, ordered by block row and column. */
+		std::vector< double > values;		/**< Values of all dense blocks. */
+		uint nGarbage;						/**< Number of values no longer used by any block. */
 };
 
 static       BlockMatrix emptyBlockMatrix;
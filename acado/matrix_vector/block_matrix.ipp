@@ -45,7 +45,32 @@ inline returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx, DMatrix &
 	ASSERT( rowIdx < getNumRows( ) );
 	ASSERT( colIdx < getNumCols( ) );
 
-    value = elements[rowIdx][colIdx];
+    int idx = findBlock( rowIdx, colIdx );
+
+    if( idx < 0 ){
+        value = DMatrix();
+        return SUCCESSFUL_RETURN;
+    }
+
+    const BlockEntry& block = blocks[idx];
+
+    switch( block.type ){
+
+        case SBMT_DENSE:
+            value = getBlock( idx );
+            break;
+
+        case SBMT_ONE:
+            value.resize( block.nRows, block.nCols );
+            value.setIdentity();
+            break;
+
+        default:
+            value.resize( block.nRows, block.nCols );
+            value.setZero();
+            break;
+    }
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -66,7 +91,8 @@ inline uint BlockMatrix::getNumRows( uint rowIdx, uint colIdx ) const{
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
-    return elements[rowIdx][colIdx].getNumRows();
+    int idx = findBlock( rowIdx, colIdx );
+    return idx < 0 ? 0 : blocks[idx].nRows;
 }
 
 
@@ -75,7 +101,8 @@ inline uint BlockMatrix::getNumCols( uint rowIdx, uint colIdx ) const{
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
-    return elements[rowIdx][colIdx].getNumCols();
+    int idx = findBlock( rowIdx, colIdx );
+    return idx < 0 ? 0 : blocks[idx].nCols;
 }
 
 
@@ -84,10 +111,12 @@ inline returnValue BlockMatrix::setIdentity( uint rowIdx, uint colIdx, uint dim
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
-           types   [rowIdx][colIdx] = SBMT_ONE   ;
-           elements[rowIdx][colIdx] = DMatrix(dim, dim);     
-    elements[rowIdx][colIdx].setIdentity();
-    
+    BlockEntry& block = blocks[ insertBlock( rowIdx, colIdx ) ];
+
+    block.type  = SBMT_ONE;
+    block.nRows = dim;
+    block.nCols = dim;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -97,8 +126,10 @@ inline returnValue BlockMatrix::setZero( uint rowIdx, uint colIdx ){
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
-           types   [rowIdx][colIdx] = SBMT_ZERO;
-           elements[rowIdx][colIdx].setZero()  ;
+    int idx = findBlock( rowIdx, colIdx );
+    if( idx >= 0 )
+        blocks[idx].type = SBMT_ZERO;
+
     return SUCCESSFUL_RETURN; 
 }
 
@@ -108,10 +139,11 @@ inline returnValue BlockMatrix::addRegularisation( uint rowIdx, uint colIdx, dou
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
-    if( types[rowIdx][colIdx] != SBMT_ZERO ){
-        DMatrix tmp( elements[rowIdx][colIdx].getNumRows(), elements[rowIdx][colIdx].getNumCols() );
-        tmp.setConstant( eps );
-        elements[rowIdx][colIdx] += tmp;
+    int idx = findBlock( rowIdx, colIdx );
+
+    if( idx >= 0 && blocks[idx].type != SBMT_ZERO ){
+        makeDense( idx );
+        getBlock( idx ).array() += eps;
     }
 
     return SUCCESSFUL_RETURN;
@@ -120,11 +152,8 @@ inline returnValue BlockMatrix::addRegularisation( uint rowIdx, uint colIdx, dou
 
 inline returnValue BlockMatrix::setZero(){
 
-    uint run1, run2;
-
-    for( run1 = 0; run1 < getNumRows(); run1++ )
-        for( run2 = 0; run2 < getNumCols(); run2++ )
-            setZero( run1, run2 );
+    for( uint run1 = 0; run1 < blocks.size(); run1++ )
+        blocks[run1].type = SBMT_ZERO;
 
     return SUCCESSFUL_RETURN;
 }
@@ -132,11 +161,12 @@ inline returnValue BlockMatrix::setZero(){
 
 inline BlockMatrix BlockMatrix::addRegularisation( double eps ){
 
-    uint run1, run2;
-
-    for( run1 = 0; run1 < getNumRows(); run1++ )
-        for( run2 = 0; run2 < getNumCols(); run2++ )
-            addRegularisation( run1, run2, eps );
+    for( uint run1 = 0; run1 < blocks.size(); run1++ ){
+        if( blocks[run1].type != SBMT_ZERO ){
+            makeDense( run1 );
+            getBlock( run1 ).array() += eps;
+        }
+    }
 
     return *this;
 }
@@ -155,7 +185,7 @@ inline bool BlockMatrix::isSquare( uint rowIdx, uint colIdx ) const{
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
-    return elements[rowIdx][colIdx].isSquare();
+    return getNumRows( rowIdx, colIdx ) == getNumCols( rowIdx, colIdx );
 }
 
 
@@ -166,6 +196,20 @@ inline bool BlockMatrix::isEmpty() const{
 }
 
 
+inline BlockMatrix::BlockMap BlockMatrix::getBlock( uint blockIdx ){
+
+    const BlockEntry& block = blocks[blockIdx];
+    return BlockMap( ( values.empty() ? 0 : &values[0] ) + block.offset, block.nRows, block.nCols );
+}
+
+
+inline BlockMatrix::ConstBlockMap BlockMatrix::getBlock( uint blockIdx ) const{
+
+    const BlockEntry& block = blocks[blockIdx];
+    return ConstBlockMap( ( values.empty() ? 0 : &values[0] ) + block.offset, block.nRows, block.nCols );
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
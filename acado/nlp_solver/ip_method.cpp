@@ -0,0 +1,152 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/nlp_solver/ip_method.cpp
+ *    \date 2014
+ */
+
+
+#include <acado/nlp_solver/ip_method.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Barrier parameter of the first iteration. */
+static const double initialBarrierParameter = 1.0e-1;
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+IPmethod::IPmethod( ) : SCPmethod( )
+{
+	barrierParameter = initialBarrierParameter;
+}
+
+
+IPmethod::IPmethod(	UserInteraction* _userInteraction,
+					const Objective             *objective_          ,
+					const DynamicDiscretization *dynamic_discretization_,
+					const Constraint            *constraint_,
+					BooleanType _isCP
+					) : SCPmethod( _userInteraction,objective_,dynamic_discretization_,constraint_,_isCP )
+{
+	barrierParameter = initialBarrierParameter;
+}
+
+
+IPmethod::IPmethod( const IPmethod& rhs ) : SCPmethod( rhs )
+{
+	barrierParameter = rhs.barrierParameter;
+}
+
+
+IPmethod::~IPmethod( )
+{
+}
+
+
+IPmethod& IPmethod::operator=( const IPmethod& rhs )
+{
+	if ( this != &rhs )
+	{
+		SCPmethod::operator=( rhs );
+
+		barrierParameter = rhs.barrierParameter;
+	}
+
+	return *this;
+}
+
+
+NLPsolver* IPmethod::clone( ) const
+{
+	return new IPmethod( *this );
+}
+
+
+returnValue IPmethod::feedbackStep(	const DVector& x0_,
+									const DVector& p_
+									)
+{
+	if ( ( status == BS_READY ) || ( status == BS_RUNNING ) )
+		updateBarrierParameter( );
+
+	return SCPmethod::feedbackStep( x0_,p_ );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+BandedCPsolver* IPmethod::allocateBandedCPsolver( )
+{
+	// one block per shooting interval, i.e. a Riccati recursion over the intervals
+	return new BlockCondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims(),1 );
+}
+
+
+returnValue IPmethod::updateBarrierParameter( )
+{
+	if ( numberOfSteps == 0 )
+	{
+		barrierParameter = initialBarrierParameter;
+	}
+	else
+	{
+		double barrierTuning;
+		get( CONIC_SOLVER_BARRIER_TUNING,barrierTuning );
+
+		DMatrix kktTolerance;
+		getLast( LOG_KKT_TOLERANCE,kktTolerance );
+
+		// linear decrease, superlinear once close to a KKT point
+		barrierParameter *= barrierTuning;
+
+		if ( kktTolerance.getDim( ) > 0 )
+			barrierParameter = acadoMin( barrierParameter,pow( fabs( kktTolerance(0,0) ),1.5 ) );
+	}
+
+	// allocated by allocateBandedCPsolver(), also after copying
+	BlockCondensingBasedCPsolver* blockCPsolver = dynamic_cast< BlockCondensingBasedCPsolver* >( bandedCPsolver );
+
+	if ( blockCPsolver == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	return blockCPsolver->setBarrierParameter( barrierParameter );
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
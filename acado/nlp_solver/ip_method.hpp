@@ -36,7 +36,7 @@
 
 
 #include <acado/utils/acado_utils.hpp>
-#include <acado/nlp_solver/nlp_solver.hpp>
+#include <acado/nlp_solver/scp_method.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -47,12 +47,28 @@ BEGIN_NAMESPACE_ACADO
  *
  *	\ingroup NumericalAlgorithms
  *
- *  The class IPmethod implements different interior-point methods 
- *  for solving nonlinear programming problems.
+ *  The class IPmethod implements a primal-dual interior-point method 
+ *  for solving nonlinear programming problems arising in optimal control.
+ *
+ *  Each iteration linearizes the NLP like SCPmethod and computes the step 
+ *  by a Mehrotra predictor-corrector method on the banded KKT system. Its 
+ *  Newton steps are computed by a Riccati recursion over the shooting 
+ *  intervals, such that the cost per iteration is linear in the horizon 
+ *  length. Instead of solving the linearized problem exactly, each step 
+ *  only follows the central path down to a barrier parameter. It starts 
+ *  large and is reduced by the factor CONIC_SOLVER_BARRIER_TUNING per 
+ *  iteration, and superlinearly once the KKT tolerance becomes small. 
+ *  Thus the early iterations stay in the interior of the inequalities 
+ *  and never enumerate active sets.
+ *
+ *  The method is used by OptimizationAlgorithm if SPARSE_QP_SOLUTION is 
+ *  set to SPARSE_SOLVER. Problems with algebraic states, parameters or 
+ *  disturbances, or with constraints coupling different shooting intervals, 
+ *  are solved by condensing as in SCPmethod.
  *
  *	 \author Boris Houska, Hans Joachim Ferreau
  */
-class IPmethod : public NLPsolver
+class IPmethod : public SCPmethod
 {
     //
     // PUBLIC MEMBER FUNCTIONS:
@@ -62,32 +78,30 @@ class IPmethod : public NLPsolver
         /** Default constructor. */
         IPmethod( );
 
-        IPmethod(	UserInteraction* _userInteraction
-					);
-					
         /** Default constructor. */
-        IPmethod( const NLP& nlp_ );
+        IPmethod(	UserInteraction* _userInteraction,
+					const Objective             *objective_             ,
+					const DynamicDiscretization *dynamic_discretization_,
+					const Constraint            *constraint_,
+					BooleanType _isCP = BT_FALSE
+					);
 
         /** Copy constructor (deep copy). */
         IPmethod( const IPmethod& rhs );
 
         /** Destructor. */
-        ~IPmethod( );
+        virtual ~IPmethod( );
 
         /** Assignment operator (deep copy). */
         IPmethod& operator=( const IPmethod& rhs );
 
-
-        /** Initialization. */
-        virtual returnValue init(VariablesGrid    *xd,
-                                 VariablesGrid    *xa,
-                                 VariablesGrid    *p,
-                                 VariablesGrid    *u,
-                                 VariablesGrid    *w   );
+        virtual NLPsolver* clone() const;
 
 
-        /** Starts execution. */
-        virtual returnValue solve( int maxNumSteps );
+        /** Executes a real-time feedback step for the current barrier parameter. */
+        virtual returnValue feedbackStep(	const DVector &x0_,
+											const DVector &p_ = emptyConstVector
+											);
 
 
     //
@@ -95,13 +109,26 @@ class IPmethod : public NLPsolver
     //
     protected:
 
+		/** Allocates the interior-point solver of the banded KKT system.
+		 *
+		 *  \return Pointer to the new solver.
+		 */
+		virtual BandedCPsolver* allocateBandedCPsolver( );
 
+		/** Reduces the barrier parameter according to the last iteration.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 *          RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue updateBarrierParameter( );
 
 
     //
     // DATA MEMBERS:
     //
     protected:
+
+		double barrierParameter;		/**< Barrier parameter of the current iteration. */
 };
 
 
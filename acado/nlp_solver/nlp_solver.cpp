@@ -231,6 +231,8 @@ returnValue NLPsolver::setupOptions( )
 	addOption( DISCRETIZATION_TYPE         , defaultDiscretizationType      );
 	addOption( LINESEARCH_TOLERANCE        , defaultLinesearchTolerance     );
 	addOption( MIN_LINESEARCH_PARAMETER    , defaultMinLinesearchParameter  );
+	addOption( NUM_LINESEARCH_CANDIDATES   , defaultNumLinesearchCandidates );
+	addOption( QP_SOLVER                   , defaultQPsolver                );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations      );
 	addOption( HOTSTART_QP                 , defaultHotstartQP              );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
@@ -238,6 +240,8 @@ returnValue NLPsolver::setupOptions( )
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( SPARSE_QP_SOLUTION          , defaultSparseQPsolution        );
+	addOption( CONDENSING_BLOCK_SIZE       , defaultCondensingBlockSize     );
+	addOption( CONIC_SOLVER_BARRIER_TUNING , defaultBarrierTuning           );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
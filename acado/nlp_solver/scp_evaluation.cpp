@@ -33,6 +33,8 @@
 
 #include <acado/nlp_solver/scp_evaluation.hpp>
 
+#include <algorithm>
+
 
 
 BEGIN_NAMESPACE_ACADO
@@ -55,6 +57,8 @@ SCPevaluation::SCPevaluation( ) : AlgorithmicBase( )
 	
 	isCP = BT_FALSE;
 	areSensitivitiesFrozen = BT_FALSE;
+
+	settings.version = 0;
 }
 
 
@@ -85,6 +89,8 @@ SCPevaluation::SCPevaluation(	UserInteraction* _userInteraction,
 	
 	isCP = _isCP;
 	areSensitivitiesFrozen = BT_FALSE;
+
+	settings.version = 0;
 }
 
 
@@ -103,6 +109,8 @@ SCPevaluation::SCPevaluation( const SCPevaluation& rhs ) : AlgorithmicBase( rhs
 	
 	isCP = rhs.isCP;
 	areSensitivitiesFrozen = rhs.areSensitivitiesFrozen;
+
+	settings = rhs.settings;
 }
 
 
@@ -137,6 +145,8 @@ SCPevaluation& SCPevaluation::operator=( const SCPevaluation& rhs )
 
 		isCP = rhs.isCP;
 		areSensitivitiesFrozen = rhs.areSensitivitiesFrozen;
+
+		settings = rhs.settings;
 	}
 
     return *this;
@@ -149,6 +159,17 @@ SCPevaluation* SCPevaluation::clone( ) const
 }
 
 
+returnValue SCPevaluation::swap( SCPevaluation& rhs )
+{
+	std::swap( objective            ,rhs.objective             );
+	std::swap( dynamicDiscretization,rhs.dynamicDiscretization );
+	std::swap( constraint           ,rhs.constraint            );
+	std::swap( objectiveValue       ,rhs.objectiveValue        );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 returnValue SCPevaluation::init(	const OCPiterate& iter
 									){
@@ -208,22 +229,12 @@ returnValue SCPevaluation::evaluateSensitivities(	const OCPiterate& iter,
 
     // DETERMINE THE HESSIAN APPROXIMATION MODE:
     // -----------------------------------------
-    int hessMode;
-    get( HESSIAN_APPROXIMATION, hessMode );
-
-    int dynHessMode;
-    get( DYNAMIC_HESSIAN_APPROXIMATION, dynHessMode );
-	if ( (HessianApproximationMode)dynHessMode == DEFAULT_HESSIAN_APPROXIMATION )
-		dynHessMode = hessMode;
+    updateSettings( );
 
-    int dynMode;
-    get( DYNAMIC_SENSITIVITY, dynMode );
-
-    int objMode;
-	get( OBJECTIVE_SENSITIVITY, objMode );
-
-    int conMode;
-    get( CONSTRAINT_SENSITIVITY, conMode );
+    int hessMode    = settings.hessianApproximation;
+    int dynHessMode = settings.dynamicHessianApproximation;
+    int dynMode     = settings.dynamicSensitivity;
+    int conMode     = settings.constraintSensitivity;
 
 
     // COMPUTE THE 1st ORDER DERIVATIVES:
@@ -412,8 +423,8 @@ double SCPevaluation::getKKTtolerance(	const OCPiterate& iter,
 //     printf("cp.deltaX \n");
 //     cp.deltaX.print();
 
-	int hessianApproximation;
-	get( HESSIAN_APPROXIMATION,hessianApproximation );
+	updateSettings( );
+	int hessianApproximation = settings.hessianApproximation;
 
 	if ( ( isCP == BT_FALSE ) || 
 		 ( ( (HessianApproximationMode)hessianApproximation != GAUSS_NEWTON ) && ( (HessianApproximationMode)hessianApproximation != GAUSS_NEWTON_WITH_BLOCK_BFGS ) )
@@ -560,6 +571,25 @@ returnValue SCPevaluation::setupLogging( )
 }
 
 
+returnValue SCPevaluation::updateSettings( )
+{
+	if ( settings.version == getOptionsVersion( ) )
+		return SUCCESSFUL_RETURN;
+
+	get( HESSIAN_APPROXIMATION,settings.hessianApproximation );
+	get( DYNAMIC_HESSIAN_APPROXIMATION,settings.dynamicHessianApproximation );
+	if ( (HessianApproximationMode)settings.dynamicHessianApproximation == DEFAULT_HESSIAN_APPROXIMATION )
+		settings.dynamicHessianApproximation = settings.hessianApproximation;
+
+	get( DYNAMIC_SENSITIVITY,settings.dynamicSensitivity );
+	get( CONSTRAINT_SENSITIVITY,settings.constraintSensitivity );
+
+	settings.version = getOptionsVersion( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -90,6 +90,15 @@ class SCPevaluation : public AlgorithmicBase
 
         virtual SCPevaluation* clone() const;
 
+        /** Exchanges the evaluated objective, dynamic discretization and
+         *  constraints with those of a copy of this evaluation. This makes
+         *  an evaluation performed on the copy the current one, including
+         *  the intermediate results the sensitivities are based on.
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        virtual returnValue swap( SCPevaluation& rhs );
+
 
 		virtual returnValue init(	const OCPiterate& iter
 									);
@@ -169,6 +178,13 @@ class SCPevaluation : public AlgorithmicBase
 		virtual returnValue setupOptions( );
 		virtual returnValue setupLogging( );
 
+		/** Reads the options used in every iteration into the settings,
+		 *	unless they have not been modified since they have been read last.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue updateSettings( );
+
 
     //
     // DATA MEMBERS:
@@ -183,6 +199,18 @@ class SCPevaluation : public AlgorithmicBase
 
 		BooleanType isCP;
 		BooleanType areSensitivitiesFrozen;
+
+		/** Options used in every iteration. */
+		struct Settings
+		{
+			int  hessianApproximation;			/**< HESSIAN_APPROXIMATION. */
+			int  dynamicHessianApproximation;	/**< DYNAMIC_HESSIAN_APPROXIMATION, with the default resolved. */
+			int  dynamicSensitivity;			/**< DYNAMIC_SENSITIVITY. */
+			int  constraintSensitivity;			/**< CONSTRAINT_SENSITIVITY. */
+			uint version;						/**< Stamp of the options the settings have been read from. */
+		};
+
+		Settings settings;
 };
 
 
@@ -92,10 +92,10 @@ returnValue SCPmeritFunction::evaluate(	double alpha,
 
         eval.clearDynamicDiscretization( );
 
-		OCPiterate iterTest = iter;
-		iterTest.applyStep( cp.deltaX,alpha );
+		// the trial iterate is kept between calls to re-use its memory
+		trialIterate.assignStep( iter,cp.deltaX,alpha );
 
-		if ( eval.evaluate( iterTest,cp ) != SUCCESSFUL_RETURN )
+		if ( eval.evaluate( trialIterate,cp ) != SUCCESSFUL_RETURN )
 			return SUCCESSFUL_RETURN;
     }
 
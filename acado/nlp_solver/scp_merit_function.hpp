@@ -115,6 +115,8 @@ class SCPmeritFunction : public AlgorithmicBase
     //
     protected:
 
+		OCPiterate trialIterate;	/**< Iterate x_k + alpha * Delta x_k of the last evaluation. */
+
     	//double functionWeight;
        	//double dynamicWeight;
     	//double equalityWeight;
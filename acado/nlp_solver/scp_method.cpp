@@ -63,6 +63,8 @@ SCPmethod::SCPmethod( ) : NLPsolver( )
 	hasPerformedStep = BT_FALSE;
 	isInRealTimeMode = BT_FALSE;
 	needToReevaluate = BT_FALSE;
+
+	settings.version = 0;
 }
 
 
@@ -86,6 +88,8 @@ SCPmethod::SCPmethod(	UserInteraction* _userInteraction,
 	isInRealTimeMode = BT_FALSE;
 	needToReevaluate = BT_FALSE;
 
+	settings.version = 0;
+
 	setupLogging( );
 }
 
@@ -118,6 +122,8 @@ SCPmethod::SCPmethod( const SCPmethod& rhs ) : NLPsolver( rhs )
 	hasPerformedStep = rhs.hasPerformedStep;
 	isInRealTimeMode = rhs.isInRealTimeMode;
 	needToReevaluate = rhs.needToReevaluate;
+
+	settings = rhs.settings;
 }
 
 
@@ -182,6 +188,8 @@ SCPmethod& SCPmethod::operator=( const SCPmethod& rhs ){
 		hasPerformedStep = rhs.hasPerformedStep;
 		isInRealTimeMode = rhs.isInRealTimeMode;
 		needToReevaluate = rhs.needToReevaluate;
+
+		settings = rhs.settings;
 	}
 
     return *this;
@@ -340,10 +348,7 @@ returnValue SCPmethod::feedbackStep(	const DVector& x0_,
 	if ( checkForRealTimeMode( x0_,p_ ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_NLP_STEP_FAILED );
 
-    int hessianMode;
-    get( HESSIAN_APPROXIMATION,hessianMode );
-
-	if ( ( isInRealTimeMode == BT_FALSE ) && ( (HessianApproximationMode)hessianMode == EXACT_HESSIAN ) )
+	if ( ( isInRealTimeMode == BT_FALSE ) && ( (HessianApproximationMode)settings.hessianApproximation == EXACT_HESSIAN ) )
 	{
 		returnvalue = initializeHessianProjection();
 		if( returnvalue != SUCCESSFUL_RETURN )
@@ -359,8 +364,7 @@ returnValue SCPmethod::feedbackStep(	const DVector& x0_,
 			return ACADOERROR( RET_NLP_STEP_FAILED );
 	}
 
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	int printLevel = settings.printLevel;
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Solving banded QP ...\n";
@@ -402,8 +406,8 @@ returnValue SCPmethod::performCurrentStep( )
 
     // Perform a globalized step:
     // --------------------------
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	updateSettings( );
+	int printLevel = settings.printLevel;
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Perform globalized SQP step ...\n";
@@ -434,10 +438,7 @@ returnValue SCPmethod::performCurrentStep( )
 	printIteration( );
 
 	// Check convergence criterion if no real-time iterations are performed
-	int terminateAtConvergence = 0;
-	get( TERMINATE_AT_CONVERGENCE,terminateAtConvergence );
-
-	if ( (BooleanType)terminateAtConvergence == BT_TRUE )
+	if ( (BooleanType)settings.terminateAtConvergence == BT_TRUE )
 	{
 		if ( checkForConvergence( ) == CONVERGENCE_ACHIEVED )
 		{
@@ -480,8 +481,8 @@ returnValue SCPmethod::prepareNextStep( )
 	
     // Linearize the NLP system at the new point:
     // ------------------------------------------
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	updateSettings( );
+	int printLevel = settings.printLevel;
 
 
 	#ifdef SIM_DEBUG
@@ -695,27 +696,21 @@ returnValue SCPmethod::setup( )
 	if ( bandedCPsolver != 0 )
 		delete bandedCPsolver;
 
-	int sparseQPsolution;
-	get( SPARSE_QP_SOLUTION,sparseQPsolution );
-	
 	int printLevel;
 	get( PRINTLEVEL,printLevel );
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Initializing banded QP solver ...\n";
 
-	if ( (SparseQPsolutionMethods)sparseQPsolution == CONDENSING )
-	{
-    	bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
-    	bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
+	bandedCPsolver = allocateBandedCPsolver( );
 
-		bandedCPsolver = new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
-		bandedCPsolver->init( iter );
-	}
-	else
-	{
+	if ( bandedCPsolver == 0 )
 		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
-	}
+
+	bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
+	bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
+
+	bandedCPsolver->init( iter );
 
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "<-- Initializing banded QP solver done.\n";
@@ -825,6 +820,29 @@ returnValue SCPmethod::setup( )
 }
 
 
+BandedCPsolver* SCPmethod::allocateBandedCPsolver( )
+{
+	int sparseQPsolution;
+	get( SPARSE_QP_SOLUTION,sparseQPsolution );
+
+	switch( (SparseQPsolutionMethods)sparseQPsolution )
+	{
+		case CONDENSING:
+			return new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+
+		case BLOCK_CONDENSING_N2:
+			return new BlockCondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+
+		case SPARSE_SOLVER:
+			// interior-point method with a Riccati recursion over the shooting intervals
+			return new BlockCondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims(),1 );
+
+		default:
+			return 0;
+	}
+}
+
+
 returnValue SCPmethod::printIterate( ) const
 {
 	return iter.print( );
@@ -833,15 +851,13 @@ returnValue SCPmethod::printIterate( ) const
 
 returnValue SCPmethod::printIteration( )
 {
-	double KKTmultiplierRegularisation;
-	get( KKT_TOLERANCE_SAFEGUARD,KKTmultiplierRegularisation );
+	updateSettings( );
 	
 	setLast( LOG_NUM_SQP_ITERATIONS, numberOfSteps );
-	setLast( LOG_KKT_TOLERANCE, eval->getKKTtolerance( iter,bandedCP,KKTmultiplierRegularisation ) );
+	setLast( LOG_KKT_TOLERANCE, eval->getKKTtolerance( iter,bandedCP,settings.kktToleranceSafeguard ) );
 	setLast( LOG_OBJECTIVE_VALUE, eval->getObjectiveValue() );
 
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
+	int printLevel = settings.printLevel;
 
 	if ( (PrintLevel)printLevel >= MEDIUM ) 
 	{
@@ -884,29 +900,20 @@ returnValue SCPmethod::printIteration( )
 
 returnValue SCPmethod::checkForConvergence( )
 {
-	double tol;
-	get( KKT_TOLERANCE,tol );
+	updateSettings( );
+	double tol = settings.kktTolerance;
 
 	// NEEDS TO BE CHECKED CARFULLY !!!
-	double KKTmultiplierRegularisation;
-	get(KKT_TOLERANCE_SAFEGUARD, KKTmultiplierRegularisation);
-
-	if( eval->getKKTtolerance( iter,bandedCP,KKTmultiplierRegularisation ) <= tol )
+	if( eval->getKKTtolerance( iter,bandedCP,settings.kktToleranceSafeguard ) <= tol )
 	{
-		int discretizationMode;
-		get( DISCRETIZATION_TYPE, discretizationMode );
-
-		if( (StateDiscretizationType)discretizationMode == SINGLE_SHOOTING )
+		if( (StateDiscretizationType)settings.discretizationType == SINGLE_SHOOTING )
 		{
 			eval->clearDynamicDiscretization( );
 			if ( eval->evaluate( iter,bandedCP ) != SUCCESSFUL_RETURN )
 				return ACADOERROR( RET_NLP_STEP_FAILED );
 		}
 
-		int printLevel;
-		get( PRINTLEVEL,printLevel );
-
-		if ( (PrintLevel)printLevel >= MEDIUM )
+		if ( (PrintLevel)settings.printLevel >= MEDIUM )
 		{
 			cout	<< endl
 					<< "Covergence achieved. Demanded KKT tolerance is "
@@ -963,9 +970,8 @@ returnValue SCPmethod::checkForRealTimeMode(	const DVector &x0_,
 												const DVector &p_
 												)
 {
-	int useRealtimeIterations;
-	get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
-	isInRealTimeMode = (BooleanType)useRealtimeIterations;
+	updateSettings( );
+	isInRealTimeMode = (BooleanType)settings.useRealtimeIterations;
 
 	if ( ( isInRealTimeMode == BT_FALSE ) && 
 		 ( ( x0_.isEmpty( ) == BT_FALSE ) || ( p_.isEmpty( ) == BT_FALSE ) ) )
@@ -997,10 +1003,9 @@ returnValue SCPmethod::stopClockAndPrintRuntimeProfile( )
 	clockTotalTime.stop( );
 	setLast( LOG_TIME_SQP_ITERATION,clockTotalTime.getTime() );
 	
-	int printProfile;
-	get( PRINT_SCP_METHOD_PROFILE, printProfile );
+	updateSettings( );
 
-	if( (BooleanType) printProfile == BT_TRUE )
+	if( (BooleanType)settings.printProfile == BT_TRUE )
 		printRuntimeProfile();
 	
 	return SUCCESSFUL_RETURN;
@@ -1008,6 +1013,27 @@ returnValue SCPmethod::stopClockAndPrintRuntimeProfile( )
 
 
 
+returnValue SCPmethod::updateSettings( )
+{
+	if ( settings.version == getOptionsVersion( ) )
+		return SUCCESSFUL_RETURN;
+
+	get( PRINTLEVEL,settings.printLevel );
+	get( HESSIAN_APPROXIMATION,settings.hessianApproximation );
+	get( TERMINATE_AT_CONVERGENCE,settings.terminateAtConvergence );
+	get( KKT_TOLERANCE,settings.kktTolerance );
+	get( KKT_TOLERANCE_SAFEGUARD,settings.kktToleranceSafeguard );
+	get( DISCRETIZATION_TYPE,settings.discretizationType );
+	get( USE_REALTIME_ITERATIONS,settings.useRealtimeIterations );
+	get( PRINT_SCP_METHOD_PROFILE,settings.printProfile );
+
+	settings.version = getOptionsVersion( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue SCPmethod::getDifferentialStates( VariablesGrid &xd_ ) const{
 
     if( iter.x == 0 )
@@ -43,6 +43,7 @@
 #include <acado/conic_solver/dense_qp_solver.hpp>
 #include <acado/conic_solver/banded_cp_solver.hpp>
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/conic_solver/block_condensing_based_cp_solver.hpp>
 
 #include <acado/nlp_solver/scp_evaluation.hpp>
 #include <acado/nlp_solver/scp_step_linesearch.hpp>
@@ -176,6 +177,12 @@ class SCPmethod : public NLPsolver
 
 
 		returnValue setup( );
+
+		/** Allocates the banded CP solver selected by SPARSE_QP_SOLUTION.
+		 *
+		 *  \return Pointer to the new solver, or 0 if the selected method is not implemented.
+		 */
+		virtual BandedCPsolver* allocateBandedCPsolver( );
 		
 
         /** Prints the actual values of x, xa, p, u, and w.
@@ -206,6 +213,13 @@ class SCPmethod : public NLPsolver
 
 		returnValue stopClockAndPrintRuntimeProfile( );
 
+		/** Reads the options used in every iteration into the settings,
+		 *	unless they have not been modified since they have been read last.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue updateSettings( );
+
 
         virtual returnValue getDifferentialStates( VariablesGrid &xd_ ) const;
         virtual returnValue getAlgebraicStates   ( VariablesGrid &xa_ ) const;
@@ -273,6 +287,22 @@ class SCPmethod : public NLPsolver
 		BooleanType hasPerformedStep;
 		BooleanType isInRealTimeMode;
 		BooleanType needToReevaluate;
+
+		/** Options used in every iteration. */
+		struct Settings
+		{
+			int    printLevel;				/**< PRINTLEVEL. */
+			int    hessianApproximation;	/**< HESSIAN_APPROXIMATION. */
+			int    terminateAtConvergence;	/**< TERMINATE_AT_CONVERGENCE. */
+			double kktTolerance;			/**< KKT_TOLERANCE. */
+			double kktToleranceSafeguard;	/**< KKT_TOLERANCE_SAFEGUARD. */
+			int    discretizationType;		/**< DISCRETIZATION_TYPE. */
+			int    useRealtimeIterations;	/**< USE_REALTIME_ITERATIONS. */
+			int    printProfile;			/**< PRINT_SCP_METHOD_PROFILE. */
+			uint   version;					/**< Stamp of the options the settings have been read from. */
+		};
+
+		Settings settings;
 };
 
 
@@ -33,32 +33,48 @@
 
 #include <acado/nlp_solver/scp_step_linesearch.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <thread>
+#endif
+
 
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Maximum number of step lengths tried by the line search. */
+static const int    maxNumLinesearchIterations = 50;
+
+/** Factor by which the step length is reduced. */
+static const double linesearchReduction = 0.5;
+
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
 
 SCPstepLinesearch::SCPstepLinesearch( ) : SCPstep( )
 {
+	settings.version = 0;
 }
 
 
 SCPstepLinesearch::SCPstepLinesearch( UserInteraction* _userInteraction ) : SCPstep( _userInteraction )
 {
+	settings.version = 0;
 }
 
 
 SCPstepLinesearch::SCPstepLinesearch( const SCPstepLinesearch& rhs ) : SCPstep( rhs )
 {
+	settings = rhs.settings;
 }
 
 
 SCPstepLinesearch::~SCPstepLinesearch( )
 {
+	clearCandidates( );
 }
 
 
@@ -67,6 +83,9 @@ SCPstepLinesearch& SCPstepLinesearch::operator=( const SCPstepLinesearch& rhs )
     if ( this != &rhs )
     {
 		SCPstep::operator=( rhs );
+		clearCandidates( );
+
+		settings = rhs.settings;
     }
 
     return *this;
@@ -90,10 +109,10 @@ returnValue SCPstepLinesearch::performStep(	OCPiterate& iter,
 	returnValue returnvalue;
 
 	double alpha = 1.0;
-	double lineSearchTOL, alphaMin;
 
-	get( LINESEARCH_TOLERANCE    , lineSearchTOL );
-	get( MIN_LINESEARCH_PARAMETER, alphaMin      );
+	updateSettings( );
+	const double lineSearchTOL = settings.linesearchTolerance;
+	const double alphaMin      = settings.minLinesearchParameter;
 
 // 	iter.print();
 	
@@ -134,8 +153,8 @@ returnValue SCPstepLinesearch::performLineSearch(	const OCPiterate& iter,
 													)
 {
 
-    const int     maxIter = 50;
-    const double  kappa   = 0.5;
+    const int     maxIter = maxNumLinesearchIterations;
+    const double  kappa   = linesearchReduction;
 
     alpha   = 1.0;
 
@@ -145,6 +164,14 @@ returnValue SCPstepLinesearch::performLineSearch(	const OCPiterate& iter,
 	if ( meritFcn->evaluate( 0.0,iter,cp,eval, meritFcnValue1 ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_UNKNOWN_BUG );
 
+	updateSettings( );
+	int nCandidates = settings.numCandidates;
+
+#ifdef ACADO_HAS_CXX11
+	if ( ( nCandidates > 1 ) && ( alphaMin < 1.0-EPS ) )
+		return performSpeculativeLineSearch( iter,cp,eval, meritFcnValue1,alpha,alphaMin,nCandidates );
+#endif
+
     int run1 = 0;
     while( run1 < maxIter ){
         meritFcn->evaluate( alpha,iter,cp,eval, meritFcnValue2 );
@@ -163,6 +190,158 @@ returnValue SCPstepLinesearch::performLineSearch(	const OCPiterate& iter,
 }
 
 
+returnValue SCPstepLinesearch::performSpeculativeLineSearch(	const OCPiterate& iter,
+																BandedCP& cp,
+																SCPevaluation& eval,
+																double meritFcnValue0,
+																double& alpha,
+																const double& alphaMin,
+																int nCandidates
+																)
+{
+    int run1, run2;
+
+    // SYNCHRONISE THE COPIES WITH THE CURRENT EVALUATION:
+    // ---------------------------------------------------
+    // (the first step length of each round is evaluated on eval itself)
+    if( (int) candidates.size() < nCandidates ){
+
+        run1 = candidates.size();
+        candidates.resize( nCandidates );
+
+        for( ; run1 < nCandidates; run1++ ){
+            candidates[run1].meritFcn = 0;
+            candidates[run1].eval     = 0;
+        }
+    }
+
+    for( run1 = 1; run1 < nCandidates; run1++ ){
+
+        Candidate &c = candidates[run1];
+
+        if( c.meritFcn == 0 ) c.meritFcn = meritFcn->clone();
+
+        if( c.eval == 0 ) c.eval = eval.clone();
+        else             *c.eval = eval;
+
+        c.cp.deltaX           = cp.deltaX;
+        c.cp.lambdaDynamic    = cp.lambdaDynamic;
+        c.cp.lambdaBound      = cp.lambdaBound;
+        c.cp.lambdaConstraint = cp.lambdaConstraint;
+    }
+
+    int accepted = -1;
+    int nBatch   =  0;
+
+    alpha = 1.0;
+
+    run1 = 0;
+    while( run1 < maxNumLinesearchIterations ){
+
+        // STEP LENGTHS OF THIS ROUND, ENDING AT THE MINIMUM ONE:
+        // ------------------------------------------------------
+        nBatch = 0;
+        while( nBatch < nCandidates && run1+nBatch < maxNumLinesearchIterations ){
+
+            candidates[nBatch].alpha = alpha;
+            nBatch++;
+
+            if( alpha <= alphaMin+EPS ) break;
+            alpha *= linesearchReduction;
+        }
+
+        // EVALUATE THE MERIT FUNCTION AT ALL OF THEM:
+        // -------------------------------------------
+        std::vector<std::thread> workers;
+
+        for( run2 = 1; run2 < nBatch; run2++ )
+            workers.push_back( std::thread( [&]( int idx ){
+
+                Candidate &c = candidates[idx];
+
+                c.log.clear();
+                Logging::deferLogging( &c.log );
+                c.meritFcn->evaluate( c.alpha,iter,c.cp,*c.eval, c.value );
+                Logging::deferLogging( 0 );
+            }, run2 ) );
+
+        meritFcn->evaluate( candidates[0].alpha,iter,cp,eval, candidates[0].value );
+
+        for( run2 = 0; run2 < (int) workers.size(); run2++ )
+            workers[run2].join();
+
+        // TAKE THE FIRST ACCEPTABLE ONE:
+        // ------------------------------
+        for( run2 = 0; run2 < nBatch; run2++ ){
+            if( candidates[run2].value <= meritFcnValue0 + EPS ||
+                candidates[run2].alpha <= alphaMin+EPS ){
+                accepted = run2;
+                alpha    = candidates[run2].alpha;
+                break;
+            }
+        }
+
+        // log the step lengths a sequential backtracking would have tried
+        for( run2 = 1; run2 < nBatch && ( accepted < 0 || run2 <= accepted ); run2++ )
+            ACADO_TRY( userInteraction->writeDeferredLog( candidates[run2].log ) );
+
+        run1 += nBatch;
+
+        if( accepted >= 0 ) break;
+    }
+
+    // as the sequential backtracking, end up at the last evaluated step length
+    if( accepted < 0 )
+        accepted = nBatch-1;
+
+    // MAKE THE ACCEPTED EVALUATION THE CURRENT ONE:
+    // ---------------------------------------------
+    if( accepted > 0 ){
+
+        Candidate &c = candidates[accepted];
+
+        ACADO_TRY( eval.swap( *c.eval ) );
+
+        cp.dynResiduum             = c.cp.dynResiduum;
+        cp.lowerBoundResiduum      = c.cp.lowerBoundResiduum;
+        cp.upperBoundResiduum      = c.cp.upperBoundResiduum;
+        cp.lowerConstraintResiduum = c.cp.lowerConstraintResiduum;
+        cp.upperConstraintResiduum = c.cp.upperConstraintResiduum;
+    }
+
+	setLast( LOG_MERIT_FUNCTION_VALUE,candidates[accepted].value );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void SCPstepLinesearch::clearCandidates( )
+{
+    for( unsigned run1 = 0; run1 < candidates.size(); run1++ ){
+        if( candidates[run1].meritFcn != 0 ) delete candidates[run1].meritFcn;
+        if( candidates[run1].eval     != 0 ) delete candidates[run1].eval;
+    }
+    candidates.clear();
+}
+
+
+returnValue SCPstepLinesearch::updateSettings( )
+{
+	if ( settings.version == getOptionsVersion( ) )
+		return SUCCESSFUL_RETURN;
+
+	settings.numCandidates = defaultNumLinesearchCandidates;
+
+	get( LINESEARCH_TOLERANCE     , settings.linesearchTolerance    );
+	get( MIN_LINESEARCH_PARAMETER , settings.minLinesearchParameter );
+	get( NUM_LINESEARCH_CANDIDATES, settings.numCandidates          );
+
+	settings.version = getOptionsVersion( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 
 CLOSE_NAMESPACE_ACADO
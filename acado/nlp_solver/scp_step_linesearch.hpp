@@ -38,6 +38,8 @@
 #include <acado/utils/acado_utils.hpp>
 #include <acado/nlp_solver/scp_step.hpp>
 
+#include <vector>
+
 
 
 BEGIN_NAMESPACE_ACADO
@@ -52,6 +54,14 @@ BEGIN_NAMESPACE_ACADO
  *  The class SCPstepLinesearch implements linesearch techniques to perform a 
  *  globalized step of an SCPmethod for solving nonlinear programming problems.
  *
+ *  The step lengths 1, kappa, kappa^2, ... are tried one after the other by
+ *  default. If the option NUM_LINESEARCH_CANDIDATES is larger than one, several
+ *  of them are evaluated concurrently on copies of the SCPevaluation and the
+ *  first one yielding a descent is taken, i.e. the same step length as by the
+ *  sequential backtracking. The accepted evaluation is swapped into place and
+ *  only the log entries of the step lengths the sequential backtracking would
+ *  have tried are written. The copies are kept between the steps.
+ *
  *	 \author Boris Houska, Hans Joachim Ferreau
  */
 class SCPstepLinesearch : public SCPstep {
@@ -105,12 +115,63 @@ class SCPstepLinesearch : public SCPstep {
 										const double& alphaMin
 										);
 
+        /** Backtracks by evaluating the merit function at nCandidates step    \n
+         *  lengths concurrently, the first of them on eval in the calling     \n
+         *  thread and the others on copies of eval. Afterwards, eval and the  \n
+         *  residuals of cp belong to the returned step size parameter alpha.  \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         *                                                                     \n
+         */
+		returnValue performSpeculativeLineSearch(	const OCPiterate& iter,
+													BandedCP& cp,
+													SCPevaluation& eval,
+													double meritFcnValue0,
+													double& alpha,
+													const double& alphaMin,
+													int nCandidates
+													);
+
+        /** Deletes all copies used for the concurrent evaluation. */
+        void clearCandidates( );
+
+        /** Reads the options of the line search into the settings, unless \n
+         *  they have not been modified since they have been read last.    \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue updateSettings( );
+
 
 
     //
     // DATA MEMBERS:
     //
     protected:
+
+        /** Copies used to evaluate one step length of the concurrent line search. */
+        struct Candidate
+        {
+            SCPmeritFunction* meritFcn;     /**< Merit function with its own trial iterate. */
+            SCPevaluation*    eval;         /**< Evaluation of the trial iterate.           */
+            BandedCP          cp;           /**< Step, multipliers and trial residuals.     */
+            DeferredLog       log;          /**< Log entries of the evaluation.             */
+            double            alpha;        /**< Step length.                               */
+            double            value;        /**< Merit function value.                      */
+        };
+
+        std::vector< Candidate > candidates;
+
+        /** Options of the line search. */
+        struct Settings
+        {
+            double linesearchTolerance;     /**< LINESEARCH_TOLERANCE.                          */
+            double minLinesearchParameter;  /**< MIN_LINESEARCH_PARAMETER.                      */
+            int    numCandidates;           /**< NUM_LINESEARCH_CANDIDATES.                     */
+            uint   version;                 /**< Stamp of the options the settings are read from. */
+        };
+
+        Settings settings;
 };
 
 
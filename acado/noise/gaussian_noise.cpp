@@ -138,11 +138,8 @@ returnValue GaussianNoise::init(	uint seed
 	if ( mean.getDim( ) == 0 )
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
-	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	/* initialize random stream: */
+	initRandomStream( seed );
 
 	setStatus( BS_READY );
 
@@ -199,7 +196,7 @@ returnValue GaussianNoise::step(	VariablesGrid& _w
 
 double GaussianNoise::getGaussianRandomNumber(	double _mean,
 												double _variance
-												) const
+												)
 {
 	// Box-Muller method
 	double norm = 2.0;
@@ -255,7 +255,7 @@ class GaussianNoise : public Noise
 		 */
 		double getGaussianRandomNumber(	double _mean,
 										double _variance
-										) const;
+										);
 
 
 	//
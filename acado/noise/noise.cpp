@@ -32,19 +32,39 @@
 
 #include <acado/noise/noise.hpp>
 
+#include <time.h>
+
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#endif
+
 
 
 BEGIN_NAMESPACE_ACADO
 
 
+// number of streams that have been seeded from the system clock, such that
+// noise blocks initialised within the same second still differ
+#ifdef ACADO_HAS_CXX11
+static std::atomic<uint> nClockStreams( 0 );
+#else
+static uint nClockStreams = 0;
+#endif
+
+
 Noise::Noise( )
 {
+	streamKey     = 0;
+	streamCounter = 0;
 }
 
 
 Noise::Noise( const Noise& rhs )
 {
 	w = rhs.w;
+
+	streamKey     = rhs.streamKey;
+	streamCounter = rhs.streamCounter;
 }
 
 
@@ -58,12 +78,48 @@ Noise& Noise::operator=( const Noise& rhs )
 	if ( this != &rhs )
 	{
 		w = rhs.w;
+
+		streamKey     = rhs.streamKey;
+		streamCounter = rhs.streamCounter;
 	}
 
     return *this;
 }
 
 
+uint Noise::getStreamSeed(	uint seed,
+							uint stream
+							)
+{
+	unsigned long long z = scramble( ( ((unsigned long long) seed) << 32 ) + stream + 1 );
+
+	uint streamSeed = (uint) ( z >> 32 );
+
+	if ( streamSeed == 0 )
+		streamSeed = 1;
+
+	return streamSeed;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue Noise::initRandomStream(	uint seed
+										)
+{
+	if ( seed == 0 )
+		seed = getStreamSeed( (uint)time(0),nClockStreams++ );
+
+	streamKey     = scramble( seed );
+	streamCounter = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -157,6 +157,20 @@ class Noise
 		inline BlockStatus getStatus( ) const;
 
 
+		/** Derives the seed of an independent stream of pseudo-random numbers
+		 *	from a given seed, e.g. one stream for each component of a signal
+		 *	or for each scenario of a Monte-Carlo simulation.
+		 *
+		 *	@param[in] seed		Seed the stream is derived from.
+		 *	@param[in] stream	Number of the stream.
+		 *
+		 *  \return Seed of the stream (never 0)
+		 */
+		static uint getStreamSeed(	uint seed,
+									uint stream
+									);
+
+
 
 	//
 	//  PROTECTED MEMBER FUNCTIONS:
@@ -172,8 +186,21 @@ class Noise
 		inline returnValue setStatus(	BlockStatus _status
 										);
 
+		/** Restarts the stream of pseudo-random numbers of this noise block.
+		 *	If seed is 0, a seed is obtained from the system clock.
+		 *
+		 *	@param[in] seed		Seed for pseudo-random number generator.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue initRandomStream(	uint seed
+										);
+
 		/** Returns a pseudo-random number based on a uniform distribution with
-		 *	given lower and upper limits.
+		 *	given lower and upper limits. The numbers are drawn from the own
+		 *	stream of this noise block: the n-th number only depends on the seed
+		 *	and on n, so noise blocks can be used on several threads and each
+		 *	realisation can be reproduced from its seed.
 		 *
 		 *	@param[in] _lowerLimit		Lower limit of random variable.
 		 *	@param[in] _upperLimit		Lower limit of random variable.
@@ -182,7 +209,16 @@ class Noise
 		 */
 		inline double getUniformRandomNumber(	double _lowerLimit,
 												double _upperLimit
-												) const;
+												);
+
+		/** Scrambles the bits of a 64-bit integer (finalizer of SplitMix64).
+		 *
+		 *	@param[in] z		Integer to be scrambled.
+		 *
+		 *  \return Scrambled integer
+		 */
+		static inline unsigned long long scramble(	unsigned long long z
+													);
 
 
 	//
@@ -192,6 +228,9 @@ class Noise
 		BlockStatus status;				/**< Current status of the noise. */
 
 		VariablesGrid w;				/**< Sequence of most recently generated noise. */
+
+		unsigned long long streamKey;		/**< Key of the stream of pseudo-random numbers. */
+		unsigned long long streamCounter;	/**< Number of pseudo-random numbers drawn from the stream. */
 };
 
 
@@ -75,17 +75,23 @@ inline returnValue Noise::setStatus(	BlockStatus _status
 
 inline double Noise::getUniformRandomNumber(	double _lowerLimit,
 												double _upperLimit
-												) const
+												)
 {
-	double halfAmplitude = ( _upperLimit - _lowerLimit ) / 2.0;
+	++streamCounter;
 
-	/* Random number between -RAND_MAX and RAND_MAX */
-	int randomNumber = ( rand( ) - RAND_MAX/2 ) * 2;
+	/* Random number between 0 and 1 (53 random bits) */
+	double scaledRandomNumber = ((double) ( scramble( streamKey + streamCounter*0x9E3779B97F4A7C15ULL ) >> 11 )) / 9007199254740992.0;
+
+	return ( _lowerLimit + ( _upperLimit-_lowerLimit )*scaledRandomNumber );
+}
 
-	/* Random number between -1 and 1 */
-	double scaledRandomNumber = ((double) randomNumber) / ((double) RAND_MAX);
 
-	return ( halfAmplitude*scaledRandomNumber + _lowerLimit+halfAmplitude );
+inline unsigned long long Noise::scramble(	unsigned long long z
+											)
+{
+	z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+	z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+	return z ^ ( z >> 31 );
 }
 
 
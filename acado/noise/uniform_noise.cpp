@@ -194,11 +194,8 @@ returnValue UniformNoise::init(	uint seed
 	if ( lowerLimit.getDim( ) == 0 )
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
-	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	/* initialize random stream: */
+	initRandomStream( seed );
 
 	setStatus( BS_READY );
 
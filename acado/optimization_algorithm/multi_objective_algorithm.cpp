@@ -34,6 +34,12 @@
 #include <acado/optimization_algorithm/multi_objective_algorithm.hpp>
 #include <acado/ocp/ocp.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 BEGIN_NAMESPACE_ACADO
 
 
@@ -50,6 +56,7 @@ MultiObjectiveAlgorithm::MultiObjectiveAlgorithm()
     count                      = 0;
     totalNumberOfSQPiterations = 0;
     totalCPUtime               = 0;
+    totalPointCPUtime          = 0;
 
     xResults  = 0;
     xaResults = 0;
@@ -69,6 +76,7 @@ MultiObjectiveAlgorithm::MultiObjectiveAlgorithm( const OCP& ocp_ )
     count        = 0;
     totalNumberOfSQPiterations = 0;
     totalCPUtime               = 0;
+    totalPointCPUtime          = 0;
 
     xResults  = 0;
     xaResults = 0;
@@ -94,6 +102,7 @@ MultiObjectiveAlgorithm::MultiObjectiveAlgorithm( const MultiObjectiveAlgorithm&
 
     totalNumberOfSQPiterations = arg.totalNumberOfSQPiterations;
     totalCPUtime               = arg.totalCPUtime              ;
+    totalPointCPUtime          = arg.totalPointCPUtime         ;
 
     xResults  = 0;
     xaResults = 0;
@@ -128,6 +137,7 @@ MultiObjectiveAlgorithm& MultiObjectiveAlgorithm::operator=( const MultiObjectiv
 
         totalNumberOfSQPiterations = arg.totalNumberOfSQPiterations;
         totalCPUtime               = arg.totalCPUtime              ;
+        totalPointCPUtime          = arg.totalPointCPUtime         ;
 
         xResults  = 0;
         xaResults = 0;
@@ -186,11 +196,7 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
     if( uResults  == 0 ) uResults  = new VariablesGrid[Weights.getNumCols()];
     if( wResults  == 0 ) wResults  = new VariablesGrid[Weights.getNumCols()];
 
-    getDifferentialStates( xResults[index]  );
-    getAlgebraicStates   ( xaResults[index] );
-    getParameters        ( pResults[index]  );
-    getControls          ( uResults[index]  );
-    getDisturbances      ( wResults[index]  );
+    getIterate( xResults[index], xaResults[index], pResults[index], uResults[index], wResults[index] );
 
 
     if( returnvalue != SUCCESSFUL_RETURN )
@@ -209,11 +215,7 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
     VariablesGrid xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp;
 
     if( hotstart == BT_TRUE ){
-        getDifferentialStates( *userInit.x );
-        getAlgebraicStates   ( *userInit.xa );
-        getParameters        ( *userInit.p );
-        getControls          ( *userInit.u );
-        getDisturbances      ( *userInit.w );
+        getIterate( *userInit.x, *userInit.xa, *userInit.p, *userInit.u, *userInit.w );
         xd_tmp = *userInit.x;
         xa_tmp = *userInit.xa;
         p_tmp  = *userInit.p;
@@ -221,11 +223,7 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
         w_tmp  = *userInit.w;
     }
     else{
-        getDifferentialStates( xd_tmp );
-        getAlgebraicStates   ( xa_tmp );
-        getParameters        ( p_tmp  );
-        getControls          ( u_tmp  );
-        getDisturbances      ( w_tmp  );
+        getIterate( xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp );
     }
 
     VariablesGrid *_xd = 0;
@@ -277,8 +275,7 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
 
 returnValue MultiObjectiveAlgorithm::solve( ){
 
-    int           run1,run2;
-    returnValue returnvalue;
+    int run1,run2;
 
     ASSERT( ocp != 0 );
     ASSERT( m >= 2 );
@@ -290,16 +287,6 @@ returnValue MultiObjectiveAlgorithm::solve( ){
     int hotstart;
     get( PARETO_FRONT_HOTSTART, hotstart );
 
-    Expression **arg = 0;
-    arg = new Expression*[m];
-
-    for( run1 = 0; run1 < m; run1++ )
-        ocp->getObjective( run1, &arg[run1] );
-
-    Constraint tmp_con;
-
-    double *idx = new double[m];
-
     WeightGeneration generator;
     DMatrix Weights;
     DVector formers;
@@ -310,102 +297,193 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 
     generator.getWeights( m, N, lb, ub, Weights, formers );
 
-    result.init( Weights.getNumCols(), m );
+    const int nPoints = Weights.getNumCols();
+
+    result.init( nPoints, m );
     count = 0;
 
-    if( xResults  == 0 ) xResults  = new VariablesGrid[Weights.getNumCols()];
-    if( xaResults == 0 ) xaResults = new VariablesGrid[Weights.getNumCols()];
-    if( pResults  == 0 ) pResults  = new VariablesGrid[Weights.getNumCols()];
-    if( uResults  == 0 ) uResults  = new VariablesGrid[Weights.getNumCols()];
-    if( wResults  == 0 ) wResults  = new VariablesGrid[Weights.getNumCols()];
+    if( xResults  == 0 ) xResults  = new VariablesGrid[nPoints];
+    if( xaResults == 0 ) xaResults = new VariablesGrid[nPoints];
+    if( pResults  == 0 ) pResults  = new VariablesGrid[nPoints];
+    if( uResults  == 0 ) uResults  = new VariablesGrid[nPoints];
+    if( wResults  == 0 ) wResults  = new VariablesGrid[nPoints];
 
     totalNumberOfSQPiterations = 0;
+    totalPointCPUtime          = 0.0;
     totalCPUtime               = -acadoGetTime();
 
-    run1 = 0;
-    while( run1 < (int) Weights.getNumCols() ){
 
+    // POINTS AT THE VERTICES ADOPT THE SINGLE OBJECTIVE RESULTS:
+    // (THIS PART OF THE CODE WILL NOT RUN YET FOR GENERAL WEIGHTS)
+    // ------------------------------------------------------------
+    std::vector<int> vertex( nPoints, -1 );
+    std::vector<int> points, seeds;
 
-        // PRINT THE ITERATION NUMBER:
-        // ---------------------------
-    	printf("\n\n Multi-objective point: %d out of %d \n\n",run1+1, (int) Weights.getNumCols() );
+    for( run1 = 0; run1 < nPoints; run1++ ){
 
+        for( run2 = 0; run2 < m; run2++ ){
+            if( fabs( Weights(run2,run1)-1.0 ) < 100.0*EPS )
+                vertex[run1] = run2;
+        }
 
-        ocp->getConstraint( tmp_con );
+        if( vertex[run1] == -1 || paretoGeneration == PFG_WEIGHTED_SUM ){
+            vertex[run1] = -1;
+            points.push_back( run1 );
+        }
+        else{
+            if( xResults[run1].isEmpty() == BT_FALSE || pResults[run1].isEmpty() == BT_FALSE ||
+                uResults[run1].isEmpty() == BT_FALSE )
+                seeds.push_back( run1 );
+        }
+    }
 
-        for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
-            idx[run2] = Weights( run2, run1 );
 
+    // EACH POINT IS HOTSTARTED FROM A FIXED NEIGHBOUR, SUCH THAT THE
+    // RESULTS DO NOT DEPEND ON THE NUMBER OF THREADS:
+    // ---------------------------------------------------------------
+    std::vector<int> order, parent( nPoints, -1 );
 
-        // THIS PART OF THE CODE WILL NOT RUN YET FOR GENERAL WEIGHTS
+    if( hotstart == BT_TRUE )
+        getHotstartOrder( Weights, points, seeds, order, parent );
+    else
+        order = points;
 
-        int vertex = -1;
-        for( run2 = 0; run2 < m; run2++ ){
-            if( fabs( idx[run2]-1.0 ) < 100.0*EPS )
-                vertex = run2;
+    std::vector<returnValue> runStatus( nPoints, SUCCESSFUL_RETURN );
+    std::vector<DVector>     values   ( nPoints );
+    std::vector<int>         nSteps   ( nPoints, 0   );
+    std::vector<double>      cpuTime  ( nPoints, 0.0 );
+
+
+    // THE POINTS ARE SOLVED ON COPIES OF THE ALGORITHM (ONE PER THREAD):
+    // -------------------------------------------------------------------
+    const int nThreads = getNumThreads( (int) order.size() );
+
+    std::vector<MultiObjectiveAlgorithm*> workers( nThreads );
+    for( run1 = 0; run1 < nThreads; run1++ ){
+        workers[run1] = new MultiObjectiveAlgorithm( *this );
+        workers[run1]->set( PRINT_COPYRIGHT, BT_FALSE );
+    }
+
+    if( nThreads <= 1 ){
+
+        for( run1 = 0; run1 < (int) order.size(); run1++ ){
+
+            const int point = order[run1];
+
+            // a failed parent passes on its own hotstart
+            int source = parent[point];
+            while( source >= 0 && vertex[source] == -1 && runStatus[source] != SUCCESSFUL_RETURN )
+                source = parent[source];
+
+            runStatus[point] = solvePoint( *workers[0], Weights, point, source,
+                                           values[point], nSteps[point], cpuTime[point] );
         }
-        // ----------------------------------------------------------
+    }
 
+#ifdef ACADO_HAS_CXX11
 
-        if( vertex == -1 || paretoGeneration == PFG_WEIGHTED_SUM ){
+    else{
 
-            formulateOCP( idx, ocp, arg );
-            setStatus( BS_NOT_INITIALIZED );
-            returnvalue = OptimizationAlgorithm::solve();
+        // EACH THREAD PICKS THE NEXT POINT WHOSE PARENT IS SOLVED:
+        // --------------------------------------------------------
+        std::vector<int> state( nPoints, 0 );   // 0: open, 1: running, 2: done
+        for( run1 = 0; run1 < (int) seeds.size(); run1++ )
+            state[seeds[run1]] = 2;
 
-            if( nlpSolver != 0 )
-                totalNumberOfSQPiterations += nlpSolver->getNumberOfSteps();
+        std::mutex              mutex;
+        std::condition_variable solved;
 
-            ocp->setConstraint( tmp_con );
-            set( PRINT_COPYRIGHT, BT_FALSE );
+        // the threads continue the numbering of the symbols of the model
+        SymbolicContext *contexts = new SymbolicContext[nThreads];
+        for( run1 = 0; run1 < nThreads; run1++ )
+            contexts[run1].continueFrom( SymbolicContext::current() );
 
-            if( returnvalue != SUCCESSFUL_RETURN ){
-                ACADOERROR(returnvalue);
-            }
-            else{
-
-               getDifferentialStates( xResults[run1]  );
-               getAlgebraicStates   ( xaResults[run1] );
-               getParameters        ( pResults[run1]  );
-               getControls          ( uResults[run1]  );
-               getDisturbances      ( wResults[run1]  );
-
-               if( hotstart == BT_TRUE ){
-                    getDifferentialStates( *userInit.x );
-                    getAlgebraicStates   ( *userInit.xa );
-                    getParameters        ( *userInit.p  );
-                    getControls          ( *userInit.u );
-                    getDisturbances      ( *userInit.w  );
-                    evaluateObjectives( *userInit.x, *userInit.xa, *userInit.p, *userInit.u, *userInit.w, arg );
+        std::vector<std::thread> threads;
+
+        for( run1 = 0; run1 < nThreads; run1++ )
+            threads.push_back( std::thread( [&]( int thread ){
+
+                SymbolicContextScope scope( contexts[thread] );
+                std::unique_lock<std::mutex> lock( mutex );
+
+                while( true ){
+
+                    int  point = -1;
+                    bool open  = false;
+
+                    for( unsigned i = 0; i < order.size(); i++ ){
+                        if( state[order[i]] == 0 ){
+                            open = true;
+                            if( parent[order[i]] < 0 || state[parent[order[i]]] == 2 ){
+                                point = order[i];
+                                break;
+                            }
+                        }
+                    }
+
+                    if( open == false )
+                        break;
+
+                    if( point < 0 ){
+                        solved.wait( lock );
+                        continue;
+                    }
+
+                    int source = parent[point];
+                    while( source >= 0 && vertex[source] == -1 && runStatus[source] != SUCCESSFUL_RETURN )
+                        source = parent[source];
+
+                    state[point] = 1;
+                    lock.unlock();
+
+                    returnValue returnvalue = solvePoint( *workers[thread], Weights, point, source,
+                                                          values[point], nSteps[point], cpuTime[point] );
+
+                    lock.lock();
+                    runStatus[point] = returnvalue;
+                    state [point] = 2;
+                    solved.notify_all();
                 }
-                else{
-                   VariablesGrid xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp;
-                   getDifferentialStates( xd_tmp );
-                   getAlgebraicStates   ( xa_tmp );
-                   getParameters        ( p_tmp  );
-                   getControls          ( u_tmp  );
-                   getDisturbances      ( w_tmp  );
-                   evaluateObjectives( xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp, arg );
-               }
-            }
+            }, run1 ) );
+
+        for( run1 = 0; run1 < nThreads; run1++ )
+            threads[run1].join();
+
+        delete[] contexts;
+    }
+
+#endif
+
+    for( run1 = 0; run1 < nThreads; run1++ )
+        delete workers[run1];
+
+
+    // COLLECT THE RESULTS IN THE ORDER OF THE WEIGHTS:
+    // ------------------------------------------------
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        if( vertex[run1] != -1 ){
+            printf("\n Multi-objective point %d: result from single objective optimization is adopted. \n", run1+1 );
+            for( run2 = 0; run2 < m; run2++ )
+                result(count,run2) = vertices(vertex[run1],run2);
+            count++;
+            continue;
+        }
+
+        totalNumberOfSQPiterations += nSteps [run1];
+        totalPointCPUtime          += cpuTime[run1];
+
+        if( runStatus[run1] != SUCCESSFUL_RETURN ){
+            ACADOERROR( runStatus[run1] );
         }
         else{
-        	printf(" Result from single objective optimization is adopted. \n\n" );
-            for( run2 = 0; run2 < m; run2++ ){
-                result(count,run2) = vertices(vertex,run2);
-            }
+            for( run2 = 0; run2 < m; run2++ )
+                result(count,run2) = values[run1](run2);
             count++;
         }
-        run1++;
     }
     totalCPUtime += acadoGetTime();
 
-    for( run1 = 0; run1 < m; run1++ )
-        delete arg[run1];
-    delete[] arg;
-
-    delete[] idx;
-
     return SUCCESSFUL_RETURN;
 }
 
@@ -420,6 +498,7 @@ returnValue MultiObjectiveAlgorithm::setupOptions( )
     addOption( PARETO_FRONT_DISCRETIZATION  , defaultParetoFrontDiscretization );
     addOption( PARETO_FRONT_GENERATION      , defaultParetoFrontGeneration     );
     addOption( PARETO_FRONT_HOTSTART        , defaultParetoFrontHotstart       );
+    addOption( PARETO_FRONT_NUM_THREADS     , defaultParetoFrontNumThreads     );
 
 	// add optimization algorithm options
 	//OptimizationAlgorithm::setupOptions( );
@@ -620,12 +699,29 @@ returnValue MultiObjectiveAlgorithm::formulateOCP( double *idx, OCP *ocp_, Expre
 }
 
 
+returnValue MultiObjectiveAlgorithm::getIterate( VariablesGrid &xd_,
+                                                 VariablesGrid &xa_,
+                                                 VariablesGrid &p_ ,
+                                                 VariablesGrid &u_ ,
+                                                 VariablesGrid &w_   ) const{
+
+    if( getNX () > 0 ) ACADO_TRY( getDifferentialStates( xd_ ) );
+    if( getNXA() > 0 ) ACADO_TRY( getAlgebraicStates   ( xa_ ) );
+    if( getNP () > 0 ) ACADO_TRY( getParameters        ( p_  ) );
+    if( getNU () > 0 ) ACADO_TRY( getControls          ( u_  ) );
+    if( getNW () > 0 ) ACADO_TRY( getDisturbances      ( w_  ) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue MultiObjectiveAlgorithm::evaluateObjectives( VariablesGrid    &xd_ ,
                                                          VariablesGrid    &xa_ ,
                                                          VariablesGrid    &p_  ,
                                                          VariablesGrid    &u_  ,
                                                          VariablesGrid    &w_  ,
-                                                         Expression      **arg   ){
+                                                         Expression      **arg ,
+                                                         DVector          &values ){
 
     int run1;
     Grid tmp_grid;
@@ -643,16 +739,17 @@ returnValue MultiObjectiveAlgorithm::evaluateObjectives( VariablesGrid    &xd_ ,
     if( u_.isEmpty()  == BT_FALSE ) _u  = new VariablesGrid(u_ );
     if( w_.isEmpty()  == BT_FALSE ) _w  = new VariablesGrid(w_ );
 
+    values.init( m );
+
     Objective *obj;
     for( run1 = 0; run1 < m; run1++ ){
         obj = new Objective( tmp_grid );
         obj->addMayerTerm(*arg[run1]);
         OCPiterate xx( _xd, _xa, _p, _u, _w );
         obj->evaluate( xx );
-        obj->getObjectiveValue( result(count,run1) );
+        obj->getObjectiveValue( values(run1) );
         delete obj;
     }
-    count++;
 
     if( _xd != 0 ) delete _xd;
     if( _xa != 0 ) delete _xa;
@@ -665,6 +762,166 @@ returnValue MultiObjectiveAlgorithm::evaluateObjectives( VariablesGrid    &xd_ ,
 
 
 
+
+returnValue MultiObjectiveAlgorithm::getHotstartOrder( const DMatrix          &Weights,
+                                                       const std::vector<int> &points ,
+                                                       const std::vector<int> &seeds  ,
+                                                       std::vector<int>       &order  ,
+                                                       std::vector<int>       &parent   ) const{
+
+    int run1, run2;
+
+    const int nPoints = Weights.getNumCols();
+
+    std::vector<double> distance( nPoints, INFTY );   // squared distance to the nearest added point
+    std::vector<int>    nearest ( nPoints, -1    );
+    std::vector<bool>   added   ( nPoints, false );
+
+    std::vector<int> sources( seeds );
+
+    order.clear();
+    parent.assign( nPoints, -1 );
+
+    // WITHOUT SEEDS, THE FIRST POINT STARTS FROM THE USER INITIALIZATION:
+    // -------------------------------------------------------------------
+    if( sources.empty() == true && points.empty() == false ){
+        order.push_back( points[0] );
+        added[points[0]] = true;
+        sources.push_back( points[0] );
+    }
+
+    while( order.size() < points.size() ){
+
+        // UPDATE THE DISTANCES BY THE POINTS OF THE LAST WAVE:
+        // ----------------------------------------------------
+        for( run1 = 0; run1 < (int) sources.size(); run1++ ){
+            for( run2 = 0; run2 < (int) points.size(); run2++ ){
+
+                const int point = points[run2];
+
+                double d = 0.0;
+                for( int i = 0; i < m; i++ )
+                    d += ( Weights(i,point) - Weights(i,sources[run1]) )*( Weights(i,point) - Weights(i,sources[run1]) );
+
+                if( d < distance[point] - 100.0*EPS ){
+                    distance[point] = d;
+                    nearest [point] = sources[run1];
+                }
+            }
+        }
+
+        // THE NEXT WAVE CONSISTS OF THE CLOSEST REMAINING POINTS:
+        // -------------------------------------------------------
+        double dMin = INFTY;
+        for( run2 = 0; run2 < (int) points.size(); run2++ ){
+            if( added[points[run2]] == false && distance[points[run2]] < dMin )
+                dMin = distance[points[run2]];
+        }
+
+        sources.clear();
+        for( run2 = 0; run2 < (int) points.size(); run2++ ){
+
+            const int point = points[run2];
+
+            if( added[point] == false && distance[point] <= dMin + 100.0*EPS ){
+                order.push_back( point );
+                parent[point] = nearest[point];
+                added [point] = true;
+                sources.push_back( point );
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MultiObjectiveAlgorithm::solvePoint( const MultiObjectiveAlgorithm &worker  ,
+                                                 const DMatrix                 &Weights ,
+                                                 int                            point   ,
+                                                 int                            hotstart,
+                                                 DVector                       &values  ,
+                                                 int                           &nSteps  ,
+                                                 double                        &cpuTime   ){
+
+    int         run1       ;
+    returnValue returnvalue;
+
+    printf("\n\n Multi-objective point: %d out of %d \n\n", point+1, (int) Weights.getNumCols() );
+
+    cpuTime = -acadoGetTime();
+
+    // EACH POINT STARTS FROM A FRESH COPY OF THE WORKER:
+    // --------------------------------------------------
+    MultiObjectiveAlgorithm algorithm( worker );
+
+    Expression **arg = new Expression*[m];
+    for( run1 = 0; run1 < m; run1++ )
+        algorithm.ocp->getObjective( run1, &arg[run1] );
+
+    double *idx = new double[m];
+    for( run1 = 0; run1 < m; run1++ )
+        idx[run1] = Weights( run1, point );
+
+    // copies of an OCP share their constraint, so the point gets its own
+    // one before the scalarization adds to it
+    Constraint tmp_con;
+    algorithm.ocp->getConstraint( tmp_con );
+    algorithm.ocp->setConstraint( tmp_con );
+
+    algorithm.formulateOCP( idx, algorithm.ocp, arg );
+
+    if( hotstart >= 0 ){
+        *algorithm.userInit.x  = xResults [hotstart];
+        *algorithm.userInit.xa = xaResults[hotstart];
+        *algorithm.userInit.p  = pResults [hotstart];
+        *algorithm.userInit.u  = uResults [hotstart];
+        *algorithm.userInit.w  = wResults [hotstart];
+    }
+
+    algorithm.setStatus( BS_NOT_INITIALIZED );
+    returnvalue = algorithm.OptimizationAlgorithm::solve();
+
+    nSteps = 0;
+    if( algorithm.nlpSolver != 0 )
+        nSteps = algorithm.nlpSolver->getNumberOfSteps();
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        algorithm.getIterate( xResults [point], xaResults[point], pResults [point], uResults [point], wResults [point] );
+
+        algorithm.evaluateObjectives( xResults[point], xaResults[point], pResults[point],
+                                      uResults[point], wResults [point], arg, values );
+    }
+
+    for( run1 = 0; run1 < m; run1++ )
+        delete arg[run1];
+    delete[] arg;
+
+    delete[] idx;
+
+    cpuTime += acadoGetTime();
+
+    return returnvalue;
+}
+
+
+int MultiObjectiveAlgorithm::getNumThreads( int nTasks ){
+
+    int nThreads = defaultParetoFrontNumThreads;
+    get( PARETO_FRONT_NUM_THREADS, nThreads );
+
+#ifndef ACADO_HAS_CXX11
+    nThreads = 1;
+#endif
+
+    if( nThreads > nTasks ) nThreads = nTasks;
+    if( nThreads < 1      ) nThreads = 1;
+
+    return nThreads;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -233,7 +233,22 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
                                   Expression **arg   );
 
 
+        /**  Returns the current iterate. Only the kinds of variables   \n
+         *  that the problem has are requested from the NLP solver,     \n
+         *  the other grids are left unchanged.                          \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         */
+        returnValue getIterate( VariablesGrid &xd_,
+                                VariablesGrid &xa_,
+                                VariablesGrid &p_ ,
+                                VariablesGrid &u_ ,
+                                VariablesGrid &w_   ) const;
+
+
         /**  Evaluates the objectives.                                  \n
+         *                                                              \n
+         *  \param values  The values of the objectives (output).       \n
          *                                                              \n
          *  \return SUCCESSFUL_RETURN                                   \n
          */
@@ -242,7 +257,57 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
                                         VariablesGrid    &p_  ,
                                         VariablesGrid    &u_  ,
                                         VariablesGrid    &w_  ,
-                                        Expression      **arg1  );
+                                        Expression      **arg1,
+                                        DVector          &values );
+
+        /** Determines the order in which the points of the Pareto front \n
+         *  are solved. Starting from the seeds (or from the first point), \n
+         *  the points are added in waves: each wave contains the points   \n
+         *  that are closest (in weight space) to the points added so far, \n
+         *  and each point is hotstarted from its nearest neighbour among   \n
+         *  them. The points of one wave can be solved concurrently.        \n
+         *                                                                 \n
+         *  \param Weights  The weights (stored column-wise).              \n
+         *  \param points   The points to be solved.                       \n
+         *  \param seeds    The points whose results are already known.    \n
+         *  \param order    The order of the points (output).              \n
+         *  \param parent   The point to hotstart from, for each point     \n
+         *                  (output, -1 for the user initialization).      \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue getHotstartOrder( const DMatrix          &Weights,
+                                      const std::vector<int> &points ,
+                                      const std::vector<int> &seeds  ,
+                                      std::vector<int>       &order  ,
+                                      std::vector<int>       &parent   ) const;
+
+        /** Solves the scalarized problem of one point of the Pareto      \n
+         *  front on a copy of the given algorithm and stores its results. \n
+         *                                                                 \n
+         *  \param worker     The algorithm to be copied.                  \n
+         *  \param Weights    The weights (stored column-wise).            \n
+         *  \param point      The number of the point.                     \n
+         *  \param hotstart   The point to hotstart from (or -1).          \n
+         *  \param values     The values of the objectives (output).       \n
+         *  \param nSteps     The number of SQP iterations (output).       \n
+         *  \param cpuTime    The CPU time of the point (output).          \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         *          or an error message from the optimization algorithms   \n
+         */
+        returnValue solvePoint( const MultiObjectiveAlgorithm &worker  ,
+                                const DMatrix                 &Weights ,
+                                int                            point   ,
+                                int                            hotstart,
+                                DVector                       &values  ,
+                                int                           &nSteps  ,
+                                double                        &cpuTime   );
+
+        /** Returns the number of threads that shall be used for nTasks \n
+         *  points (according to the option PARETO_FRONT_NUM_THREADS).   \n
+         */
+        int getNumThreads( int nTasks );
 
 
 
@@ -275,6 +340,7 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
 
         int     totalNumberOfSQPiterations;
         double  totalCPUtime              ;
+        double  totalPointCPUtime         ;   // sum of the CPU times of all points
 };
 
 
@@ -319,6 +319,9 @@ inline returnValue MultiObjectiveAlgorithm::printInfo()
     std::cout << "\n\n--------------- INFO: ------------------------\n";
     std::cout << "\n    Total number of SQP iterations:  " <<  totalNumberOfSQPiterations << std::endl;
     std::cout << "    Total CPU time                :    " << totalCPUtime << " sec" << std::endl;
+    std::cout << "    Sum of CPU times of all points:    " << totalPointCPUtime << " sec" << std::endl;
+    if( totalCPUtime > 0.0 )
+        std::cout << "    Speed-up by parallel solution :    " << totalPointCPUtime / totalCPUtime << std::endl;
     std::cout << "\n\n----------------------------------------------\n\n";
 
     return SUCCESSFUL_RETURN;
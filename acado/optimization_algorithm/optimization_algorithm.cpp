@@ -153,6 +153,8 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( DISCRETIZATION_TYPE         , defaultDiscretizationType      );
 	addOption( LINESEARCH_TOLERANCE        , defaultLinesearchTolerance     );
 	addOption( MIN_LINESEARCH_PARAMETER    , defaultMinLinesearchParameter  );
+	addOption( NUM_LINESEARCH_CANDIDATES   , defaultNumLinesearchCandidates );
+	addOption( QP_SOLVER                   , defaultQPsolver                );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations      );
 	addOption( HOTSTART_QP                 , defaultHotstartQP              );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
@@ -160,11 +162,17 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( SPARSE_QP_SOLUTION          , defaultSparseQPsolution        );
+	addOption( CONDENSING_BLOCK_SIZE       , defaultCondensingBlockSize     );
+	addOption( CONIC_SOLVER_BARRIER_TUNING , defaultBarrierTuning           );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
+	addOption( COLLOCATION_SCHEME          , defaultCollocationScheme       );
+	addOption( NUM_COLLOCATION_NODES       , defaultNumCollocationNodes     );
+	addOption( NUM_INTEGRATOR_STEPS        , defaultNumCollocationSteps     );
 	addOption( INTEGRATOR_TYPE             , defaultIntegratorType          );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
@@ -180,6 +188,7 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_COLORING           , defaultJacobianColoring        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
@@ -205,7 +214,13 @@ returnValue OptimizationAlgorithm::allocateNlpSolver( Objective *F, DynamicDiscr
 	if( nlpSolver != 0 )
 		delete nlpSolver;
 
-	nlpSolver = new SCPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+	int sparseQPsolution;
+	get( SPARSE_QP_SOLUTION,sparseQPsolution );
+
+	if ( (SparseQPsolutionMethods)sparseQPsolution == SPARSE_SOLVER )
+		nlpSolver = new IPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+	else
+		nlpSolver = new SCPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -576,8 +576,6 @@ returnValue OptimizationAlgorithmBase::init(	UserInteraction* _userIteraction
        if( iter.w  != 0 ) iter.w ->disableAutoInit();
 
 
-    // (COLLOCATION NOT IMPLEMENTED YET)
-
 // 	printf("before!!!\n");
 // 	iter.print();
 
@@ -716,6 +714,23 @@ returnValue OptimizationAlgorithmBase::setupDynamicDiscretization(	UserInteracti
 
     if( differentialEquation != 0 ){
 
+        // COLLOCATION IS ONLY AVAILABLE FOR EXPLICIT, SYMBOLIC ODES:
+        // ----------------------------------------------------------
+        int discretizationType;
+        _userIteraction->get( DISCRETIZATION_TYPE, discretizationType );
+
+        if( (StateDiscretizationType)discretizationType == COLLOCATION &&
+            differentialEquation[0]->getNumAlgebraicEquations() == 0 &&
+            differentialEquation[0]->isImplicit()    == BT_FALSE &&
+            differentialEquation[0]->isDiscretized() == BT_FALSE &&
+            differentialEquation[0]->isSymbolic()    == BT_TRUE )
+        {
+            *dynamicDiscretization = new CollocationMethod( _userIteraction );
+            (*dynamicDiscretization)->addStage( *differentialEquation[0], unionGrid );
+
+            return SUCCESSFUL_RETURN;
+        }
+
         *dynamicDiscretization = new ShootingMethod( _userIteraction );
 
         int intType;
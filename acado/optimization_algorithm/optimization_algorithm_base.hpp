@@ -38,6 +38,7 @@
 //#include <acado/ocp/ocp.hpp>
 #include <acado/nlp_solver/nlp_solver.hpp>
 #include <acado/nlp_solver/scp_method.hpp>
+#include <acado/nlp_solver/ip_method.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -56,6 +56,7 @@ Process::Process( ) : SimulationBlock( BN_PROCESS )
 	dynamicSystems = 0;
 
 	integrationMethod = 0;
+	integratorType    = INT_UNKNOWN;
 
 	actuator = 0;
 	sensor   = 0;
@@ -79,6 +80,7 @@ Process::Process(	const DynamicSystem& _dynamicSystem,
 	dynamicSystems = 0;
 
 	integrationMethod = 0;
+	integratorType    = INT_UNKNOWN;
 
 	actuator = 0;
 	sensor   = 0;
@@ -115,11 +117,15 @@ Process::Process( const Process& rhs ) : SimulationBlock( rhs )
 		dynamicSystems = 0;
 	}
 
+	// the integration method has to use the options and logging of this
+	// process (its stages are set up again at each simulation step)
 	if ( rhs.integrationMethod != 0 )
-		integrationMethod = new ShootingMethod( *(rhs.integrationMethod) );
+		integrationMethod = new ShootingMethod( this );
 	else
 		integrationMethod = 0;
 
+	integratorType = rhs.integratorType;
+
 	if ( rhs.actuator != 0 )
 		actuator = new Actuator( *(rhs.actuator) );
 	else
@@ -172,9 +178,11 @@ Process& Process::operator=( const Process& rhs )
 		}
 
 		if ( rhs.integrationMethod != 0 )
-			integrationMethod = new ShootingMethod( *(rhs.integrationMethod) );
+			integrationMethod = new ShootingMethod( this );
 		else
 			integrationMethod = 0;
+
+		integratorType = rhs.integratorType;
 	
 		if ( rhs.actuator != 0 )
 			actuator = new Actuator( *(rhs.actuator) );
@@ -285,6 +293,21 @@ returnValue Process::setSensor(	const Sensor& _sensor
 }
 
 
+returnValue Process::setNoiseSeed(	uint seed
+									)
+{
+	if ( actuator != 0 )
+		actuator->setNoiseSeed( seed == 0 ? 0 : Noise::getStreamSeed( seed,0 ) );
+
+	if ( sensor != 0 )
+		sensor->setNoiseSeed( seed == 0 ? 0 : Noise::getStreamSeed( seed,1 ) );
+
+	setStatus( BS_NOT_INITIALIZED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 returnValue Process::setProcessDisturbance(	const Curve& _processDisturbance
 											)
@@ -719,6 +742,7 @@ returnValue Process::setupOptions( )
 	
 	// add integration options
 	addOption( FREEZE_INTEGRATOR           , BT_FALSE                       );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
@@ -734,6 +758,7 @@ returnValue Process::setupOptions( )
 	addOption( CORRECTOR_TOLERANCE         , defaultCorrectorTolerance      );
 	addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel    );
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
+	addOption( JACOBIAN_COLORING           , defaultJacobianColoring        );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
@@ -157,6 +157,19 @@ class Process : public SimulationBlock
 		returnValue setSensor(	const Sensor& _sensor
 								);
 
+		/** Sets the seed of the actuator and sensor noise, such that a noisy
+		 *	simulation can be reproduced. Actuator and sensor draw from streams
+		 *	derived from this seed; a seed of 0 seeds them from the system clock.
+		 *
+		 *	@param[in]  seed		Seed of the process noise.
+		 *
+		 *	\note Actuator and sensor have to be assigned before.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setNoiseSeed(	uint seed
+									);
+
 
 		/** Assigns new process disturbance to be used for simulation.
 		 *
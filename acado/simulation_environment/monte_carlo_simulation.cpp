@@ -0,0 +1,459 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file src/simulation_environment/monte_carlo_simulation.cpp
+*    \date 2014
+*/
+
+
+#include <acado/simulation_environment/monte_carlo_simulation.hpp>
+
+#include <stdio.h>
+#include <string>
+
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#include <thread>
+#endif
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+MonteCarloSimulation::MonteCarloSimulation( ) : SimulationBlock( BN_SIMULATION_ENVIRONMENT )
+{
+	setupOptions( );
+
+	startTime = 0.0;
+	endTime   = 0.0;
+
+	process    = 0;
+	controller = 0;
+
+	setStatus( BS_NOT_INITIALIZED );
+}
+
+
+MonteCarloSimulation::MonteCarloSimulation(	double _startTime,
+											double _endTime,
+											Process& _process,
+											Controller& _controller
+											) : SimulationBlock( BN_SIMULATION_ENVIRONMENT )
+{
+	setupOptions( );
+
+	startTime = _startTime;
+	endTime   = _endTime;
+
+	if ( _process.isDefined( ) == BT_TRUE )
+		process = &_process;
+	else
+		process = 0;
+
+	if ( _controller.isDefined( ) == BT_TRUE )
+		controller = &_controller;
+	else
+		controller = 0;
+
+	setStatus( BS_NOT_INITIALIZED );
+}
+
+
+MonteCarloSimulation::MonteCarloSimulation( const MonteCarloSimulation &rhs ) : SimulationBlock( rhs )
+{
+	startTime = rhs.startTime;
+	endTime   = rhs.endTime;
+
+	process    = rhs.process;
+	controller = rhs.controller;
+
+	seeds        = rhs.seeds;
+	x0           = rhs.x0;
+	p0           = rhs.p0;
+	disturbances = rhs.disturbances;
+
+	outputs  = rhs.outputs;
+	controls = rhs.controls;
+}
+
+
+MonteCarloSimulation::~MonteCarloSimulation( )
+{
+}
+
+
+MonteCarloSimulation& MonteCarloSimulation::operator=( const MonteCarloSimulation &rhs )
+{
+	if( this != &rhs )
+	{
+		SimulationBlock::operator=( rhs );
+
+		startTime = rhs.startTime;
+		endTime   = rhs.endTime;
+
+		process    = rhs.process;
+		controller = rhs.controller;
+
+		seeds        = rhs.seeds;
+		x0           = rhs.x0;
+		p0           = rhs.p0;
+		disturbances = rhs.disturbances;
+
+		outputs  = rhs.outputs;
+		controls = rhs.controls;
+	}
+
+	return *this;
+}
+
+
+
+returnValue MonteCarloSimulation::addScenario(	uint seed,
+												const DVector &x0_,
+												const DVector &p_,
+												const VariablesGrid &disturbance
+												)
+{
+	seeds.push_back( seed );
+	x0.push_back( x0_ );
+	p0.push_back( p_ );
+	disturbances.push_back( disturbance );
+
+	setStatus( BS_NOT_INITIALIZED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MonteCarloSimulation::clearScenarios( )
+{
+	seeds.clear( );
+	x0.clear( );
+	p0.clear( );
+	disturbances.clear( );
+
+	outputs.clear( );
+	controls.clear( );
+
+	setStatus( BS_NOT_INITIALIZED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue MonteCarloSimulation::run( )
+{
+	if ( controller == 0 || controller->getControlLaw( ) == 0 )
+		return ACADOERROR( RET_NO_CONTROLLER_SPECIFIED );
+
+	if ( process == 0 )
+		return ACADOERROR( RET_NO_PROCESS_SPECIFIED );
+
+	int run1;
+	const int nScenarios = (int) getNumScenarios( );
+
+	outputs.assign ( nScenarios,VariablesGrid( ) );
+	controls.assign( nScenarios,VariablesGrid( ) );
+
+	const int nThreads = getNumThreads( nScenarios );
+
+	if( nThreads <= 1 )
+	{
+		for( run1 = 0; run1 < nScenarios; run1++ )
+			ACADO_TRY( runScenario( run1 ) );
+
+		setStatus( BS_READY );
+		return SUCCESSFUL_RETURN;
+	}
+
+#ifdef ACADO_HAS_CXX11
+
+	// EACH THREAD PICKS THE NEXT OPEN SCENARIO:
+	// -----------------------------------------
+	std::vector<returnValue> scenarioStatus( nScenarios,SUCCESSFUL_RETURN );
+	std::vector<std::thread> workers;
+	std::atomic<int>         next( 0 );
+
+	// the threads continue the numbering of the symbols of the model
+	SymbolicContext *contexts = new SymbolicContext[nThreads];
+	for( run1 = 0; run1 < nThreads; run1++ )
+		contexts[run1].continueFrom( SymbolicContext::current( ) );
+
+	for( run1 = 0; run1 < nThreads; run1++ )
+		workers.push_back( std::thread( [&]( int thread ){
+			SymbolicContextScope scope( contexts[thread] );
+			int idx;
+			while( ( idx = next++ ) < nScenarios )
+				scenarioStatus[idx] = runScenario( idx );
+		}, run1 ) );
+
+	for( run1 = 0; run1 < nThreads; run1++ )
+		workers[run1].join( );
+
+	delete[] contexts;
+
+	// REPORT THE FIRST FAILING SCENARIO:
+	// ----------------------------------
+	for( run1 = 0; run1 < nScenarios; run1++ )
+		if( scenarioStatus[run1] != SUCCESSFUL_RETURN )
+			return scenarioStatus[run1];
+
+#endif
+
+	setStatus( BS_READY );
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue MonteCarloSimulation::write(	const char* fileName
+											) const
+{
+	uint run1, run2, run3;
+
+	const uint nScenarios = (uint) outputs.size( );
+
+	uint nY = 0, nU = 0, nRows = 0;
+	for( run1 = 0; run1 < nScenarios; run1++ )
+	{
+		nRows += outputs[run1].getNumPoints( );
+
+		if ( outputs[run1].getNumValues( ) > nY )
+			nY = outputs[run1].getNumValues( );
+
+		if ( controls[run1].getNumValues( ) > nU )
+			nU = controls[run1].getNumValues( );
+	}
+
+	// COLLECT THE NAMES OF THE COLUMNS:
+	// ---------------------------------
+	std::vector<std::string> names;
+	names.push_back( "scenario" );
+	names.push_back( "seed" );
+	names.push_back( "time" );
+
+	char columnName[32];
+	for( run1 = 0; run1 < nY; run1++ )
+	{
+		sprintf( columnName,"y%d",run1 );
+		names.push_back( columnName );
+	}
+	for( run1 = 0; run1 < nU; run1++ )
+	{
+		sprintf( columnName,"u%d",run1 );
+		names.push_back( columnName );
+	}
+
+	const uint nCols = (uint) names.size( );
+
+	FILE* file = fopen( fileName,"wb" );
+	if ( file == 0 )
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+	// HEADER:
+	// -------
+	fwrite( "ACADOMC1",sizeof(char),8,file );
+
+	uint dims[2] = { nCols,nRows };
+	fwrite( dims,sizeof(uint),2,file );
+
+	for( run1 = 0; run1 < nCols; run1++ )
+	{
+		uint length = (uint) names[run1].size( );
+		fwrite( &length,sizeof(uint),1,file );
+		fwrite( names[run1].c_str( ),sizeof(char),length,file );
+	}
+
+	// COLUMNS, EACH OF THEM AS CONTIGUOUS DOUBLES:
+	// -------------------------------------------
+	std::vector<double> column( nRows );
+
+	for( run1 = 0; run1 < nCols; run1++ )
+	{
+		uint row = 0;
+
+		for( run2 = 0; run2 < nScenarios; run2++ )
+		{
+			const VariablesGrid &y = outputs [run2];
+			const VariablesGrid &u = controls[run2];
+
+			for( run3 = 0; run3 < y.getNumPoints( ); run3++ )
+			{
+				double value = 0.0;
+
+				if ( run1 == 0 )
+					value = (double) run2;
+				else if ( run1 == 1 )
+					value = (double) seeds[run2];
+				else if ( run1 == 2 )
+					value = y.getTime( run3 );
+				else if ( run1 < 3+nY )
+				{
+					if ( run1-3 < y.getNumValues( ) )
+						value = y( run3,run1-3 );
+				}
+				else
+				{
+					if ( run1-3-nY < u.getNumValues( ) && run3 < u.getNumPoints( ) )
+						value = u( run3,run1-3-nY );
+				}
+
+				column[row++] = value;
+			}
+		}
+
+		if ( nRows > 0 )
+			fwrite( &column[0],sizeof(double),nRows,file );
+	}
+
+	fclose( file );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue MonteCarloSimulation::setupOptions( )
+{
+	addOption( SIMULATE_COMPUTATIONAL_DELAY , defaultSimulateComputationalDelay );
+	addOption( COMPUTATIONAL_DELAY_FACTOR   , defaultComputationalDelayFactor   );
+	addOption( COMPUTATIONAL_DELAY_OFFSET   , defaultComputationalDelayOffset   );
+	addOption( PRINTLEVEL                   , defaultPrintlevel                 );
+	addOption( NUM_THREADS                  , defaultNumThreads                 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MonteCarloSimulation::runScenario(	uint idx
+												)
+{
+	// EACH SCENARIO SIMULATES ITS OWN COPY OF THE PROCESS:
+	// ----------------------------------------------------
+	Process scenarioProcess( *process );
+
+	scenarioProcess.setNoiseSeed( seeds[idx] );
+
+	if ( disturbances[idx].isEmpty( ) == BT_FALSE )
+		ACADO_TRY( scenarioProcess.setProcessDisturbance( disturbances[idx] ) );
+
+	// ... CONTROLLED BY CLONES OF THE BLOCKS OF THE CONTROLLER:
+	// ---------------------------------------------------------
+	ControlLaw*          controlLaw          = controller->getControlLaw( )->clone( );
+	Estimator*           estimator           = 0;
+	ReferenceTrajectory* referenceTrajectory = 0;
+
+	Controller scenarioController;
+	scenarioController.setOptions( *controller );
+	scenarioController.setControlLaw( *controlLaw );
+
+	if ( controller->hasEstimator( ) == BT_TRUE )
+	{
+		estimator = controller->getEstimator( )->clone( );
+		scenarioController.setEstimator( *estimator );
+	}
+
+	if ( controller->hasReferenceTrajectory( ) == BT_TRUE )
+	{
+		referenceTrajectory = controller->getReferenceTrajectory( )->clone( );
+		scenarioController.setReferenceTrajectory( *referenceTrajectory );
+	}
+
+	// RUN THE CLOSED-LOOP SIMULATION:
+	// -------------------------------
+	SimulationEnvironment sim( startTime,endTime,scenarioProcess,scenarioController );
+
+	int simulateComputationalDelay, printLevel;
+	double computationalDelayFactor, computationalDelayOffset;
+
+	get( SIMULATE_COMPUTATIONAL_DELAY,simulateComputationalDelay );
+	get( COMPUTATIONAL_DELAY_FACTOR,computationalDelayFactor );
+	get( COMPUTATIONAL_DELAY_OFFSET,computationalDelayOffset );
+	get( PRINTLEVEL,printLevel );
+
+	sim.set( SIMULATE_COMPUTATIONAL_DELAY,simulateComputationalDelay );
+	sim.set( COMPUTATIONAL_DELAY_FACTOR,computationalDelayFactor );
+	sim.set( COMPUTATIONAL_DELAY_OFFSET,computationalDelayOffset );
+	sim.set( PRINTLEVEL,printLevel );
+
+	returnValue returnvalue = sim.init( x0[idx],p0[idx] );
+
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = sim.run( );
+
+	// SAMPLE THE CONTROLS AT THE SAMPLING INSTANTS OF THE OUTPUT:
+	// -----------------------------------------------------------
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = sim.getSampledProcessOutput( outputs[idx] );
+
+	if ( returnvalue == SUCCESSFUL_RETURN && sim.getNU( ) > 0 )
+	{
+		Curve feedbackControl;
+		sim.getFeedbackControl( feedbackControl );
+
+		returnvalue = feedbackControl.discretize( outputs[idx].getTimePoints( ),controls[idx] );
+		controls[idx].setType( VT_CONTROL );
+	}
+
+	delete controlLaw;
+
+	if ( estimator != 0 )
+		delete estimator;
+
+	if ( referenceTrajectory != 0 )
+		delete referenceTrajectory;
+
+	return returnvalue;
+}
+
+
+int MonteCarloSimulation::getNumThreads( int nTasks )
+{
+	int nThreads = defaultNumThreads;
+	get( NUM_THREADS,nThreads );
+
+#ifndef ACADO_HAS_CXX11
+	nThreads = 1;
+#endif
+
+	if( nThreads > nTasks ) nThreads = nTasks;
+	if( nThreads < 1      ) nThreads = 1;
+
+	return nThreads;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,260 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file include/acado/simulation_environment/monte_carlo_simulation.hpp
+*    \date 2014
+*/
+
+
+#ifndef ACADO_TOOLKIT_MONTE_CARLO_SIMULATION_HPP
+#define ACADO_TOOLKIT_MONTE_CARLO_SIMULATION_HPP
+
+
+#include <acado/simulation_environment/simulation_environment.hpp>
+
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+/**
+ *	\brief Runs many closed-loop simulations of the same Process and Controller.
+ *
+ *	\ingroup UserInterfaces
+ *
+ *	The class MonteCarloSimulation runs a closed-loop simulation for each of a
+ *	number of scenarios, i.e. for different initial values, parameters, process
+ *	disturbances and realisations of the actuator and sensor noise.
+ *
+ *	Each scenario runs on its own copy of the Process and on a Controller built
+ *	from clones of the control law, the estimator and the reference trajectory,
+ *	such that the scenarios can be simulated concurrently (see option NUM_THREADS).
+ *	The noise of a scenario is drawn from streams derived from the seed of the
+ *	scenario, hence each result only depends on its scenario and not on the number
+ *	of threads or the order in which the scenarios are run.
+ *
+ *	The sampled process outputs and feedback controls of all scenarios can be
+ *	written to a compact columnar binary file for the post-processing.
+ *
+ *	\note The control law has to provide a deep copy by its clone( ) method.
+ */
+class MonteCarloSimulation : public SimulationBlock
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Default constructor.
+		 */
+		MonteCarloSimulation( );
+
+		/** Constructor which takes the simulation horizon, the process and the controller.
+		 *
+		 *	@param[in] _startTime		Start time of the simulations.
+		 *	@param[in] _endTime			End time of the simulations.
+		 *	@param[in] _process			Process used for simulating the dynamic system.
+ 		 *	@param[in] _controller		Controller used for controlling the dynamic system.
+		 *
+		 *	\note Only pointers to Process and Controller are stored, the scenarios run on copies of them!
+		 */
+		MonteCarloSimulation(	double _startTime,
+								double _endTime,
+								Process& _process,
+								Controller& _controller
+								);
+
+		/** Copy constructor (deep copy).
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		MonteCarloSimulation(	const MonteCarloSimulation &rhs
+								);
+
+		/** Destructor.
+		 */
+		virtual ~MonteCarloSimulation( );
+
+		/** Assignment Operator (deep copy).
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		MonteCarloSimulation& operator=(	const MonteCarloSimulation &rhs
+											);
+
+
+		/** Adds a scenario to be simulated.
+		 *
+		 *	@param[in]  seed			Seed of the actuator and sensor noise (0 = seeded from the system clock).
+		 *	@param[in]  x0_				Initial value for differential states.
+		 *	@param[in]  p_				Initial value for parameters.
+		 *	@param[in]  disturbance		Process disturbance of the scenario (none if empty).
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue addScenario(	uint seed,
+									const DVector &x0_,
+									const DVector &p_ = emptyConstVector,
+									const VariablesGrid &disturbance = emptyConstVariablesGrid
+									);
+
+		/** Removes all scenarios and their results.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearScenarios( );
+
+
+		/** Runs the closed-loop simulations of all scenarios.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_NO_CONTROLLER_SPECIFIED, \n
+		 *	        RET_NO_PROCESS_SPECIFIED, \n
+		 *	        RET_ENVIRONMENT_INIT_FAILED, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED
+		 */
+		returnValue run( );
+
+
+		/** Returns number of scenarios.
+		 *
+		 *	\return Number of scenarios
+		 */
+		inline uint getNumScenarios( ) const;
+
+		/** Returns output of the process at sampling instants of a scenario.
+		 *
+		 *	@param[in]   idx					Index of the scenario.
+		 *	@param[out]  _sampledProcessOutput	Sampled output of the process.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		inline returnValue getSampledProcessOutput(	uint idx,
+													VariablesGrid& _sampledProcessOutput
+													) const;
+
+		/** Returns feedback control signals of a scenario at the sampling
+		 *	instants of the process output.
+		 *
+		 *	@param[in]   idx						Index of the scenario.
+		 *	@param[out]  _sampledFeedbackControl	Feedback control signals of the controller.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		inline returnValue getFeedbackControl(	uint idx,
+												VariablesGrid& _sampledFeedbackControl
+												) const;
+
+
+		/** Writes the results of all scenarios into a binary file. The file starts
+		 *	with the tag "ACADOMC1", followed by the number of columns and rows (as
+		 *	32-bit unsigned integers) and the name of each column (length and
+		 *	characters). Afterwards, each column is stored as contiguous doubles.
+		 *	The columns are the index of the scenario, its seed, the time and all
+		 *	process outputs and feedback controls; each row is one sampling instant
+		 *	of one scenario.
+		 *
+		 *	@param[in]  fileName	Name of the file.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_FILE_CAN_NOT_BE_OPENED
+		 */
+		returnValue write(	const char* fileName
+							) const;
+
+
+
+	//
+	//  PROTECTED MEMBER FUNCTIONS:
+	//
+	protected:
+
+		/** Sets-up default options.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue setupOptions( );
+
+		/** Runs the closed-loop simulation of a single scenario.
+		 *
+		 *	@param[in]  idx		Index of the scenario.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_ENVIRONMENT_INIT_FAILED, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED
+		 */
+		returnValue runScenario(	uint idx
+									);
+
+		/** Returns the number of threads used for the given number of scenarios.
+		 *
+		 *	@param[in]  nTasks	Number of scenarios.
+		 *
+		 *  \return Number of threads
+		 */
+		int getNumThreads(	int nTasks
+							);
+
+
+
+	//
+	//  PROTECTED MEMBERS:
+	//
+	protected:
+
+		double startTime;							/**< Start time of the simulations. */
+		double endTime;								/**< End time of the simulations. */
+
+		Process* process;							/**< Pointer to Process the scenarios are simulated with. */
+		Controller* controller;			 			/**< Pointer to Controller the scenarios are controlled with. */
+
+		std::vector<uint> seeds;					/**< Noise seed of each scenario. */
+		std::vector<DVector> x0;					/**< Initial differential states of each scenario. */
+		std::vector<DVector> p0;					/**< Initial parameters of each scenario. */
+		std::vector<VariablesGrid> disturbances;	/**< Process disturbance of each scenario. */
+
+		std::vector<VariablesGrid> outputs;			/**< Sampled process output of each scenario. */
+		std::vector<VariablesGrid> controls;		/**< Feedback controls of each scenario at the sampling instants. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/simulation_environment/monte_carlo_simulation.ipp>
+
+
+#endif	// ACADO_TOOLKIT_MONTE_CARLO_SIMULATION_HPP
+
+/*
+ *	end of file
+ */
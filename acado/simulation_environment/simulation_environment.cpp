@@ -308,8 +308,12 @@ returnValue SimulationEnvironment::step( )
 		return ACADOERROR( RET_BLOCK_NOT_READY );
 
 
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
 	++nSteps;
-	printf( "\n*** SIMULATION LOOP NO. %d (starting at time %.3f) ***\n",nSteps,simulationClock.getTime( ) );
+	if ( (PrintLevel)printLevel >= MEDIUM )
+		printf( "\n*** SIMULATION LOOP NO. %d (starting at time %.3f) ***\n",nSteps,simulationClock.getTime( ) );
 
 	/* Perform one single simulation loop */
 	DVector u, p;
@@ -331,9 +335,6 @@ returnValue SimulationEnvironment::step( )
 	// step controller
 // 	yPrevious.print("controller input y");
 
-	int printLevel;
-	get( PRINTLEVEL,printLevel );
-
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		cout << "--> Calling controller ...\n";
 
@@ -145,7 +145,7 @@ REFER_NAMESPACE_ACADO Expression getRiccatiODE( const REFER_NAMESPACE_ACADO Expr
 REFER_NAMESPACE_ACADO Expression chol( const REFER_NAMESPACE_ACADO Expression &arg );
 
 
-/** Function which clears all the static counters, used throughout ACADO symbolics. */
+/** Function which clears the variable counters of the current symbolic context, used throughout ACADO symbolics. */
 REFER_NAMESPACE_ACADO returnValue clearAllStaticCounters();
 
 
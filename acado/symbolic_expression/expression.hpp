@@ -36,6 +36,7 @@
 
 #include <acado/utils/acado_utils.hpp>
 #include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/symbolic_expression/symbolic_context.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -325,7 +326,8 @@ BEGIN_NAMESPACE_ACADO
 /** A helper class implementing the CRTP design pattern.
  *
  *  This class gives object counting and clone capability to a derived
- *  class via static polymorphism.
+ *  class via static polymorphism. The objects are counted within the
+ *  current SymbolicContext.
  *
  *  \tparam Derived      The derived class.
  *  \tparam Type         The expression type. \sa VariableType
@@ -343,19 +345,13 @@ public:
 
 	/** Default constructor. */
 	ExpressionType()
-		: Expression("", 1, 1, Type, AllowCounter ? count : 0)
-	{
-		if (AllowCounter == true)
-			count++;
-	}
+		: Expression("", 1, 1, Type, AllowCounter ? SymbolicContext::current().reserveVariables(Type, 1) : 0)
+	{}
 
 	/** The constructor with arguments. */
 	ExpressionType(const std::string& _name, unsigned _nRows, unsigned _nCols)
-		: Expression(_name, _nRows, _nCols, Type, AllowCounter ? count : 0)
-	{
-		if (AllowCounter == true)
-			count += _nRows * _nCols;
-	}
+		: Expression(_name, _nRows, _nCols, Type, AllowCounter ? SymbolicContext::current().reserveVariables(Type, _nRows * _nCols) : 0)
+	{}
 
 	/** The constructor from an expression. */
 	ExpressionType(const Expression& _expression, unsigned _componentIdx = 0)
@@ -364,7 +360,7 @@ public:
 		variableType = Type;
 		component += _componentIdx;
 		if (AllowCounter == true)
-			count++;
+			SymbolicContext::current().reserveVariables(Type, 1);
 	}
 
 	/** The constructor from a scalar number. */
@@ -394,17 +390,11 @@ public:
 	virtual Expression* clone() const
 	{ return new Derived( static_cast< Derived const& >( *this ) ); }
 
-	/** A function for resetting of the istance counter. */
+	/** A function for resetting of the instance counter (of the current symbolic context). */
 	returnValue clearStaticCounters()
-	{ count = 0; return SUCCESSFUL_RETURN; }
-
-private:
-	static unsigned count;
+	{ return SymbolicContext::current().clearVariableCounter( Type ); }
 };
 
-template<class Derived, VariableType Type, bool AllowCounter>
-unsigned ExpressionType<Derived, Type, AllowCounter>::count( 0 );
-
 CLOSE_NAMESPACE_ACADO
 
 #endif  // ACADO_TOOLKIT_EXPRESSION_HPP
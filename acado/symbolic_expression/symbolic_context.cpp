@@ -0,0 +1,155 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/symbolic_expression/symbolic_context.cpp
+ *    \date 2014
+ */
+
+
+#include <acado/symbolic_expression/symbolic_context.hpp>
+
+
+#ifdef ACADO_HAS_CXX11
+#define ACADO_THREAD_LOCAL thread_local
+#else
+#define ACADO_THREAD_LOCAL
+#endif
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Context that has been made current by a SymbolicContextScope (per thread). */
+static ACADO_THREAD_LOCAL SymbolicContext* currentContext = 0;
+
+
+SymbolicContext::SymbolicContext( ){
+
+    clear( );
+}
+
+
+SymbolicContext::~SymbolicContext( ){}
+
+
+SymbolicContext& SymbolicContext::current( ){
+
+    static ACADO_THREAD_LOCAL SymbolicContext defaultContext;
+
+    if( currentContext != 0 )
+        return *currentContext;
+
+    return defaultContext;
+}
+
+
+unsigned SymbolicContext::reserveVariables( VariableType type, unsigned n ){
+
+    unsigned first = variableCount[type];
+    variableCount[type] += n;
+
+    return first;
+}
+
+
+returnValue SymbolicContext::clearVariableCounter( VariableType type ){
+
+    variableCount[type] = 0;
+    return SUCCESSFUL_RETURN;
+}
+
+
+int SymbolicContext::getNextTreeProjectionIndex( ){
+
+    return treeProjectionCount++;
+}
+
+
+returnValue SymbolicContext::clearTreeProjectionCounter( ){
+
+    treeProjectionCount = 0;
+    return SUCCESSFUL_RETURN;
+}
+
+
+int SymbolicContext::getCOperatorID( ) const{
+
+    return cOperatorCount;
+}
+
+
+int SymbolicContext::increaseCOperatorID( ){
+
+    return cOperatorCount++;
+}
+
+
+returnValue SymbolicContext::clear( ){
+
+    int run1;
+
+    for( run1 = 0; run1 <= VT_UNKNOWN; run1++ )
+        variableCount[run1] = 0;
+
+    treeProjectionCount = 0;
+    cOperatorCount      = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SymbolicContext::continueFrom( const SymbolicContext &arg ){
+
+    int run1;
+
+    for( run1 = 0; run1 <= VT_UNKNOWN; run1++ )
+        variableCount[run1] = arg.variableCount[run1];
+
+    treeProjectionCount = arg.treeProjectionCount;
+    cOperatorCount      = arg.cOperatorCount     ;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+SymbolicContextScope::SymbolicContextScope( SymbolicContext &context ){
+
+    previous       = currentContext;
+    currentContext = &context;
+}
+
+
+SymbolicContextScope::~SymbolicContextScope( ){
+
+    currentContext = previous;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file
@@ -0,0 +1,158 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/symbolic_expression/symbolic_context.hpp
+ *    \date 2014
+ */
+
+
+#ifndef ACADO_TOOLKIT_SYMBOLIC_CONTEXT_HPP
+#define ACADO_TOOLKIT_SYMBOLIC_CONTEXT_HPP
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *  \brief Stores the counters of the symbolic layer.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class SymbolicContext stores the counters which are used to assign
+ *  indices to new variables, intermediate states (tree projections) and
+ *  C-operators. Each thread has its own default context, such that models
+ *  can be built and differentiated in several threads at the same time.
+ *  In addition, a context can be made current explicitly within a scope
+ *  (cf. SymbolicContextScope), e.g. in order to give each model its own
+ *  context.
+ *
+ *  A context must not be used by several threads at the same time.
+ */
+class SymbolicContext{
+
+public:
+
+    /** Default constructor. */
+    SymbolicContext( );
+
+    /** Destructor. */
+    ~SymbolicContext( );
+
+
+    /** Returns the context of the calling thread. This is the context  \n
+     *  which has been made current by a SymbolicContextScope, or the    \n
+     *  default context of the thread otherwise.                         \n
+     */
+    static SymbolicContext& current( );
+
+
+    /** Reserves n consecutive indices for variables of the given type.  \n
+     *  \return The first reserved index.                                \n
+     */
+    unsigned reserveVariables( VariableType type,
+                               unsigned     n = 1 );
+
+    /** Resets the counter of the variables of the given type. */
+    returnValue clearVariableCounter( VariableType type );
+
+
+    /** Returns a new index for an intermediate state (tree projection). */
+    int getNextTreeProjectionIndex( );
+
+    /** Resets the counter of the tree projections. */
+    returnValue clearTreeProjectionCounter( );
+
+
+    /** Returns the ID of the next C-operator. */
+    int getCOperatorID( ) const;
+
+    /** Increases the ID of the C-operators.             \n
+     *  \return The ID before increasing it.              \n
+     */
+    int increaseCOperatorID( );
+
+
+    /** Resets all counters of the context. */
+    returnValue clear( );
+
+    /** Continues the numbering of another context, such that models    \n
+     *  of one thread can be extended within another thread.             \n
+     */
+    returnValue continueFrom( const SymbolicContext &arg );
+
+
+private:
+
+    /** Copying a context is not allowed. */
+    SymbolicContext( const SymbolicContext& );
+    SymbolicContext& operator=( const SymbolicContext& );
+
+
+    unsigned variableCount[VT_UNKNOWN+1];  /**< number of variables per type      */
+    int      treeProjectionCount        ;  /**< number of tree projections        */
+    int      cOperatorCount             ;  /**< number of C-operators             */
+};
+
+
+/**
+ *  \brief Makes a SymbolicContext current within a scope.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class SymbolicContextScope makes the given context the current one
+ *  of the calling thread; the previous context is restored when the scope
+ *  is left. Scopes can be nested.
+ */
+class SymbolicContextScope{
+
+public:
+
+    /** Makes the given context current for the calling thread. */
+    SymbolicContextScope( SymbolicContext &context );
+
+    /** Restores the previous context of the calling thread. */
+    ~SymbolicContextScope( );
+
+
+private:
+
+    /** Copying a scope is not allowed. */
+    SymbolicContextScope( const SymbolicContextScope& );
+    SymbolicContextScope& operator=( const SymbolicContextScope& );
+
+    SymbolicContext *previous;  /**< context that was current before */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_SYMBOLIC_CONTEXT_HPP
+
+// end of file
@@ -39,6 +39,7 @@
 // COLLECTION OF ALL EXPRESSION-HEADER FILES:
 // -------------------------------------------------------
 
+#include <acado/symbolic_expression/symbolic_context.hpp>
 #include <acado/symbolic_expression/expression.hpp>
 #include <acado/symbolic_expression/variable_types.hpp>
 #include <acado/symbolic_expression/lyapunov.hpp>
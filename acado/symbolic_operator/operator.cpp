@@ -50,6 +50,12 @@ Operator::Operator(){
     initialized = BT_FALSE;
 }
 
+Operator::Operator( const Operator &arg ){
+
+    nCount      = (int) arg.nCount;
+    initialized = arg.initialized;
+}
+
 Operator::~Operator(){ }
 
 
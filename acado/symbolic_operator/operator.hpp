@@ -37,6 +37,10 @@
 
 #include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#endif
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -65,6 +69,9 @@ public:
            /** Default constructor. */
            Operator();
 
+           /** Copy constructor. */
+           Operator( const Operator &arg );
+
     virtual ~Operator();
 
 
@@ -553,7 +560,14 @@ public:
     virtual BooleanType isSymbolic() const = 0;
 
 
+    /** Number of additional tree projections sharing the operator. As   \n
+     *  copies of a model may be used by several threads, it is atomic.   \n
+     */
+#ifdef ACADO_HAS_CXX11
+    std::atomic<int> nCount;
+#else
     int nCount;
+#endif
 
 
 
@@ -42,7 +42,6 @@ BEGIN_NAMESPACE_ACADO
 
 
 
-int TreeProjection::count = 0;
 
 TreeProjection::TreeProjection( )
                :Projection(){
@@ -88,13 +87,11 @@ TreeProjection::~TreeProjection(){
  
     if( argument != 0 ){
 
-        if( argument->nCount == 0 ){
+        // the last projection sharing the argument deletes it
+        if( argument->nCount-- == 0 ){
             delete argument;
             argument = 0;
         }
-        else{
-            argument->nCount--;
-        }
     }
 }
 
@@ -105,13 +102,10 @@ Operator& TreeProjection::operator=( const Operator &arg ){
     if( this != &arg ){
 
         if( argument != 0 ){
-            if( argument->nCount == 0 ){
+            if( argument->nCount-- == 0 ){
                 delete argument;
                 argument = 0;
             }
-            else{
-                argument->nCount--;
-            }
         }
 
     	Operator *arg_tmp = arg.clone();
@@ -140,7 +134,7 @@ Operator& TreeProjection::operator=( const Operator &arg ){
     		else {
     			// no special case: create a new treeprojection
     			argument = arg.clone() ;
-    			vIndex   = count++;
+    			vIndex   = SymbolicContext::current().getNextTreeProjectionIndex();
     			variableIndex  = vIndex ;
 
     			curvature      = CT_UNKNOWN; // argument->getCurvature();
@@ -164,18 +158,15 @@ Operator& TreeProjection::operator=( const Expression &arg ){
 	ASSERT( arg.getDim() == 1 );
 
 	if( argument != 0 ){
-		if( argument->nCount == 0 ){
+		if( argument->nCount-- == 0 ){
 			delete argument;
 			argument = 0;
 		}
-		else{
-			argument->nCount--;
-		}
 	}
 
 	argument = arg.getOperatorClone(0);
 
-	vIndex         = count++;
+	vIndex         = SymbolicContext::current().getNextTreeProjectionIndex();
 	variableIndex  = vIndex ;
 
 	curvature      = CT_UNKNOWN; // argument->getCurvature();
@@ -551,8 +542,7 @@ BooleanType TreeProjection::isRationalIn( int dim,
 
 returnValue TreeProjection::clearStaticCounters(){
 
-    count     = 0;
-    return SUCCESSFUL_RETURN;
+    return SymbolicContext::current().clearTreeProjectionCounter();
 }
 
 
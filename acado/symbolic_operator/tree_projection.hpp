@@ -169,7 +169,8 @@ public:
                                          BooleanType  *implicit_dep  /**< implicit dependencies */ );
 
 
-     /** This function clears all static counters. Although this \n
+     /** This function clears the counter of the tree projections \n
+      *  (within the current symbolic context). Although this    \n
       *  function is public it should never be used in C-code.   \n
       *  It is necessary for some Matlab-specific interfaces.    \n
       *  Please have a look into the header file                 \n
@@ -279,7 +280,6 @@ protected:
     protected:
 
         Operator   *argument;
-        static int  count   ;
         NeutralElement    ne;
 };
 
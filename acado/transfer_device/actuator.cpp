@@ -398,10 +398,16 @@ returnValue Actuator::delayActuatorInput(	VariablesGrid& _u,
 		if ( getDelayedInputGrids( _u,_p, uDelayed,pDelayed ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_DELAYING_INPUTS_FAILED );
 
+		// both delayed grids share the same time points, so the floor
+		// indices of the horizon bounds only need to be searched once
+		uint startIdx = 0;
+		uint endIdx   = uDelayed.getFloorIndex( endTime );
+		uDelayed.getFloorIndex( startTime,startIdx );
+
 		// store last signal
-		lastSignal = uDelayed.getTimeSubGrid( uDelayed.getFloorIndex( endTime ),uDelayed.getLastIndex( ) );
+		lastSignal = uDelayed.getTimeSubGrid( endIdx,uDelayed.getLastIndex( ) );
 		if ( _p.isEmpty( ) == BT_FALSE )
-			lastSignal.appendValues( pDelayed.getTimeSubGrid( pDelayed.getFloorIndex( endTime ),pDelayed.getLastIndex( ) ) );
+			lastSignal.appendValues( pDelayed.getTimeSubGrid( endIdx,pDelayed.getLastIndex( ) ) );
 
 /*		printf("u:\n");
 		_u.print();
@@ -417,9 +423,9 @@ returnValue Actuator::delayActuatorInput(	VariablesGrid& _u,
 // 		lastSignal.print();
 
 		// crop delayed signal to current horizon
-		_u = uDelayed.getTimeSubGrid( uDelayed.getFloorIndex( startTime ),uDelayed.getFloorIndex( endTime ) );
+		_u = uDelayed.getTimeSubGrid( startIdx,endIdx );
 		if ( _p.isEmpty( ) == BT_FALSE )
-			_p = pDelayed.getTimeSubGrid( pDelayed.getFloorIndex( startTime ),pDelayed.getFloorIndex( endTime ) );
+			_p = pDelayed.getTimeSubGrid( startIdx,endIdx );
 
 // 		printf("u:\n");
 // 		_u.print();
@@ -244,11 +244,15 @@ returnValue Sensor::delaySensorOutput(	VariablesGrid& _y
 		if ( getDelayedOutputGrid( _y, yDelayed ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_DELAYING_OUTPUTS_FAILED );
 
+		uint startIdx = 0;
+		uint endIdx   = yDelayed.getFloorIndex( endTime );
+		yDelayed.getFloorIndex( startTime,startIdx );
+
 		// store last signal
-		lastSignal = yDelayed.getTimeSubGrid( yDelayed.getFloorIndex( endTime ),yDelayed.getLastIndex( ) );
+		lastSignal = yDelayed.getTimeSubGrid( endIdx,yDelayed.getLastIndex( ) );
 
 		// crop delayed signal to current horizon
-		_y = yDelayed.getTimeSubGrid( yDelayed.getFloorIndex( startTime ),yDelayed.getFloorIndex( endTime ) );
+		_y = yDelayed.getTimeSubGrid( startIdx,endIdx );
 
 		return SUCCESSFUL_RETURN;
 	}
@@ -46,6 +46,7 @@ BEGIN_NAMESPACE_ACADO
 TransferDevice::TransferDevice( ) : SimulationBlock( )
 {
 	additiveNoise = 0;
+	noiseSeed = 0;
 
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -68,6 +69,8 @@ TransferDevice::TransferDevice(	uint _dim,
 	deadTimes.init( _dim );
 	deadTimes.setAll( 0.0 );
 
+	noiseSeed = 0;
+
 	setStatus( BS_NOT_INITIALIZED );
 }
 
@@ -92,6 +95,8 @@ TransferDevice::TransferDevice( const TransferDevice& rhs ) : SimulationBlock( r
 	noiseSamplingTimes = rhs.noiseSamplingTimes;
 	
 	deadTimes = rhs.deadTimes;
+
+	noiseSeed = rhs.noiseSeed;
 }
 
 
@@ -142,12 +147,25 @@ TransferDevice& TransferDevice::operator=( const TransferDevice& rhs )
 		noiseSamplingTimes = rhs.noiseSamplingTimes;
 
 		deadTimes = rhs.deadTimes;
+
+		noiseSeed = rhs.noiseSeed;
 	}
 
 	return *this;
 }
 
 
+returnValue TransferDevice::setNoiseSeed(	uint _noiseSeed
+											)
+{
+	noiseSeed = _noiseSeed;
+
+	setStatus( BS_NOT_INITIALIZED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 
 //
@@ -181,7 +199,13 @@ returnValue TransferDevice::init(	double _startTime,
 		for( uint i=0; i<getDim( ); ++i )
 		{
 			if ( additiveNoise[i] != 0 )
-				additiveNoise[i]->init( );
+			{
+				// each component draws from its own stream
+				if ( noiseSeed == 0 )
+					additiveNoise[i]->init( );
+				else
+					additiveNoise[i]->init( Noise::getStreamSeed( noiseSeed,i ) );
+			}
 		}
 	}
 
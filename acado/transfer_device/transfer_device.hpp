@@ -131,6 +131,21 @@ class TransferDevice : public SimulationBlock
 		inline BooleanType hasDeadTime( ) const;
 
 
+		/** Sets the seed of the additive noise. Each component of the transfer
+		 *	device draws from its own stream derived from this seed, such that the
+		 *	noise can be reproduced. If the seed is 0 (default), the noise is seeded
+		 *	from the system clock.
+		 *
+		 *	@param[in] _noiseSeed	Seed of the additive noise.
+		 *
+		 *	\note The seed takes effect when the transfer device is initialised.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setNoiseSeed(	uint _noiseSeed
+									);
+
+
 
 	//
 	// PROTECTED MEMBER FUNCTIONS:
@@ -178,6 +193,8 @@ class TransferDevice : public SimulationBlock
 		DVector  noiseSamplingTimes;					/**< Noise sampling times for each component of the transfer device signal. */
 
 		DVector  deadTimes;							/**< Dead times for each component of the transfer device signal. */
+
+		uint noiseSeed;								/**< Seed of the additive noise (0 = seeded from the system clock). */
 };
 
 
@@ -451,6 +451,13 @@ class AlgorithmicBase
 		inline BooleanType haveOptionsChanged(	uint idx
 												) const;
 
+		/** Returns the stamp of the current option values. Option values that
+		 *	have been read while the stamp was the same need not be read again.
+		 *
+		 *	\return Stamp of the current option values
+		 */
+		inline uint getOptionsVersion( ) const;
+
 
 		/** Sets all numerical values at all time instants of all items
 		 *	with given name within all records.
@@ -173,6 +173,12 @@ inline BooleanType AlgorithmicBase::haveOptionsChanged(	uint idx
 }
 
 
+inline uint AlgorithmicBase::getOptionsVersion( ) const
+{
+	return userInteraction->getOptionsVersion( );
+}
+
+
 
 inline returnValue AlgorithmicBase::setAll(	LogName _name,
 											const MatrixVariablesGrid& values
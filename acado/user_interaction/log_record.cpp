@@ -76,7 +76,8 @@ returnValue LogRecord::addItem(	LogName _name,
 //		LOG( LVL_DEBUG ) << "Log record "<< _name << " exists!" << endl;
 		return SUCCESSFUL_RETURN;
 	}
-	items[ make_pair(_name, LRT_ENUM) ] = LogRecordData( _label );
+	items[ make_pair(_name, LRT_ENUM) ] = itemData.size();
+	itemData.push_back( LogRecordData( _label ) );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -87,7 +88,8 @@ returnValue LogRecord::addItem(	const Expression& _name,
 {
 	if (items.count(make_pair(_name.getComponent( 0 ), LRT_VARIABLE)))
 		return SUCCESSFUL_RETURN;
-	items[ make_pair(_name.getComponent( 0 ), LRT_VARIABLE) ] = LogRecordData( _label );
+	items[ make_pair(_name.getComponent( 0 ), LRT_VARIABLE) ] = itemData.size();
+	itemData.push_back( LogRecordData( _label ) );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -114,13 +116,14 @@ returnValue LogRecord::print(	std::ostream& _stream,
 	case PRINT_ITEM_BY_ITEM:
 		for (it = items.begin(); it != items.end(); ++it)
 		{
+			const LogRecordData& data = itemData[ it->second ];
 			DMatrix tmp;
 
-			for (uint i = 0; i < it->second.values.getNumPoints(); ++i)
-				tmp.appendRows(it->second.values.getMatrix(i));
+			for (uint i = 0; i < data.getNumPoints(); ++i)
+				tmp.appendRows(data.getMatrix(i));
 
 			 status = tmp.print(
-					_stream, it->second.label.c_str(),
+					_stream, data.label.c_str(),
 					startString, endString, width, precision,
 					colSeparator, rowSeparator);
 			 if (status != SUCCESSFUL_RETURN)
@@ -133,11 +136,13 @@ returnValue LogRecord::print(	std::ostream& _stream,
 		for (unsigned i = 0; i < getMaxNumMatrices(); ++i)
 			for (it = items.begin(); it != items.end(); ++it)
 			{
-				if (i >= it->second.values.getNumPoints()
-						|| it->second.values.getNumPoints() == 0)
+				const LogRecordData& data = itemData[ it->second ];
+
+				if (i >= data.getNumPoints()
+						|| data.getNumPoints() == 0)
 					break;
-				if (it->second.values.getMatrix( i ).print(
-						_stream, it->second.label.c_str(),
+				if (data.getMatrix( i ).print(
+						_stream, data.label.c_str(),
 						startString, endString, width, precision,
 						colSeparator, rowSeparator)
 						!= SUCCESSFUL_RETURN)
@@ -149,10 +154,12 @@ returnValue LogRecord::print(	std::ostream& _stream,
 	case PRINT_LAST_ITER:
 		for (it = items.begin(); it != items.end(); ++it)
 		{
-			if (it->second.values.getNumPoints() == 0)
+			const LogRecordData& data = itemData[ it->second ];
+
+			if (data.getNumPoints() == 0)
 				continue;
-			if (it->second.values.getMatrix(getMaxNumMatrices() - 1).print(
-					_stream, it->second.label.c_str(),
+			if (data.getMatrix(getMaxNumMatrices() - 1).print(
+					_stream, data.label.c_str(),
 					startString, endString, width, precision,
 					colSeparator, rowSeparator) != SUCCESSFUL_RETURN)
 				goto LogRecord_print_exit;
@@ -193,7 +200,7 @@ uint LogRecord::getMaxNumMatrices( ) const
 	for (it = items.begin(); it != items.end(); ++it)
 	{
 //		if ( items[ i ].getNumPoints( ) > maxNumMatrices );
-		maxNumMatrices = it->second.values.getNumPoints( );
+		maxNumMatrices = itemData[ it->second ].getNumPoints( );
 	}
 
 	return maxNumMatrices;
@@ -214,7 +221,7 @@ returnValue LogRecord::getAll(	uint _name,
 	if (it == items.end())
 		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 
-	values = it->second.values;
+	itemData[ it->second ].getValues( values );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -229,10 +236,12 @@ returnValue LogRecord::getFirst(	uint _name,
 	if (it == items.end())
 		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 
-	if (it->second.values.getNumPoints() == 0)
+	const LogRecordData& data = itemData[ it->second ];
+
+	if (data.getNumPoints() == 0)
 		firstValue = DMatrix();
 	else
-		firstValue = it->second.values.getMatrix( 0 );
+		firstValue = data.getMatrix( 0 );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -247,10 +256,12 @@ returnValue LogRecord::getLast(	uint _name,
 	if (it == items.end())
 		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 
-	if (it->second.values.getNumPoints() == 0)
+	const LogRecordData& data = itemData[ it->second ];
+
+	if (data.getNumPoints() == 0)
 		lastValue = DMatrix();
 	else
-		lastValue = it->second.values.getMatrix(it->second.values.getNumPoints() - 1);
+		lastValue = data.getMatrix(data.getNumPoints() - 1);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -266,23 +277,36 @@ returnValue LogRecord::setAll(	uint _name,
 	if (it == items.end())
 		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 
-	if (it->second.values.getNumPoints( ) == 0)
-		return it->second.values.init( );
+	LogRecordData& data = itemData[ it->second ];
+
+	if (data.getNumPoints( ) == 0)
+	{
+		data.clear( );
+		return SUCCESSFUL_RETURN;
+	}
 
 	switch( frequency )
 	{
 	case LOG_AT_START:
-		it->second.values.init();
-		it->second.values.addMatrix(values.getFirstMatrix( ), values.getFirstTime( ));
+		data.replace(values.getFirstMatrix( ), values.getFirstTime( ));
 		break;
 
 	case LOG_AT_END:
-		it->second.values.init();
-		it->second.values.addMatrix(values.getLastMatrix( ), values.getFirstTime( ));
+		data.replace(values.getLastMatrix( ), values.getFirstTime( ));
 		break;
 
 	case LOG_AT_EACH_ITERATION:
-		it->second.values = values;
+		if (data.ringCapacity == 0)
+		{
+			data.values = values;
+			data.nLogged = values.getNumPoints( );
+		}
+		else
+		{
+			data.clear( );
+			for (uint i = 0; i < values.getNumPoints( ); ++i)
+				data.add(values.getMatrix( i ), values.getTime( i ));
+		}
 		break;
 	}
 
@@ -299,42 +323,115 @@ returnValue LogRecord::setLast(	uint _name,
 	if (it == items.end())
 		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
 
+	return setLast( ItemHandle( it->second ),value,time );
+}
+
+returnValue LogRecord::setLast(	ItemHandle _handle,
+								const DMatrix& value,
+								double time
+								)
+{
+	if ( ( _handle.isValid( ) == false ) || ( (uint)_handle.idx >= itemData.size( ) ) )
+		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
+
+	LogRecordData& data = itemData[ _handle.idx ];
 	double logTime = time;
 
 	switch( frequency )
 	{
 	case LOG_AT_START:
 		// only log if no matrix has been logged so far
-		if (it->second.values.getNumPoints() == 0)
+		if (data.getNumPoints() == 0)
 		{
 			if (acadoIsEqual(logTime, -INFTY) == BT_TRUE)
 				logTime = 0.0;
 
-			it->second.values.addMatrix(value, logTime);
+			data.add(value, logTime);
 		}
 		break;
 
 	case LOG_AT_END:
 		// always overwrite existing matrices in order to keep only the last one
-		it->second.values.init();
-
 		if (acadoIsEqual(logTime, -INFTY) == BT_TRUE)
 			logTime = 0.0;
 
-		it->second.values.addMatrix(value, logTime);
+		data.replace(value, logTime);
 		break;
 
 	case LOG_AT_EACH_ITERATION:
 		// add matrix to list
 		if (acadoIsEqual(logTime, -INFTY) == BT_TRUE)
-			logTime = (double)it->second.values.getNumPoints() + 1.0;
+			logTime = (double)data.nLogged + 1.0;
 
-		it->second.values.addMatrix(value, logTime);
+		data.add(value, logTime);
 		break;
 	}
 	return SUCCESSFUL_RETURN;
 }
 
+LogRecord::ItemHandle LogRecord::getItemHandle(	uint _name,
+												LogRecordItemType _type
+												) const
+{
+	LogRecordItems::const_iterator it = items.find(make_pair(_name, _type));
+	if (it == items.end())
+		return ItemHandle( );
+
+	return ItemHandle( it->second );
+}
+
+returnValue LogRecord::enableRingBuffer(	uint _name,
+											LogRecordItemType _type,
+											uint _capacity,
+											uint _nRows,
+											uint _nCols
+											)
+{
+	LogRecordItems::iterator it = items.find(make_pair(_name, _type));
+	if (it == items.end())
+		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
+
+	LogRecordData& data = itemData[ it->second ];
+
+	data.clear( );
+	data.setupRingBuffer( _capacity,_nRows,_nCols );
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue LogRecord::dumpBinary(	uint _name,
+									LogRecordItemType _type,
+									std::ostream& _stream
+									) const
+{
+	LogRecordItems::const_iterator it = items.find(make_pair(_name, _type));
+	if (it == items.end())
+		return ACADOERROR( RET_LOG_ENTRY_DOESNT_EXIST );
+
+	const LogRecordData& data = itemData[ it->second ];
+
+	unsigned nEntries = data.getNumPoints( );
+	_stream.write( (const char*)&nEntries,sizeof( unsigned ) );
+
+	for (uint i = 0; i < nEntries; ++i)
+	{
+		DMatrix value = data.getMatrix( i );
+		double valueTime = data.getTime( i );
+		unsigned nRows = value.getNumRows( );
+		unsigned nCols = value.getNumCols( );
+
+		_stream.write( (const char*)&valueTime,sizeof( double ) );
+		_stream.write( (const char*)&nRows,sizeof( unsigned ) );
+		_stream.write( (const char*)&nCols,sizeof( unsigned ) );
+		_stream.write( (const char*)value.data( ),nRows*nCols*sizeof( double ) );
+	}
+
+	if ( !_stream )
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+	return SUCCESSFUL_RETURN;
+}
+
 returnValue LogRecord::updateLogRecord( LogRecord& _record
 										) const
 {
@@ -342,18 +439,150 @@ returnValue LogRecord::updateLogRecord( LogRecord& _record
 
 	for (it = _record.items.begin(); it != _record.items.end(); ++it)
 	{
-		if (it->second.writeProtection == true)
+		LogRecordData& data = _record.itemData[ it->second ];
+
+		if (data.writeProtection == true)
 			continue;
 
 		LogRecordItems::const_iterator cit = items.find( it->first );
 
 		if (cit != items.end())
-			it->second = cit->second;
+			data = itemData[ cit->second ];
 	}
 
 	return SUCCESSFUL_RETURN;
 }
 
+
+//
+// LOG RECORD ITEM DATA:
+//
+
+uint LogRecord::LogRecordData::getNumPoints( ) const
+{
+	if (ringCapacity == 0)
+		return values.getNumPoints( );
+
+	return ringSize;
+}
+
+uint LogRecord::LogRecordData::getDim( ) const
+{
+	if (ringCapacity == 0)
+		return values.getDim( );
+
+	return ringSize * ringRows * ringCols;
+}
+
+DMatrix LogRecord::LogRecordData::getMatrix(	uint idx
+												) const
+{
+	if (ringCapacity == 0)
+		return values.getMatrix( idx );
+
+	ASSERT( idx < ringSize );
+
+	uint dim  = ringRows * ringCols;
+	uint slot = (ringNext + ringCapacity - ringSize + idx) % ringCapacity;
+
+	DMatrix tmp(ringRows, ringCols);
+	std::copy(ringValues.begin() + slot * dim, ringValues.begin() + (slot + 1) * dim, tmp.data());
+
+	return tmp;
+}
+
+double LogRecord::LogRecordData::getTime(	uint idx
+											) const
+{
+	if (ringCapacity == 0)
+		return values.getTime( idx );
+
+	ASSERT( idx < ringSize );
+
+	return ringTimes[ (ringNext + ringCapacity - ringSize + idx) % ringCapacity ];
+}
+
+void LogRecord::LogRecordData::getValues(	MatrixVariablesGrid& _values
+											) const
+{
+	if (ringCapacity == 0)
+	{
+		_values = values;
+		return;
+	}
+
+	_values.init( );
+	for (uint i = 0; i < ringSize; ++i)
+		_values.addMatrix(getMatrix( i ), getTime( i ));
+}
+
+void LogRecord::LogRecordData::clear( )
+{
+	values.init( );
+
+	ringNext = 0;
+	ringSize = 0;
+	nLogged  = 0;
+}
+
+void LogRecord::LogRecordData::add(	const DMatrix& value,
+									double time
+									)
+{
+	++nLogged;
+
+	if (ringCapacity == 0)
+	{
+		values.addMatrix(value, time);
+		return;
+	}
+
+	// (re-)allocate storage only if dimensions change
+	if ((value.getNumRows() != ringRows) || (value.getNumCols() != ringCols))
+		setupRingBuffer(ringCapacity, value.getNumRows(), value.getNumCols());
+
+	uint dim = ringRows * ringCols;
+	std::copy(value.data(), value.data() + dim, ringValues.begin() + ringNext * dim);
+	ringTimes[ ringNext ] = time;
+
+	ringNext = (ringNext + 1) % ringCapacity;
+	if (ringSize < ringCapacity)
+		++ringSize;
+}
+
+void LogRecord::LogRecordData::replace(	const DMatrix& value,
+										double time
+										)
+{
+	if ((ringCapacity == 0) && (values.getNumPoints() == 1) &&
+		(values.getNumRows( 0 ) == value.getNumRows()) && (values.getNumCols( 0 ) == value.getNumCols()))
+	{
+		// overwrite the single stored entry in place
+		values.getMatrixMap( 0 ) = value;
+		values.setTime(0, time);
+		nLogged = 1;
+		return;
+	}
+
+	clear( );
+	add(value, time);
+}
+
+void LogRecord::LogRecordData::setupRingBuffer(	uint _capacity,
+												uint _nRows,
+												uint _nCols
+												)
+{
+	ringCapacity = _capacity;
+	ringRows = _nRows;
+	ringCols = _nCols;
+	ringNext = 0;
+	ringSize = 0;
+
+	ringValues.resize(_capacity * _nRows * _nCols);
+	ringTimes.resize(_capacity);
+}
+
 CLOSE_NAMESPACE_ACADO
 
 /*
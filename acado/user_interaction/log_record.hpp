@@ -38,6 +38,7 @@
 #include <acado/variables_grid/variables_grid.hpp>
 
 #include <map>
+#include <vector>
 #include <iterator>
 
 BEGIN_NAMESPACE_ACADO
@@ -67,12 +68,39 @@ class Logging;
  *	flushed to UserInterface classes. Internally, LogRecords are stored as basic 
  *	singly-linked within a LogCollection.
  *
+ *	For long-running applications, single items can be switched to a ring buffer
+ *	of fixed capacity (see enableRingBuffer()), which keeps only the most recent 
+ *	values and does not allocate memory when new values are logged. Together with
+ *	pre-resolved item handles (see getItemHandle()), this makes logging within a 
+ *	feedback loop cheap and bounded in memory.
+ *
  *	\author Hans Joachim Ferreau, Boris Houska, Milan Vukov
  */
 class LogRecord
 {
 	friend class Logging;
 
+	public:
+
+		/** Pre-resolved handle to an item of a log record, see getItemHandle().
+		 *	A handle stays valid as long as no items are added to the record and 
+		 *	can also be used with copies of the record. */
+		struct ItemHandle
+		{
+			explicit ItemHandle(	int _idx = -1
+									)
+				: idx( _idx )
+			{}
+
+			/** Returns whether handle refers to an item. */
+			bool isValid( ) const
+			{
+				return idx >= 0;
+			}
+
+			int idx;
+		};
+
 	//
 	// PUBLIC MEMBER FUNCTIONS:
 	//
@@ -393,6 +421,111 @@ class LogRecord
 									double time = -INFTY
 									);
 
+		/** Sets numerical value at last time instant of the item referred to
+		 *	by given handle. This avoids the lookup of the item by its name and
+		 *	should be preferred when logging the same item repeatedly.
+		 *
+		 *	@param[in]  _handle		Handle of item, as returned by getItemHandle().
+		 *	@param[in]  value		Numerical value at last time instant of given item.
+		 *	@param[in]  time		Time label of the instant.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 */
+		returnValue setLast(	ItemHandle _handle,
+								const DMatrix& value,
+								double time = -INFTY
+								);
+
+		/** Returns handle of the item with given name, which allows to 
+		 *	set its values without looking it up again.
+		 *
+		 *	@param[in] _name	Internal name of item.
+		 *
+		 *  \return Handle of item (invalid if item does not exist)
+		 */
+		inline ItemHandle getItemHandle(	LogName _name
+											) const;
+
+		/** Returns handle of the item with given name, which allows to 
+		 *	set its values without looking it up again.
+		 *
+		 *	@param[in] _name	Internal name of item.
+		 *
+		 *  \return Handle of item (invalid if item does not exist)
+		 */
+		inline ItemHandle getItemHandle(	const Expression& _name
+											) const;
+
+		/** Stores the values of the item with given name in a ring buffer
+		 *	holding only the last _capacity entries. Memory for the ring buffer
+		 *	is allocated here if the dimensions of the values are given, and 
+		 *	otherwise once the first value is logged. As long as the dimensions 
+		 *	do not change afterwards, logging does not allocate any memory.
+		 *	Values logged so far are discarded.
+		 *
+		 *	@param[in] _name		Internal name of item.
+		 *	@param[in] _capacity	Maximum number of entries to be kept (0 disables the ring buffer).
+		 *	@param[in] _nRows		Number of rows of logged values (optional).
+		 *	@param[in] _nCols		Number of columns of logged values (optional).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 */
+		inline returnValue enableRingBuffer(	LogName _name,
+												uint _capacity,
+												uint _nRows = 0,
+												uint _nCols = 0
+												);
+
+		/** Stores the values of the item with given name in a ring buffer
+		 *	holding only the last _capacity entries (see above).
+		 *
+		 *	@param[in] _name		Internal name of item.
+		 *	@param[in] _capacity	Maximum number of entries to be kept (0 disables the ring buffer).
+		 *	@param[in] _nRows		Number of rows of logged values (optional).
+		 *	@param[in] _nCols		Number of columns of logged values (optional).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 */
+		inline returnValue enableRingBuffer(	const Expression& _name,
+												uint _capacity,
+												uint _nRows = 0,
+												uint _nCols = 0
+												);
+
+		/** Writes all entries of the item with given name in binary form into
+		 *	a stream, oldest entry first. The dump starts with the number of entries 
+		 *	(unsigned int), followed by each entry consisting of its time (double), 
+		 *	its number of rows and columns (unsigned int each) and its values (doubles, 
+		 *	row-wise).
+		 *
+		 *	@param[in] _name	Internal name of item.
+		 *	@param[in] _stream	Stream (opened in binary mode) to write the entries.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_FILE_CAN_NOT_BE_OPENED
+		 */
+		inline returnValue dumpBinary(	LogName _name,
+										std::ostream& _stream
+										) const;
+
+		/** Writes all entries of the item with given name in binary form into
+		 *	a stream (see above).
+		 *
+		 *	@param[in] _name	Internal name of item.
+		 *	@param[in] _stream	Stream (opened in binary mode) to write the entries.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_FILE_CAN_NOT_BE_OPENED
+		 */
+		inline returnValue dumpBinary(	const Expression& _name,
+										std::ostream& _stream
+										) const;
+
 		/** Prints whole record into a stream;
 		 *	all items are printed according to the output format settings.
 		 *
@@ -600,6 +733,46 @@ class LogRecord
 								);
 
 
+		/** Returns handle of the item with given internal name and internal type.
+		 *
+		 *	@param[in] _name	Internal name of item.
+		 *	@param[in] _type	Internal type of item.
+		 *
+		 *  \return Handle of item (invalid if item does not exist)
+		 */
+		ItemHandle getItemHandle(	uint _name,
+									LogRecordItemType _type
+									) const;
+
+		/** Switches item with given internal name and internal type to
+		 *	a ring buffer of given capacity.
+		 *
+		 *	\note All <em>public</em> enableRingBuffer member functions make use of this protected function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST 
+		 */
+		returnValue enableRingBuffer(	uint _name,
+										LogRecordItemType _type,
+										uint _capacity,
+										uint _nRows,
+										uint _nCols
+										);
+
+		/** Writes all entries of item with given internal name and internal 
+		 *	type in binary form into a stream.
+		 *
+		 *	\note All <em>public</em> dumpBinary member functions make use of this protected function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_ENTRY_DOESNT_EXIST, \n
+		 *	        RET_FILE_CAN_NOT_BE_OPENED
+		 */
+		returnValue dumpBinary(	uint _name,
+								LogRecordItemType _type,
+								std::ostream& _stream
+								) const;
+
 		/** Returns whether an (possibly empty) item with given internal name 
 		 *	and internal type exists or not.
 		 *
@@ -664,34 +837,85 @@ class LogRecord
 		/** Print scheme defining the output format of the information. */
 		PrintScheme printScheme;
 
-		/** Log record item data. */
+		/** Log record item data. Numerical values are either stored in a grid
+		 *	growing with each logged value or, if a ring buffer capacity is set,
+		 *	in preallocated storage keeping only the last ringCapacity entries. */
 		struct LogRecordData
 		{
 			LogRecordData()
-				: label( DEFAULT_LABEL ), writeProtection( false )
+				: label( DEFAULT_LABEL ), writeProtection( false ),
+				  ringCapacity( 0 ), ringRows( 0 ), ringCols( 0 ),
+				  ringNext( 0 ), ringSize( 0 ), nLogged( 0 )
 			{}
 
 			LogRecordData(	const std::string& _label
 							)
-				: label( _label ), writeProtection( false )
+				: label( _label ), writeProtection( false ),
+				  ringCapacity( 0 ), ringRows( 0 ), ringCols( 0 ),
+				  ringNext( 0 ), ringSize( 0 ), nLogged( 0 )
 			{}
 
 			LogRecordData(	const MatrixVariablesGrid& _values,
 							const std::string& _label,
 							bool _writeProtection
 							)
-				: values( _values ), label( _label ), writeProtection( _writeProtection )
+				: values( _values ), label( _label ), writeProtection( _writeProtection ),
+				  ringCapacity( 0 ), ringRows( 0 ), ringCols( 0 ),
+				  ringNext( 0 ), ringSize( 0 ), nLogged( 0 )
 			{}
 
+			/** Returns number of stored entries. */
+			uint getNumPoints( ) const;
+			/** Returns total number of stored doubles. */
+			uint getDim( ) const;
+			/** Returns stored entry with given index (0 = oldest one). */
+			DMatrix getMatrix(	uint idx
+								) const;
+			/** Returns time of stored entry with given index (0 = oldest one). */
+			double getTime(	uint idx
+							) const;
+			/** Returns all stored entries, oldest one first. */
+			void getValues(	MatrixVariablesGrid& _values
+							) const;
+
+			/** Removes all stored entries. */
+			void clear( );
+			/** Appends an entry. */
+			void add(	const DMatrix& value,
+						double time
+						);
+			/** Replaces all stored entries by the given one. Does not allocate 
+			 *	memory if an entry of same dimensions is stored already. */
+			void replace(	const DMatrix& value,
+							double time
+							);
+			/** Sets up ring buffer of given capacity. */
+			void setupRingBuffer(	uint _capacity,
+									uint _nRows,
+									uint _nCols
+									);
+
 			MatrixVariablesGrid values;
 			std::string label;
 			bool writeProtection;
+
+			uint ringCapacity;				/**< Capacity of ring buffer (0 = no ring buffer). */
+			uint ringRows;					/**< Number of rows of entries stored in ring buffer. */
+			uint ringCols;					/**< Number of columns of entries stored in ring buffer. */
+			uint ringNext;					/**< Slot to be written next. */
+			uint ringSize;					/**< Number of entries stored in ring buffer. */
+			uint nLogged;					/**< Number of entries logged since last clear. */
+			std::vector<double> ringValues;	/**< Row-wise values of all ring buffer slots. */
+			std::vector<double> ringTimes;	/**< Times of all ring buffer slots. */
 		};
 
-		/** Type definition for Log record items. */
-		typedef std::map<std::pair<int, LogRecordItemType>, LogRecordData> LogRecordItems;
+		/** Type definition for Log record items, mapping the name and type of an
+		 *	item to its index within itemData. */
+		typedef std::map<std::pair<int, LogRecordItemType>, uint> LogRecordItems;
 		/** Log record items. */
 		LogRecordItems items;
+		/** Data of all log record items, in order of their creation. */
+		std::vector< LogRecordData > itemData;
 };
 
 CLOSE_NAMESPACE_ACADO
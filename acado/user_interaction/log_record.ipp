@@ -185,6 +185,56 @@ inline returnValue LogRecord::setLast(	const Expression& _name,
 	return setLast( _name,tmp,time );
 }
 
+inline LogRecord::ItemHandle LogRecord::getItemHandle(	LogName _name
+														) const
+{
+	return getItemHandle( (uint)_name,LRT_ENUM );
+}
+
+
+inline LogRecord::ItemHandle LogRecord::getItemHandle(	const Expression& _name
+														) const
+{
+	return getItemHandle( _name.getComponent( 0 ),LRT_VARIABLE );
+}
+
+
+inline returnValue LogRecord::enableRingBuffer(	LogName _name,
+												uint _capacity,
+												uint _nRows,
+												uint _nCols
+												)
+{
+	return enableRingBuffer( (uint)_name,LRT_ENUM,_capacity,_nRows,_nCols );
+}
+
+
+inline returnValue LogRecord::enableRingBuffer(	const Expression& _name,
+												uint _capacity,
+												uint _nRows,
+												uint _nCols
+												)
+{
+	return enableRingBuffer( _name.getComponent( 0 ),LRT_VARIABLE,_capacity,_nRows,_nCols );
+}
+
+
+inline returnValue LogRecord::dumpBinary(	LogName _name,
+											std::ostream& _stream
+											) const
+{
+	return dumpBinary( (uint)_name,LRT_ENUM,_stream );
+}
+
+
+inline returnValue LogRecord::dumpBinary(	const Expression& _name,
+											std::ostream& _stream
+											) const
+{
+	return dumpBinary( _name.getComponent( 0 ),LRT_VARIABLE,_stream );
+}
+
+
 inline uint LogRecord::getNumItems( ) const
 {
 	return items.size();
@@ -250,7 +300,7 @@ inline BooleanType LogRecord::hasNonEmptyItem(	LogName _name
 	it = items.find(std::make_pair(_name, LRT_ENUM));
 	if (it == items.end())
 		return false;
-	if (it->second.values.isEmpty( ) == false)
+	if (itemData[ it->second ].getNumPoints( ) > 0)
 		return true;
 		
 	return false;
@@ -264,7 +314,7 @@ inline BooleanType LogRecord::hasNonEmptyItem(	const Expression& _name
 	it = items.find(std::make_pair(_name.getComponent( 0 ), LRT_VARIABLE));
 	if (it == items.end())
 		return false;
-	if (it->second.values.isEmpty( ) == false)
+	if (itemData[ it->second ].getNumPoints( ) > 0)
 		return true;
 		
 	return false;
@@ -276,7 +326,7 @@ inline uint LogRecord::getNumDoubles( ) const
 	unsigned nDoubles = 0;
 
 	for (it = items.begin(); it != items.end(); ++it)
-		nDoubles += it->second.values.getDim();
+		nDoubles += itemData[ it->second ].getDim();
 
 	return nDoubles;
 }
@@ -289,7 +339,7 @@ inline returnValue LogRecord::enableWriteProtection(        LogName _name
 	if (it == items.end())
 		return SUCCESSFUL_RETURN;
 	
-	it->second.writeProtection = true;	
+	itemData[ it->second ].writeProtection = true;	
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -303,7 +353,7 @@ inline returnValue LogRecord::enableWriteProtection(        const Expression& _n
 	if (it == items.end())
 		return SUCCESSFUL_RETURN;
 	
-	it->second.writeProtection = true;	
+	itemData[ it->second ].writeProtection = true;	
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -317,7 +367,7 @@ inline returnValue LogRecord::disableWriteProtection(        LogName _name
 	if (it == items.end())
 		return SUCCESSFUL_RETURN;
 	
-	it->second.writeProtection = false;	
+	itemData[ it->second ].writeProtection = false;	
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -331,7 +381,7 @@ inline returnValue LogRecord::disableWriteProtection(        const Expression& _
 	if (it == items.end())
 		return SUCCESSFUL_RETURN;
 	
-	it->second.writeProtection = false;	
+	itemData[ it->second ].writeProtection = false;	
 	
 	return SUCCESSFUL_RETURN;
 }
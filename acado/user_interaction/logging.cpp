@@ -36,6 +36,23 @@ using namespace std;
 
 BEGIN_NAMESPACE_ACADO
 
+
+/** Buffer the logging of the calling thread is redirected to (0 = log directly). */
+#ifdef ACADO_HAS_CXX11
+static thread_local DeferredLog* deferredLog = 0;
+#else
+static DeferredLog* deferredLog = 0;
+#endif
+
+
+returnValue DeferredLog::clear( )
+{
+	entries.clear( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -127,6 +144,38 @@ returnValue Logging::printNumDoubles( ) const
 	return SUCCESSFUL_RETURN;
 }
 
+void Logging::deferLogging(	DeferredLog* _buffer
+							)
+{
+	deferredLog = _buffer;
+}
+
+returnValue Logging::writeDeferredLog(	const DeferredLog& _buffer
+										)
+{
+	for (unsigned i = 0; i < _buffer.entries.size(); ++i)
+	{
+		const DeferredLog::Entry& entry = _buffer.entries[ i ];
+
+		if (entry.isAll == BT_TRUE)
+		{
+			ACADO_TRY( setAll(entry.name, entry.values) );
+		}
+		else if (entry.isGrid == BT_TRUE)
+		{
+			VariablesGrid value;
+			value = entry.values;
+			ACADO_TRY( setLast(entry.name, value, entry.time) );
+		}
+		else
+		{
+			ACADO_TRY( setLast(entry.name, entry.value, entry.time) );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -136,6 +185,11 @@ returnValue Logging::setupLogging( )
 	return SUCCESSFUL_RETURN;
 }
 
+DeferredLog* Logging::getDeferredLog( )
+{
+	return deferredLog;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 /*
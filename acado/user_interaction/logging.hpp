@@ -40,6 +40,57 @@ BEGIN_NAMESPACE_ACADO
 
 static LogRecord emptyLogRecord;
 
+
+/**
+ *	\brief Buffers the log entries of a thread whose logging is deferred.
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *  The class DeferredLog stores the log entries written by a thread while
+ *	its logging is redirected by Logging::deferLogging. This allows to run
+ *	copies of an algorithm concurrently and to write only the entries of the
+ *	copy whose result is used into the log collection afterwards.
+ */
+class DeferredLog
+{
+	friend class Logging;
+
+	//
+	// PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Removes all buffered entries.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clear( );
+
+	//
+	// PROTECTED DATA TYPES:
+	//
+	protected:
+
+		/** Single buffered call of Logging::setLast or Logging::setAll. */
+		struct Entry
+		{
+			LogName name;					/**< Internal name of the item. */
+			BooleanType isAll;				/**< Flag indicating whether all values are set. */
+			BooleanType isGrid;				/**< Flag indicating whether the last value is a VariablesGrid. */
+			DMatrix value;					/**< Last value given as DMatrix. */
+			MatrixVariablesGrid values;		/**< All values or last value given as VariablesGrid. */
+			double time;					/**< Time label of the last value. */
+		};
+
+	//
+	// DATA MEMBERS:
+	//
+	protected:
+		/** Buffered entries in the order they have been written. */
+		std::vector< Entry > entries;
+};
+
+
 /**
  *	\brief Provides a generic way to store algorithmic information during runtime.
  *
@@ -255,6 +306,27 @@ class Logging
 
 		returnValue printNumDoubles( ) const;
 
+
+		/** Redirects all subsequent setLast and setAll calls of the calling
+		 *	thread into the given buffer instead of the log collection.
+		 *
+		 *	@param[in] _buffer	Buffer of the log entries (0 = log directly).
+		 *
+		 *	\note Without C++11 support, the redirection applies to all threads.
+		 */
+		static void deferLogging(	DeferredLog* _buffer
+									);
+
+		/** Writes all entries of a deferred log into the log collection.
+		 *
+		 *	@param[in] _buffer	Buffer of the log entries.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_RECORD_CORRUPTED
+		 */
+		returnValue writeDeferredLog(	const DeferredLog& _buffer
+										);
+
     //
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -267,6 +339,12 @@ class Logging
 		 */
 		virtual returnValue setupLogging( );
 
+		/** Returns the buffer the logging of the calling thread is redirected to.
+		 *
+		 *  \return Buffer of the log entries (0 = log directly)
+		 */
+		static DeferredLog* getDeferredLog( );
+
     //
     // DATA MEMBERS:
     //
@@ -103,6 +103,17 @@ inline returnValue Logging::setAll(	LogName _name,
 									const MatrixVariablesGrid& values
 									)
 {
+	DeferredLog* buffer = getDeferredLog( );
+	if ( buffer != 0 )
+	{
+		buffer->entries.push_back( DeferredLog::Entry( ) );
+		buffer->entries.back( ).name   = _name;
+		buffer->entries.back( ).isAll  = BT_TRUE;
+		buffer->entries.back( ).isGrid = BT_TRUE;
+		buffer->entries.back( ).values = values;
+		return SUCCESSFUL_RETURN;
+	}
+
 	for (unsigned it = 0; it < logCollection.size(); ++it)
 		if (logCollection[ it ].hasItem( _name ) == true)
 			return logCollection[ it ].setAll(_name, values); 
@@ -117,9 +128,25 @@ inline returnValue Logging::setLast(	LogName _name,
 										double time
 										)
 {
+	DeferredLog* buffer = getDeferredLog( );
+	if ( buffer != 0 )
+	{
+		buffer->entries.push_back( DeferredLog::Entry( ) );
+		buffer->entries.back( ).name   = _name;
+		buffer->entries.back( ).isAll  = BT_FALSE;
+		buffer->entries.back( ).isGrid = BT_FALSE;
+		buffer->entries.back( ).value  = value;
+		buffer->entries.back( ).time   = time;
+		return SUCCESSFUL_RETURN;
+	}
+
 	for (unsigned it = 0; it < logCollection.size(); ++it)
-		if (logCollection[ it ].hasItem( _name ) == true)
-			return logCollection[ it ].setLast(_name, value, time); 
+	{
+		LogRecord::ItemHandle handle = logCollection[ it ].getItemHandle( _name );
+
+		if (handle.isValid( ) == true)
+			return logCollection[ it ].setLast(handle, value, time);
+	}
 
 	return SUCCESSFUL_RETURN;
 }
@@ -129,6 +156,18 @@ inline returnValue Logging::setLast(	LogName _name,
 										double time
 										)
 {
+	DeferredLog* buffer = getDeferredLog( );
+	if ( buffer != 0 )
+	{
+		buffer->entries.push_back( DeferredLog::Entry( ) );
+		buffer->entries.back( ).name   = _name;
+		buffer->entries.back( ).isAll  = BT_FALSE;
+		buffer->entries.back( ).isGrid = BT_TRUE;
+		buffer->entries.back( ).values = value;
+		buffer->entries.back( ).time   = time;
+		return SUCCESSFUL_RETURN;
+	}
+
 	for (unsigned it = 0; it < logCollection.size(); ++it)
 		if (logCollection[ it ].hasItem( _name ) == true)
 			return logCollection[ it ].setLast(_name, value, time);
@@ -32,11 +32,23 @@
 
 #include <acado/user_interaction/options.hpp>
 
+#ifdef ACADO_HAS_CXX11
+#include <atomic>
+#endif
+
 
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Last stamp assigned to option values, shared by all Options objects. */
+#ifdef ACADO_HAS_CXX11
+static std::atomic< uint > lastOptionsVersion( 0 );
+#else
+static uint lastOptionsVersion = 0;
+#endif
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -45,6 +57,7 @@ BEGIN_NAMESPACE_ACADO
 Options::Options( )
 {
 	lists.push_back( OptionsList() );
+	updateOptionsVersion( );
 }
 
 
@@ -52,6 +65,7 @@ Options::Options(	const OptionsList& _lists
 					)
 {
 	lists.push_back( _lists );
+	updateOptionsVersion( );
 }
 
 
@@ -61,7 +75,8 @@ Options::~Options( )
 returnValue Options::addOptionsList( )
 {
 	lists.push_back( lists[ 0 ] );
-	
+	updateOptionsVersion( );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -127,6 +142,9 @@ returnValue Options::set(	OptionsName name,
 							int value
 							)
 {
+	if ( lists[0].hasValue( name,value ) == BT_FALSE )
+		updateOptionsVersion( );
+
 	return lists[0].set( name,value );
 }
 
@@ -135,6 +153,9 @@ returnValue Options::set(	OptionsName name,
 							double value
 							)
 {	
+	if ( lists[0].hasValue( name,value ) == BT_FALSE )
+		updateOptionsVersion( );
+
 	return lists[0].set( name,value );
 }
 
@@ -142,6 +163,9 @@ returnValue Options::set(	OptionsName name,
 							const std::string& value
 							)
 {
+	if ( lists[0].hasValue( name,value ) == BT_FALSE )
+		updateOptionsVersion( );
+
 	return lists[0].set( name,value );
 }
 
@@ -153,6 +177,9 @@ returnValue Options::set(	uint idx,
 	if ( idx >= getNumOptionsLists( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
+	if ( lists[idx].hasValue( name,value ) == BT_FALSE )
+		updateOptionsVersion( );
+
 	return lists[idx].set( name,value );
 }
 
@@ -165,6 +192,9 @@ returnValue Options::set(	uint idx,
 	if ( idx >= getNumOptionsLists( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 	
+	if ( lists[idx].hasValue( name,value ) == BT_FALSE )
+		updateOptionsVersion( );
+
 	return lists[idx].set( name,value );
 }
 
@@ -176,6 +206,9 @@ returnValue Options::set(	uint idx,
 	if ( idx >= getNumOptionsLists( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
+	if ( lists[idx].hasValue( name,value ) == BT_FALSE )
+		updateOptionsVersion( );
+
 	return lists[idx].set( name,value );
 }
 
@@ -196,6 +229,7 @@ returnValue Options::setOptions(	uint idx,
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
 	lists[ idx ] = arg.lists[ idx ];
+	updateOptionsVersion( );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -298,6 +332,12 @@ returnValue Options::declareOptionsUnchanged(	uint idx
 }
 
 
+void Options::updateOptionsVersion( )
+{
+	optionsVersion = ++lastOptionsVersion;
+}
+
+
 returnValue Options::addOption(	OptionsName name,
 								int value
 								)
@@ -310,6 +350,7 @@ returnValue Options::addOption(	OptionsName name,
 		if ( returnvalue != SUCCESSFUL_RETURN )
 			return returnvalue;
 	}
+	updateOptionsVersion( );
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -327,6 +368,7 @@ returnValue Options::addOption(	OptionsName name,
 		if ( returnvalue != SUCCESSFUL_RETURN )
 			return returnvalue;
 	}
+	updateOptionsVersion( );
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -343,6 +385,7 @@ returnValue Options::addOption(	OptionsName name,
 		if ( returnvalue != SUCCESSFUL_RETURN )
 			return returnvalue;
 	}
+	updateOptionsVersion( );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -357,6 +400,7 @@ returnValue Options::addOption(	uint idx,
 	if ( idx >= getNumOptionsLists( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
+	updateOptionsVersion( );
 	return lists[idx].add( name,value );
 }
 
@@ -369,6 +413,7 @@ returnValue Options::addOption(	uint idx,
 	if ( idx >= getNumOptionsLists( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
+	updateOptionsVersion( );
 	return lists[idx].add( name,value );
 }
 
@@ -380,6 +425,7 @@ returnValue Options::addOption(	uint idx,
 	if ( idx >= getNumOptionsLists( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
+	updateOptionsVersion( );
 	return lists[idx].add( name,value );
 }
 
@@ -308,6 +308,14 @@ class Options
 		 */
 		uint getNumOptionsLists( ) const;
 
+		/** Returns a stamp of the current option values. Each modification of
+		 *	the options assigns a new stamp that has never been used before, so
+		 *	option values read while the stamp was the same are still valid.
+		 *
+		 *  \return Stamp of the current option values
+		 */
+		inline uint getOptionsVersion( ) const;
+
 
 		/** Prints a list of all available options of all option lists.
 		 *
@@ -379,6 +387,11 @@ class Options
 		returnValue declareOptionsUnchanged(	uint idx
 												);
 
+		/** Assigns a new stamp to the current option values; to be called
+		 *	whenever the options are modified.
+		 */
+		void updateOptionsVersion( );
+
 
 		/** Add an option item with a given integer default value to the all option lists.
 		 *
@@ -474,8 +487,18 @@ class Options
 
 		/** A list consisting of OptionsLists. */
 		std::vector< OptionsList > lists;
+
+		/** Stamp of the current option values. */
+		uint optionsVersion;
 };
 
+
+inline uint Options::getOptionsVersion( ) const
+{
+	return optionsVersion;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 #endif	// ACADO_TOOLKIT_OPTIONS_HPP
@@ -138,6 +138,20 @@ class OptionsList
 								const T& value
 								);
 
+		/** Determines whether an existing option item has a given value.
+		 *
+		 *  @tparam    T		Option data type.
+		 *	@param[in] name		Name of option item.
+		 *	@param[in] value	Value to compare with.
+		 *
+		 *  \return BT_TRUE  iff option item exists and has the given value, \n
+		 *	        BT_FALSE otherwise
+		 */
+		template< typename T >
+		inline BooleanType hasValue(	OptionsName name,
+										const T& value
+										) const;
+
 		/** Returns total number of option items in list.
 		 *
 		 *  \return Total number of options in list
@@ -289,6 +303,22 @@ inline returnValue OptionsList::set(	OptionsName name,
 	return ACADOERROR( RET_OPTION_DOESNT_EXIST );
 }
 
+template< typename T >
+inline BooleanType OptionsList::hasValue(	OptionsName name,
+											const T& value
+											) const
+{
+	OptionItems::const_iterator it = items.find(std::make_pair(name, getType< T >()));
+	if (it == items.end())
+		return BT_FALSE;
+
+	std::shared_ptr< OptionValue< T > > ptr;
+	ptr = std::static_pointer_cast< OptionValue< T > >(it->second);
+
+	// exact comparison, written without operator== to stay -Wfloat-equal clean for doubles
+	return (BooleanType)( !( ptr->value < value ) && !( value < ptr->value ) );
+}
+
 CLOSE_NAMESPACE_ACADO
 
 #include <acado/user_interaction/options_list.ipp>
@@ -51,10 +51,14 @@ const int 		defaultDynamicSensitivity = BACKWARD_SENSITIVITY;					/**< Default v
 const int 		defaultObjectiveSensitivity = BACKWARD_SENSITIVITY;					/**< Default value for generating sensitivities of the objective function (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultConstraintSensitivity = BACKWARD_SENSITIVITY;				/**< Default value for generating sensitivities of the constraints (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultDiscretizationType = MULTIPLE_SHOOTING;						/**< Default value for specifying how to discretize the OCP in time (possible values: SINGLE_SHOOTING, MULTIPLE_SHOOTING, COLLOCATION). */
-const int 		defaultSparseQPsolution = CONDENSING;								/**< Default value for specifying how to solve the sparse sub-QP (possible values: SPARSE_SOLVER, CONDENSING, FULL_CONDENSING). */
+const int 		defaultSparseQPsolution = CONDENSING;								/**< Default value for specifying how to solve the sparse sub-QP (possible values: SPARSE_SOLVER, CONDENSING, FULL_CONDENSING, BLOCK_CONDENSING_N2). */
+const int 		defaultCondensingBlockSize = 0;										/**< Default value for the number of shooting intervals condensed into one block if SPARSE_QP_SOLUTION is BLOCK_CONDENSING_N2 (possible values: any positive integer). */
+const double 	defaultBarrierTuning = 0.2;											/**< Default value for the factor by which the interior-point NLP solver reduces its barrier parameter per iteration (possible values: any real number in (0,1)). */
 const int 		defaultGlobalizationStrategy = GS_LINESEARCH;						/**< Default value for specifying which globablization strategy is used within the NLP solver (possible values: GS_FULLSTEP, GS_LINESEARCH). */
 const double 	defaultLinesearchTolerance = 1.0e-5;								/**< Default value for the tolerance of the line-search globalization (possible values: any positive real number). */
 const double 	defaultMinLinesearchParameter = 0.5;								/**< Default value for the minimum stepsize of the line-search globalization (possible values: any positive real number). */
+const int 		defaultNumLinesearchCandidates = 1;									/**< Default value for the number of step lengths evaluated concurrently by the line-search globalization, 1 for sequential backtracking (possible values: any positive integer). */
+const int 		defaultQPsolver = QP_QPOASES;										/**< Default value for specifying the QP solver used by the online optimization algorithms (possible values: QP_QPOASES, QP_QPOASES_SPARSE). */
 const int 		defaultMaxNumQPiterations = 10000;									/**< Default value for maximum number of iterations of the (underlying) QP solver (possible values: any positive integer). */
 const int 		defaultHotstartQP = BT_FALSE;										/**< Default value for specifying whether the underlying QP shall be hotstarted or not (possible values: BT_TRUE, BT_FALSE). */
 const double 	defaultInfeasibleQPrelaxation = 1.0e-8;								/**< Default value for the amount constraints are relaxed in case of an infeasible sub-QP (possible values: ). */
@@ -72,6 +76,10 @@ const int 		defaultprintSCPmethodProfile = BT_FALSE;							/**< Default value fo
 const int 		defaultFreezeIntegrator = BT_TRUE;							/**< Default value for specifying whether integrator should freeze all intermediate results (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_BDF). */
 const int 		defaultFeasibilityCheck = BT_FALSE;							/**< Default value for specifying whether infeasibilty shall be checked (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultNumThreads = 1;										/**< Default value for the number of threads used to integrate the shooting intervals (possible values: any positive integer). */
+const int 		defaultCollocationScheme = CS_RADAU_IIA;					/**< Default value for the collocation scheme (possible values: CS_RADAU_IIA, CS_GAUSS_LEGENDRE). */
+const int 		defaultNumCollocationNodes = 3;								/**< Default value for the number of collocation nodes per step (possible values: any positive integer). */
+const int 		defaultNumCollocationSteps = 1;								/**< Default value for the number of collocation steps per discretization interval, set by NUM_INTEGRATOR_STEPS (possible values: any positive integer). */
 const int 		defaultPlotResoltion = LOW;									/**< Default value for specifying the plot resolution (possible values: HIGH, MEDIUM, LOW). */
 
 // Integrator
@@ -88,11 +96,13 @@ const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default valu
 const int 		defaultAlgebraicRelaxation = ART_ADAPTIVE_POLYNOMIAL;		/**< Default value for specifying how algebraic equations are relaxed within the integrator (possible values: ART_EXPONENTIAL, ART_ADAPTIVE_POLYNOMIAL). */
 const double	defaultRelaxationParameter = 0.5;							/**< Default value for the amount algebraic equations are relaxed within the integrator (possible values: any positive real number). */
 const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value for specifying whether a runtime profile of the integrator shall be printed (possible values: BT_TRUE, BT_FALSE). */
+const int       defaultJacobianColoring = BT_TRUE;							/**< Default value for specifying whether the integrator evaluates Jacobians of the rhs in compressed form based on a coloring of their sparsity pattern (possible values: BT_TRUE, BT_FALSE). */
 
 // MultiObjectiveAlgorithm
 const int 		defaultParetoFrontDiscretization = 21;						/**< Default value for the number of points of the pareto front (possible values: any postive integer). */
 const int 		defaultParetoFrontGeneration = PFG_WEIGHTED_SUM;			/**< Default value for specifying the scalarization method (possible values: PFG_FIRST_OBJECTIVE, PFG_SECOND_OBJECTIVE, PFG_WEIGHTED_SUM, PFG_NORMALIZED_NORMAL_CONSTRAINT, PFG_NORMAL_BOUNDARY_INTERSECTION, PFG_ENHANCED_NORMALIZED_NORMAL_CONSTRAINT, PFG_EPSILON_CONSTRAINT). */
 const int 		defaultParetoFrontHotstart = BT_TRUE;						/**< Default value for specifying whether hotstarts are to be used within the multi-objective optimization (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultParetoFrontNumThreads = 1;							/**< Default value for the number of threads used to solve the points of the pareto front (possible values: any positive integer). */
 
 // SimulationEnvironment
 const int 		defaultSimulateComputationalDelay = BT_FALSE;				/**< Default value for specifying whether computational delays shall be simulated or not (possible values: BT_TRUE, BT_FALSE). */
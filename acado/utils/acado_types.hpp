@@ -206,6 +206,15 @@ enum StateDiscretizationType{
 };
 
 
+/** Summarises all collocation schemes of the CollocationMethod.
+ */
+enum CollocationScheme{
+
+    CS_RADAU_IIA,           /**< Radau IIA collocation (stiffly accurate, L-stable). */
+    CS_GAUSS_LEGENDRE       /**< Gauss-Legendre collocation (A-stable, maximum order). */
+};
+
+
 /** Summarises all possible ways of discretising the system's states. */
 enum ControlParameterizationType{
 
@@ -275,6 +284,15 @@ enum MeasurementGrid{
 };
 
 
+/** Summarises all available variants of the Kalman filter.
+ */
+enum KalmanFilterType{
+
+	KFT_EXTENDED,			/**< Extended Kalman filter, linearising the model by its sensitivities.	*/
+	KFT_UNSCENTED			/**< Unscented Kalman filter, propagating a set of sigma points.			*/
+};
+
+
 /** Unrolling option.
  */
 enum UnrollOption{
@@ -337,8 +355,11 @@ enum OptionsName
 	CG_EXPORT_FOLDER_NAME,						/**< Export folder name. */
 	CG_USE_ARRIVAL_COST,						/**< Enable interface for arival cost calculation. */
 	CG_USE_OPENMP,								/**< Use OpenMP for parallelization in multiple shooting. */
+	CG_USE_SOLVER_CONTEXT,						/**< Pass all solver data through an explicit context pointer instead of global variables, allowing several re-entrant solver instances. */
 	CG_USE_VARIABLE_WEIGHTING_MATRIX,			/**< Use variable weighting matrix S on first N shooting nodes. */
 	CG_USE_C99,									/**< Code generation is allowed (or not) to export C-code that conforms C99 standard. */
+	CG_MULTIPLICATION_KERNEL,					/**< Kernel used to export products of matrices that are not hard-coded (see enum ExportMultiplicationKernel). */
+	CG_REUSE_WORKSPACE_MEMORY,					/**< Share the memory of workspace temporaries with disjoint lifetimes (needs anonymous structures and unions, as in C11). */
 	CG_COMPUTE_COVARIANCE_MATRIX,				/**< Enable computation of the variance-covariance matrix for the last estimate. */
 	CG_HARDCODE_CONSTRAINT_VALUES,				/**< Enable/disable hard-coding of the constraint values. */
 	IMPLICIT_INTEGRATOR_MODE,					/**< This determines the mode of the implicit integrator (see enum ImplicitIntegratorMode). */
@@ -347,7 +368,7 @@ enum OptionsName
 	IMPLICIT_INTEGRATOR_NUM_ITS,				/**< This is the performed number of Newton iterations in the implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS_INIT,			/**< This is the performed number of Newton iterations in the implicit integrator for the initialization of the first step. */
 	UNROLL_LINEAR_SOLVER,						/**< This option of the boolean type determines the unrolling of the linear solver (no unrolling recommended for larger systems). */
-	CONDENSING_BLOCK_SIZE,						/**< Defines the block size used in a block based condensing approach for code generated RTI. */
+	CONDENSING_BLOCK_SIZE,						/**< Defines the block size used in a block based condensing approach for code generated RTI and the online CP solver. */
 	INTEGRATOR_DEBUG_MODE,
 	OPT_UNKNOWN,
 	MAX_NUM_INTEGRATOR_STEPS,
@@ -412,7 +433,7 @@ enum OptionsName
 	CONIC_SOLVER_MAXIMUM_NUMBER_OF_STEPS,
 	CONIC_SOLVER_TOLERANCE,
 	CONIC_SOLVER_LINE_SEARCH_TUNING,
-	CONIC_SOLVER_BARRIER_TUNING,
+	CONIC_SOLVER_BARRIER_TUNING,				/**< Factor by which the interior-point NLP solver (SPARSE_QP_SOLUTION = SPARSE_SOLVER) reduces its barrier parameter per iteration. */
 	CONIC_SOLVER_MEHROTRA_CORRECTION,
 	CONIC_SOLVER_PRINT_LEVEL,
 	PRINT_SCP_METHOD_PROFILE,
@@ -423,7 +444,13 @@ enum OptionsName
 	GENERATE_SIMULINK_INTERFACE,
 	GENERATE_MATLAB_INTERFACE,
 	OPERATING_SYSTEM,
-	USE_SINGLE_PRECISION
+	USE_SINGLE_PRECISION,
+	JACOBIAN_COLORING,							/**< Evaluate the Jacobians of the rhs within the integrators in compressed form based on a coloring of their symbolic sparsity pattern. */
+	NUM_THREADS,								/**< Number of threads used to integrate the shooting intervals concurrently. */
+	PARETO_FRONT_NUM_THREADS,					/**< Number of threads used to solve the scalarized problems of the Pareto front concurrently. */
+	COLLOCATION_SCHEME,							/**< Collocation scheme used by the collocation discretisation (see enum CollocationScheme). */
+	NUM_COLLOCATION_NODES,						/**< Number of collocation nodes per step of the collocation discretisation. */
+	NUM_LINESEARCH_CANDIDATES					/**< Number of step lengths the line search evaluates concurrently. */
 };
 
 
@@ -491,7 +518,8 @@ enum LogName
     LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS,
     LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,
 	// 50
-    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION
+    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,
+    LOG_NUMBER_OF_INTEGRATOR_JACOBIAN_SEEDS
 };
 
 
@@ -638,6 +666,8 @@ enum QPSolverName
 	QP_QPDUNES,
 	QP_HPMPC,
     QP_GENERIC,
+	QP_RICCATI,
+	QP_QPOASES_SPARSE,
 	QP_NONE
 };
 
@@ -819,6 +849,15 @@ enum CondensedHessianCholeskyDecomposition
 	INTERNAL_N2		/**< n-square version, performed within the exported code, and passed to a QP solver. */
 };
 
+/** Kernels for exporting products of matrices that are not hard-coded. */
+enum ExportMultiplicationKernel
+{
+	MULTIPLICATION_LOOPS,			/**< Plain triple loops; products with less than 4096 flops are fully unrolled (default). */
+	MULTIPLICATION_BLOCKED,			/**< Register-blocked 4x4 micro-kernels in portable C. */
+	MULTIPLICATION_BLOCKED_SSE2,	/**< Register-blocked 4x4 micro-kernels using SSE2 intrinsics (double precision only). */
+	MULTIPLICATION_BLOCKED_AVX		/**< Register-blocked 4x8 micro-kernels using AVX intrinsics (double precision only, requires e.g. -mavx). */
+};
+
 /**
  *	\brief Defines all symbols for global return values.
  *
@@ -139,6 +139,15 @@ inline BooleanType isInfty(const double x)
 	return BT_FALSE;
 }
 
+/** Returns whether x is exactly 0 (e.g. a structural zero of a sparsity pattern). */
+inline BooleanType acadoIsExactlyZero(const double x)
+{
+	if ( ( x >= 0.0 ) && ( x <= 0.0 ) )
+		return BT_TRUE;
+
+	return BT_FALSE;
+}
+
 /** Specific rounding implemenation for compiler who don't support the round
  *  command. Does a round to nearest.
  */
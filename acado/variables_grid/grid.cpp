@@ -47,6 +47,7 @@ BEGIN_NAMESPACE_ACADO
 Grid::Grid( )
 {
 	nPoints = 0;
+	nAllocatedPoints = 0;
 	times   = 0;
 }
 
@@ -55,6 +56,7 @@ Grid::Grid(	uint nPoints_,
 			double *times_
 			)
 {
+	nAllocatedPoints = 0;
 	times = 0;
 	init( nPoints_,times_ );
 }
@@ -63,6 +65,7 @@ Grid::Grid(	uint nPoints_,
 Grid::Grid(	const DVector& times_
 			)
 {
+	nAllocatedPoints = 0;
 	times = 0;
 	init( times_ );
 }
@@ -73,6 +76,7 @@ Grid::Grid(	double _firstTime,
 			uint _nPoints
 			)
 {
+	nAllocatedPoints = 0;
 	times = 0;
 	init( _firstTime,_lastTime,_nPoints );
 }
@@ -82,6 +86,7 @@ Grid::Grid(	double _firstTime,
 Grid::Grid( const Grid& rhs )
 {
 	nPoints = rhs.nPoints;
+	nAllocatedPoints = nPoints;
 
 	if ( rhs.times != 0 )
 	{
@@ -113,6 +118,8 @@ returnValue Grid::init( uint _nPoints,
 	if ( times != 0 )
 		free( times );
 
+	nAllocatedPoints = nPoints;
+
 	if ( nPoints > 0 )
 		times = (double*) calloc( nPoints,sizeof(double) );
 	else
@@ -141,6 +148,8 @@ returnValue Grid::init(	const DVector& times_
 	if ( times != 0 )
 		free( times );
 
+	nAllocatedPoints = nPoints;
+
 	if ( nPoints > 0 )
 		times = (double*) calloc( nPoints,sizeof(double) );
 	else
@@ -163,6 +172,8 @@ returnValue Grid::init(	double _firstTime,
 	if ( times != 0 )
 		free( times );
 
+	nAllocatedPoints = nPoints;
+
 	if ( nPoints > 0 )
 		times = (double*) calloc( nPoints,sizeof(double) );
 	else
@@ -191,6 +202,7 @@ Grid& Grid::operator=( const Grid& rhs )
 
 
 		nPoints = rhs.nPoints;
+		nAllocatedPoints = nPoints;
 
 		if ( rhs.times != 0 )
 		{
@@ -345,16 +357,21 @@ returnValue Grid::addTime(	double _time
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 	}
 
-	++nPoints;
+	// grow time array geometrically to keep appending amortised constant
+	if ( nPoints >= nAllocatedPoints )
+	{
+		nAllocatedPoints = ( nAllocatedPoints > 0 ) ? 2*nAllocatedPoints : 4;
+		times = (double*) realloc( times,nAllocatedPoints*sizeof(double) );
+	}
 
-	times = (double*) realloc( times,nPoints*sizeof(double) );
-	times[nPoints-1] = _time;
+	times[nPoints] = _time;
+	++nPoints;
 
 	return SUCCESSFUL_RETURN;
 }
 
 
-// uses a simple O(n^2) algorithm for sorting
+// merges both ordered grids in a single linear pass
 returnValue Grid::merge(	const Grid& arg,
 							MergeMethod _mergeMethod,
 							BooleanType keepOverlap
@@ -494,6 +511,7 @@ returnValue Grid::refineGrid(	uint factor
 
 	/* assign new time array and deallocate old one */
 	nPoints = getNumIntervals( )*factor + 1;
+	nAllocatedPoints = nPoints;
 
 	double* tmp = times;
 	times = newTimes;
@@ -543,16 +561,24 @@ int Grid::findFirstTime(	double _time,
 	if ( times == 0 )
 		return -1;
 
-	for( uint i=startIdx; i<getNumPoints( ); ++i )
+	/* binary search for first grid point not lying before given time
+	   (grid point times are ordered!) */
+	uint lowerIdx = startIdx;
+	uint upperIdx = getNumPoints( );
+
+	while ( lowerIdx < upperIdx )
 	{
-		if ( acadoIsEqual( times[i] ,_time ) == BT_TRUE )
-			return i;
+		uint idx = lowerIdx + ( upperIdx - lowerIdx ) / 2;
 
-		/* stop here as grid point times are ordered! */
-		if ( times[i] > _time )
-			return -1;
+		if ( ( times[idx] < _time ) && ( acadoIsEqual( times[idx] ,_time ) == BT_FALSE ) )
+			lowerIdx = idx+1;
+		else
+			upperIdx = idx;
 	}
 
+	if ( ( lowerIdx < getNumPoints( ) ) && ( acadoIsEqual( times[lowerIdx] ,_time ) == BT_TRUE ) )
+		return lowerIdx;
+
 	/* no grid point with given time found */
 	return -1;
 }
@@ -562,30 +588,26 @@ int Grid::findLastTime(	double _time,
 						uint startIdx
 						) const
 {
-	if ( times == 0 )
-		return -1;
+	int firstIdx = findFirstTime( _time,startIdx );
 
-	for( uint i=startIdx; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsEqual( times[i] ,_time ) == BT_TRUE )
-		{
-			uint j = i;
+	if ( firstIdx < 0 )
+		return -1;
 
-			while( ( j<getNumPoints( ) ) && ( acadoIsEqual( times[j] , _time ) == BT_TRUE ) )
-			{
-				++j;
-			}
+	/* binary search for first grid point lying after given time */
+	uint lowerIdx = firstIdx+1;
+	uint upperIdx = getNumPoints( );
 
-			return j-1;
-		}
+	while ( lowerIdx < upperIdx )
+	{
+		uint idx = lowerIdx + ( upperIdx - lowerIdx ) / 2;
 
-		/* stop here as grid point times are ordered! */
-		if ( times[i] > _time )
-			return -1;
+		if ( ( times[idx] > _time ) && ( acadoIsEqual( times[idx] ,_time ) == BT_FALSE ) )
+			upperIdx = idx;
+		else
+			lowerIdx = idx+1;
 	}
 
-	/* no grid point with given time found */
-	return -1;
+	return lowerIdx-1;
 }
 
 
@@ -593,62 +615,97 @@ int Grid::findLastTime(	double _time,
 uint Grid::getFloorIndex(	double time_
 							) const
 {
-	uint lowerIdx = 0;
-	uint upperIdx = getLastIndex( );
-	uint idx = 0;
+	return searchFloorIndex( time_,0,getLastIndex( ) );
+}
 
-	/* ensure that time lies within range */
-	if ( acadoIsGreater( getTime( lowerIdx ) , time_ ) == BT_TRUE )
-		return lowerIdx;
 
-	if ( acadoIsSmaller( getTime( upperIdx ) , time_ ) == BT_TRUE )
-		return upperIdx;
+uint Grid::getCeilIndex ( double time_ ) const
+{
+	return searchCeilIndex( time_,0,getLastIndex( ) );
+}
 
-	/* if so, perform binary search */
-	while ( lowerIdx < upperIdx )
+
+uint Grid::getFloorIndex(	double time_,
+							uint& hintIdx
+							) const
+{
+	uint lastIdx  = getLastIndex( );
+	uint lowerIdx = ( hintIdx < lastIdx ) ? hintIdx : lastIdx;
+	uint upperIdx = lowerIdx;
+	uint step = 1;
+
+	/* gallop from hint until the given time is bracketed */
+	if ( acadoIsSmaller( getTime( lowerIdx ) , time_ ) == BT_TRUE )
 	{
-		idx = (uint)floor( 0.5*( (double)(upperIdx + lowerIdx) ) );
+		while ( upperIdx < lastIdx )
+		{
+			upperIdx = ( lastIdx - lowerIdx > step ) ? lowerIdx+step : lastIdx;
 
-		if ( isInUpperHalfOpenInterval( idx,time_ ) == BT_TRUE )
-			break;
+			if ( acadoIsSmaller( getTime( upperIdx ) , time_ ) == BT_FALSE )
+				break;
 
-		if ( acadoIsStrictlyGreater( getTime( idx ) , time_ ) == BT_TRUE )
-			upperIdx = idx;
-		else
-			lowerIdx = idx;
+			lowerIdx = upperIdx;
+			step *= 2;
+		}
 	}
+	else
+	{
+		while ( lowerIdx > 0 )
+		{
+			lowerIdx = ( upperIdx > step ) ? upperIdx-step : 0;
 
-    return idx;
+			if ( acadoIsSmaller( getTime( lowerIdx ) , time_ ) == BT_TRUE )
+				break;
+
+			upperIdx = lowerIdx;
+			step *= 2;
+		}
+	}
+
+	hintIdx = searchFloorIndex( time_,lowerIdx,upperIdx );
+	return hintIdx;
 }
 
 
-uint Grid::getCeilIndex ( double time_ ) const
+uint Grid::getCeilIndex (	double time_,
+							uint& hintIdx
+							) const
 {
-	uint lowerIdx = 0;
-	uint upperIdx = getLastIndex( );
-	uint idx = 0;
+	uint lastIdx  = getLastIndex( );
+	uint lowerIdx = ( hintIdx < lastIdx ) ? hintIdx : lastIdx;
+	uint upperIdx = lowerIdx;
+	uint step = 1;
 
-	/* ensure that time lies within range */
-	if ( acadoIsGreater( getTime( lowerIdx ) , time_ ) == BT_TRUE )
-		return lowerIdx;
+	/* gallop from hint until the given time is bracketed */
+	if ( acadoIsStrictlySmaller( getTime( lowerIdx ) , time_ ) == BT_TRUE )
+	{
+		while ( upperIdx < lastIdx )
+		{
+			upperIdx = ( lastIdx - lowerIdx > step ) ? lowerIdx+step : lastIdx;
 
-	if ( acadoIsSmaller( getTime( upperIdx ) , time_ ) == BT_TRUE )
-		return upperIdx;
+			if ( acadoIsStrictlySmaller( getTime( upperIdx ) , time_ ) == BT_FALSE )
+				break;
 
-	/* if so, perform binary search */
-	while ( lowerIdx < upperIdx )
+			lowerIdx = upperIdx;
+			step *= 2;
+		}
+	}
+	else
 	{
-		idx = (uint)ceil(0.5*( (double)( upperIdx + lowerIdx) ) );
+		while ( lowerIdx > 0 )
+		{
+			lowerIdx = ( upperIdx > step ) ? upperIdx-step : 0;
 
-		if ( isInLowerHalfOpenInterval( idx,time_ ) == BT_TRUE )
-			break;
+			if ( acadoIsStrictlySmaller( getTime( lowerIdx ) , time_ ) == BT_TRUE )
+				break;
 
-		if ( acadoIsGreater( getTime( idx ) ,  time_ ) == BT_TRUE )
-			upperIdx = idx;
-		else
-			lowerIdx = idx;
-    }
-    return idx;
+			upperIdx = lowerIdx;
+			step *= 2;
+		}
+	}
+
+	hintIdx = searchCeilIndex( time_,lowerIdx,upperIdx );
+	return hintIdx;
 }
 
 
@@ -662,35 +719,32 @@ returnValue Grid::getSubGrid(	double tStart,
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
 
+	// determine range of grid points within [tStart,tEnd]
+	uint firstIdx = findLowerBound( tStart );
+	uint endIdx   = findUpperBound( tEnd,firstIdx );
+
+	BooleanType hasStartTime = hasTime( tStart );
+	BooleanType hasEndTime   = hasTime( tEnd );
+
 	// determine number of subpoints
-	uint nSubPoints = 0;
+	uint nSubPoints = endIdx - firstIdx;
 
-	if ( hasTime( tStart ) == BT_FALSE )
+	if ( hasStartTime == BT_FALSE )
 		++nSubPoints;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsGreater( getTime( i ) , tStart ) == BT_TRUE  &&
-			 acadoIsSmaller( getTime( i ) , tEnd   ) == BT_TRUE     ) ++nSubPoints;
-	}
-
-	if ( hasTime( tEnd ) == BT_FALSE )
+	if ( hasEndTime == BT_FALSE )
 		++nSubPoints;
 
 	// setup subgrid with subpoints
 	_subGrid.init( nSubPoints );
 
-	if ( hasTime( tStart ) == BT_FALSE )
+	if ( hasStartTime == BT_FALSE )
 		_subGrid.setTime( tStart );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsGreater( getTime( i ) , tStart ) == BT_TRUE &&
-			 acadoIsSmaller( getTime( i ) , tEnd   ) == BT_TRUE     )
-			_subGrid.setTime( getTime( i ) );
-	}
+	for( uint i=firstIdx; i<endIdx; ++i )
+		_subGrid.setTime( getTime( i ) );
 
-	if ( hasTime( tEnd ) == BT_FALSE )
+	if ( hasEndTime == BT_FALSE )
 		_subGrid.setTime( tEnd );
 
 	return SUCCESSFUL_RETURN;
@@ -753,6 +807,112 @@ int Grid::findNextIndex( ) const
 
 
 
+uint Grid::findLowerBound(	double _time,
+							uint startIdx
+							) const
+{
+	uint lowerIdx = startIdx;
+	uint upperIdx = getNumPoints( );
+
+	while ( lowerIdx < upperIdx )
+	{
+		uint idx = lowerIdx + ( upperIdx - lowerIdx ) / 2;
+
+		if ( acadoIsGreater( times[idx] , _time ) == BT_TRUE )
+			upperIdx = idx;
+		else
+			lowerIdx = idx+1;
+	}
+
+	return lowerIdx;
+}
+
+
+uint Grid::findUpperBound(	double _time,
+							uint startIdx
+							) const
+{
+	uint lowerIdx = startIdx;
+	uint upperIdx = getNumPoints( );
+
+	while ( lowerIdx < upperIdx )
+	{
+		uint idx = lowerIdx + ( upperIdx - lowerIdx ) / 2;
+
+		if ( acadoIsStrictlyGreater( times[idx] , _time ) == BT_TRUE )
+			upperIdx = idx;
+		else
+			lowerIdx = idx+1;
+	}
+
+	return lowerIdx;
+}
+
+
+uint Grid::searchFloorIndex(	double time_,
+								uint lowerIdx,
+								uint upperIdx
+								) const
+{
+	uint idx = lowerIdx;
+
+	/* ensure that time lies within range */
+	if ( acadoIsGreater( getTime( lowerIdx ) , time_ ) == BT_TRUE )
+		return lowerIdx;
+
+	if ( acadoIsSmaller( getTime( upperIdx ) , time_ ) == BT_TRUE )
+		return upperIdx;
+
+	/* if so, perform binary search */
+	while ( lowerIdx < upperIdx )
+	{
+		idx = (uint)floor( 0.5*( (double)(upperIdx + lowerIdx) ) );
+
+		if ( isInUpperHalfOpenInterval( idx,time_ ) == BT_TRUE )
+			break;
+
+		if ( acadoIsStrictlyGreater( getTime( idx ) , time_ ) == BT_TRUE )
+			upperIdx = idx;
+		else
+			lowerIdx = idx;
+	}
+
+    return idx;
+}
+
+
+uint Grid::searchCeilIndex(	double time_,
+							uint lowerIdx,
+							uint upperIdx
+							) const
+{
+	uint idx = lowerIdx;
+
+	/* ensure that time lies within range */
+	if ( acadoIsGreater( getTime( lowerIdx ) , time_ ) == BT_TRUE )
+		return lowerIdx;
+
+	if ( acadoIsSmaller( getTime( upperIdx ) , time_ ) == BT_TRUE )
+		return upperIdx;
+
+	/* if so, perform binary search */
+	while ( lowerIdx < upperIdx )
+	{
+		idx = (uint)ceil(0.5*( (double)( upperIdx + lowerIdx) ) );
+
+		if ( isInLowerHalfOpenInterval( idx,time_ ) == BT_TRUE )
+			break;
+
+		if ( acadoIsGreater( getTime( idx ) ,  time_ ) == BT_TRUE )
+			upperIdx = idx;
+		else
+			lowerIdx = idx;
+    }
+    return idx;
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 
@@ -489,6 +489,32 @@ class Grid
 		uint getCeilIndex (	double time
 							) const;
 
+		/** Returns index of grid point with greatest time smaller or equal to given time,
+		 *	starting the search at the given hint index. The search moves outwards from the 
+		 *	hint, so that a sequence of monotone queries passing the previous result as hint
+		 *	costs amortised constant time per query.
+		 *
+		 *	@param[in]     _time	Time greater or equal than that of the time point to be found.
+		 *	@param[in,out] hintIdx	Index to start searching from; on return, the found index.
+		 *
+		 *  \return Index of grid point with greatest time smaller or equal to given time
+		 */
+		uint getFloorIndex(	double time,
+							uint& hintIdx
+							) const;
+
+		/** Returns index of grid point with smallest time greater or equal to given time,
+		 *	starting the search at the given hint index (see getFloorIndex() for details).
+		 *
+		 *	@param[in]     _time	Time smaller or equal than that of the time point to be found.
+		 *	@param[in,out] hintIdx	Index to start searching from; on return, the found index.
+		 *
+		 *  \return Index of grid point with smallest time greater or equal to given time
+		 */
+		uint getCeilIndex (	double time,
+							uint& hintIdx
+							) const;
+
 
 		/** Returns largest index of grid (note the difference to getNumPoints()).
 		 *
@@ -604,6 +630,44 @@ class Grid
 		 */
 		int findNextIndex( ) const;
 
+		/** Returns index of first grid point at or after startIdx whose time is greater 
+		 *	or equal to given time (up to tolerance), or the number of grid points if no 
+		 *	such point exists. Uses a binary search.
+		 *
+		 *	@param[in] _time		Time to be compared with.
+		 *	@param[in] startIdx		Start index for searching.
+		 */
+		uint findLowerBound(	double _time,
+								uint startIdx = 0
+								) const;
+
+		/** Returns index of first grid point at or after startIdx whose time is strictly
+		 *	greater than given time (up to tolerance), or the number of grid points if no 
+		 *	such point exists. Uses a binary search.
+		 *
+		 *	@param[in] _time		Time to be compared with.
+		 *	@param[in] startIdx		Start index for searching.
+		 */
+		uint findUpperBound(	double _time,
+								uint startIdx = 0
+								) const;
+
+		/** Binary search for the floor index of given time within the index range 
+		 *	[lowerIdx,upperIdx], which has to bracket the given time.
+		 */
+		uint searchFloorIndex(	double _time,
+								uint lowerIdx,
+								uint upperIdx
+								) const;
+
+		/** Binary search for the ceil index of given time within the index range 
+		 *	[lowerIdx,upperIdx], which has to bracket the given time.
+		 */
+		uint searchCeilIndex(	double _time,
+								uint lowerIdx,
+								uint upperIdx
+								) const;
+
 
     //
     // DATA MEMBERS:
@@ -611,6 +675,7 @@ class Grid
     protected:
 
 		uint nPoints;					/**< Number of grid points. */
+		uint nAllocatedPoints;			/**< Number of time values the allocated time array can hold. */
 		double* times;					/**< Time values at grid points. */
 };
 
@@ -47,7 +47,6 @@ BEGIN_NAMESPACE_ACADO
 
 MatrixVariablesGrid::MatrixVariablesGrid( ) : Grid( )
 {
-	values = 0;
 }
 
 
@@ -63,7 +62,6 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
 	init( _nRows,_nCols,_grid,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -80,7 +78,6 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
 	init( _nRows,_nCols,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -99,7 +96,6 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											const BooleanType* const  _autoInit
 											) : Grid( )
 {
-	values = 0;
 	init( _nRows,_nCols,_firstTime,_lastTime,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -109,20 +105,13 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const DMatrix& arg,
 											VariableType _type
 											) : Grid( )
 {
-	values = 0;
 	init( arg,_grid,_type );
 }
 
 MatrixVariablesGrid::MatrixVariablesGrid(	const MatrixVariablesGrid& rhs
-											) : Grid( rhs )
+											) : Grid( rhs ), values( rhs.values ), valueOffsets( rhs.valueOffsets ),
+												valueRows( rhs.valueRows ), valueCols( rhs.valueCols ), settings( rhs.settings )
 {
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
-	for( uint i=0; i<nPoints; ++i )
-		values[i] = new MatrixVariable( *(rhs.values[i]) );
 }
 
 
@@ -138,17 +127,13 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator=(	const MatrixVariablesGrid&
 {
     if ( this != &rhs )
     {
-		clearValues( );
-
 		Grid::operator=( rhs );
 
-		if ( nPoints > 0 )
-			values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-		else
-			values = 0;
-	
-		for( uint i=0; i<nPoints; ++i )
-			values[i] = new MatrixVariable( *(rhs.values[i]) );
+		values       = rhs.values;
+		valueOffsets = rhs.valueOffsets;
+		valueRows    = rhs.valueRows;
+		valueCols    = rhs.valueCols;
+		settings     = rhs.settings;
     }
 
     return *this;
@@ -196,11 +181,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -220,11 +200,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _nPoints );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -246,11 +221,6 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _firstTime,_lastTime,_nPoints );
 	
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
-
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -263,13 +233,19 @@ returnValue MatrixVariablesGrid::init(	const DMatrix& arg,
 	clearValues( );
 	Grid::operator=( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	uint dim = arg.getDim( );
+
+	values.resize( nPoints*dim );
+	valueOffsets.resize( nPoints );
+	valueRows.assign( nPoints,arg.getNumRows( ) );
+	valueCols.assign( nPoints,arg.getNumCols( ) );
+	settings.assign( nPoints,VariableSettings( dim ) );
 
 	for( uint i=0; i<nPoints; ++i )
-		values[i] = new MatrixVariable( arg );
+	{
+		valueOffsets[i] = i*dim;
+		std::copy( arg.data( ),arg.data( )+dim,getPointValues( i ) );
+	}
 
     return SUCCESSFUL_RETURN;
 }
@@ -289,14 +265,10 @@ returnValue MatrixVariablesGrid::setMatrix(	uint pointIdx,
 											const DMatrix& _value
 											) const
 {
-	ASSERT( values != 0 );
-
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	*(values[pointIdx]) = _value;
-
-	return SUCCESSFUL_RETURN;
+	return const_cast<MatrixVariablesGrid*>( this )->replacePoint( pointIdx,_value,VariableSettings( _value.getDim( ) ) );
 }
 
 
@@ -313,12 +285,74 @@ returnValue MatrixVariablesGrid::setAllMatrices(	const DMatrix& _values
 DMatrix MatrixVariablesGrid::getMatrix(	uint pointIdx
 										) const
 {
-	ASSERT( values != 0 );
-
 	if ( pointIdx >= getNumPoints( ) )
 		return emptyMatrix;
 
-	return values[pointIdx]->getMatrix( );
+	return DMatrix( valueRows[pointIdx],valueCols[pointIdx],getPointValues( pointIdx ) );
+}
+
+
+MatrixVariablesGrid::MatrixMap MatrixVariablesGrid::getMatrixMap(	uint pointIdx
+																	)
+{
+	if ( pointIdx >= getNumPoints( ) )
+	{
+		ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+		return MatrixMap( 0,0,0 );
+	}
+
+	return MatrixMap( getPointValues( pointIdx ),valueRows[pointIdx],valueCols[pointIdx] );
+}
+
+
+MatrixVariablesGrid::ConstMatrixMap MatrixVariablesGrid::getMatrixMap(	uint pointIdx
+																		) const
+{
+	if ( pointIdx >= getNumPoints( ) )
+	{
+		ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+		return ConstMatrixMap( 0,0,0 );
+	}
+
+	return ConstMatrixMap( getPointValues( pointIdx ),valueRows[pointIdx],valueCols[pointIdx] );
+}
+
+
+MatrixVariablesGrid::ComponentMap MatrixVariablesGrid::getComponentMap(	uint valueIdx
+																		)
+{
+	if ( ( getNumPoints( ) == 0 ) || ( hasFixedDimensions( ) == BT_FALSE ) || ( valueIdx >= getNumValues( 0 ) ) )
+	{
+		ACADOERROR( RET_INVALID_ARGUMENTS );
+		return ComponentMap( 0,0,Eigen::InnerStride<>( 1 ) );
+	}
+
+	return ComponentMap( values.data( )+valueIdx,getNumPoints( ),Eigen::InnerStride<>( getNumValues( 0 ) ) );
+}
+
+
+MatrixVariablesGrid::ConstComponentMap MatrixVariablesGrid::getComponentMap(	uint valueIdx
+																				) const
+{
+	if ( ( getNumPoints( ) == 0 ) || ( hasFixedDimensions( ) == BT_FALSE ) || ( valueIdx >= getNumValues( 0 ) ) )
+	{
+		ACADOERROR( RET_INVALID_ARGUMENTS );
+		return ConstComponentMap( 0,0,Eigen::InnerStride<>( 1 ) );
+	}
+
+	return ConstComponentMap( values.data( )+valueIdx,getNumPoints( ),Eigen::InnerStride<>( getNumValues( 0 ) ) );
+}
+
+
+BooleanType MatrixVariablesGrid::hasFixedDimensions( ) const
+{
+	for( uint i=1; i<getNumPoints( ); ++i )
+	{
+		if ( ( valueRows[i] != valueRows[0] ) || ( valueCols[i] != valueCols[0] ) )
+			return BT_FALSE;
+	}
+
+	return BT_TRUE;
 }
 
 
@@ -355,7 +389,7 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 	{
 		// simply append
 		for( uint i=0; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 	else
 	{
@@ -370,13 +404,13 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 				break;
 
 			case MM_DUPLICATE:
-				addMatrix( *(arg.values[0]),arg.getTime( 0 ) );
+				addPoint( arg,0,arg.getTime( 0 ) );
 				break;
 		}
 
 		// simply append all remaining points
 		for( uint i=1; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -388,14 +422,31 @@ returnValue MatrixVariablesGrid::appendValues( const MatrixVariablesGrid& arg )
 	if ( getNumPoints( ) != arg.getNumPoints( ) )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
-	DVector tmp1,tmp2;
+	for( uint i=0; i<getNumPoints(); ++i )
+	{
+		if ( getNumCols( i ) != arg.getNumCols( i ) )
+			return ACADOERROR( RET_INVALID_ARGUMENTS );
+	}
+
+	// rebuild value buffer with rows of both grids at each grid point
+	std::vector< double > newValues;
+	newValues.reserve( values.size( ) + arg.values.size( ) );
 
 	for( uint i=0; i<getNumPoints(); ++i )
 	{
-		values[i]->appendRows( *(arg.values[i]) );
-		values[i]->appendSettings( *(arg.values[i]) );
+		const double* const currentValues = getPointValues( i );
+		const double* const argValues = arg.getPointValues( i );
+
+		valueOffsets[i] = newValues.size( );
+		newValues.insert( newValues.end( ),currentValues,currentValues+getNumValues( i ) );
+		newValues.insert( newValues.end( ),argValues,argValues+arg.getNumValues( i ) );
+
+		valueRows[i] += arg.getNumRows( i );
+		settings[i].appendSettings( arg.settings[i] );
 	}
 
+	values.swap( newValues );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -442,7 +493,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_REPLACE ) ) )
 			{
-				mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+				mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 			}
 
 			++j;
@@ -454,16 +505,16 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			switch ( _mergeMethod )
 			{
 				case MM_KEEP:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
 					break;
 	
 				case MM_REPLACE:
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 	
 				case MM_DUPLICATE:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 			}
 			++j;
@@ -474,7 +525,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_KEEP ) ) )
 			{
-				mergedGrid.addMatrix( *(values[i]),getTime( i ) );//arg.
+				mergedGrid.addPoint( *this,i,getTime( i ) );//arg.
 			}
 		}
 	}
@@ -483,7 +534,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 	while ( j < arg.getNumPoints( ) )
 	{
 		if ( acadoIsStrictlyGreater( arg.getTime(j),getLastTime() ) == BT_TRUE )
-			mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+			mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 
 		++j;
 	}
@@ -509,7 +560,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getTimeSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -528,7 +579,7 @@ MatrixVariablesGrid MatrixVariablesGrid::getValuesSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		newVariablesGrid.addMatrix( values[i]->getRows( startIdx,endIdx ),getTime( i ) );
+		newVariablesGrid.addMatrix( getMatrixVariable( i ).getRows( startIdx,endIdx ),getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -592,13 +643,14 @@ MatrixVariablesGrid MatrixVariablesGrid::getRefinedGrid(	const Grid& arg,
 
 	for( uint i=0; i<arg.getNumPoints( ); ++i )
 	{
-		if ( hasTime( arg.getTime( i ) ) == BT_TRUE )
+		// times of both grids are ordered, so search can start at last match
+		if ( findFirstTime( arg.getTime( i ),( count > 0 ) ? count : 0 ) >= 0 )
 			count = acadoMin( count+1,(int)getNumPoints()-1 );
 
 		if ( count < 0 )
-			tmp.addMatrix( *(values[0]),arg.getTime( i ) );
+			tmp.addPoint( *this,0,arg.getTime( i ) );
 		else
-			tmp.addMatrix( *(values[count]),arg.getTime( i ) );
+			tmp.addPoint( *this,count,arg.getTime( i ) );
 	}
 
 	return tmp;
@@ -621,12 +673,15 @@ MatrixVariablesGrid MatrixVariablesGrid::getCoarsenedGrid(	const Grid& arg
 	if ( Grid::operator>=( arg ) == BT_FALSE )
 		return tmp;
 
+	int idx = 0;
+
 	for( uint i=0; i<arg.getNumPoints( ); ++i )
 	{
-		int idx = findLastTime( arg.getTime( i ) );
+		// times of both grids are ordered, so search can start at last match
+		idx = findLastTime( arg.getTime( i ),idx );
 
 		if ( idx >= 0 )
-			tmp.addMatrix( *(values[idx]),arg.getTime( i ) );
+			tmp.addPoint( *this,idx,arg.getTime( i ) );
 		else
 		{
 			tmp.init( );
@@ -651,15 +706,27 @@ MatrixVariablesGrid& MatrixVariablesGrid::shiftBackwards( DMatrix lastValue )
 {
 	if ( getNumPoints() < 2 ){
         if( lastValue.isEmpty() == BT_FALSE )
-             *(values[getNumIntervals()]) = lastValue;	
+             replacePoint( getNumIntervals(),lastValue,VariableSettings( lastValue.getDim() ) );
 		return *this;	
     }
 
-	for( uint i=1; i<getNumPoints( ); ++i )
-		*(values[i-1]) = *(values[i]);
-		
+	if ( hasFixedDimensions( ) == BT_TRUE )
+	{
+		// move all values by one grid point within the contiguous buffer
+		uint dim = getNumValues( 0 );
+		std::copy( values.begin( )+dim,values.end( ),values.begin( ) );
+
+		for( uint i=1; i<getNumPoints( ); ++i )
+			settings[i-1] = settings[i];
+	}
+	else
+	{
+		for( uint i=1; i<getNumPoints( ); ++i )
+			replacePoint( i-1,getMatrix( i ),settings[i] );
+	}
+
     if( lastValue.isEmpty() == BT_FALSE )
-        *(values[getNumIntervals()]) = lastValue;
+        replacePoint( getNumIntervals(),lastValue,VariableSettings( lastValue.getDim() ) );
 
 	return *this;
 }
@@ -671,12 +738,11 @@ DVector MatrixVariablesGrid::linearInterpolation( double time ) const
     uint idx1 = getFloorIndex( time );
     uint idx2 = getCeilIndex ( time );
 
-	ASSERT( values != 0 );
 	ASSERT( idx1 < getNumPoints( ) );
 	ASSERT( idx2 < getNumPoints( ) );
 
-    DVector tmp1( values[idx1]->getCol( 0 ) );
-    DVector tmp2( values[idx2]->getCol( 0 ) );
+    DVector tmp1( getMatrixMap( idx1 ).col( 0 ) );
+    DVector tmp2( getMatrixMap( idx2 ).col( 0 ) );
 
     double t1 = getTime( idx1 );
     double t2 = getTime( idx2 );
@@ -722,7 +788,7 @@ returnValue MatrixVariablesGrid::print(	std::ostream& stream,
 		if (colSeparator != NULL && strlen(colSeparator) > 0)
 			stream << colSeparator;
 
-		values[k]->print(stream, "", "", "", width, precision, colSeparator, colSeparator);
+		getMatrix( k ).print(stream, "", "", "", width, precision, colSeparator, colSeparator);
 
 		if (k < (getNumPoints() - 1) && rowSeparator != NULL && strlen(rowSeparator) > 0)
 			stream << rowSeparator;
@@ -893,17 +959,11 @@ std::istream& operator>>(std::istream& stream, MatrixVariablesGrid& arg)
 
 returnValue MatrixVariablesGrid::clearValues( )
 {
-	if ( values != 0 )
-	{
-		for( uint i=0; i<nPoints; ++i )
-		{
-			if ( values[i] != 0 )
-				delete values[i];
-		}
-
-		free( values );
-		values = 0;
-	}
+	values.clear( );
+	valueOffsets.clear( );
+	valueRows.clear( );
+	valueCols.clear( );
+	settings.clear( );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -922,8 +982,18 @@ returnValue MatrixVariablesGrid::initMatrixVariables(	uint _nRows,
 {
 	DVector currentScaling,currentLb,currentUb;
 
+	uint dim = _nRows*_nCols;
+
+	values.assign( nPoints*dim,0.0 );
+	valueOffsets.resize( nPoints );
+	valueRows.assign( nPoints,_nRows );
+	valueCols.assign( nPoints,_nCols );
+	settings.resize( nPoints );
+
 	for( uint i=0; i<nPoints; ++i )
 	{
+		valueOffsets[i] = i*dim;
+
 		if ( _scaling != 0 )
 			currentScaling = _scaling[i];
 		else
@@ -939,7 +1009,7 @@ returnValue MatrixVariablesGrid::initMatrixVariables(	uint _nRows,
 		else
 			currentUb.init( );
 
-		values[i] = new MatrixVariable( _nRows,_nCols,_type,_names,_units,currentScaling,currentLb,currentUb );
+		settings[i].init( dim,_type,_names,_units,currentScaling,currentLb,currentUb );
 	}
 	
 	return SUCCESSFUL_RETURN;
@@ -949,6 +1019,17 @@ returnValue MatrixVariablesGrid::initMatrixVariables(	uint _nRows,
 returnValue MatrixVariablesGrid::addMatrix(	const MatrixVariable& newMatrix,
 											double newTime
 											)
+{
+	return addPoint( newMatrix.data( ),newMatrix.getNumRows( ),newMatrix.getNumCols( ),newMatrix,newTime );
+}
+
+
+returnValue MatrixVariablesGrid::addPoint(	const double* const _values,
+											uint _nRows,
+											uint _nCols,
+											const VariableSettings& _settings,
+											double newTime
+											)
 {
 	if ( ( isInfty( newTime ) == BT_TRUE ) && ( getNumPoints( ) > 0 ) )
 		newTime = getLastTime( ) + 1.0;
@@ -956,8 +1037,70 @@ returnValue MatrixVariablesGrid::addMatrix(	const MatrixVariable& newMatrix,
 	if ( Grid::addTime( newTime ) != SUCCESSFUL_RETURN )
 		return RET_INVALID_ARGUMENTS;
 
-	values = (MatrixVariable**) realloc( values,nPoints*sizeof(MatrixVariable*) );
-	values[nPoints-1] = new MatrixVariable( newMatrix );
+	// std::vector grows geometrically, so appending is amortised constant
+	valueOffsets.push_back( values.size( ) );
+	valueRows.push_back( _nRows );
+	valueCols.push_back( _nCols );
+	settings.push_back( _settings );
+	values.insert( values.end( ),_values,_values+_nRows*_nCols );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixVariablesGrid::addPoint(	const MatrixVariablesGrid& arg,
+											uint pointIdx,
+											double newTime
+											)
+{
+	ASSERT( pointIdx < arg.getNumPoints( ) );
+
+	return addPoint(	arg.getPointValues( pointIdx ),arg.valueRows[pointIdx],arg.valueCols[pointIdx],
+						arg.settings[pointIdx],newTime );
+}
+
+
+MatrixVariable MatrixVariablesGrid::getMatrixVariable(	uint pointIdx
+														) const
+{
+	MatrixVariable tmp( getMatrix( pointIdx ) );
+
+	if ( pointIdx < getNumPoints( ) )
+		tmp.VariableSettings::operator=( settings[pointIdx] );
+
+	return tmp;
+}
+
+
+returnValue MatrixVariablesGrid::replacePoint(	uint pointIdx,
+												const DMatrix& _value,
+												const VariableSettings& _settings
+												)
+{
+	ASSERT( pointIdx < getNumPoints( ) );
+
+	uint oldDim = getNumValues( pointIdx );
+	uint newDim = _value.getDim( );
+
+	if ( newDim != oldDim )
+	{
+		// move all subsequent values accordingly
+		std::vector< double >::iterator it = values.begin( ) + valueOffsets[pointIdx];
+
+		if ( newDim > oldDim )
+			values.insert( it+oldDim,newDim-oldDim,0.0 );
+		else
+			values.erase( it+newDim,it+oldDim );
+
+		for( uint i=pointIdx+1; i<getNumPoints( ); ++i )
+			valueOffsets[i] = valueOffsets[i] + newDim - oldDim;
+	}
+
+	valueRows[pointIdx] = _value.getNumRows( );
+	valueCols[pointIdx] = _value.getNumCols( );
+	std::copy( _value.data( ),_value.data( )+newDim,getPointValues( pointIdx ) );
+
+	settings[pointIdx] = _settings;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1011,19 +1154,19 @@ returnValue MatrixVariablesGrid::sprint(	std::ostream& stream
 
 double& MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint colIdx )
 {
-	ASSERT( values != 0 );
 	ASSERT( pointIdx < getNumPoints( ) );
+	ASSERT( ( rowIdx < valueRows[pointIdx] ) && ( colIdx < valueCols[pointIdx] ) );
 
-    return values[pointIdx]->operator()( rowIdx,colIdx );
+    return values[ valueOffsets[pointIdx] + rowIdx*valueCols[pointIdx] + colIdx ];
 }
 
 
 double MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint colIdx ) const
 {
-	ASSERT( values != 0 );
 	ASSERT( pointIdx < getNumPoints( ) );
+	ASSERT( ( rowIdx < valueRows[pointIdx] ) && ( colIdx < valueCols[pointIdx] ) );
 
-    return values[pointIdx]->operator()( rowIdx,colIdx );
+    return values[ valueOffsets[pointIdx] + rowIdx*valueCols[pointIdx] + colIdx ];
 }
 
 
@@ -1031,7 +1174,6 @@ double MatrixVariablesGrid::operator()( uint pointIdx, uint rowIdx, uint colIdx
 MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 															) const
 {
-    ASSERT( values != 0 );
 	if ( rowIdx >= getNumRows( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -1044,7 +1186,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 	MatrixVariablesGrid rowGrid( 1,1,tmpGrid,getType( ) );
 
     for( uint run1 = 0; run1 < getNumPoints(); run1++ )
-         rowGrid( run1,0,0 ) = values[run1]->operator()( rowIdx,0 );
+         rowGrid( run1,0,0 ) = operator()( run1,rowIdx,0 );
 
     return rowGrid;
 }
@@ -1053,7 +1195,6 @@ MatrixVariablesGrid MatrixVariablesGrid::operator()(	const uint rowIdx
 MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 															) const
 {
-    ASSERT( values != 0 );
 	if ( pointIdx >= getNumPoints( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -1061,7 +1202,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator[](	const uint pointIdx
 	}
 
 	MatrixVariablesGrid pointGrid;
-	pointGrid.addMatrix( *(values[pointIdx]),getTime( pointIdx ) );
+	pointGrid.addPoint( *this,pointIdx,getTime( pointIdx ) );
 
     return pointGrid;
 }
@@ -1075,8 +1216,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator+(	const MatrixVariablesGrid& a
 
 	MatrixVariablesGrid tmp( *this );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(tmp.values[i]) += *(arg.values[i]);
+	tmp += arg;
 
 	return tmp;
 }
@@ -1091,7 +1231,7 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator+=(	const MatrixVariablesGrid&
 	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		*(values[i]) += *(arg.values[i]);
+		getMatrixMap( i ) += arg.getMatrixMap( i );
 
 	return *this;
 }
@@ -1105,8 +1245,7 @@ MatrixVariablesGrid MatrixVariablesGrid::operator-(	const MatrixVariablesGrid& a
 
 	MatrixVariablesGrid tmp( *this );
 
-	for( uint i=0; i<getNumPoints( ); ++i )
-		*(tmp.values[i]) -= *(arg.values[i]);
+	tmp -= arg;
 
 	return tmp;
 }
@@ -1118,7 +1257,7 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator-=(	const MatrixVariablesGrid&
 	ASSERT( getNumPoints( ) == arg.getNumPoints( ) );
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		*(values[i]) -= *(arg.values[i]);
+		getMatrixMap( i ) -= arg.getMatrixMap( i );
 
 	return *this;
 }
@@ -1127,19 +1266,14 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator-=(	const MatrixVariablesGrid&
 
 uint MatrixVariablesGrid::getDim( ) const
 {
-	uint totalDim = 0;
-
-	for( uint i=0; i<getNumPoints( ); ++i )
-		totalDim += values[i]->getDim( );
-
-	return totalDim;
+	return values.size( );
 }
 
 
 
 uint MatrixVariablesGrid::getNumRows( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
 	return getNumRows( 0 );
@@ -1148,7 +1282,7 @@ uint MatrixVariablesGrid::getNumRows( ) const
 
 uint MatrixVariablesGrid::getNumCols( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
 	return getNumCols( 0 );
@@ -1157,7 +1291,7 @@ uint MatrixVariablesGrid::getNumCols( ) const
 
 uint MatrixVariablesGrid::getNumValues( ) const
 {
-	if ( values == 0 )
+	if ( getNumPoints( ) == 0 )
 		return 0;
 
 	return getNumValues( 0 );
@@ -1167,36 +1301,36 @@ uint MatrixVariablesGrid::getNumValues( ) const
 uint MatrixVariablesGrid::getNumRows(	uint pointIdx
 												) const
 {
-	if( values == 0 )
+	if( getNumPoints( ) == 0 )
 		return 0;
 
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getNumRows( );
+    return valueRows[pointIdx];
 }
 
 
 uint MatrixVariablesGrid::getNumCols(	uint pointIdx
 												) const
 {
-	if( values == 0 )
+	if( getNumPoints( ) == 0 )
 		return 0;
 
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getNumCols( );
+    return valueCols[pointIdx];
 }
 
 
 uint MatrixVariablesGrid::getNumValues(	uint pointIdx
 												) const
 {
-	if( values == 0 )
+	if( getNumPoints( ) == 0 )
 		return 0;
 
 	ASSERT( pointIdx < getNumPoints( ) );
 
-    return values[pointIdx]->getDim( );
+    return valueRows[pointIdx]*valueCols[pointIdx];
 }
 
 
@@ -1226,7 +1360,7 @@ VariableType MatrixVariablesGrid::getType(	uint pointIdx
 	if ( pointIdx >= getNumPoints( ) )
 		return VT_UNKNOWN;
 
-	return values[pointIdx]->getType( );
+	return settings[pointIdx].getType( );
 }
 
 
@@ -1237,7 +1371,7 @@ returnValue MatrixVariablesGrid::setType(	uint pointIdx,
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setType( _type );
+	return settings[pointIdx].setType( _type );
 }
 
 
@@ -1250,7 +1384,7 @@ returnValue MatrixVariablesGrid::getName(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->getName( idx,_name );
+	return settings[pointIdx].getName( idx,_name );
 }
 
 
@@ -1262,7 +1396,7 @@ returnValue MatrixVariablesGrid::setName(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setName( idx,_name );
+	return settings[pointIdx].setName( idx,_name );
 }
 
 
@@ -1275,7 +1409,7 @@ returnValue MatrixVariablesGrid::getUnit(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->getUnit( idx,_unit );
+	return settings[pointIdx].getUnit( idx,_unit );
 }
 
 
@@ -1287,7 +1421,7 @@ returnValue MatrixVariablesGrid::setUnit(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setUnit( idx,_unit );
+	return settings[pointIdx].setUnit( idx,_unit );
 }
 
 
@@ -1298,7 +1432,7 @@ DVector MatrixVariablesGrid::getScaling(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVector;
 
-	return values[pointIdx]->getScaling( );
+	return settings[pointIdx].getScaling( );
 }
 
 
@@ -1309,7 +1443,7 @@ returnValue MatrixVariablesGrid::setScaling(	uint pointIdx,
     if ( pointIdx >= getNumPoints( ) )
         return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setScaling( _scaling );
+    return settings[pointIdx].setScaling( _scaling );
 }
 
 
@@ -1320,7 +1454,7 @@ double MatrixVariablesGrid::getScaling(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return -1.0;
 
-	return values[pointIdx]->getScaling( valueIdx );
+	return settings[pointIdx].getScaling( valueIdx );
 }
 
 
@@ -1332,10 +1466,10 @@ returnValue MatrixVariablesGrid::setScaling(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( pointIdx ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-    values[pointIdx]->setScaling( valueIdx,_scaling );
+    settings[pointIdx].setScaling( valueIdx,_scaling );
     return SUCCESSFUL_RETURN;
 }
 
@@ -1347,7 +1481,7 @@ DVector MatrixVariablesGrid::getLowerBounds(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVector;
 
-	return values[pointIdx]->getLowerBounds( );
+	return settings[pointIdx].getLowerBounds( );
 }
 
 
@@ -1358,7 +1492,7 @@ returnValue MatrixVariablesGrid::setLowerBounds(	uint pointIdx,
     if( pointIdx >= nPoints )
         return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setLowerBounds( _lb );
+    return settings[pointIdx].setLowerBounds( _lb );
 }
 
 
@@ -1369,7 +1503,7 @@ double MatrixVariablesGrid::getLowerBound(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return -INFTY;
 
-	return values[pointIdx]->getLowerBound( valueIdx );
+	return settings[pointIdx].getLowerBound( valueIdx );
 }
 
 
@@ -1381,10 +1515,10 @@ returnValue MatrixVariablesGrid::setLowerBound(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( pointIdx ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	values[pointIdx]->setLowerBound( valueIdx,_lb );
+	settings[pointIdx].setLowerBound( valueIdx,_lb );
     return SUCCESSFUL_RETURN;
 }
 
@@ -1396,7 +1530,7 @@ DVector MatrixVariablesGrid::getUpperBounds(	uint pointIdx
 	if( pointIdx >= getNumPoints( ) )
 		return emptyVector;
 
-	return values[pointIdx]->getUpperBounds( );
+	return settings[pointIdx].getUpperBounds( );
 }
 
 
@@ -1407,7 +1541,7 @@ returnValue MatrixVariablesGrid::setUpperBounds(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
 
-    return values[pointIdx]->setUpperBounds( _ub );
+    return settings[pointIdx].setUpperBounds( _ub );
 }
 
 
@@ -1418,7 +1552,7 @@ double MatrixVariablesGrid::getUpperBound(	uint pointIdx,
     if( pointIdx >= getNumPoints( ) )
         return INFTY;
 
-	return values[pointIdx]->getUpperBound( valueIdx );
+	return settings[pointIdx].getUpperBound( valueIdx );
 }
 
 
@@ -1430,10 +1564,10 @@ returnValue MatrixVariablesGrid::setUpperBound(	uint pointIdx,
 	if( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	if( valueIdx >= values[pointIdx]->getDim( ) )
+	if( valueIdx >= getNumValues( pointIdx ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-    values[pointIdx]->setUpperBound( valueIdx,_ub );
+    settings[pointIdx].setUpperBound( valueIdx,_ub );
     return SUCCESSFUL_RETURN;
 }
 
@@ -1448,7 +1582,7 @@ BooleanType MatrixVariablesGrid::getAutoInit(	uint pointIdx
 		return defaultAutoInit;
 	}
 
-	return values[pointIdx]->getAutoInit( );
+	return settings[pointIdx].getAutoInit( );
 }
 
 
@@ -1459,14 +1593,14 @@ returnValue MatrixVariablesGrid::setAutoInit(	uint pointIdx,
 	if ( pointIdx >= getNumPoints( ) )
 		return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
 
-	return values[pointIdx]->setAutoInit( _autoInit );
+	return settings[pointIdx].setAutoInit( _autoInit );
 }
 
 
 returnValue MatrixVariablesGrid::disableAutoInit( )
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setAutoInit( BT_FALSE );
+		settings[i].setAutoInit( BT_FALSE );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1475,7 +1609,7 @@ returnValue MatrixVariablesGrid::disableAutoInit( )
 returnValue MatrixVariablesGrid::enableAutoInit( )
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setAutoInit( BT_TRUE );
+		settings[i].setAutoInit( BT_TRUE );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1486,7 +1620,7 @@ BooleanType MatrixVariablesGrid::hasNames( ) const
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->hasNames( ) == BT_TRUE )
+		if ( settings[i].hasNames( ) == BT_TRUE )
 			return BT_TRUE;
 	}
 
@@ -1498,7 +1632,7 @@ BooleanType MatrixVariablesGrid::hasUnits( ) const
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->hasUnits( ) == BT_TRUE )
+		if ( settings[i].hasUnits( ) == BT_TRUE )
 			return BT_TRUE;
 	}
 
@@ -1510,7 +1644,7 @@ BooleanType MatrixVariablesGrid::hasScaling( ) const
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->hasScaling( ) == BT_TRUE )
+		if ( settings[i].hasScaling( ) == BT_TRUE )
 			return BT_TRUE;
 	}
 
@@ -1522,7 +1656,7 @@ BooleanType MatrixVariablesGrid::hasLowerBounds( ) const
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->hasLowerBounds( ) == BT_TRUE )
+		if ( settings[i].hasLowerBounds( ) == BT_TRUE )
 			return BT_TRUE;
 	}
 
@@ -1534,7 +1668,7 @@ BooleanType MatrixVariablesGrid::hasUpperBounds( ) const
 {
 	for( uint i=0; i<getNumPoints( ); ++i )
 	{
-		if ( values[i]->hasUpperBounds( ) == BT_TRUE )
+		if ( settings[i].hasUpperBounds( ) == BT_TRUE )
 			return BT_TRUE;
 	}
 
@@ -1547,10 +1681,10 @@ double MatrixVariablesGrid::getMax( ) const
 {
 	double maxValue = -INFTY;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
+	for( uint i=0; i<values.size( ); ++i )
 	{
-		if ( values[i]->getMax( ) > maxValue )
-			maxValue = values[i]->getMax( );
+		if ( values[i] > maxValue )
+			maxValue = values[i];
 	}
 
 	return maxValue;
@@ -1561,10 +1695,10 @@ double MatrixVariablesGrid::getMin( ) const
 {
 	double minValue = INFTY;
 
-	for( uint i=0; i<getNumPoints( ); ++i )
+	for( uint i=0; i<values.size( ); ++i )
 	{
-		if ( values[i]->getMin( ) < minValue )
-			minValue = values[i]->getMin( );
+		if ( values[i] < minValue )
+			minValue = values[i];
 	}
 
 	return minValue;
@@ -1579,7 +1713,7 @@ double MatrixVariablesGrid::getMean( ) const
 		return meanValue;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		meanValue += values[i]->getMean( );
+		meanValue += getMatrixMap( i ).mean( );
 
 	return ( meanValue / (double)getNumPoints( ) );
 }
@@ -1588,8 +1722,7 @@ double MatrixVariablesGrid::getMean( ) const
 
 returnValue MatrixVariablesGrid::setZero( )
 {
-	for( uint i=0; i<getNumPoints( ); ++i )
-		values[i]->setZero( );
+	std::fill( values.begin( ),values.end( ),0.0 );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -1598,8 +1731,7 @@ returnValue MatrixVariablesGrid::setZero( )
 returnValue MatrixVariablesGrid::setAll(	double _value
 												)
 {
-    for( uint i = 0; i<getNumPoints( ); ++i )
-		values[i]->setAll( _value );
+	std::fill( values.begin( ),values.end( ),_value );
 
     return SUCCESSFUL_RETURN;
 }
@@ -34,6 +34,9 @@
 #define ACADO_TOOLKIT_MATRIX_VARIABLES_GRID_HPP
 
 #include <acado/variables_grid/grid.hpp>
+#include <acado/variables_grid/variable_settings.hpp>
+
+#include <vector>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -52,13 +55,32 @@ class MatrixVariable;
  *	matrix-valued optimization variables at each grid point, as they 
  *	usually occur when discretizing optimal control problems.
  *
- *	The class inherits from the Grid class and stores the matrix-valued
- *	optimization variables in an re-allocatable array of MatrixVariables.
+ *	The class inherits from the Grid class and stores the numerical values
+ *	of all grid points in a single contiguous buffer (each matrix in row-major
+ *	order, one grid point after the other) that grows geometrically when
+ *	appending grid points. Variable settings are kept separately for each
+ *	grid point. Zero-copy views on the values at a grid point or, for grids
+ *	whose matrices all have the same dimensions, on the trajectory of a single
+ *	component are provided as Eigen maps.
  *
  *	\author Hans Joachim Ferreau, Boris Houska, Milan Vukov
  */
 class MatrixVariablesGrid : public Grid
 {
+	//
+	// PUBLIC DATA TYPES:
+	//
+	public:
+
+		/** Zero-copy view on the (row-major) matrix at one grid point. */
+		typedef Eigen::Map< DMatrix::Base > MatrixMap;
+		/** Zero-copy read-only view on the (row-major) matrix at one grid point. */
+		typedef Eigen::Map< const DMatrix::Base > ConstMatrixMap;
+		/** Zero-copy view on one component at all grid points. */
+		typedef Eigen::Map< Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> > ComponentMap;
+		/** Zero-copy read-only view on one component at all grid points. */
+		typedef Eigen::Map< const Eigen::VectorXd,Eigen::Unaligned,Eigen::InnerStride<> > ConstComponentMap;
+
     //
     // PUBLIC MEMBER FUNCTIONS:
     //
@@ -446,6 +468,61 @@ class MatrixVariablesGrid : public Grid
 		DMatrix getMatrix(	uint pointIdx
 							) const;
 
+		/** Returns a zero-copy view on the matrix at grid point with given index.
+		 *	The view becomes invalid as soon as grid points are added or the
+		 *	dimensions of any matrix change.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return View on the matrix at grid point with given index (empty if index is out of bounds)
+		 */
+		MatrixMap getMatrixMap(	uint pointIdx
+								);
+
+		/** Returns a read-only zero-copy view on the matrix at grid point with
+		 *	given index. The view becomes invalid as soon as grid points are added
+		 *	or the dimensions of any matrix change.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return View on the matrix at grid point with given index (empty if index is out of bounds)
+		 */
+		ConstMatrixMap getMatrixMap(	uint pointIdx
+										) const;
+
+		/** Returns a zero-copy view on the trajectory of the component with given
+		 *	(row-major) index over all grid points. Only available if the matrices
+		 *	at all grid points have equal dimensions. The view becomes invalid as
+		 *	soon as grid points are added or the dimensions of any matrix change.
+		 *
+		 *	@param[in] valueIdx		Index of component.
+		 *
+		 *  \return View on the given component at all grid points (empty if not available)
+		 */
+		ComponentMap getComponentMap(	uint valueIdx
+										);
+
+		/** Returns a read-only zero-copy view on the trajectory of the component
+		 *	with given (row-major) index over all grid points. Only available if the
+		 *	matrices at all grid points have equal dimensions. The view becomes
+		 *	invalid as soon as grid points are added or the dimensions of any matrix
+		 *	change.
+		 *
+		 *	@param[in] valueIdx		Index of component.
+		 *
+		 *  \return View on the given component at all grid points (empty if not available)
+		 */
+		ConstComponentMap getComponentMap(	uint valueIdx
+											) const;
+
+		/** Returns whether the matrices at all grid points have equal dimensions.
+		 *
+		 *  \return BT_TRUE  iff all matrices have equal dimensions, \n
+		 *	        BT_FALSE otherwise
+		 */
+		BooleanType hasFixedDimensions( ) const;
+
+
 		/** Returns matrix at first grid point.
 		 *
 		 *  \return DMatrix at first grid point
@@ -1225,15 +1302,108 @@ class MatrixVariablesGrid : public Grid
 								double newTime = -INFTY
 								);
 
+		/** Adds a new grid point with given values, variable settings and time to grid.
+		 *
+		 *	@param[in] _values		Row-major values of the matrix to be added.
+		 *	@param[in] _nRows		Number of rows of the matrix to be added.
+		 *	@param[in] _nCols		Number of columns of the matrix to be added.
+		 *	@param[in] _settings	Variable settings of the grid point to be added.
+		 *	@param[in] newTime		Time of grid point to be added.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue addPoint(	const double* const _values,
+								uint _nRows,
+								uint _nCols,
+								const VariableSettings& _settings,
+								double newTime
+								);
+
+		/** Adds a copy of the grid point with given index of another grid
+		 *	at given time to grid.
+		 *
+		 *	@param[in] arg			Grid containing the grid point to be copied.
+		 *	@param[in] pointIdx		Index of grid point to be copied.
+		 *	@param[in] newTime		Time of grid point to be added.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue addPoint(	const MatrixVariablesGrid& arg,
+								uint pointIdx,
+								double newTime
+								);
+
+		/** Returns the MatrixVariable (values and settings) at grid point with given index.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *
+		 *  \return MatrixVariable at grid point with given index
+		 */
+		MatrixVariable getMatrixVariable(	uint pointIdx
+											) const;
+
+		/** Replaces values and variable settings at grid point with given index.
+		 *	If the dimensions change, all subsequent values are moved accordingly.
+		 *
+		 *	@param[in] pointIdx		Index of grid point.
+		 *	@param[in] _value		New values.
+		 *	@param[in] _settings	New variable settings.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue replacePoint(	uint pointIdx,
+									const DMatrix& _value,
+									const VariableSettings& _settings
+									);
+
+		/** Returns a pointer to the values at grid point with given index. */
+		inline double* getPointValues(	uint pointIdx
+										);
+
+		/** Returns a read-only pointer to the values at grid point with given index. */
+		inline const double* getPointValues(	uint pointIdx
+												) const;
+
     //
     // DATA MEMBERS:
     //
     protected:
 
-		/** DMatrix-valued optimization variable at all grid points. */
-		MatrixVariable** values;
+		/** Numerical values at all grid points, stored contiguously one grid
+		 *	point after the other with each matrix in row-major order. */
+		std::vector< double > values;
+
+		/** Offset of the values of each grid point within the value buffer. */
+		std::vector< uint > valueOffsets;
+
+		/** Number of rows of the matrix at each grid point. */
+		std::vector< uint > valueRows;
+
+		/** Number of columns of the matrix at each grid point. */
+		std::vector< uint > valueCols;
+
+		/** Variable settings at each grid point. */
+		std::vector< VariableSettings > settings;
 };
 
+
+
+inline double* MatrixVariablesGrid::getPointValues(	uint pointIdx
+													)
+{
+	return values.data( ) + valueOffsets[pointIdx];
+}
+
+
+inline const double* MatrixVariablesGrid::getPointValues(	uint pointIdx
+															) const
+{
+	return values.data( ) + valueOffsets[pointIdx];
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 #endif  // ACADO_TOOLKIT_MATRIX_VARIABLES_GRID_HPP
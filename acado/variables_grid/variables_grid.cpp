@@ -169,7 +169,6 @@ VariablesGrid& VariablesGrid::operator=( const DMatrix& rhs )
 VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 											) const
 {
-    ASSERT( values != 0 );
 	if ( rowIdx >= getNumRows( ) )
 	{
 		ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
@@ -182,7 +181,7 @@ VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 	VariablesGrid rowGrid( 1,tmpGrid,getType( ) );
 
     for( uint run1 = 0; run1 < getNumPoints(); run1++ )
-         rowGrid( run1,0 ) = values[run1]->operator()( rowIdx,0 );
+         rowGrid( run1,0 ) = MatrixVariablesGrid::operator()( run1,rowIdx,0 );
 
     return rowGrid;
 }
@@ -191,7 +190,6 @@ VariablesGrid VariablesGrid::operator()(	const uint rowIdx
 VariablesGrid VariablesGrid::operator[](	const uint pointIdx
 												) const
 {
-    ASSERT( values != 0 );
 	if ( pointIdx >= getNumPoints( ) )
 	{
 		ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -199,7 +197,7 @@ VariablesGrid VariablesGrid::operator[](	const uint pointIdx
 	}
 
 	VariablesGrid pointGrid;
-	pointGrid.addMatrix( *(values[pointIdx]),getTime( pointIdx ) );
+	pointGrid.addPoint( *this,pointIdx,getTime( pointIdx ) );
 
     return pointGrid;
 }
@@ -306,10 +304,10 @@ returnValue VariablesGrid::setAllVectors(	const DVector& _values
 DVector VariablesGrid::getVector(	uint pointIdx
 									) const
 {
-	if ( ( values == 0 ) || ( pointIdx >= getNumPoints() ) )
+	if ( pointIdx >= getNumPoints() )
 		return emptyVector;
 
-	return values[pointIdx]->getCol( 0 );
+	return DVector( getMatrixMap( pointIdx ).col( 0 ) );
 }
 
 
@@ -381,7 +379,7 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 	{
 		// simply append
 		for( uint i=0; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 	else
 	{
@@ -396,13 +394,13 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 				break;
 
 			case MM_DUPLICATE:
-				addMatrix( *(arg.values[0]),arg.getTime( 0 ) );
+				addPoint( arg,0,arg.getTime( 0 ) );
 				break;
 		}
 
 		// simply append all remaining points
 		for( uint i=1; i<arg.getNumPoints( ); ++i )
-			addMatrix( *(arg.values[i]),arg.getTime( i ) );
+			addPoint( arg,i,arg.getTime( i ) );
 	}
 
 	return SUCCESSFUL_RETURN;
@@ -430,15 +428,7 @@ returnValue VariablesGrid::appendValues( const VariablesGrid& arg )
 	if ( getNumPoints( ) != arg.getNumPoints( ) )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
-	DVector tmp1,tmp2;
-
-	for( uint i=0; i<getNumPoints(); ++i )
-	{
-		values[i]->appendRows( *(arg.values[i]) );
-		values[i]->appendSettings( *(arg.values[i]) );
-	}
-
-	return SUCCESSFUL_RETURN;
+	return MatrixVariablesGrid::appendValues( arg );
 }
 
 
@@ -484,7 +474,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_REPLACE ) ) )
 			{
-				mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+				mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 			}
 
 			++j;
@@ -496,16 +486,16 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			switch ( _mergeMethod )
 			{
 				case MM_KEEP:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
 					break;
 	
 				case MM_REPLACE:
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 	
 				case MM_DUPLICATE:
-					mergedGrid.addMatrix( *(values[i]),getTime( i ) );
-					mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+					mergedGrid.addPoint( *this,i,getTime( i ) );
+					mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 					break;
 			}
 			++j;
@@ -516,7 +506,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 			if ( ( overlapping == BT_FALSE ) ||
 				 ( ( overlapping == BT_TRUE ) && ( _mergeMethod == MM_KEEP ) ) )
 			{
-				mergedGrid.addMatrix( *(values[i]),getTime( i ) );//arg.
+				mergedGrid.addPoint( *this,i,getTime( i ) );//arg.
 			}
 		}
 	}
@@ -525,7 +515,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 	while ( j < arg.getNumPoints( ) )
 	{
 		if ( acadoIsStrictlyGreater( arg.getTime(j),getLastTime() ) == BT_TRUE )
-			mergedGrid.addMatrix( *(arg.values[j]),arg.getTime( j ) );
+			mergedGrid.addPoint( arg,j,arg.getTime( j ) );
 
 		++j;
 	}
@@ -552,7 +542,7 @@ VariablesGrid VariablesGrid::getTimeSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -578,13 +568,13 @@ VariablesGrid VariablesGrid::getTimeSubGrid(	double startTime,
 	
 	// add all matrices in interval (constant interpolation)
 	if ( ( hasTime( startTime ) == BT_FALSE ) && ( startIdx > 0 ) )
-		newVariablesGrid.addMatrix( *(values[ startIdx-1 ]),startTime );
+		newVariablesGrid.addPoint( *this,startIdx-1,startTime );
 	
 	for( uint i=startIdx; i<=endIdx; ++i )
-		newVariablesGrid.addMatrix( *(values[i]),getTime( i ) );
+		newVariablesGrid.addPoint( *this,i,getTime( i ) );
 	
 	if ( hasTime( endTime ) == BT_FALSE )
-		newVariablesGrid.addMatrix( *(values[ endIdx ]),endTime );
+		newVariablesGrid.addPoint( *this,endIdx,endTime );
 
     return newVariablesGrid;
 }
@@ -603,7 +593,7 @@ VariablesGrid VariablesGrid::getValuesSubGrid(	uint startIdx,
 		return newVariablesGrid;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
-		newVariablesGrid.addMatrix( values[i]->getRows( startIdx,endIdx ),getTime( i ) );
+		newVariablesGrid.addMatrix( getMatrixVariable( i ).getRows( startIdx,endIdx ),getTime( i ) );
 
     return newVariablesGrid;
 }
@@ -0,0 +1,130 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+
+ /**
+ *    \file examples/matrix_vector/block_matrix_benchmark.cpp
+ *    \date 2014
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/clock/real_clock.hpp>
+
+#include <cmath>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* fills a matrix with deterministic pseudo-random values */
+DMatrix sampleMatrix( uint nRows, uint nCols, uint seed ){
+
+    DMatrix result( nRows, nCols );
+
+    for( uint i = 0; i < nRows*nCols; ++i )
+        result.data()[i] = sin( 1.0 + seed*nRows*nCols + i );
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    // DIMENSIONS OF THE DISCRETIZED OPTIMAL CONTROL PROBLEM:
+    // ------------------------------------------------------
+    const uint N  = 20;     // number of shooting intervals
+    const uint nx = 8;      // number of differential states
+    const uint nu = 3;      // number of controls
+    const uint nc = 4;      // number of path constraints
+
+    const uint nReps = 200;
+
+
+    // CONDENSING OPERATOR AS SET UP BY THE CondensingBasedCPsolver:
+    // -------------------------------------------------------------
+    BlockMatrix T( 5*N, 3*N );
+
+    T.setIdentity( 0, 0, nx );
+    for( uint i = 0; i < N; ++i ){
+
+        if( i != N-1 ) T.setIdentity( 3*N+i, N+2+i, nu );
+        else           T.setIdentity( 3*N+i, N+1+i, nu );
+
+        if( i == 0 ) continue;
+
+        T.setDense( i, 0, sampleMatrix( nx, nx, i ) );
+        for( uint k = 0; k < i; ++k )
+            T.setDense( i, N+2+k, sampleMatrix( nx, nu, i*N+k ) );
+    }
+
+
+    // HESSIAN AND CONSTRAINT JACOBIAN OF THE BANDED QP:
+    // -------------------------------------------------
+    BlockMatrix H( 5*N, 5*N ), A( N, 5*N );
+
+    for( uint i = 0; i < N; ++i ){
+
+        H.setDense( i    , i    , sampleMatrix( nx, nx, 3*i   ) );
+        H.setDense( i    , 3*N+i, sampleMatrix( nx, nu, 3*i+1 ) );
+        H.setDense( 3*N+i, i    , sampleMatrix( nx, nu, 3*i+1 ).transpose() );
+        H.setDense( 3*N+i, 3*N+i, sampleMatrix( nu, nu, 3*i+2 ) );
+
+        A.setDense( i, i    , sampleMatrix( nc, nx, 2*i   ) );
+        A.setDense( i, 3*N+i, sampleMatrix( nc, nu, 2*i+1 ) );
+    }
+
+
+    // CONDENSE THE QP REPEATEDLY, REUSING THE RESULT MATRICES:
+    // ---------------------------------------------------------
+    BlockMatrix hT, HDense, ADense;
+    RealClock clock;
+
+    clock.start( );
+    for( uint run = 0; run < nReps; ++run ){
+
+        H.multiply( T, hT );
+        T.multiplyTransposed( hT, HDense );
+        A.multiply( T, ADense );
+    }
+    clock.stop( );
+
+    DMatrix block;
+    HDense.getSubBlock( 0, 0, block );
+
+    printf( "condensing (N = %d, nx = %d, nu = %d):  %.3f ms per iteration\n",
+            N, nx, nu, 1.0e3 * clock.getTime( ) / nReps );
+    printf( "checksum: %.12e\n", block.getNorm( ) );
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
+
+
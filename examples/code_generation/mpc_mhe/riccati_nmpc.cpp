@@ -0,0 +1,121 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file   examples/code_generation/mpc_mhe/riccati_nmpc.cpp
+ *    \date   2014
+ *
+ *    Exports the same NMPC problem twice: with full condensing and qpOASES,
+ *    and with the sparse Riccati-based QP solver. The generated solvers are
+ *    compared in riccati_nmpc_test.cpp.
+ */
+
+#include <acado_code_generation.hpp>
+
+USING_NAMESPACE_ACADO
+
+static int exportSolver(	const std::string& folder,
+							const std::string& moduleName,
+							const std::string& modulePrefix,
+							bool sparse
+							)
+{
+	clearAllStaticCounters( );
+
+	DifferentialState   p, v, phi, omega;
+	Control             a;
+
+	const double     g = 9.81;
+	const double     b = 0.20;
+
+	DifferentialEquation f;
+
+	f << dot( p ) == v;
+	f << dot( v ) == a;
+	f << dot( phi ) == omega;
+	f << dot( omega ) == -g * sin(phi) - a * cos(phi) - b * omega;
+
+	Function h, hN;
+	h << p << v << phi << omega << a;
+	hN << p << v << phi << omega;
+
+	DMatrix W = eye<double>( h.getDim() );
+	DMatrix WN = eye<double>( hN.getDim() );
+	WN *= 5;
+
+	const int N = 50;
+
+	OCP ocp(0.0, 0.1 * N, N);
+
+	ocp.subjectTo( f );
+
+	ocp.minimizeLSQ(W, h);
+	ocp.minimizeLSQEndTerm(WN, hN);
+
+	ocp.subjectTo( -1.0 <= a <= 1.0 );
+	ocp.subjectTo( -0.5 <= v <= 1.5 );
+	ocp.subjectTo( -2.0 <= p + 0.5 * a <= 2.0 );
+
+	OCPexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION,       GAUSS_NEWTON      );
+	mpc.set( DISCRETIZATION_TYPE,         MULTIPLE_SHOOTING );
+	mpc.set( INTEGRATOR_TYPE,             INT_RK4           );
+	mpc.set( NUM_INTEGRATOR_STEPS,        2 * N             );
+
+	if (sparse == true)
+	{
+		mpc.set( SPARSE_QP_SOLUTION,      SPARSE_SOLVER     );
+		mpc.set( QP_SOLVER,               QP_RICCATI        );
+	}
+	else
+	{
+		mpc.set( SPARSE_QP_SOLUTION,      FULL_CONDENSING_N2 );
+		mpc.set( QP_SOLVER,               QP_QPOASES        );
+	}
+
+	mpc.set( CG_MODULE_NAME,              moduleName        );
+	mpc.set( CG_MODULE_PREFIX,            modulePrefix      );
+	mpc.set( GENERATE_TEST_FILE,          NO                );
+	mpc.set( GENERATE_MAKE_FILE,          YES               );
+
+	if (mpc.exportCode( folder ) != SUCCESSFUL_RETURN)
+		return EXIT_FAILURE;
+
+	mpc.printDimensionsQP( );
+
+	return EXIT_SUCCESS;
+}
+
+int main( )
+{
+	if (exportSolver("riccati_nmpc_export", "acado", "ACADO", false) != EXIT_SUCCESS)
+		exit( EXIT_FAILURE );
+
+	if (exportSolver("riccati_nmpc_export/riccati", "riccati", "RICCATI", true) != EXIT_SUCCESS)
+		exit( EXIT_FAILURE );
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+ /**
+ *    \file   examples/code_generation/mpc_mhe/riccati_nmpc_test.cpp
+ *    \date   2014
+ *
+ *    Runs the condensed qpOASES based and the Riccati based RTI solvers
+ *    side by side and checks that they compute the same feedback.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+
+using namespace std;
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+#include "riccati_common.h"
+
+#define NX          ACADO_NX	/* number of differential states */
+#define NU          ACADO_NU	/* number of control inputs */
+#define N          	ACADO_N		/* number of control intervals */
+#define NUM_STEPS   30			/* number of simulation steps */
+#define TOLERANCE   1e-4		/* admissible difference of the QP solutions */
+#define VERBOSE     1			/* show iterations: 1, silent: 0 */
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+RICCATIvariables riccatiVariables;
+RICCATIworkspace riccatiWorkspace;
+
+int main()
+{
+	unsigned i, iter;
+	acado_timer t;
+	real_t tCondensed = 0.0, tRiccati = 0.0;
+	real_t dU, dX, maxDiff = 0.0;
+	int statusCondensed, statusRiccati;
+
+	memset(&acadoWorkspace, 0, sizeof( acadoWorkspace ));
+	memset(&acadoVariables, 0, sizeof( acadoVariables ));
+	memset(&riccatiWorkspace, 0, sizeof( riccatiWorkspace ));
+	memset(&riccatiVariables, 0, sizeof( riccatiVariables ));
+
+	acado_initializeSolver();
+	riccati_initializeSolver();
+
+	// Initial state; all references are zero
+	acadoVariables.x0[ 0 ] = 1.5;
+	acadoVariables.x0[ 2 ] = 0.3;
+
+	for( iter = 0; iter < NUM_STEPS; iter++ )
+	{
+		for (i = 0; i < NX; ++i)
+			riccatiVariables.x0[ i ] = acadoVariables.x0[ i ];
+
+		acado_preparationStep();
+		riccati_preparationStep();
+
+		acado_tic( &t );
+		statusCondensed = acado_feedbackStep( );
+		tCondensed += acado_toc( &t );
+
+		acado_tic( &t );
+		statusRiccati = riccati_feedbackStep( );
+		tRiccati += acado_toc( &t );
+
+		if (statusCondensed || statusRiccati)
+		{
+			cout << "Iteration:" << iter << ", QP problem! QP status: "
+				 << statusCondensed << ", " << statusRiccati << endl;
+
+			return EXIT_FAILURE;
+		}
+
+		dU = dX = 0.0;
+		for (i = 0; i < N * NU; ++i)
+			dU = max(dU, fabs(acadoVariables.u[ i ] - riccatiVariables.u[ i ]));
+		for (i = 0; i < (N + 1) * NX; ++i)
+			dX = max(dX, fabs(acadoVariables.x[ i ] - riccatiVariables.x[ i ]));
+		maxDiff = max(maxDiff, max(dU, dX));
+
+#if VERBOSE
+		cout	<< "Iteration #" << setw( 4 ) << iter
+				<< ", IP iterations: " << setw( 3 ) << riccatiWorkspace.nIt[ 0 ]
+				<< ", max. difference u: " << scientific << dU
+				<< ", x: " << scientific << dX
+				<< endl;
+#endif // VERBOSE
+
+		// Ideal feedback, the solvers are not shifted.
+		for (i = 0; i < NX; ++i)
+			acadoVariables.x0[ i ] = acadoVariables.x[NX + i];
+	}
+
+#if VERBOSE
+	cout << "Average feedback time, condensing + qpOASES: " << scientific << tCondensed / NUM_STEPS * 1e6 << " microseconds" << endl;
+	cout << "Average feedback time, Riccati:              " << scientific << tRiccati / NUM_STEPS * 1e6 << " microseconds" << endl;
+#endif // VERBOSE
+
+	if (maxDiff > TOLERANCE)
+	{
+		cout << "Solutions differ by " << maxDiff << endl;
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+
+ /**
+ *    \file examples/ocp/options_benchmark.cpp
+ *    \date 2014
+ */
+
+
+#include <acado_optimal_control.hpp>
+#include <acado/clock/real_clock.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint nReps = 1000000;
+
+    // A SMALL OPTIMAL CONTROL PROBLEM:
+    // --------------------------------
+    DifferentialState     v,s,m;
+    Control               u    ;
+    DifferentialEquation  f    ;
+
+    f << dot(s) == v;
+    f << dot(v) == (u-0.02*v*v)/m;
+    f << dot(m) == -0.01*u*u;
+
+    OCP ocp( 0.0, 10.0, 20 );
+    ocp.minimizeLagrangeTerm( u*u );
+    ocp.subjectTo( f );
+
+    ocp.subjectTo( AT_START, s ==  0.0 );
+    ocp.subjectTo( AT_START, v ==  0.0 );
+    ocp.subjectTo( AT_START, m ==  1.0 );
+    ocp.subjectTo( AT_END  , s == 10.0 );
+    ocp.subjectTo( AT_END  , v ==  0.0 );
+
+    ocp.subjectTo( -0.01 <= v <= 1.3 );
+
+    OptimizationAlgorithm algorithm( ocp );
+    algorithm.set( HESSIAN_APPROXIMATION, EXACT_HESSIAN );
+    algorithm.set( INTEGRATOR_TOLERANCE, 1e-4 );
+    algorithm.set( KKT_TOLERANCE, 1e-10 );
+    algorithm.set( PRINTLEVEL, NONE );
+    algorithm.set( PRINT_COPYRIGHT, BT_FALSE );
+
+
+    // LOOKUP OF AN OPTION VERSUS COMPARISON OF THE OPTIONS STAMP:
+    // -----------------------------------------------------------
+    RealClock clock;
+    double tol = 0.0, sum = 0.0;
+
+    clock.start( );
+    for( uint run = 0; run < nReps; ++run ){
+        algorithm.get( KKT_TOLERANCE, tol );
+        sum += tol;
+    }
+    clock.stop( );
+    double lookupTime = clock.getTime( );
+
+    uint version = algorithm.getOptionsVersion( );
+
+    clock.reset( );
+    clock.start( );
+    for( uint run = 0; run < nReps; ++run ){
+        if( version != algorithm.getOptionsVersion( ) )
+            algorithm.get( KKT_TOLERANCE, tol );
+        sum += tol;
+    }
+    clock.stop( );
+    double stampTime = clock.getTime( );
+
+    printf( "option lookup:     %.1f ns\n", 1.0e9 * lookupTime / nReps );
+    printf( "stamp comparison:  %.1f ns\n", 1.0e9 * stampTime  / nReps );
+
+
+    // SQP ITERATIONS:
+    // ---------------
+    LogRecord logRecord( LOG_AT_EACH_ITERATION );
+    logRecord << LOG_NUM_SQP_ITERATIONS;
+    algorithm << logRecord;
+
+    clock.reset( );
+    clock.start( );
+    algorithm.solve( );
+    clock.stop( );
+
+    algorithm.getLogRecord( logRecord );
+
+    DMatrix numSteps;
+    logRecord.getLast( LOG_NUM_SQP_ITERATIONS, numSteps );
+
+    printf( "rocket (N = 20):   %.3f ms per SQP iteration (%d iterations)\n",
+            1.0e3 * clock.getTime( ) / numSteps( 0,0 ), (int) numSteps( 0,0 ) );
+    printf( "checksum: %.12e\n", sum + algorithm.getObjectiveValue( ) );
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
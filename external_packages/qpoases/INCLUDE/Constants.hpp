@@ -42,6 +42,12 @@
   #include STR(QPOASES_CUSTOM_INTERFACE)
 #endif
 
+/** Interfaces which do not solve QPs concurrently may keep auxiliary
+	objects static (see QProblem::solveInitialQP). */
+#ifndef QPOASES_REENTRANT
+#define QPOASES_REENTRANT 0
+#endif
+
 /** Maximum number of variables within a QP formulation.
 	Note: this value has to be positive! */
 const int NVMAX = QPOASES_NVMAX;
@@ -842,11 +842,19 @@ returnValue QProblem::solveInitialQP(	const real_t* const xOpt, const real_t* co
 
 	/* 3) Obtain linear independent working set for auxiliary QP. */
 
+#if QPOASES_REENTRANT
+	Bounds auxiliaryBounds;
+#else
 	static Bounds auxiliaryBounds;
+#endif
 
 	auxiliaryBounds.init( nV );
 
+#if QPOASES_REENTRANT
+	Constraints auxiliaryConstraints;
+#else
 	static Constraints auxiliaryConstraints;
+#endif
 
 	auxiliaryConstraints.init( nC );
 
@@ -867,7 +867,11 @@ returnValue QProblemB::solveInitialQP(	const real_t* const xOpt, const real_t* c
 
 	/* 3) Obtain linear independent working set for auxiliary QP. */
 
+#if QPOASES_REENTRANT
+	Bounds auxiliaryBounds;
+#else
 	static Bounds auxiliaryBounds;
+#endif
 
 	auxiliaryBounds.init( nV );
 
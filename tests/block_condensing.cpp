@@ -0,0 +1,53 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE BlockCondensingTests
+#include <boost/test/unit_test.hpp>
+
+#include "test_problems.hpp"
+
+USING_NAMESPACE_ACADO
+
+/* rocket with state, control and path constraints; the path constraint is active */
+static void solveRocket( int sparseQPsolution, int blockSize, RocketSolution& solution )
+{
+	RocketSettings settings;
+	settings.uvBound = 1.3;
+	settings.intOptions[ SPARSE_QP_SOLUTION ] = sparseQPsolution;
+	if ( blockSize > 0 )
+		settings.intOptions[ CONDENSING_BLOCK_SIZE ] = blockSize;
+
+	solveRocket( settings,solution );
+}
+
+BOOST_AUTO_TEST_CASE( rocket_matches_condensing )
+{
+	RocketSolution condensing;
+	solveRocket( CONDENSING,0,condensing );
+
+	// the path constraint is active at some nodes
+	double maxDistance = 0.0;
+	for( uint i=0; i<condensing.controls.getNumPoints( ); ++i )
+		maxDistance = acadoMax( maxDistance,fabs( condensing.controls( i,0 ) - condensing.states( i,1 ) ) );
+	BOOST_REQUIRE_SMALL( maxDistance - 1.3,1e-8 );
+
+	// a block size that divides the 20 intervals and one that does not
+	const int blockSizes[2] = { 4,3 };
+
+	for( int k=0; k<2; ++k )
+	{
+		RocketSolution block;
+		solveRocket( BLOCK_CONDENSING_N2,blockSizes[k],block );
+
+		BOOST_CHECK_SMALL( condensing.objective - block.objective,1e-10 );
+
+		BOOST_REQUIRE( condensing.controls.getNumPoints( ) == block.controls.getNumPoints( ) );
+		for( uint i=0; i<block.controls.getNumPoints( ); ++i )
+			BOOST_CHECK_SMALL( condensing.controls( i,0 ) - block.controls( i,0 ),1e-6 );
+
+		BOOST_REQUIRE( condensing.states.getNumPoints( ) == block.states.getNumPoints( ) );
+		for( uint i=0; i<block.states.getNumPoints( ); ++i )
+			for( uint j=0; j<block.states.getNumValues( ); ++j )
+				BOOST_CHECK_SMALL( condensing.states( i,j ) - block.states( i,j ),1e-6 );
+	}
+}
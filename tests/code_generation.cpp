@@ -0,0 +1,445 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE CodeGenerationTests
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <acado/code_generation/export_function.hpp>
+#include <acado/code_generation/export_arithmetic_statement.hpp>
+#include <acado/code_generation/integrators/integrator_export_types.hpp>
+#include <acado/code_generation/ocp_export.hpp>
+#include <acado/code_generation/sim_export.hpp>
+#include <acado/function/function.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+USING_NAMESPACE_ACADO
+
+namespace
+{
+
+/** Compiles the given files of a directory into a program, runs it and reads
+ *  all numbers the program prints. Returns false if any step fails. */
+bool buildAndRun(	const boost::filesystem::path& dir,
+					const std::string& files,
+					const std::string& flags,
+					std::vector< double >& output
+					)
+{
+	std::string exe = ( dir / "test" ).string( );
+
+	std::string compile = "cd " + dir.string( ) + " && gcc -O2 -o " + exe + " " + files + " " + flags + " -lm";
+	bool success = std::system( compile.c_str( ) ) == 0;
+
+	output.clear( );
+	if ( success == true )
+	{
+		FILE* pipe = popen( exe.c_str( ),"r" );
+		double value;
+		while ( pipe != 0 && std::fscanf( pipe,"%lf",&value ) == 1 )
+			output.push_back( value );
+		success = pipe != 0 && pclose( pipe ) == 0;
+	}
+
+	return success;
+}
+
+/** Returns a new temporary directory. */
+boost::filesystem::path createTemporaryDirectory( )
+{
+	boost::filesystem::path dir = boost::filesystem::temp_directory_path( ) /
+			boost::filesystem::unique_path( "acado_codegen_%%%%-%%%%-%%%%" );
+	boost::filesystem::create_directories( dir );
+
+	return dir;
+}
+
+/** Writes the given C source into a new directory, compiles and runs it, and
+ *  reads all numbers the program prints. Returns false if any step fails. */
+bool compileAndRun(	const std::string& source,
+					const std::string& flags,
+					std::vector< double >& output
+					)
+{
+	boost::filesystem::path dir = createTemporaryDirectory( );
+	std::ofstream( ( dir / "test.c" ).string( ).c_str( ) ) << source;
+
+	bool success = buildAndRun( dir,"test.c",flags,output );
+
+	boost::filesystem::remove_all( dir );
+	return success;
+}
+
+/** Returns the C initializer of a variable filled with deterministic data. */
+std::string initializer( DMatrix& data, unsigned nRows, unsigned nCols, double seed )
+{
+	data.resize(nRows, nCols);
+
+	std::stringstream ss;
+	ss.precision( 17 );
+	ss << "{";
+	for (unsigned i = 0; i < nRows; ++i)
+		for (unsigned j = 0; j < nCols; ++j)
+		{
+			data(i, j) = sin(seed + 0.37 * i + 0.11 * j);
+			ss << data(i, j) << (i + 1 < nRows || j + 1 < nCols ? ", " : "}");
+		}
+
+	return ss.str();
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( multiplication_kernels )
+{
+	// Sizes with incomplete tiles in both dimensions, below and above the unrolling limit
+	const unsigned n = 17, m = 19, p = 23;
+
+	ExportVariable A("A", n, m), B("B", m, p), E("E", n, p);
+	ExportVariable C("C", n, p), D("D", m, p), F("F", n, p);
+
+	DMatrix valA, valB, valE, valD, valF;
+	std::stringstream driver;
+	driver << "real_t A[] = " << initializer(valA, n, m, 0.1) << ";\n"
+		<< "real_t B[] = " << initializer(valB, m, p, 0.2) << ";\n"
+		<< "real_t E[] = " << initializer(valE, n, p, 0.3) << ";\n"
+		<< "real_t D[] = " << initializer(valD, m, p, 0.4) << ";\n"
+		<< "real_t F[] = " << initializer(valF, n, p, 0.5) << ";\n"
+		<< "real_t C[" << n * p << "];\n\n"
+		<< "int main() {\nint i;\n"
+		<< "%s(A, B, E, C, D, F);\n"
+		<< "for (i = 0; i < " << n * p << "; ++i) printf(\"%.16e\\n\", C[i]);\n"
+		<< "for (i = 0; i < " << m * p << "; ++i) printf(\"%.16e\\n\", D[i]);\n"
+		<< "for (i = 0; i < " << n * p << "; ++i) printf(\"%.16e\\n\", F[i]);\n"
+		<< "return 0;\n}\n";
+
+	// Reference results in the order printed by the program
+	DMatrix refC = valA * valB;
+	DMatrix refD = valD + valA.transpose() * valE;
+	DMatrix refF = valF - valA.block(0, 0, 8, m) * valB;
+
+	std::vector< double > reference;
+	for (unsigned i = 0; i < n; ++i)
+		for (unsigned j = 0; j < p; ++j)
+			reference.push_back( refC(i, j) );
+	for (unsigned i = 0; i < m; ++i)
+		for (unsigned j = 0; j < p; ++j)
+			reference.push_back( refD(i, j) );
+	for (unsigned i = 0; i < n; ++i)
+		for (unsigned j = 0; j < p; ++j)
+			reference.push_back( i < 8 ? refF(i, j) : valF(i, j) );
+
+	const ExportMultiplicationKernel kernels[] = {MULTIPLICATION_LOOPS, MULTIPLICATION_BLOCKED,
+			MULTIPLICATION_BLOCKED_SSE2, MULTIPLICATION_BLOCKED_AVX};
+	const char* headers[] = {"", "", "#include <emmintrin.h>\n", "#include <immintrin.h>\n"};
+	const char* flags[] = {"", "", "-msse2", "-mavx"};
+
+	std::vector< double > first;
+	for (unsigned k = 0; k < 4; ++k)
+	{
+		// AVX code can only be executed on processors supporting it
+		if (kernels[ k ] == MULTIPLICATION_BLOCKED_AVX && __builtin_cpu_supports("avx") == 0)
+			continue;
+
+		ExportArithmeticStatement::multiplicationKernel = kernels[ k ];
+
+		ExportFunction multiply("multiply", A, B, E, C, D, F);
+		multiply.addStatement( C == A * B );
+		multiply.addStatement( D += A.getTranspose() * E );
+		multiply.addStatement( F.getRows(0, 8) -= A.getRows(0, 8) * B );
+
+		std::stringstream source;
+		source << "#include <stdio.h>\n" << headers[ k ] << "typedef double real_t;\n\n";
+		BOOST_REQUIRE( multiply.exportCode(source, "real_t", "int", 16) == SUCCESSFUL_RETURN );
+		std::string call = driver.str();
+		call.replace(call.find("%s"), 2, multiply.getName());
+		source << "\n" << call;
+
+		std::vector< double > output;
+		BOOST_REQUIRE_MESSAGE( compileAndRun(source.str(), flags[ k ], output) == true,
+				"kernel " << kernels[ k ] );
+		BOOST_REQUIRE_EQUAL( output.size(), reference.size() );
+
+		for (unsigned i = 0; i < reference.size(); ++i)
+			BOOST_CHECK_SMALL( output[ i ] - reference[ i ], 1e-12 );
+
+		// All kernels sum up the products in the same order
+		if (first.empty() == true)
+			first = output;
+		else
+			BOOST_CHECK_EQUAL_COLLECTIONS( output.begin(), output.end(), first.begin(), first.end() );
+	}
+
+	ExportArithmeticStatement::multiplicationKernel = MULTIPLICATION_LOOPS;
+}
+
+BOOST_AUTO_TEST_CASE( function_export_with_and_without_tape )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x, y;
+	Control u;
+	IntermediateState a, b;
+
+	a = x*y + sin(u);
+	b = exp(a) - x*x;
+
+	Function f;
+	f << a*b + y;
+	f << b/(1.0 + u*u);
+	f << cos(a)*x + a*a;
+
+	// Reference values of the outputs for the input (x, y, u)
+	const double in[] = {0.3, -0.7, 1.1};
+
+	std::vector< double > xf( f.getNumberOfVariables() + 1, 0.0 ), reference( f.getDim() );
+	xf[ f.index(VT_DIFFERENTIAL_STATE, 0) ] = in[ 0 ];
+	xf[ f.index(VT_DIFFERENTIAL_STATE, 1) ] = in[ 1 ];
+	xf[ f.index(VT_CONTROL, 0) ] = in[ 2 ];
+	BOOST_REQUIRE( f.evaluate(0, &xf[0], &reference[0]) == SUCCESSFUL_RETURN );
+
+	std::stringstream driver;
+	driver.precision( 17 );
+	driver << "\nint main() {\nint i;\n"
+		<< "const real_t in[] = {" << in[ 0 ] << ", " << in[ 1 ] << ", " << in[ 2 ] << "};\n"
+		<< "real_t out[" << f.getDim() << "];\n"
+		<< "evaluate(in, out);\n"
+		<< "for (i = 0; i < " << f.getDim() << "; ++i) printf(\"%.16e\\n\", out[i]);\n"
+		<< "return 0;\n}\n";
+
+	const BooleanType tapeEnabled[] = {BT_TRUE, BT_FALSE};
+
+	for (unsigned k = 0; k < 2; ++k)
+	{
+		Function g = f;
+		BOOST_REQUIRE( g.setTapeEnabled( tapeEnabled[ k ] ) == SUCCESSFUL_RETURN );
+
+		std::stringstream source;
+		source << "#include <stdio.h>\n#include <math.h>\ntypedef double real_t;\n\n";
+		BOOST_REQUIRE( g.exportCode(source, "evaluate", "real_t") == SUCCESSFUL_RETURN );
+
+		// Repeated exports reuse the recorded tape and yield the same code
+		std::stringstream again;
+		BOOST_REQUIRE( g.exportCode(again, "evaluate", "real_t") == SUCCESSFUL_RETURN );
+		BOOST_CHECK( source.str().find( again.str() ) != std::string::npos );
+
+		source << driver.str();
+
+		std::vector< double > output;
+		BOOST_REQUIRE_MESSAGE( compileAndRun(source.str(), "", output) == true,
+				"tape enabled " << tapeEnabled[ k ] );
+		BOOST_REQUIRE_EQUAL( output.size(), reference.size() );
+
+		for (unsigned i = 0; i < reference.size(); ++i)
+			BOOST_CHECK_SMALL( output[ i ] - reference[ i ], 1e-12 );
+	}
+}
+
+/** Exports an MPC solver with or without a solver context, runs the real-time
+ *  iterations of two problems and returns their controls. */
+static void runExportedSolver( bool useSolverContext, std::vector< double >& controls )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState p, v;
+	Control F;
+
+	DifferentialEquation f;
+	f << dot( p ) == v;
+	f << dot( v ) == F - 0.5*sin( p );
+
+	Function h, hN;
+	h << p << v << F;
+	hN << p << v;
+
+	OCP ocp(0.0, 2.0, 10);
+	ocp.subjectTo( f );
+	ocp.minimizeLSQ( eye<double>( h.getDim() ), h );
+	ocp.minimizeLSQEndTerm( eye<double>( hN.getDim() ), hN );
+	ocp.subjectTo( -1.0 <= F <= 1.0 );
+
+	OCPexport mpc( ocp );
+	mpc.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
+	mpc.set( DISCRETIZATION_TYPE, MULTIPLE_SHOOTING );
+	mpc.set( INTEGRATOR_TYPE, INT_RK4 );
+	mpc.set( NUM_INTEGRATOR_STEPS, 20 );
+	mpc.set( QP_SOLVER, QP_QPOASES );
+	mpc.set( GENERATE_TEST_FILE, NO );
+	mpc.set( GENERATE_MAKE_FILE, NO );
+	mpc.set( CG_USE_SOLVER_CONTEXT, useSolverContext == true ? YES : NO );
+
+	boost::filesystem::path dir = createTemporaryDirectory( );
+	BOOST_REQUIRE( mpc.exportCode( dir.string() ) == SUCCESSFUL_RETURN );
+
+	// Both problems are solved concurrently if each has its own context
+	std::ofstream( ( dir / "test.c" ).string( ).c_str( ) )
+		<< "#include \"acado_common.h\"\n#include <pthread.h>\n#include <stdio.h>\n\n"
+		<< "#if ACADO_USE_SOLVER_CONTEXT\n"
+		<< "ACADOcontext contexts[ 2 ];\n#define CONTEXT( k ) &contexts[ k ]\n"
+		<< "#define VARIABLES( k ) contexts[ k ].variables\n"
+		<< "#else\n"
+		<< "ACADOvariables acadoVariables;\nACADOworkspace acadoWorkspace;\n"
+		<< "#define CONTEXT( k )\n#define VARIABLES( k ) acadoVariables\n"
+		<< "#endif\n\n"
+		<< "real_t controls[ 2 ][ ACADO_N * ACADO_NU ];\n\n"
+		<< "void* solve( void* arg ) {\n"
+		<< "int i, iter, k = *(int*)arg;\n"
+		<< "acado_initializeSolver( CONTEXT( k ) );\n"
+		<< "for (i = 0; i < ACADO_NX * (ACADO_N + 1); ++i) VARIABLES( k ).x[ i ] = 0.0;\n"
+		<< "for (i = 0; i < ACADO_NU * ACADO_N; ++i) VARIABLES( k ).u[ i ] = 0.0;\n"
+		<< "for (i = 0; i < ACADO_NY * ACADO_N; ++i) VARIABLES( k ).y[ i ] = 0.0;\n"
+		<< "for (i = 0; i < ACADO_NYN; ++i) VARIABLES( k ).yN[ i ] = 0.0;\n"
+		<< "for (i = 0; i < ACADO_NX; ++i) VARIABLES( k ).x0[ i ] = 0.5 * (k + 1) * (i + 1);\n"
+		<< "for (iter = 0; iter < 200; ++iter) {\n"
+		<< "acado_preparationStep( CONTEXT( k ) );\n"
+		<< "acado_feedbackStep( CONTEXT( k ) );\n}\n"
+		<< "for (i = 0; i < ACADO_N * ACADO_NU; ++i) controls[ k ][ i ] = VARIABLES( k ).u[ i ];\n"
+		<< "return 0;\n}\n\n"
+		<< "int main() {\nint i, k[] = {0, 1};\n"
+		<< "#if ACADO_USE_SOLVER_CONTEXT\n"
+		<< "pthread_t threads[ 2 ];\n"
+		<< "for (i = 0; i < 2; ++i) pthread_create( &threads[ i ], 0, solve, &k[ i ] );\n"
+		<< "for (i = 0; i < 2; ++i) pthread_join( threads[ i ], 0 );\n"
+		<< "#else\n"
+		<< "for (i = 0; i < 2; ++i) solve( &k[ i ] );\n"
+		<< "#endif\n"
+		<< "for (i = 0; i < 2 * ACADO_N * ACADO_NU; ++i) printf(\"%.16e\\n\", controls[ i / (ACADO_N * ACADO_NU) ][ i % (ACADO_N * ACADO_NU) ]);\n"
+		<< "return 0;\n}\n";
+
+	// The embedded qpOASES of the source tree
+	boost::filesystem::path qpoases = boost::filesystem::path( __FILE__ ).parent_path( ).parent_path( ) /
+			"external_packages" / "qpoases";
+
+	std::string files = "test.c acado_solver.c acado_integrator.c acado_qpoases_interface.cpp";
+	const char* qpoasesFiles[] = {"Bounds", "Constraints", "CyclingManager", "Indexlist",
+			"MessageHandling", "QProblem", "QProblemB", "SubjectTo", "Utils"};
+	for (unsigned i = 0; i < sizeof( qpoasesFiles ) / sizeof( qpoasesFiles[ 0 ] ); ++i)
+		files += " " + ( qpoases / "SRC" / ( std::string( qpoasesFiles[ i ] ) + ".cpp" ) ).string( );
+
+	std::string flags = "-I. -I" + qpoases.string( ) + " -I" + ( qpoases / "INCLUDE" ).string( ) +
+			" -I" + ( qpoases / "SRC" ).string( ) + " -pthread -lstdc++";
+
+	bool success = buildAndRun( dir, files, flags, controls );
+	boost::filesystem::remove_all( dir );
+
+	BOOST_REQUIRE_MESSAGE( success == true, "solver context " << useSolverContext );
+}
+
+BOOST_AUTO_TEST_CASE( solver_context_threads )
+{
+	std::vector< double > global, contexts;
+
+	runExportedSolver( false, global );
+	runExportedSolver( true, contexts );
+
+	BOOST_REQUIRE_EQUAL( global.size(), 20u );
+	BOOST_REQUIRE_EQUAL( contexts.size(), global.size() );
+
+	for (unsigned i = 0; i < global.size(); ++i)
+		BOOST_CHECK_SMALL( contexts[ i ] - global[ i ], 1e-12 );
+
+	// The problems differ, the bounds are active at their beginning
+	BOOST_CHECK( std::fabs( global[ 2 ] - global[ 12 ] ) > 1e-3 );
+	BOOST_CHECK_SMALL( global[ 0 ] + 1.0, 1e-9 );
+	BOOST_CHECK_SMALL( global[ 10 ] + 1.0, 1e-9 );
+}
+
+/** Exports an RK4 integrator for two decoupled pendulums and returns the
+ *  states and sensitivities after one integration. If coupled, each pendulum
+ *  also depends on the other one through the control eps, which is zero at
+ *  run time. The sensitivities are then structurally dense. */
+static void runExportedIntegrator( bool coupled, std::vector< double >& result )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState p1, v1, p2, v2;
+	Control u1, u2, eps;
+
+	DifferentialEquation f;
+	if ( coupled == true )
+	{
+		f << dot( p1 ) == v1 + eps*( p2 + v2 );
+		f << dot( v1 ) == u1 - 0.5*sin( p1 );
+		f << dot( p2 ) == v2 + eps*( p1 + v1 );
+		f << dot( v2 ) == u2 - p2*v2 + eps;
+	}
+	else
+	{
+		f << dot( p1 ) == v1;
+		f << dot( v1 ) == u1 - 0.5*sin( p1 );
+		f << dot( p2 ) == v2;
+		f << dot( v2 ) == u2 - p2*v2 + eps;
+	}
+
+	SIMexport sim( 1, 0.5 );
+	sim.setModel( f );
+	sim.set( INTEGRATOR_TYPE, INT_RK4 );
+	sim.set( NUM_INTEGRATOR_STEPS, 5 );
+	sim.set( GENERATE_MAKE_FILE, NO );
+
+	boost::filesystem::path dir = createTemporaryDirectory( );
+	BOOST_REQUIRE( sim.exportCode( dir.string() ) == SUCCESSFUL_RETURN );
+
+	// rk_eta holds the states, their sensitivities w.r.t. states and controls, and the controls
+	std::ofstream( ( dir / "test.c" ).string( ).c_str( ) )
+		<< "#include \"acado_common.h\"\n#include <stdio.h>\n\n"
+		<< "ACADOworkspace acadoWorkspace;\n\n"
+		<< "int main() {\n"
+		<< "int i, dim = ACADO_NX * (1 + ACADO_NX + ACADO_NU);\n"
+		<< "real_t x[ ACADO_NX * (1 + ACADO_NX + ACADO_NU) + ACADO_NU ] = {0.3, -0.2, 0.8, 0.1};\n"
+		<< "for (i = 0; i < ACADO_NX; ++i) x[ ACADO_NX + i * ACADO_NX + i ] = 1.0;\n"
+		<< "x[ dim ] = 0.4;\nx[ dim + 1 ] = -0.6;\nx[ dim + 2 ] = 0.0;\n"
+		<< "acado_integrate( x, 1 );\n"
+		<< "for (i = 0; i < dim; ++i) printf(\"%.16e\\n\", x[ i ]);\n"
+		<< "return 0;\n}\n";
+
+	// Only the decoupled model propagates compressed sensitivities
+	std::ifstream integrator( ( dir / "acado_integrator.c" ).string( ).c_str( ) );
+	std::string code( ( std::istreambuf_iterator< char >( integrator ) ), std::istreambuf_iterator< char >( ) );
+	BOOST_CHECK_EQUAL( code.find( "rk_diffsSparse" ) == std::string::npos, coupled );
+
+	bool success = buildAndRun( dir, "test.c acado_integrator.c", "-I.", result );
+	boost::filesystem::remove_all( dir );
+
+	BOOST_REQUIRE_MESSAGE( success == true, "coupled " << coupled );
+}
+
+BOOST_AUTO_TEST_CASE( sparse_integrator_sensitivities )
+{
+	std::vector< double > sparse, dense;
+
+	runExportedIntegrator( false, sparse );
+	runExportedIntegrator( true, dense );
+
+	const unsigned NX = 4, NU = 3;
+	BOOST_REQUIRE_EQUAL( sparse.size(), NX * (1 + NX + NU) );
+	BOOST_REQUIRE_EQUAL( dense.size(), sparse.size() );
+
+	// All entries agree, except the sensitivities w.r.t. eps of the coupled states
+	for (unsigned i = 0; i < sparse.size(); ++i)
+	{
+		bool epsSensitivity = i >= NX * (1 + NX) && ( i - NX * (1 + NX) ) % NU == 2;
+		if ( epsSensitivity == false )
+			BOOST_CHECK_SMALL( sparse[ i ] - dense[ i ], 1e-14 );
+	}
+
+	// The pendulums do not influence each other
+	for (unsigned i = 0; i < 2; ++i)
+		for (unsigned j = 2; j < 4; ++j)
+		{
+			BOOST_CHECK_EQUAL( sparse[ NX + i * NX + j ], 0.0 );
+			BOOST_CHECK_EQUAL( sparse[ NX + j * NX + i ], 0.0 );
+		}
+	BOOST_CHECK_EQUAL( sparse[ NX * (1 + NX) + 2 * NU + 0 ], 0.0 );
+	BOOST_CHECK_EQUAL( sparse[ NX * (1 + NX) + 0 * NU + 1 ], 0.0 );
+}
@@ -0,0 +1,119 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE CollocationMethodTests
+#include <boost/test/unit_test.hpp>
+
+#include "test_problems.hpp"
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( linear_model_and_sensitivities )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x;
+	Control u;
+
+	DifferentialEquation f;
+	f << dot(x) == -2.0*x + u;
+
+	const double h = 0.5;
+	Grid grid( 0.0,1.0,3 );
+
+	VariablesGrid xGrid( 1,grid ), uGrid( 1,grid );
+	xGrid( 0,0 ) = 1.0;  uGrid( 0,0 ) = 0.3;
+	xGrid( 1,0 ) = 0.5;  uGrid( 1,0 ) = 0.7;
+	xGrid( 2,0 ) = 0.2;  uGrid( 2,0 ) = 0.0;
+
+	// all nodes are given, so the intervals are independent
+	xGrid.disableAutoInit( );
+	uGrid.disableAutoInit( );
+
+	for( int scheme = CS_RADAU_IIA; scheme <= CS_GAUSS_LEGENDRE; ++scheme )
+	{
+		CollocationMethod collocation;
+		collocation.set( COLLOCATION_SCHEME,scheme );
+		collocation.set( NUM_COLLOCATION_NODES,3 );
+		collocation.set( NUM_INTEGRATOR_STEPS,4 );
+
+		BOOST_REQUIRE( collocation.addStage( f,grid ) == SUCCESSFUL_RETURN );
+
+		OCPiterate iter( &xGrid,0,0,&uGrid,0 );
+		BOOST_REQUIRE( collocation.evaluate( iter ) == SUCCESSFUL_RETURN );
+
+		BlockMatrix residuum;
+		collocation.getResiduum( residuum );
+
+		BOOST_REQUIRE( collocation.setUnitForwardSeed( ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( collocation.evaluateSensitivities( ) == SUCCESSFUL_RETURN );
+
+		BlockMatrix D;
+		collocation.getForwardSensitivities( D );
+
+		// compare with the exact solution of the interval (Radau IIA is of order 2s-1)
+		for( uint i=0; i<2; ++i )
+		{
+			double xEnd = xGrid( i,0 )*exp( -2.0*h ) + 0.5*uGrid( i,0 )*( 1.0-exp( -2.0*h ) );
+
+			DMatrix r, Dx, Du;
+			residuum.getSubBlock( i,0,r );
+			D.getSubBlock( i,0,Dx );
+			D.getSubBlock( i,3,Du );
+
+			BOOST_CHECK_SMALL( r( 0,0 ) - ( xEnd - xGrid( i+1,0 ) ),1e-7 );
+			BOOST_CHECK_SMALL( Dx( 0,0 ) - exp( -2.0*h ),1e-7 );
+			BOOST_CHECK_SMALL( Du( 0,0 ) - 0.5*( 1.0-exp( -2.0*h ) ),1e-7 );
+		}
+	}
+}
+
+static void solveRocket( int discretizationType, int nThreads, int hessianApproximation,
+						 RocketSolution& solution )
+{
+	RocketSettings settings;
+	settings.nIntervals = 10;
+	settings.freeEndTime = true;
+	settings.drag = 0.2;
+	settings.vMin = -0.1;
+	settings.vMax = 1.7;
+
+	settings.intOptions[ DISCRETIZATION_TYPE ] = discretizationType;
+	settings.intOptions[ HESSIAN_APPROXIMATION ] = hessianApproximation;
+	settings.intOptions[ NUM_THREADS ] = nThreads;
+	settings.intOptions[ NUM_INTEGRATOR_STEPS ] = 3;
+	settings.doubleOptions[ INTEGRATOR_TOLERANCE ] = 1e-10;
+
+	solveRocket( settings,solution );
+}
+
+BOOST_AUTO_TEST_CASE( rocket_matches_multiple_shooting )
+{
+	RocketSolution shooting, collocation;
+
+	solveRocket( MULTIPLE_SHOOTING,1,BLOCK_BFGS_UPDATE,shooting );
+	solveRocket( COLLOCATION,1,BLOCK_BFGS_UPDATE,collocation );
+
+	BOOST_CHECK_SMALL( shooting.endTime - collocation.endTime,1e-4 );
+
+	BOOST_REQUIRE( shooting.controls.getNumPoints( ) == collocation.controls.getNumPoints( ) );
+	for( uint i=0; i<shooting.controls.getNumPoints( ); ++i )
+		BOOST_CHECK_SMALL( shooting.controls( i,0 ) - collocation.controls( i,0 ),1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( rocket_threads_and_exact_hessian )
+{
+	RocketSolution single, multi, exact;
+
+	solveRocket( COLLOCATION,1,BLOCK_BFGS_UPDATE,single );
+	solveRocket( COLLOCATION,3,BLOCK_BFGS_UPDATE,multi );
+	solveRocket( COLLOCATION,2,EXACT_HESSIAN,exact );
+
+	// the intervals do not depend on each other, whatever the number of threads
+	BOOST_CHECK_EQUAL( single.endTime,multi.endTime );
+	for( uint i=0; i<single.controls.getNumPoints( ); ++i )
+		BOOST_CHECK_EQUAL( single.controls( i,0 ),multi.controls( i,0 ) );
+
+	BOOST_CHECK_SMALL( single.endTime - exact.endTime,1e-6 );
+}
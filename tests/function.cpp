@@ -0,0 +1,172 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE FunctionTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/function/function.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+
+#include <vector>
+
+USING_NAMESPACE_ACADO
+
+/* fills the variables of the i-th test point; the intermediate states are overwritten */
+static std::vector< double > testPoint( int nV, int i )
+{
+	std::vector< double > x( nV+1 );
+	for( int j=0; j<nV+1; ++j )
+		x[j] = 0.3 + 0.1*j - 0.05*i*j + 0.2*i;
+	return x;
+}
+
+static void checkClose( const std::vector< double >& a, const std::vector< double >& b )
+{
+	BOOST_REQUIRE_EQUAL( a.size( ),b.size( ) );
+	for( uint i=0; i<a.size( ); ++i )
+		BOOST_CHECK_SMALL( a[i] - b[i],1e-12 );
+}
+
+BOOST_AUTO_TEST_CASE( tape_matches_tree )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x, y;
+	Control u;
+	IntermediateState a, b;
+
+	a = x*y + sin(u);
+	b = exp(a) - x*x;
+
+	Function tape, tree;
+	tape << a*b + y;
+	tape << b/(1.0 + u*u);
+	tape << cos(a)*x + pow(y,3);
+
+	tree = tape;
+	BOOST_REQUIRE( tree.setTapeEnabled( BT_FALSE ) == SUCCESSFUL_RETURN );
+
+	const int nV  = tape.getNumberOfVariables( );
+	const int dim = tape.getDim( );
+
+	for( int i=0; i<4; ++i )
+	{
+		std::vector< double > xTape = testPoint( nV,i ), xTree = xTape;
+		std::vector< double > fTape( dim ), fTree( dim );
+
+		BOOST_REQUIRE( tape.evaluate( i,&xTape[0],&fTape[0] ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( tree.evaluate( i,&xTree[0],&fTree[0] ) == SUCCESSFUL_RETURN );
+		checkClose( fTape,fTree );
+
+		// the intermediate states are written back into the arguments
+		checkClose( xTape,xTree );
+	}
+
+	// derivatives at the stored positions, in reverse order
+	for( int i=3; i>=0; --i )
+	{
+		std::vector< double > seed = testPoint( nV,i+7 ), seedTree = seed;
+		std::vector< double > dfTape( dim ), dfTree( dim );
+
+		BOOST_REQUIRE( tape.AD_forward( i,&seed[0],&dfTape[0] ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( tree.AD_forward( i,&seedTree[0],&dfTree[0] ) == SUCCESSFUL_RETURN );
+		checkClose( dfTape,dfTree );
+
+		std::vector< double > bseed( dim );
+		for( int j=0; j<dim; ++j )
+			bseed[j] = 1.0 - 0.4*j;
+
+		std::vector< double > dxTape( nV+1,0.0 ), dxTree( nV+1,0.0 );
+		BOOST_REQUIRE( tape.AD_backward( i,&bseed[0],&dxTape[0] ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( tree.AD_backward( i,&bseed[0],&dxTree[0] ) == SUCCESSFUL_RETURN );
+		checkClose( dxTape,dxTree );
+
+		// second order derivatives run on the tree, whose buffers are refilled from the tape
+		std::vector< double > bseed2( dim,0.0 );
+		std::vector< double > d1Tape( nV+1,0.0 ), d1Tree( nV+1,0.0 );
+		std::vector< double > d2Tape( nV+1,0.0 ), d2Tree( nV+1,0.0 );
+		BOOST_REQUIRE( tape.AD_backward2( i,&bseed[0],&bseed2[0],&d1Tape[0],&d2Tape[0] ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( tree.AD_backward2( i,&bseed[0],&bseed2[0],&d1Tree[0],&d2Tree[0] ) == SUCCESSFUL_RETURN );
+		checkClose( d1Tape,d1Tree );
+		checkClose( d2Tape,d2Tree );
+	}
+
+	// batched evaluation writes the same intermediate results
+	const int nPoints = 11, ldx = nV+1;
+	std::vector< double > X( nPoints*ldx ), Ftape( nPoints*dim ), Ftree( nPoints*dim );
+	for( int i=0; i<nPoints; ++i )
+	{
+		std::vector< double > xi = testPoint( nV,i+3 );
+		std::copy( xi.begin( ),xi.end( ),X.begin( ) + i*ldx );
+	}
+
+	BOOST_REQUIRE( tape.evaluateBatch( 2,&X[0],nPoints,ldx,&Ftape[0] ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( tree.evaluateBatch( 2,&X[0],nPoints,ldx,&Ftree[0] ) == SUCCESSFUL_RETURN );
+	checkClose( Ftape,Ftree );
+
+	std::vector< double > seed = testPoint( nV,5 );
+	std::vector< double > dfTape( dim ), dfTree( dim );
+	BOOST_REQUIRE( tape.AD_forward( 2+nPoints-1,&seed[0],&dfTape[0] ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( tree.AD_forward( 2+nPoints-1,&seed[0],&dfTree[0] ) == SUCCESSFUL_RETURN );
+	checkClose( dfTape,dfTree );
+}
+
+BOOST_AUTO_TEST_CASE( batch_matches_points )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x, y;
+	Control u;
+	IntermediateState a;
+
+	a = x*u - y;
+
+	Function f;
+	f << exp(a) + x;
+	f << a*a*y;
+
+	const int nV  = f.getNumberOfVariables( );
+	const int dim = f.getDim( );
+	const int nPoints = 7, ldx = nV+3;
+
+	std::vector< double > X( nPoints*ldx,0.0 );
+	for( int i=0; i<nPoints; ++i )
+	{
+		std::vector< double > xi = testPoint( nV,i );
+		std::copy( xi.begin( ),xi.end( ),X.begin( ) + i*ldx );
+	}
+
+	// with the tape and with the evaluation on the tree
+	for( int k=0; k<2; ++k )
+	{
+		Function batch = f, points = f;
+		if ( k == 1 )
+		{
+			BOOST_REQUIRE( batch.setTapeEnabled( BT_FALSE ) == SUCCESSFUL_RETURN );
+			BOOST_REQUIRE( points.setTapeEnabled( BT_FALSE ) == SUCCESSFUL_RETURN );
+		}
+
+		std::vector< double > Fbatch( nPoints*dim );
+		BOOST_REQUIRE( batch.evaluateBatch( 1,&X[0],nPoints,ldx,&Fbatch[0] ) == SUCCESSFUL_RETURN );
+
+		for( int i=0; i<nPoints; ++i )
+		{
+			std::vector< double > xi( X.begin( ) + i*ldx,X.begin( ) + i*ldx + nV+1 );
+			std::vector< double > fi( dim );
+			BOOST_REQUIRE( points.evaluate( 1+i,&xi[0],&fi[0] ) == SUCCESSFUL_RETURN );
+			checkClose( fi,std::vector< double >( Fbatch.begin( ) + i*dim,Fbatch.begin( ) + (i+1)*dim ) );
+		}
+
+		// both stored the same intermediate results
+		for( int i=0; i<nPoints; ++i )
+		{
+			std::vector< double > seed = testPoint( nV,i+2 ), seed2 = seed;
+			std::vector< double > dfBatch( dim ), dfPoints( dim );
+			BOOST_REQUIRE( batch.AD_forward( 1+i,&seed[0],&dfBatch[0] ) == SUCCESSFUL_RETURN );
+			BOOST_REQUIRE( points.AD_forward( 1+i,&seed2[0],&dfPoints[0] ) == SUCCESSFUL_RETURN );
+			checkClose( dfBatch,dfPoints );
+		}
+	}
+}
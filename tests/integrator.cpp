@@ -0,0 +1,160 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE IntegratorTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_integrators.hpp>
+
+USING_NAMESPACE_ACADO
+
+/* differential states and their sensitivities w.r.t. the initial states at the end time */
+struct IntegrationResult
+{
+	DVector x;
+	DMatrix forward;		/* column i: forward sensitivity in direction e_i */
+	DMatrix backward;		/* row i: backward sensitivity of component i */
+	DMatrix second;			/* row i: second order sensitivity in direction e_i */
+};
+
+static void integrate( Integrator& integrator, const DVector& x0, const DVector& xa0,
+					   const DVector& p, const DVector& u, IntegrationResult& result )
+{
+	const uint nx = x0.getDim( );
+
+	integrator.set( INTEGRATOR_TOLERANCE,1e-10 );
+	integrator.set( ABSOLUTE_TOLERANCE,1e-12 );
+
+	BOOST_REQUIRE( integrator.freezeAll( ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( integrator.integrate( 0.0,1.0,x0,xa0,p,u ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( integrator.getX( result.x ) == SUCCESSFUL_RETURN );
+
+	result.forward.init( nx,nx );
+	result.backward.init( nx,nx );
+	result.second.init( nx,nx );
+
+	for( uint i=0; i<nx; ++i )
+	{
+		DVector seed = DVector::Zero( nx ), Dx;
+		seed( i ) = 1.0;
+
+		BOOST_REQUIRE( integrator.setForwardSeed( 1,seed ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( integrator.integrateSensitivities( ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( integrator.getForwardSensitivities( Dx,1 ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( Dx.getDim( ) == nx );
+		result.forward.col( i ) = Dx;
+
+		// forward over backward with the weights 1, 2, ... of the components
+		DVector weights( nx ), Dx2( nx ), Dp2, Du2, Dw2;
+		for( uint j=0; j<nx; ++j )
+			weights( j ) = j+1.0;
+
+		BOOST_REQUIRE( integrator.setBackwardSeed( 2,weights ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( integrator.integrateSensitivities( ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( integrator.getBackwardSensitivities( Dx2,Dp2,Du2,Dw2,2 ) == SUCCESSFUL_RETURN );
+		result.second.row( i ) = Dx2.transpose( );
+
+		BOOST_REQUIRE( integrator.deleteAllSeeds( ) == SUCCESSFUL_RETURN );
+	}
+
+	for( uint i=0; i<nx; ++i )
+	{
+		DVector seed = DVector::Zero( nx ), Dx( nx ), Dp, Du, Dw;
+		seed( i ) = 1.0;
+
+		BOOST_REQUIRE( integrator.setBackwardSeed( 1,seed ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( integrator.integrateSensitivities( ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( integrator.getBackwardSensitivities( Dx,Dp,Du,Dw,1 ) == SUCCESSFUL_RETURN );
+		result.backward.row( i ) = Dx.transpose( );
+
+		BOOST_REQUIRE( integrator.deleteAllSeeds( ) == SUCCESSFUL_RETURN );
+	}
+}
+
+static void checkClose( const IntegrationResult& a, const IntegrationResult& b, double tol )
+{
+	BOOST_CHECK_SMALL( (a.x - b.x).norm( ),tol );
+	BOOST_CHECK_SMALL( (a.forward - b.forward).norm( ),tol );
+	BOOST_CHECK_SMALL( (a.backward - b.backward).norm( ),tol );
+	BOOST_CHECK_SMALL( (a.second - b.second).norm( ),tol );
+}
+
+BOOST_AUTO_TEST_CASE( bdf_sparse_lu_matches_dense )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	// chain of coupled states, the algebraic states couple neighbours
+	DifferentialState x1, x2, x3, x4;
+	AlgebraicState z1, z2;
+	Control u;
+	Parameter p;
+
+	DifferentialEquation f;
+	f << dot(x1) == -p*x1 + z1;
+	f << dot(x2) == x1 - x2*x2 + u;
+	f << dot(x3) == -x3 + z2*x2;
+	f << dot(x4) == x3 - 0.5*x4;
+	f << 0 == z1 + z1*z1*z1 - x2;
+	f << 0 == 2.0*z2 - sin(x3) - x4;
+
+	DVector x0( 4 ), xa0( 2 ), pp( 1 ), uu( 1 );
+	x0( 0 ) = 1.0;  x0( 1 ) = 0.5;  x0( 2 ) = -0.3;  x0( 3 ) = 0.2;
+	xa0( 0 ) = 0.4;  xa0( 1 ) = -0.1;
+	pp( 0 ) = 0.7;
+	uu( 0 ) = 0.2;
+
+	IntegrationResult dense, sparse;
+
+	IntegratorBDF denseIntegrator( f );
+	denseIntegrator.set( LINEAR_ALGEBRA_SOLVER,HOUSEHOLDER_METHOD );
+	integrate( denseIntegrator,x0,xa0,pp,uu,dense );
+
+	IntegratorBDF sparseIntegrator( f );
+	sparseIntegrator.set( LINEAR_ALGEBRA_SOLVER,SPARSE_LU );
+	integrate( sparseIntegrator,x0,xa0,pp,uu,sparse );
+
+	checkClose( dense,sparse,1e-8 );
+
+	// the end point is consistent, i.e. the algebraic states are converged
+	DVector za;
+	BOOST_REQUIRE( sparseIntegrator.getXA( za ) == SUCCESSFUL_RETURN );
+	BOOST_CHECK_SMALL( za( 0 ) + pow( za( 0 ),3 ) - sparse.x( 1 ),1e-8 );
+}
+
+BOOST_AUTO_TEST_CASE( jacobian_coloring_matches_uncolored )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	// tridiagonal Jacobian, i.e. three colors for six columns
+	DifferentialState x1, x2, x3, x4, x5, x6;
+	Control u;
+
+	DifferentialEquation f;
+	f << dot(x1) == -x1 + 0.5*x2*x2 + u;
+	f << dot(x2) == x1*x3 - x2;
+	f << dot(x3) == sin(x2) - x3 + 0.2*x4;
+	f << dot(x4) == x3 - x4*x5;
+	f << dot(x5) == exp(-x4) - 2.0*x5 + x6;
+	f << dot(x6) == x5*x5 - x6;
+
+	DVector x0( 6 ), uu( 1 );
+	for( uint i=0; i<6; ++i )
+		x0( i ) = 0.1*(i+1.0);
+	uu( 0 ) = 0.3;
+
+	IntegrationResult colored, uncolored;
+
+	IntegratorRK45 rk( f ), rkUncolored( f );
+	rkUncolored.set( JACOBIAN_COLORING,BT_FALSE );
+	integrate( rk,x0,emptyVector,emptyVector,uu,colored );
+	integrate( rkUncolored,x0,emptyVector,emptyVector,uu,uncolored );
+	checkClose( colored,uncolored,1e-10 );
+
+	IntegratorBDF bdf( f ), bdfUncolored( f );
+	bdfUncolored.set( JACOBIAN_COLORING,BT_FALSE );
+	integrate( bdf,x0,emptyVector,emptyVector,uu,colored );
+	integrate( bdfUncolored,x0,emptyVector,emptyVector,uu,uncolored );
+	checkClose( colored,uncolored,1e-8 );
+}
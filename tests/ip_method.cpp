@@ -0,0 +1,68 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE IPmethodTests
+#include <boost/test/unit_test.hpp>
+
+#include "test_problems.hpp"
+
+USING_NAMESPACE_ACADO
+
+/* rocket with state and control path constraints */
+static void solveRocket( int sparseQPsolution, RocketSolution& solution )
+{
+	RocketSettings settings;
+	settings.nIntervals = 40;
+	settings.uvBound = 1.5;
+	settings.intOptions[ SPARSE_QP_SOLUTION ] = sparseQPsolution;
+
+	solveRocket( settings,solution );
+}
+
+BOOST_AUTO_TEST_CASE( rocket_matches_condensing )
+{
+	RocketSolution condensing, ip;
+
+	solveRocket( CONDENSING,condensing );
+	solveRocket( SPARSE_SOLVER,ip );
+
+	BOOST_CHECK_SMALL( condensing.objective - ip.objective,1e-8 );
+
+	BOOST_REQUIRE( condensing.controls.getNumPoints( ) == ip.controls.getNumPoints( ) );
+	for( uint i=0; i<ip.controls.getNumPoints( ); ++i )
+		BOOST_CHECK_SMALL( condensing.controls( i,0 ) - ip.controls( i,0 ),1e-5 );
+
+	// the barrier continuation costs only a few extra iterations
+	BOOST_CHECK( ip.nIterations <= 2*condensing.nIterations + 10 );
+}
+
+BOOST_AUTO_TEST_CASE( barrier_tuning_is_an_option )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x;
+	Control u;
+
+	DifferentialEquation f;
+	f << dot(x) == u;
+
+	OCP ocp( 0.0,1.0,10 );
+	ocp.minimizeLagrangeTerm( x*x + u*u );
+	ocp.subjectTo( f );
+	ocp.subjectTo( AT_START, x == 1.0 );
+	ocp.subjectTo( -0.5 <= u <= 0.5 );
+
+	OptimizationAlgorithm algorithm( ocp );
+	algorithm.set( SPARSE_QP_SOLUTION,SPARSE_SOLVER );
+	algorithm.set( CONIC_SOLVER_BARRIER_TUNING,0.5 );
+	algorithm.set( PRINTLEVEL,NONE );
+	algorithm.set( PRINT_COPYRIGHT,BT_FALSE );
+
+	BOOST_REQUIRE( algorithm.solve( ) == SUCCESSFUL_RETURN );
+
+	// the unconstrained feedback would exceed the control bound at the start
+	VariablesGrid u_;
+	algorithm.getControls( u_ );
+	BOOST_CHECK_SMALL( u_( 0,0 ) + 0.5,1e-6 );
+}
@@ -0,0 +1,242 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE KalmanFilterTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_toolkit.hpp>
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( extended_discrete_linear )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x1, x2;
+	Control F;
+
+	const double h = 0.1;
+	DiscretizedDifferentialEquation f( h );
+	f << next(x1) == x1 + h*x2;
+	f << next(x2) == 0.9*x2 + h*F;
+
+	OutputFcn g;
+	g << x1;
+
+	DynamicSystem dynSys( f,g );
+
+	DMatrix Q( 2,2 ), R( 1,1 ), P( 2,2 );
+	Q(0,0) = 1e-3; Q(1,1) = 2e-3; Q(0,1) = Q(1,0) = 5e-4;
+	R(0,0) = 1e-2;
+	P(0,0) = 1.0;  P(1,1) = 0.5;
+
+	KalmanFilter ekf( dynSys,h,KFT_EXTENDED );
+	BOOST_REQUIRE( ekf.setProcessNoiseCovariance( Q ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( ekf.setMeasurementNoiseCovariance( R ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( ekf.setInitialCovariance( P ) == SUCCESSFUL_RETURN );
+
+	DVector x( 2 );
+	x(0) = 1.0;
+	x(1) = -0.5;
+	BOOST_REQUIRE( ekf.init( 0.0,x ) == SUCCESSFUL_RETURN );
+
+	// the textbook Kalman filter of the same model
+	DMatrix A( 2,2 ), C( 1,2 );
+	A(0,0) = 1.0; A(0,1) = h; A(1,1) = 0.9;
+	C(0,0) = 1.0;
+
+	DVector B( 2 ), y( 1 ), u( 1 ), xEst;
+	B(1) = h;
+
+	for( uint k=1; k<=20; ++k )
+	{
+		u(0) = sin( 0.3*k );
+		y(0) = 0.2*cos( 0.5*k );
+
+		x = A*x + B*u(0);
+		P = A*P*A.transpose() + Q;
+
+		DMatrix K = P*C.transpose() / ( (C*P*C.transpose())(0,0) + R(0,0) );
+		x += K*( y - C*x );
+		P = ( DMatrix::Identity( 2,2 ) - K*C )*P;
+
+		BOOST_REQUIRE( ekf.setU( u ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( ekf.step( k*h,y ) == SUCCESSFUL_RETURN );
+
+		DMatrix PEst;
+		ekf.getX( xEst );
+		ekf.getCovariance( PEst );
+
+		BOOST_CHECK_SMALL( (xEst - x).norm( ),1e-10 );
+		BOOST_CHECK_SMALL( (PEst - P).norm( ),1e-10 );
+	}
+}
+
+BOOST_AUTO_TEST_CASE( unscented_matches_extended_on_linear_model )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x1, x2;
+	Control F;
+
+	DifferentialEquation f;
+	f << dot(x1) == x2;
+	f << dot(x2) == -x1 - 0.3*x2 + F;
+
+	OutputFcn g;
+	g << x1 + 0.5*x2;
+
+	DynamicSystem dynSys( f,g );
+
+	DMatrix Q( 2,2 ), R( 1,1 ), P0( 2,2 );
+	Q(0,0) = Q(1,1) = 1e-3;
+	R(0,0) = 1e-2;
+	P0(0,0) = 1.0; P0(1,1) = 2.0; P0(0,1) = P0(1,0) = 0.3;
+
+	KalmanFilter ekf( dynSys,0.1,KFT_EXTENDED );
+	KalmanFilter ukf( dynSys,0.1,KFT_UNSCENTED );
+
+	KalmanFilter* filters[2] = { &ekf,&ukf };
+	DVector x0( 2 );
+	x0(0) = 0.5;
+	x0(1) = 0.0;
+
+	for( uint i=0; i<2; ++i )
+	{
+		filters[i]->set( INTEGRATOR_TOLERANCE,1e-10 );
+		filters[i]->setProcessNoiseCovariance( Q );
+		filters[i]->setMeasurementNoiseCovariance( R );
+		filters[i]->setInitialCovariance( P0 );
+		BOOST_REQUIRE( filters[i]->init( 0.0,x0 ) == SUCCESSFUL_RETURN );
+	}
+
+	DVector y( 1 ), u( 1 ), xE, xU;
+	DMatrix PE, PU;
+
+	for( uint k=1; k<=10; ++k )
+	{
+		u(0) = 0.1*k;
+		y(0) = 0.3 - 0.02*k;
+
+		for( uint i=0; i<2; ++i )
+		{
+			filters[i]->setU( u );
+			BOOST_REQUIRE( filters[i]->step( 0.1*k,y ) == SUCCESSFUL_RETURN );
+		}
+
+		ekf.getX( xE );
+		ukf.getX( xU );
+		ekf.getCovariance( PE );
+		ukf.getCovariance( PU );
+
+		BOOST_CHECK_SMALL( (xE - xU).norm( ),1e-6 );
+		BOOST_CHECK_SMALL( (PE - PU).norm( ),1e-6 );
+	}
+
+	// a copy carries on with the same estimate
+	KalmanFilter copy( ukf );
+	copy.getX( xE );
+	BOOST_CHECK_EQUAL( (xE - xU).norm( ),0.0 );
+}
+
+BOOST_AUTO_TEST_CASE( convergence_on_pendulum )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState phi, omega;
+
+	DifferentialEquation f;
+	f << dot(phi)   == omega;
+	f << dot(omega) == -sin(phi) - 0.2*omega;
+
+	OutputFcn g;
+	g << phi;
+
+	DynamicSystem dynSys( f,g );
+
+	DMatrix Q( 2,2 ), R( 1,1 ), P0( 2,2 );
+	Q(0,0) = Q(1,1) = 1e-6;
+	R(0,0) = 1e-4;
+	P0(0,0) = P0(1,1) = 1.0;
+
+	IntegratorRK45 simulator( f );
+
+	for( int type = KFT_EXTENDED; type <= KFT_UNSCENTED; ++type )
+	{
+		KalmanFilter filter( dynSys,0.1,(KalmanFilterType) type );
+		filter.setProcessNoiseCovariance( Q );
+		filter.setMeasurementNoiseCovariance( R );
+		filter.setInitialCovariance( P0 );
+
+		DVector xTrue( 2 ), xGuess( 2 ), y( 1 ), xEst;
+		xTrue(0) = 1.0;
+		xTrue(1) = 0.0;
+		xGuess.setZero( );
+
+		BOOST_REQUIRE( filter.init( 0.0,xGuess ) == SUCCESSFUL_RETURN );
+
+		for( uint k=1; k<=50; ++k )
+		{
+			BOOST_REQUIRE( simulator.integrate( 0.1*(k-1),0.1*k,xTrue ) == SUCCESSFUL_RETURN );
+			simulator.getX( xTrue );
+
+			y(0) = xTrue(0);
+			BOOST_REQUIRE( filter.step( 0.1*k,y ) == SUCCESSFUL_RETURN );
+		}
+
+		filter.getX( xEst );
+		BOOST_CHECK_SMALL( (xEst - xTrue).norm( ),1e-2 );
+	}
+}
+
+BOOST_AUTO_TEST_CASE( closed_loop_with_controller )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x, v;
+	Control F;
+
+	DifferentialEquation f;
+	f << dot(x) == v;
+	f << dot(v) == -0.5*v + F;
+
+	OutputFcn g;
+	g << x;
+
+	DynamicSystem dynSys( f,g );
+	Process process( dynSys,INT_RK45 );
+
+	DMatrix R( 1,1 ), P0( 2,2 );
+	R(0,0) = 1e-4;
+	P0(0,0) = P0(1,1) = 1.0;
+
+	KalmanFilter ekf( dynSys,0.1 );
+	ekf.setMeasurementNoiseCovariance( R );
+	ekf.setInitialCovariance( P0 );
+
+	DMatrix K( 1,2 );
+	K(0,0) = 2.0;
+	K(0,1) = 1.0;
+	LinearStateFeedback lqr( K,0.1 );
+
+	StaticReferenceTrajectory zeroReference;
+	Controller controller( lqr,ekf,zeroReference );
+
+	SimulationEnvironment sim( 0.0,5.0,process,controller );
+	sim.set( PRINTLEVEL,NONE );
+
+	DVector x0( 2 );
+	x0(0) = 1.0;
+	x0(1) = 0.0;
+
+	BOOST_REQUIRE( sim.init( x0 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( sim.run( ) == SUCCESSFUL_RETURN );
+
+	VariablesGrid y;
+	sim.getSampledProcessOutput( y );
+	BOOST_CHECK( fabs( y( y.getNumPoints()-1,0 ) ) < 0.1 );
+}
@@ -0,0 +1,95 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE LogRecordTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/user_interaction/log_record.hpp>
+
+#include <sstream>
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( ring_buffer )
+{
+	LogRecord record( LOG_AT_EACH_ITERATION );
+	record << LOG_KKT_TOLERANCE;
+	record << LOG_DIFFERENTIAL_STATES;
+
+	BOOST_REQUIRE( record.enableRingBuffer( LOG_DIFFERENTIAL_STATES, 4, 2, 1 ) == SUCCESSFUL_RETURN );
+
+	LogRecord::ItemHandle handle = record.getItemHandle( LOG_DIFFERENTIAL_STATES );
+	BOOST_REQUIRE( handle.isValid( ) );
+	BOOST_CHECK( record.getItemHandle( LOG_OBJECTIVE_VALUE ).isValid( ) == false );
+
+	DMatrix x( 2, 1 );
+	for (unsigned i = 0; i < 10; ++i)
+	{
+		x( 0 ) = i;
+		x( 1 ) = -1.0 * i;
+		BOOST_REQUIRE( record.setLast( handle, x ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( record.setLast( LOG_KKT_TOLERANCE, DMatrix( 0.5 * i ) ) == SUCCESSFUL_RETURN );
+	}
+
+	// ring buffer keeps the last four entries only, in chronological order
+	MatrixVariablesGrid states;
+	BOOST_REQUIRE( record.getAll( LOG_DIFFERENTIAL_STATES, states ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( states.getNumPoints( ) == 4 );
+	BOOST_CHECK_EQUAL( states.getMatrix( 0 )( 0 ), 6.0 );
+	BOOST_CHECK_EQUAL( states.getTime( 0 ), 7.0 );
+	BOOST_CHECK_EQUAL( states.getMatrix( 3 )( 1 ), -9.0 );
+	BOOST_CHECK_EQUAL( states.getLastTime( ), 10.0 );
+
+	DMatrix first, last;
+	record.getFirst( LOG_DIFFERENTIAL_STATES, first );
+	record.getLast( LOG_DIFFERENTIAL_STATES, last );
+	BOOST_CHECK_EQUAL( first( 0 ), 6.0 );
+	BOOST_CHECK_EQUAL( last( 0 ), 9.0 );
+
+	// other items keep growing
+	MatrixVariablesGrid kkt;
+	record.getAll( LOG_KKT_TOLERANCE, kkt );
+	BOOST_CHECK( kkt.getNumPoints( ) == 10 );
+
+	// binary dump: number of entries, then time, rows, cols and values per entry
+	std::stringstream dump( std::ios::in | std::ios::out | std::ios::binary );
+	BOOST_REQUIRE( record.dumpBinary( LOG_DIFFERENTIAL_STATES, dump ) == SUCCESSFUL_RETURN );
+
+	unsigned nEntries, nRows, nCols;
+	double t, v[ 2 ];
+	dump.read( (char*)&nEntries, sizeof( unsigned ) );
+	BOOST_REQUIRE( nEntries == 4 );
+	dump.read( (char*)&t, sizeof( double ) );
+	dump.read( (char*)&nRows, sizeof( unsigned ) );
+	dump.read( (char*)&nCols, sizeof( unsigned ) );
+	dump.read( (char*)v, 2 * sizeof( double ) );
+	BOOST_CHECK_EQUAL( t, 7.0 );
+	BOOST_CHECK( nRows == 2 && nCols == 1 );
+	BOOST_CHECK_EQUAL( v[ 0 ], 6.0 );
+	BOOST_CHECK_EQUAL( v[ 1 ], -6.0 );
+}
+
+BOOST_AUTO_TEST_CASE( log_at_end )
+{
+	LogRecord record( LOG_AT_END );
+	record << LOG_OBJECTIVE_VALUE;
+
+	for (unsigned i = 0; i < 5; ++i)
+		record.setLast( LOG_OBJECTIVE_VALUE, DMatrix( (double)i ), (double)i );
+
+	MatrixVariablesGrid values;
+	record.getAll( LOG_OBJECTIVE_VALUE, values );
+	BOOST_REQUIRE( values.getNumPoints( ) == 1 );
+	BOOST_CHECK_EQUAL( values.getMatrix( 0 )( 0 ), 4.0 );
+	BOOST_CHECK_EQUAL( values.getTime( 0 ), 4.0 );
+
+	// copies of a record share item handles
+	LogRecord copy( record );
+	copy.setLast( record.getItemHandle( LOG_OBJECTIVE_VALUE ), DMatrix( 7.0 ) );
+
+	DMatrix last;
+	copy.getLast( LOG_OBJECTIVE_VALUE, last );
+	BOOST_CHECK_EQUAL( last( 0 ), 7.0 );
+	record.getLast( LOG_OBJECTIVE_VALUE, last );
+	BOOST_CHECK_EQUAL( last( 0 ), 4.0 );
+}
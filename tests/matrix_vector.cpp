@@ -24,3 +24,90 @@ BOOST_AUTO_TEST_CASE( vector_ctors )
     BOOST_REQUIRE( d.getDim() == 2 );
     BOOST_REQUIRE( acadoIsEqual(d( 0 ), -10) && acadoIsEqual(d( 1 ), 99) );
 }
+
+static DMatrix assembleBlockMatrix( const BlockMatrix& M, const unsigned* rowDims, const unsigned* colDims )
+{
+	unsigned nRows = 0, nCols = 0;
+	for (unsigned i = 0; i < M.getNumRows(); ++i)
+		nRows += rowDims[ i ];
+	for (unsigned j = 0; j < M.getNumCols(); ++j)
+		nCols += colDims[ j ];
+
+	DMatrix result(nRows, nCols);
+	DMatrix block;
+
+	unsigned rowOffset = 0;
+	for (unsigned i = 0; i < M.getNumRows(); rowOffset += rowDims[ i++ ])
+	{
+		unsigned colOffset = 0;
+		for (unsigned j = 0; j < M.getNumCols(); colOffset += colDims[ j++ ])
+		{
+			M.getSubBlock(i, j, block, rowDims[ i ], colDims[ j ]);
+			result.block(rowOffset, colOffset, rowDims[ i ], colDims[ j ]) = block;
+		}
+	}
+
+	return result;
+}
+
+BOOST_AUTO_TEST_CASE( block_matrix_products )
+{
+	DMatrix A(2, 2), B(2, 3), C(2, 2);
+	A << 1, 2, 3, 4;
+	B << 1, 2, 3, 4, 5, 6;
+	C << 1, 2, 4, 5;
+
+	unsigned two[ 2 ] = {2, 2};
+	unsigned three[ 3 ] = {2, 3, 2};
+
+	//    ( 1  A )        ( 1  B  C )
+	// M: (      ),   N:  (         )
+	//    ( 0  1 )        ( 0  B  1 )
+	BlockMatrix M(2, 2), N(2, 3);
+	M.setIdentity(0, 0, 2); M.setDense(0, 1, A); M.setIdentity(1, 1, 2);
+	N.setIdentity(0, 0, 2); N.setDense(0, 1, B); N.setDense(0, 2, C);
+	N.setDense(1, 1, B); N.setIdentity(1, 2, 2);
+
+	DMatrix Md = assembleBlockMatrix(M, two, two);
+	DMatrix Nd = assembleBlockMatrix(N, two, three);
+
+	BlockMatrix MN = M * N;
+	BOOST_CHECK( assembleBlockMatrix(MN, two, three) == DMatrix(Md * Nd) );
+
+	// zero blocks are not stored, identity times identity stays an identity
+	BOOST_CHECK( MN.getNumRows(1, 0) == 0 );
+	DMatrix tmp;
+	MN.getSubBlock(0, 0, tmp);
+	BOOST_CHECK( tmp == DMatrix(DMatrix::Identity(2, 2)) );
+
+	BlockMatrix MTN = M ^ N;
+	BOOST_CHECK( assembleBlockMatrix(MTN, two, three) == DMatrix(Md.transpose() * Nd) );
+
+	// products into preallocated results reuse their memory
+	BlockMatrix result;
+	for (unsigned run = 0; run < 3; ++run)
+	{
+		M.multiply(N, result);
+		BOOST_CHECK( assembleBlockMatrix(result, two, three) == assembleBlockMatrix(MN, two, three) );
+		M.multiplyTransposed(N, result);
+		BOOST_CHECK( assembleBlockMatrix(result, two, three) == assembleBlockMatrix(MTN, two, three) );
+	}
+	M.multiply(M, M);
+	BOOST_CHECK( assembleBlockMatrix(M, two, two) == DMatrix(Md * Md) );
+
+	// element-wise operations
+	BlockMatrix D = MN - N;
+	BOOST_CHECK( assembleBlockMatrix(D, two, three) == DMatrix(Md * Nd - Nd) );
+	D += N;
+	BOOST_CHECK( assembleBlockMatrix(D, two, three) == assembleBlockMatrix(MN, two, three) );
+	D *= 2.0;
+	BOOST_CHECK( assembleBlockMatrix(D.transpose(), three, two) == DMatrix(2.0 * (Md * Nd).transpose()) );
+
+	// overwriting blocks with differently sized values
+	D.setDense(0, 0, DMatrix(2, 2));
+	D.setDense(0, 0, B);
+	D.addDense(1, 2, A);
+	BOOST_CHECK( D.getNumCols(0, 0) == 3 );
+	D.getSubBlock(1, 2, tmp);
+	BOOST_CHECK( tmp == DMatrix(A + DMatrix::Identity(2, 2) * 2.0) );
+}
@@ -0,0 +1,156 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE MonteCarloSimulationTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_toolkit.hpp>
+
+#include <stdio.h>
+
+USING_NAMESPACE_ACADO
+
+static void simulate( int nThreads, uint firstSeed, std::vector<VariablesGrid>& y,
+					  std::vector<VariablesGrid>& u, const char* fileName = 0 )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x, v;
+	Control F;
+
+	DifferentialEquation f;
+	f << dot(x) == v;
+	f << dot(v) == -0.5*v + F;
+
+	OutputFcn g;
+	g << x;
+	g << v;
+
+	DynamicSystem dynSys( f,g );
+
+	DVector mean( 2 ), variance( 2 );
+	mean.setZero( );
+	variance.setAll( 0.01 );
+	GaussianNoise noise( mean,variance );
+
+	Sensor sensor( 2 );
+	sensor.setOutputNoise( noise,0.1 );
+
+	Process process( dynSys,INT_RK45 );
+	process.setSensor( sensor );
+
+	DMatrix K( 1,2 );
+	K(0,0) = 2.0;
+	K(0,1) = 1.0;
+	LinearStateFeedback lqr( K,0.1 );
+
+	StaticReferenceTrajectory zeroReference;
+	Controller controller( lqr,zeroReference );
+
+	MonteCarloSimulation mc( 0.0,2.0,process,controller );
+	mc.set( NUM_THREADS,nThreads );
+	mc.set( PRINTLEVEL,NONE );
+
+	DVector x0( 2 );
+	for( uint i=0; i<5; ++i )
+	{
+		x0(0) = 1.0 + 0.1*i;
+		x0(1) = 0.0;
+		mc.addScenario( firstSeed+i,x0 );
+	}
+
+	BOOST_REQUIRE( mc.run( ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( mc.getNumScenarios( ) == 5 );
+
+	y.resize( 5 );
+	u.resize( 5 );
+	for( uint i=0; i<5; ++i )
+	{
+		BOOST_REQUIRE( mc.getSampledProcessOutput( i,y[i] ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( mc.getFeedbackControl( i,u[i] ) == SUCCESSFUL_RETURN );
+	}
+
+	if ( fileName != 0 )
+		BOOST_REQUIRE( mc.write( fileName ) == SUCCESSFUL_RETURN );
+}
+
+static bool isEqual( const VariablesGrid& a, const VariablesGrid& b )
+{
+	if ( a.getNumPoints( ) != b.getNumPoints( ) || a.getNumValues( ) != b.getNumValues( ) )
+		return false;
+
+	for( uint i=0; i<a.getNumPoints( ); ++i )
+	{
+		if ( acadoIsExactlyZero( a.getTime( i ) - b.getTime( i ) ) == BT_FALSE )
+			return false;
+
+		for( uint j=0; j<a.getNumValues( ); ++j )
+			if ( acadoIsExactlyZero( a( i,j ) - b( i,j ) ) == BT_FALSE )
+				return false;
+	}
+
+	return true;
+}
+
+BOOST_AUTO_TEST_CASE( reproducible_across_threads )
+{
+	std::vector<VariablesGrid> y1, u1, y3, u3;
+	simulate( 1,7,y1,u1 );
+	simulate( 3,7,y3,u3 );
+
+	for( uint i=0; i<5; ++i )
+	{
+		BOOST_CHECK( y1[i].getNumPoints( ) > 2 );
+		BOOST_CHECK( u1[i].getNumPoints( ) == y1[i].getNumPoints( ) );
+
+		BOOST_CHECK( isEqual( y1[i],y3[i] ) );
+		BOOST_CHECK( isEqual( u1[i],u3[i] ) );
+	}
+
+	// the scenarios draw from different streams
+	BOOST_CHECK( isEqual( y1[0],y1[1] ) == false );
+}
+
+BOOST_AUTO_TEST_CASE( seeds_and_file )
+{
+	std::vector<VariablesGrid> y1, u1, y2, u2;
+	simulate( 2,7,y1,u1,"monte_carlo_simulation.bin" );
+	simulate( 2,8,y2,u2 );
+
+	// same initial values, but other seeds
+	for( uint i=0; i<5; ++i )
+		BOOST_CHECK( isEqual( y1[i],y2[i] ) == false );
+
+	uint nRows = 0;
+	for( uint i=0; i<5; ++i )
+		nRows += y1[i].getNumPoints( );
+
+	FILE* file = fopen( "monte_carlo_simulation.bin","rb" );
+	BOOST_REQUIRE( file != 0 );
+
+	char tag[9] = { 0 };
+	uint dims[2] = { 0,0 };
+	BOOST_REQUIRE( fread( tag,sizeof(char),8,file ) == 8 );
+	BOOST_REQUIRE( fread( dims,sizeof(uint),2,file ) == 2 );
+
+	BOOST_CHECK( std::string( tag ) == "ACADOMC1" );
+	BOOST_CHECK( dims[0] == 6 );
+	BOOST_CHECK( dims[1] == nRows );
+
+	// the names of the columns (scenario, seed, time, y0, y1, u0) are followed by the data
+	uint namesLength = 6*sizeof(uint) + 8 + 4 + 4 + 2 + 2 + 2;
+
+	fseek( file,0,SEEK_END );
+	long size = ftell( file );
+	BOOST_CHECK( size == (long)( 8 + 2*sizeof(uint) + namesLength + 6*nRows*sizeof(double) ) );
+
+	// the time column of the first scenario starts at the start time
+	double t0 = -1.0;
+	fseek( file,8 + 2*sizeof(uint) + namesLength + nRows*sizeof(double)*2,SEEK_SET );
+	BOOST_REQUIRE( fread( &t0,sizeof(double),1,file ) == 1 );
+	BOOST_CHECK_EQUAL( t0,y1[0].getTime( 0 ) );
+
+	fclose( file );
+	remove( "monte_carlo_simulation.bin" );
+}
@@ -0,0 +1,95 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE MultiObjectiveAlgorithmTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_optimal_control.hpp>
+
+USING_NAMESPACE_ACADO
+
+static void solveFront( int generation, int nThreads, DMatrix& front )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	Parameter y1, y2;
+
+	NLP nlp;
+	nlp.minimize( 0, y1 );
+	nlp.minimize( 1, y2 );
+
+	nlp.subjectTo( 0.0 <= y1 <= 5.0 );
+	nlp.subjectTo( 0.0 <= y2 <= 5.2 );
+	nlp.subjectTo( 0.0 <= y2 - 5.0*exp(-y1) - 2.0*exp(-0.5*(y1-3.0)*(y1-3.0)) );
+
+	MultiObjectiveAlgorithm algorithm( nlp );
+
+	algorithm.set( PARETO_FRONT_GENERATION, generation );
+	algorithm.set( PARETO_FRONT_DISCRETIZATION, 11 );
+	algorithm.set( PARETO_FRONT_NUM_THREADS, nThreads );
+	algorithm.set( KKT_TOLERANCE, 1e-12 );
+	algorithm.set( PRINTLEVEL, NONE );
+
+	VariablesGrid init( 2, 0.0, 1.0, 2 );
+	init( 0, 0 ) = 5.0; init( 0, 1 ) = 0.3;
+	init( 1, 0 ) = 5.0; init( 1, 1 ) = 0.3;
+	algorithm.initializeParameters( init );
+
+	if (generation != PFG_WEIGHTED_SUM)
+	{
+		BOOST_REQUIRE( algorithm.solveSingleObjective( 1 ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( algorithm.solveSingleObjective( 0 ) == SUCCESSFUL_RETURN );
+		algorithm.initializeParameters( init );
+	}
+
+	BOOST_REQUIRE( algorithm.solve() == SUCCESSFUL_RETURN );
+
+	VariablesGrid paretoFront;
+	BOOST_REQUIRE( algorithm.getParetoFront( paretoFront ) == SUCCESSFUL_RETURN );
+
+	front.resize(paretoFront.getNumPoints(), 2);
+	for (unsigned i = 0; i < paretoFront.getNumPoints(); ++i)
+	{
+		front(i, 0) = paretoFront.getTime( i );
+		front(i, 1) = paretoFront(i, 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( weighted_sum_threads )
+{
+	DMatrix sequential, parallel;
+	solveFront(PFG_WEIGHTED_SUM, 1, sequential);
+	solveFront(PFG_WEIGHTED_SUM, 4, parallel);
+
+	BOOST_REQUIRE( sequential.rows() == 11 );
+	BOOST_REQUIRE( parallel.rows() == 11 );
+
+	// points are hotstarted from the same neighbours, whatever the number of threads
+	for (unsigned i = 0; i < 11; ++i)
+	{
+		BOOST_CHECK_EQUAL( sequential(i, 0), parallel(i, 0) );
+		BOOST_CHECK_EQUAL( sequential(i, 1), parallel(i, 1) );
+	}
+
+	// the front is ordered by the weights: the first objective goes down
+	// as the second one goes up
+	for (unsigned i = 1; i < 11; ++i)
+		BOOST_CHECK( sequential(i, 1) >= sequential(i - 1, 1) - 1e-8 );
+}
+
+BOOST_AUTO_TEST_CASE( normal_constraint_threads )
+{
+	DMatrix sequential, parallel;
+	solveFront(PFG_NORMALIZED_NORMAL_CONSTRAINT, 1, sequential);
+	solveFront(PFG_NORMALIZED_NORMAL_CONSTRAINT, 3, parallel);
+
+	BOOST_REQUIRE( sequential.rows() == parallel.rows() );
+	BOOST_CHECK( sequential.rows() == 11 );
+
+	for (unsigned i = 0; i < sequential.rows(); ++i)
+	{
+		BOOST_CHECK_EQUAL( sequential(i, 0), parallel(i, 0) );
+		BOOST_CHECK_EQUAL( sequential(i, 1), parallel(i, 1) );
+	}
+}
@@ -0,0 +1,70 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE OptionsTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_toolkit.hpp>
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( version_follows_modifications )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x;
+
+	DifferentialEquation f;
+	f << dot(x) == -x;
+
+	IntegratorRK45 integrator( f );
+	uint version = integrator.getOptionsVersion( );
+
+	// writing the stored value again keeps the version
+	int maxNumSteps;
+	BOOST_REQUIRE( integrator.get( MAX_NUM_INTEGRATOR_STEPS,maxNumSteps ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( integrator.set( MAX_NUM_INTEGRATOR_STEPS,maxNumSteps ) == SUCCESSFUL_RETURN );
+	BOOST_CHECK( integrator.getOptionsVersion( ) == version );
+
+	BOOST_REQUIRE( integrator.set( MAX_NUM_INTEGRATOR_STEPS,maxNumSteps+1 ) == SUCCESSFUL_RETURN );
+	BOOST_CHECK( integrator.getOptionsVersion( ) != version );
+	version = integrator.getOptionsVersion( );
+
+	// a copy has the same values, and the same version
+	IntegratorRK45 copy( integrator );
+	BOOST_CHECK( copy.getOptionsVersion( ) == version );
+
+	// versions are never handed out twice
+	BOOST_REQUIRE( copy.set( MAX_NUM_INTEGRATOR_STEPS,10 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( integrator.set( MAX_NUM_INTEGRATOR_STEPS,10 ) == SUCCESSFUL_RETURN );
+	BOOST_CHECK( copy.getOptionsVersion( ) != integrator.getOptionsVersion( ) );
+}
+
+BOOST_AUTO_TEST_CASE( integrator_reads_modified_options )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x;
+
+	DifferentialEquation f;
+	f << dot(x) == -x;
+
+	IntegratorRK45 integrator( f );
+	integrator.set( INTEGRATOR_PRINTLEVEL,NONE );
+
+	DVector x0( 1 ), xEnd;
+	x0(0) = 1.0;
+
+	BOOST_REQUIRE( integrator.integrate( 0.0,1.0,x0 ) == SUCCESSFUL_RETURN );
+	integrator.getX( xEnd );
+	BOOST_CHECK_SMALL( xEnd(0) - exp( -1.0 ),1e-5 );
+
+	// the step limit set after the first integration is respected
+	integrator.set( MAX_NUM_INTEGRATOR_STEPS,1 );
+	BOOST_CHECK( integrator.integrate( 0.0,1.0,x0 ) != SUCCESSFUL_RETURN );
+
+	integrator.set( MAX_NUM_INTEGRATOR_STEPS,1000 );
+	BOOST_CHECK( integrator.integrate( 0.0,1.0,x0 ) == SUCCESSFUL_RETURN );
+}
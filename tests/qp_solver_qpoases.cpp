@@ -0,0 +1,175 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE QPsolverQpOASESTests
+#include <boost/test/unit_test.hpp>
+
+#include "test_problems.hpp"
+#include <acado/bindings/acado_qpoases/qp_solver_qpoases_sparse.hpp>
+
+USING_NAMESPACE_ACADO
+
+/* solves a QP and a neighbouring one, returns both solutions */
+static void solveQPs( DenseQPsolver& solver, DVector x[2], DVector y[2], double objVal[2] )
+{
+	const uint nV = 4, nC = 3;
+
+	DMatrix H( nV,nV ), A( nC,nV );
+	H.setZero( );
+	A.setZero( );
+
+	H(0,0) = 2.0;  H(1,1) = 1.0;  H(2,2) = 1.5;  H(3,3) = 0.5;
+	H(0,1) = H(1,0) = 0.3;
+
+	A(0,0) = 1.0;  A(0,1) = 1.0;
+	A(1,2) = 1.0;  A(1,3) = -1.0;
+	A(2,0) = 1.0;  A(2,3) = 2.0;
+
+	DVector g( nV ), lb( nV ), ub( nV ), lbA( nC ), ubA( nC );
+	g(0) = -1.0;  g(1) = 2.0;  g(2) = -3.0;  g(3) = 1.0;
+	lb.setAll( -1.0 );
+	ub.setAll(  1.0 );
+	lbA(0) = 0.5;  lbA(1) = -0.2;  lbA(2) = -10.0;
+	ubA(0) = 2.0;  ubA(1) =  0.2;  ubA(2) =   0.8;
+
+	BOOST_REQUIRE( solver.init( nV,nC ) == SUCCESSFUL_RETURN );
+
+	for( uint k=0; k<2; ++k )
+	{
+		BOOST_REQUIRE( solver.solve( &H,&A,&g,&lb,&ub,&lbA,&ubA,100 ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( solver.getPrimalSolution( x[k] ) == SUCCESSFUL_RETURN );
+		BOOST_REQUIRE( solver.getDualSolution( y[k] ) == SUCCESSFUL_RETURN );
+		objVal[k] = solver.getObjVal( );
+
+		// neighbouring QP with changed matrices
+		g(1) = -2.0;
+		H(3,3) = 1.0;
+		A(2,1) = 0.5;
+	}
+}
+
+BOOST_AUTO_TEST_CASE( sparse_matches_dense )
+{
+	OptimizationAlgorithm options;
+	options.set( HOTSTART_QP,BT_TRUE );
+
+	QPsolver_qpOASES dense( &options );
+	QPsolver_qpOASES_sparse sparse( &options );
+
+	DVector xD[2], yD[2], xS[2], yS[2];
+	double fD[2], fS[2];
+
+	solveQPs( dense,xD,yD,fD );
+	solveQPs( sparse,xS,yS,fS );
+
+	for( uint k=0; k<2; ++k )
+	{
+		BOOST_CHECK_SMALL( (xD[k] - xS[k]).norm( ),1e-10 );
+		BOOST_CHECK_SMALL( (yD[k] - yS[k]).norm( ),1e-10 );
+		BOOST_CHECK_SMALL( fD[k] - fS[k],1e-10 );
+	}
+
+	// the QPs differ
+	BOOST_CHECK( (xD[0] - xD[1]).norm( ) > 1e-3 );
+
+	// a copy refers to its own matrices
+	QPsolver_qpOASES_sparse* copy = new QPsolver_qpOASES_sparse( sparse );
+	sparse.init( 1,0 );
+	BOOST_CHECK_SMALL( copy->getObjVal( ) - fS[1],1e-10 );
+
+	DMatrix H( 4,4 ), varD, varS;
+	H.setIdentity( );
+	BOOST_REQUIRE( dense.getVarianceCovariance( H,varD ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( copy->getVarianceCovariance( H,varS ) == SUCCESSFUL_RETURN );
+	BOOST_CHECK_SMALL( (varD - varS).norm( ),1e-10 );
+
+	delete copy;
+}
+
+BOOST_AUTO_TEST_CASE( sparse_uses_constraint_blocks )
+{
+	const uint nV = 4, nC = 3;
+
+	DenseCP cp;
+	BOOST_REQUIRE( cp.init( nV,nC ) == SUCCESSFUL_RETURN );
+
+	cp.H.setZero( );
+	cp.H(0,0) = 2.0;  cp.H(1,1) = 1.0;  cp.H(2,2) = 1.5;  cp.H(3,3) = 0.5;
+	cp.H(0,1) = cp.H(1,0) = 0.3;
+
+	cp.A.setZero( );
+	cp.A(0,0) = 1.0;  cp.A(0,1) = 1.0;
+	cp.A(1,2) = 1.0;  cp.A(1,3) = -1.0;
+	cp.A(2,0) = 1.0;  cp.A(2,3) = 2.0;
+
+	cp.g.init( nV );
+	cp.g(0) = -1.0;  cp.g(1) = 2.0;  cp.g(2) = -3.0;  cp.g(3) = 1.0;
+	cp.lb.init( nV );
+	cp.ub.init( nV );
+	cp.lb.setAll( -1.0 );
+	cp.ub.setAll(  1.0 );
+	cp.lbA.init( nC );
+	cp.ubA.init( nC );
+	cp.lbA(0) = 0.5;  cp.lbA(1) = -0.2;  cp.lbA(2) = -10.0;
+	cp.ubA(0) = 2.0;  cp.ubA(1) =  0.2;  cp.ubA(2) =   0.8;
+
+	DenseCP denseCP( cp );
+
+	// entries outside of the declared blocks are known to be zero, whatever is stored there
+	BOOST_REQUIRE( cp.addConstraintBlock( 0,0,1,2 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( cp.addConstraintBlock( 2,3,1,1 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( cp.addConstraintBlock( 1,2,1,2 ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( cp.addConstraintBlock( 2,0,1,1 ) == SUCCESSFUL_RETURN );
+	cp.A(1,0) = 5.0;
+
+	OptimizationAlgorithm options;
+	QPsolver_qpOASES dense( &options );
+	QPsolver_qpOASES_sparse sparse( &options );
+
+	BOOST_REQUIRE( dense.init( nV,nC ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( sparse.init( nV,nC ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( dense.solve( &denseCP ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( sparse.solve( &cp ) == SUCCESSFUL_RETURN );
+
+	DVector xD, yD, xS, yS;
+	dense.getPrimalSolution( xD );
+	dense.getDualSolution( yD );
+	sparse.getPrimalSolution( xS );
+	sparse.getDualSolution( yS );
+
+	BOOST_CHECK_SMALL( (xD - xS).norm( ),1e-10 );
+	BOOST_CHECK_SMALL( (yD - yS).norm( ),1e-10 );
+	BOOST_CHECK_SMALL( dense.getObjVal( ) - sparse.getObjVal( ),1e-10 );
+}
+
+static void solveRocket( int qpSolver, double uvBound, RocketSolution& solution )
+{
+	RocketSettings settings;
+	settings.uvBound = uvBound;
+	settings.intOptions[ QP_SOLVER ] = qpSolver;
+	settings.intOptions[ HOTSTART_QP ] = BT_TRUE;
+
+	solveRocket( settings,solution );
+}
+
+BOOST_AUTO_TEST_CASE( rocket_with_sparse_qps )
+{
+	// without and with path constraints, i.e. condensed constraint blocks
+	const double uvBounds[] = { 0.0,1.3 };
+	RocketSolution dense[2], sparse[2];
+
+	for( uint k=0; k<2; ++k )
+	{
+		solveRocket( QP_QPOASES,uvBounds[k],dense[k] );
+		solveRocket( QP_QPOASES_SPARSE,uvBounds[k],sparse[k] );
+
+		BOOST_CHECK_SMALL( dense[k].objective - sparse[k].objective,1e-8 );
+
+		BOOST_REQUIRE( dense[k].controls.getNumPoints( ) == sparse[k].controls.getNumPoints( ) );
+		for( uint i=0; i<dense[k].controls.getNumPoints( ); ++i )
+			BOOST_CHECK_SMALL( dense[k].controls( i,0 ) - sparse[k].controls( i,0 ),1e-6 );
+	}
+
+	// the path constraints are active
+	BOOST_CHECK( dense[1].objective > dense[0].objective + 1e-6 );
+}
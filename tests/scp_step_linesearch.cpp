@@ -0,0 +1,130 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE SCPstepLinesearchTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_optimal_control.hpp>
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( trial_iterate_reuses_grids )
+{
+	Grid grid( 0.0,1.0,3 );
+
+	VariablesGrid xGrid( 2,grid ), uGrid( 1,grid );
+	for( uint i=0; i<3; ++i )
+	{
+		xGrid( i,0 ) = 1.0*i;
+		xGrid( i,1 ) = 2.0*i;
+		uGrid( i,0 ) = -1.0*i;
+	}
+
+	OCPiterate iter( &xGrid,0,0,&uGrid,0 );
+
+	DMatrix dx( 2,1 ), du( 0.5 );
+	dx.setAll( 1.0 );
+
+	BlockMatrix step( 5*3,1 );
+	for( uint i=0; i<3; ++i )
+	{
+		step.setDense( i,0,dx );
+		step.setDense( 3*3+i,0,du );
+	}
+
+	OCPiterate trial;
+	BOOST_REQUIRE( trial.assignStep( iter,step,0.5 ) == SUCCESSFUL_RETURN );
+
+	const VariablesGrid* x = trial.x;
+	const VariablesGrid* u = trial.u;
+
+	BOOST_REQUIRE( trial.assignStep( iter,step,0.25 ) == SUCCESSFUL_RETURN );
+	BOOST_CHECK( trial.x == x );
+	BOOST_CHECK( trial.u == u );
+	BOOST_CHECK( trial.xa == 0 );
+
+	for( uint i=0; i<3; ++i )
+	{
+		BOOST_CHECK_CLOSE( trial.x->operator()( i,0 ),1.0*i + 0.25,1e-12 );
+		BOOST_CHECK_CLOSE( trial.x->operator()( i,1 ),2.0*i + 0.25,1e-12 );
+		BOOST_CHECK_CLOSE( trial.u->operator()( i,0 ),-1.0*i + 0.125,1e-12 );
+	}
+
+	// the given iterate is not touched
+	BOOST_CHECK_EQUAL( iter.x->operator()( 2,0 ),2.0 );
+}
+
+static double solveVanDerPol( int nCandidates, VariablesGrid& controls,
+							  MatrixVariablesGrid& stepLengths, MatrixVariablesGrid& states )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x1, x2;
+	Control u;
+
+	DifferentialEquation f( 0.0,5.0 );
+	f << dot(x1) == x2;
+	f << dot(x2) == (1.0-x1*x1)*x2 - x1 + u;
+
+	OCP ocp( 0.0,5.0,20 );
+	ocp.minimizeLagrangeTerm( x1*x1 + x2*x2 + u*u );
+
+	ocp.subjectTo( f );
+	ocp.subjectTo( AT_START, x1 == 2.0 );
+	ocp.subjectTo( AT_START, x2 == 1.0 );
+	ocp.subjectTo( -1.0 <= u <= 1.0 );
+
+	OptimizationAlgorithm algorithm( ocp );
+	algorithm.set( NUM_LINESEARCH_CANDIDATES,nCandidates );
+	algorithm.set( HESSIAN_APPROXIMATION,EXACT_HESSIAN );
+	algorithm.set( MIN_LINESEARCH_PARAMETER,1e-3 );
+	algorithm.set( INTEGRATOR_TOLERANCE,1e-10 );
+	algorithm.set( KKT_TOLERANCE,1e-10 );
+	algorithm.set( PRINTLEVEL,NONE );
+	algorithm.set( PRINT_COPYRIGHT,BT_FALSE );
+
+	LogRecord logRecord( LOG_AT_EACH_ITERATION );
+	logRecord << LOG_LINESEARCH_STEPLENGTH;
+	logRecord << LOG_DIFFERENTIAL_STATES;
+	algorithm << logRecord;
+
+	BOOST_REQUIRE( algorithm.solve( ) == SUCCESSFUL_RETURN );
+
+	algorithm.getLogRecord( logRecord );
+	logRecord.getAll( LOG_LINESEARCH_STEPLENGTH,stepLengths );
+	logRecord.getAll( LOG_DIFFERENTIAL_STATES,states );
+
+	algorithm.getControls( controls );
+
+	return algorithm.getObjectiveValue( );
+}
+
+BOOST_AUTO_TEST_CASE( speculative_matches_sequential )
+{
+	VariablesGrid u1, u4;
+	MatrixVariablesGrid alpha1, alpha4, x1, x4;
+
+	double f1 = solveVanDerPol( 1,u1,alpha1,x1 );
+	double f4 = solveVanDerPol( 4,u4,alpha4,x4 );
+
+	// the same step lengths are taken, including some short ones
+	BOOST_REQUIRE( alpha1.getNumPoints( ) == alpha4.getNumPoints( ) );
+
+	double minAlpha = 1.0;
+	for( uint i=0; i<alpha1.getNumPoints( ); ++i )
+	{
+		BOOST_CHECK_EQUAL( alpha1.getMatrix( i )( 0,0 ),alpha4.getMatrix( i )( 0,0 ) );
+		minAlpha = acadoMin( minAlpha,alpha1.getMatrix( i )( 0,0 ) );
+	}
+	BOOST_CHECK( minAlpha < 0.5 );
+
+	BOOST_CHECK_SMALL( f1 - f4,1e-8 );
+	for( uint i=0; i<u1.getNumPoints( ); ++i )
+		BOOST_CHECK_SMALL( u1( i,0 ) - u4( i,0 ),1e-6 );
+
+	// the logged trajectories are those of the accepted trial iterates
+	BOOST_REQUIRE( x1.getNumPoints( ) == x4.getNumPoints( ) );
+	for( uint i=0; i<x1.getNumPoints( ); ++i )
+		BOOST_CHECK_SMALL( ( x1.getMatrix( i ) - x4.getMatrix( i ) ).norm( ),1e-6 );
+}
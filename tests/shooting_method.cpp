@@ -0,0 +1,131 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE ShootingMethodTests
+#include <boost/test/unit_test.hpp>
+
+#include "test_problems.hpp"
+
+USING_NAMESPACE_ACADO
+
+static void solveRocket( int nThreads, int hessianApproximation, RocketSolution& solution )
+{
+	RocketSettings settings;
+	settings.uvBound = 1.3;
+	settings.intOptions[ NUM_THREADS ] = nThreads;
+	if ( hessianApproximation >= 0 )
+		settings.intOptions[ HESSIAN_APPROXIMATION ] = hessianApproximation;
+
+	solveRocket( settings,solution );
+}
+
+static void checkEqual( const RocketSolution& a, const RocketSolution& b )
+{
+	BOOST_CHECK_EQUAL( a.objective,b.objective );
+	BOOST_CHECK_EQUAL( a.nIterations,b.nIterations );
+
+	BOOST_REQUIRE( a.states.getNumPoints( ) == b.states.getNumPoints( ) );
+	for( uint i=0; i<a.states.getNumPoints( ); ++i )
+		for( uint j=0; j<a.states.getNumValues( ); ++j )
+			BOOST_CHECK_EQUAL( a.states( i,j ),b.states( i,j ) );
+
+	BOOST_REQUIRE( a.controls.getNumPoints( ) == b.controls.getNumPoints( ) );
+	for( uint i=0; i<a.controls.getNumPoints( ); ++i )
+		BOOST_CHECK_EQUAL( a.controls( i,0 ),b.controls( i,0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( rocket_threads_are_deterministic )
+{
+	// the default Hessian approximation and the exact Hessian
+	const int hessianApproximations[2] = { -1,EXACT_HESSIAN };
+
+	for( int k=0; k<2; ++k )
+	{
+		RocketSolution single, multi;
+
+		solveRocket( 1,hessianApproximations[k],single );
+		solveRocket( 4,hessianApproximations[k],multi );
+
+		checkEqual( single,multi );
+	}
+}
+
+/* evaluates the shooting method on x' = -2x + u; returns the states of the iterate */
+static void evaluateLinearModel( int nThreads, bool simulationMode, VariablesGrid& xGrid, BlockMatrix& residuum )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	DifferentialState x;
+	Control u;
+
+	DifferentialEquation f;
+	f << dot(x) == -2.0*x + u;
+
+	Grid grid( 0.0,1.0,5 );
+
+	VariablesGrid uGrid( 1,grid );
+	xGrid.init( 1,grid );
+	for( uint i=0; i<5; ++i )
+	{
+		xGrid( i,0 ) = 1.0 - 0.1*i;
+		uGrid( i,0 ) = 0.3 + 0.2*i;
+	}
+	uGrid.disableAutoInit( );
+
+	// in simulation mode only the initial value is given
+	if ( simulationMode == false )
+		xGrid.disableAutoInit( );
+
+	ShootingMethod shooting;
+	shooting.set( NUM_THREADS,nThreads );
+	shooting.set( INTEGRATOR_TOLERANCE,1e-10 );
+	shooting.set( ABSOLUTE_TOLERANCE,1e-12 );
+
+	BOOST_REQUIRE( shooting.addStage( f,grid,INT_RK45 ) == SUCCESSFUL_RETURN );
+
+	OCPiterate iter( &xGrid,0,0,&uGrid,0 );
+	if ( simulationMode == true )
+		BOOST_REQUIRE( iter.enableSimulationMode( ) == SUCCESSFUL_RETURN );
+
+	BOOST_REQUIRE( shooting.evaluate( iter ) == SUCCESSFUL_RETURN );
+	shooting.getResiduum( residuum );
+
+	// the iterate owns copies of the grids
+	xGrid = *iter.x;
+}
+
+BOOST_AUTO_TEST_CASE( simulation_mode_falls_back_to_sequential )
+{
+	for( int k=0; k<2; ++k )
+	{
+		const bool simulationMode = ( k == 1 );
+
+		VariablesGrid xSingle, xMulti;
+		BlockMatrix rSingle, rMulti;
+
+		evaluateLinearModel( 1,simulationMode,xSingle,rSingle );
+		evaluateLinearModel( 4,simulationMode,xMulti,rMulti );
+
+		for( uint i=0; i<4; ++i )
+		{
+			DMatrix a, b;
+			rSingle.getSubBlock( i,0,a );
+			rMulti.getSubBlock( i,0,b );
+			BOOST_CHECK_EQUAL( a( 0,0 ),b( 0,0 ) );
+			BOOST_CHECK_EQUAL( xSingle( i+1,0 ),xMulti( i+1,0 ) );
+		}
+
+		// in simulation mode, the states are propagated from one interval to the next
+		if ( simulationMode == true )
+		{
+			const double h = 0.25;
+			double xExact = 1.0;
+			for( uint i=0; i<4; ++i )
+			{
+				xExact = xExact*exp( -2.0*h ) + 0.5*( 0.3 + 0.2*i )*( 1.0-exp( -2.0*h ) );
+				BOOST_CHECK_SMALL( xMulti( i+1,0 ) - xExact,1e-8 );
+			}
+		}
+	}
+}
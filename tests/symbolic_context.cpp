@@ -0,0 +1,123 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE SymbolicContextTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+#include <thread>
+#include <vector>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Indices and values of a small model, built within the current context. */
+struct ModelData
+{
+	unsigned xIdx, vIdx, uIdx;
+	int      nVars;
+	double   values[ 3 ];
+};
+
+static void buildModel( double a, ModelData& data )
+{
+	DifferentialState x, v;
+	Control u;
+
+	IntermediateState s;
+	s = sin(a * x) * v + u;
+
+	Function f;
+	f << s * s + exp( x );
+	f << forwardDerivative( s * s + exp( x ), x );
+	f << backwardDerivative( s * u, v );
+
+	data.xIdx  = x.getComponent( 0 );
+	data.vIdx  = v.getComponent( 0 );
+	data.uIdx  = u.getComponent( 0 );
+	data.nVars = f.getNumberOfVariables( );
+
+	vector< double > xx(f.getNumberOfVariables( ) + 1, 0.0);
+	xx[ f.index(VT_DIFFERENTIAL_STATE, 0) ] = 0.3;
+	xx[ f.index(VT_DIFFERENTIAL_STATE, 1) ] = -1.2;
+	xx[ f.index(VT_CONTROL, 0) ] = 0.7;
+
+	f.evaluate(0, xx.data(), data.values);
+}
+
+static void requireEqual( const ModelData& a, const ModelData& b )
+{
+	BOOST_REQUIRE_EQUAL( a.xIdx, b.xIdx );
+	BOOST_REQUIRE_EQUAL( a.vIdx, b.vIdx );
+	BOOST_REQUIRE_EQUAL( a.uIdx, b.uIdx );
+	BOOST_REQUIRE_EQUAL( a.nVars, b.nVars );
+	BOOST_REQUIRE_EQUAL( a.values[ 0 ], b.values[ 0 ] );
+	BOOST_REQUIRE_EQUAL( a.values[ 1 ], b.values[ 1 ] );
+	BOOST_REQUIRE_EQUAL( a.values[ 2 ], b.values[ 2 ] );
+}
+
+BOOST_AUTO_TEST_CASE( context_scope )
+{
+	DifferentialState x0;
+	unsigned next = x0.getComponent( 0 ) + 1;
+
+	{
+		SymbolicContext context;
+		SymbolicContextScope scope( context );
+
+		DifferentialState x1, x2;
+		BOOST_REQUIRE( x1.getComponent( 0 ) == 0 );
+		BOOST_REQUIRE( x2.getComponent( 0 ) == 1 );
+	}
+
+	DifferentialState x3;
+	BOOST_REQUIRE( x3.getComponent( 0 ) == next );
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_models )
+{
+	const int nThreads = 8;
+	const int nModels  = 25;
+
+	ModelData reference;
+	{
+		SymbolicContext context;
+		SymbolicContextScope scope( context );
+		buildModel(2.0, reference);
+	}
+
+	BOOST_REQUIRE( reference.xIdx == 0 && reference.vIdx == 1 && reference.uIdx == 0 );
+
+	vector< ModelData > results(nThreads * nModels);
+	vector< thread > workers;
+
+	for (int i = 0; i < nThreads; ++i)
+		workers.push_back( thread( [&results, i, nModels]( )
+		{
+			for (int j = 0; j < nModels; ++j)
+			{
+				// Use both an explicit context per model and the default
+				// context of the thread.
+				if (j % 2 == 0)
+				{
+					SymbolicContext context;
+					SymbolicContextScope scope( context );
+					buildModel(2.0, results[i * nModels + j]);
+				}
+				else
+				{
+					clearAllStaticCounters();
+					buildModel(2.0, results[i * nModels + j]);
+				}
+			}
+		} ) );
+
+	for (int i = 0; i < nThreads; ++i)
+		workers[ i ].join();
+
+	for (unsigned i = 0; i < results.size(); ++i)
+		requireEqual(results[ i ], reference);
+}
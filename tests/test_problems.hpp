@@ -0,0 +1,132 @@
+#ifndef ACADO_TOOLKIT_TESTS_TEST_PROBLEMS_HPP
+#define ACADO_TOOLKIT_TESTS_TEST_PROBLEMS_HPP
+
+#include <acado_optimal_control.hpp>
+
+#include <map>
+
+USING_NAMESPACE_ACADO
+
+/* Variant of the rocket OCP and the options of its solver. */
+struct RocketSettings
+{
+	RocketSettings( ) : nIntervals( 20 ),freeEndTime( false ),drag( 0.02 ),
+						vMin( -0.01 ),vMax( 1.3 ),uvBound( 0.0 )
+	{
+		intOptions[ PRINTLEVEL ] = NONE;
+		intOptions[ PRINT_COPYRIGHT ] = BT_FALSE;
+		doubleOptions[ KKT_TOLERANCE ] = 1e-10;
+	}
+
+	int nIntervals;
+	bool freeEndTime;		/* minimizes the end time instead of the control energy */
+	double drag;
+	double vMin, vMax;
+	double uvBound;			/* bound on |u - v|, not imposed if zero */
+
+	std::map< OptionsName,int > intOptions;
+	std::map< OptionsName,double > doubleOptions;
+};
+
+/* Results of solving the rocket OCP. */
+struct RocketSolution
+{
+	double objective;
+	double endTime;
+	VariablesGrid states;
+	VariablesGrid controls;
+	int nIterations;
+};
+
+/* Objective with minimal control energy within the given end time. */
+inline void setRocketObjective( OCP& ocp, const Control& u, double )
+{
+	ocp.minimizeLagrangeTerm( u*u );
+}
+
+/* Objective with minimal end time. */
+inline void setRocketObjective( OCP& ocp, const Control&, const Parameter& T )
+{
+	ocp.minimizeMayerTerm( T );
+	ocp.subjectTo( 5.0 <= T <= 15.0 );
+}
+
+template< typename EndTime >
+void solveRocket( const RocketSettings& settings, const EndTime& tEnd, RocketSolution& solution )
+{
+	DifferentialState s, v, m;
+	Control u;
+
+	DifferentialEquation f( 0.0,tEnd );
+	f << dot(s) == v;
+	f << dot(v) == (u-settings.drag*v*v)/m;
+	f << dot(m) == -0.01*u*u;
+
+	OCP ocp( 0.0,tEnd,settings.nIntervals );
+	setRocketObjective( ocp,u,tEnd );
+
+	ocp.subjectTo( f );
+	ocp.subjectTo( AT_START, s ==  0.0 );
+	ocp.subjectTo( AT_START, v ==  0.0 );
+	ocp.subjectTo( AT_START, m ==  1.0 );
+	ocp.subjectTo( AT_END  , s == 10.0 );
+	ocp.subjectTo( AT_END  , v ==  0.0 );
+
+	ocp.subjectTo( settings.vMin <= v <= settings.vMax );
+	ocp.subjectTo( -1.1 <= u <= 1.1 );
+	if ( settings.uvBound > 0.0 )
+		ocp.subjectTo( -settings.uvBound <= u - v <= settings.uvBound );
+
+	OptimizationAlgorithm algorithm( ocp );
+
+	std::map< OptionsName,int >::const_iterator itInt;
+	for( itInt = settings.intOptions.begin( ); itInt != settings.intOptions.end( ); ++itInt )
+		BOOST_REQUIRE( algorithm.set( itInt->first,itInt->second ) == SUCCESSFUL_RETURN );
+
+	std::map< OptionsName,double >::const_iterator itDouble;
+	for( itDouble = settings.doubleOptions.begin( ); itDouble != settings.doubleOptions.end( ); ++itDouble )
+		BOOST_REQUIRE( algorithm.set( itDouble->first,itDouble->second ) == SUCCESSFUL_RETURN );
+
+	LogRecord logRecord( LOG_AT_END );
+	logRecord << LOG_NUM_SQP_ITERATIONS;
+	algorithm << logRecord;
+
+	BOOST_REQUIRE( algorithm.solve( ) == SUCCESSFUL_RETURN );
+
+	algorithm.getDifferentialStates( solution.states );
+	algorithm.getControls( solution.controls );
+	algorithm.getLogRecord( logRecord );
+
+	DMatrix numSteps;
+	logRecord.getLast( LOG_NUM_SQP_ITERATIONS,numSteps );
+	solution.nIterations = (int)numSteps( 0,0 );
+
+	solution.objective = algorithm.getObjectiveValue( );
+	solution.endTime = 10.0;
+
+	if ( settings.freeEndTime == true )
+	{
+		VariablesGrid parameters;
+		algorithm.getParameters( parameters );
+		solution.endTime = parameters( 0,0 );
+	}
+}
+
+/* Flies the rocket from rest to rest over 10 length units, either in minimal
+ * time or with minimal control energy within 10 time units. Each call uses
+ * its own symbolic context, so solutions of different calls are comparable. */
+inline void solveRocket( const RocketSettings& settings, RocketSolution& solution )
+{
+	SymbolicContext context;
+	SymbolicContextScope scope( context );
+
+	if ( settings.freeEndTime == true )
+	{
+		Parameter T;
+		solveRocket( settings,T,solution );
+	}
+	else
+		solveRocket( settings,10.0,solution );
+}
+
+#endif  // ACADO_TOOLKIT_TESTS_TEST_PROBLEMS_HPP
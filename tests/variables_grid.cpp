@@ -0,0 +1,124 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE VariablesGridTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/variables_grid/variables_grid.hpp>
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( append_and_views )
+{
+	const unsigned nPoints = 1000;
+
+	VariablesGrid grid;
+	DVector x( 3 );
+
+	for (unsigned i = 0; i < nPoints; ++i)
+	{
+		x << i, 2.0 * i, -1.0 * i;
+		BOOST_REQUIRE( grid.addVector(x, 0.1 * i) == SUCCESSFUL_RETURN );
+	}
+
+	BOOST_REQUIRE( grid.getNumPoints() == nPoints );
+	BOOST_REQUIRE( grid.getDim() == 3 * nPoints );
+	BOOST_REQUIRE( grid.hasFixedDimensions() == BT_TRUE );
+
+	for (unsigned i = 0; i < nPoints; i += 97)
+	{
+		BOOST_CHECK_EQUAL( grid.getTime( i ), 0.1 * i );
+		BOOST_CHECK_EQUAL( grid(i, 1), 2.0 * i );
+		BOOST_CHECK_EQUAL( grid.getVector( i )( 2 ), -1.0 * i );
+	}
+
+	// Writing through a point view changes the grid
+	grid.getMatrixMap( 5 ).setConstant( 7.0 );
+	BOOST_CHECK_EQUAL( grid(5, 0), 7.0 );
+	BOOST_CHECK_EQUAL( grid(5, 2), 7.0 );
+
+	// Component views stride over all grid points
+	VariablesGrid::ComponentMap y = grid.getComponentMap( 1 );
+	BOOST_REQUIRE( y.size() == nPoints );
+	BOOST_CHECK_EQUAL( y( 10 ), 20.0 );
+	y *= 0.5;
+	BOOST_CHECK_EQUAL( grid(10, 1), 10.0 );
+	BOOST_CHECK_EQUAL( grid(10, 0), 10.0 );
+}
+
+BOOST_AUTO_TEST_CASE( settings_and_resizing )
+{
+	VariablesGrid grid(2, 0.0, 1.0, 3, VT_DIFFERENTIAL_STATE);
+	grid.setAll( 1.0 );
+	grid.setUpperBound(1, 0, 5.0);
+
+	BOOST_CHECK( grid.getType() == VT_DIFFERENTIAL_STATE );
+	BOOST_CHECK_EQUAL( grid.getUpperBound(1, 0), 5.0 );
+
+	VariablesGrid other(1, 0.0, 1.0, 3);
+	other.setAll( 2.0 );
+
+	// Appending values grows the dimension at every grid point
+	BOOST_REQUIRE( grid.appendValues( other ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( grid.getNumValues() == 3 );
+	BOOST_CHECK_EQUAL( grid(2, 1), 1.0 );
+	BOOST_CHECK_EQUAL( grid(2, 2), 2.0 );
+	BOOST_CHECK_EQUAL( grid.getUpperBound(1, 0), 5.0 );
+
+	// Changing the dimension at a single grid point moves subsequent values
+	DMatrix single( 1, 1 );
+	single( 0 ) = -3.0;
+	BOOST_REQUIRE( grid.setMatrix(0, single) == SUCCESSFUL_RETURN );
+	BOOST_CHECK( grid.hasFixedDimensions() == BT_FALSE );
+	BOOST_CHECK( grid.getDim() == 7 );
+	BOOST_CHECK_EQUAL( grid(0, 0), -3.0 );
+	BOOST_CHECK_EQUAL( grid(1, 0), 1.0 );
+	BOOST_CHECK_EQUAL( grid(2, 2), 2.0 );
+
+	// Shifting keeps values and times consistent
+	VariablesGrid shifted( grid );
+	shifted.shiftBackwards( );
+	BOOST_CHECK( shifted.getNumValues( 0 ) == 3 );
+	BOOST_CHECK_EQUAL( shifted(0, 2), 2.0 );
+}
+
+BOOST_AUTO_TEST_CASE( grid_lookup )
+{
+	Grid grid;
+	for (unsigned i = 0; i < 500; ++i)
+		grid.addTime( 0.5 * i );
+
+	// duplicated time point
+	Grid single, dupGrid( grid );
+	single.addTime( 10.0 );
+	dupGrid.merge( single, MM_DUPLICATE );
+
+	BOOST_CHECK( dupGrid.findFirstTime( 10.0 ) == 20 );
+	BOOST_CHECK( dupGrid.findLastTime( 10.0 ) == 21 );
+	BOOST_CHECK( dupGrid.findFirstTime( 10.25 ) == -1 );
+	BOOST_CHECK( grid.findFirstTime( 10.0, 21 ) == -1 );
+	BOOST_CHECK( grid.hasTime( 249.5 ) == BT_TRUE );
+
+	// hinted searches agree with plain ones, for monotone and arbitrary queries
+	uint floorHint = 0, ceilHint = 0;
+	for (unsigned i = 0; i < 1100; ++i)
+	{
+		double t = -1.0 + 0.2345 * i;
+		BOOST_CHECK( grid.getFloorIndex( t, floorHint ) == grid.getFloorIndex( t ) );
+		BOOST_CHECK( grid.getCeilIndex( t, ceilHint ) == grid.getCeilIndex( t ) );
+	}
+
+	for (unsigned i = 0; i < 100; ++i)
+	{
+		double t = 0.5 * ( ( 37 * i ) % 499 ) + 0.1;
+		BOOST_CHECK( grid.getFloorIndex( t, floorHint ) == grid.getFloorIndex( t ) );
+		BOOST_CHECK( grid.getCeilIndex( t, ceilHint ) == grid.getCeilIndex( t ) );
+	}
+
+	Grid subGrid;
+	BOOST_REQUIRE( grid.getSubGrid( 1.25, 3.0, subGrid ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( subGrid.getNumPoints( ) == 5 );
+	BOOST_CHECK_EQUAL( subGrid.getTime( 0 ), 1.25 );
+	BOOST_CHECK_EQUAL( subGrid.getTime( 1 ), 1.5 );
+	BOOST_CHECK_EQUAL( subGrid.getLastTime( ), 3.0 );
+}
@@ -0,0 +1,113 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE WorkspaceAllocatorTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/code_generation/workspace_allocator.hpp>
+#include <acado/code_generation/export_function.hpp>
+#include <acado/code_generation/export_arithmetic_statement.hpp>
+
+#include <sstream>
+
+USING_NAMESPACE_ACADO
+
+BOOST_AUTO_TEST_CASE( disjoint_lifetimes )
+{
+	ExportVariable a("a", 10, 1, REAL, ACADO_WORKSPACE);
+	ExportVariable b("b", 20, 1, REAL, ACADO_WORKSPACE);
+	ExportVariable c("c", 30, 1, REAL, ACADO_WORKSPACE);
+	ExportVariable p("p", 10, 1, REAL, ACADO_WORKSPACE);
+	a.setTemporary();
+	b.setTemporary();
+	c.setTemporary();
+
+	BOOST_CHECK( a.isTemporary() == true && p.isTemporary() == false );
+
+	// a and b are used together in the first step, c alone in the second one
+	ExportFunction first( "first" );
+	first.addStatement( a == b.getRows(0, 10) );
+	first.addStatement( p == a );
+
+	ExportFunction second( "second" );
+	second.addStatement( c.getRows(0, 10) == p );
+	second.addStatement( p == c.getRows(20, 30) );
+
+	ExportFunction step( "step" );
+	step.addFunctionCall( first );
+	step.addFunctionCall( second );
+
+	ExportStatementBlock code;
+	code.addFunction( first );
+	code.addFunction( second );
+	code.addFunction( step );
+
+	ExportStatementBlock declarations;
+	declarations.addDeclaration( p );
+	declarations.addDeclaration( a );
+	declarations.addDeclaration( b );
+	declarations.addDeclaration( c );
+
+	WorkspaceAllocator allocator( 8 );
+	BOOST_REQUIRE( allocator.addCode( code ) == SUCCESSFUL_RETURN );
+
+	std::stringstream ss;
+	BOOST_REQUIRE( allocator.exportDataDeclaration(ss, declarations) == SUCCESSFUL_RETURN );
+	std::string text = ss.str();
+
+	// c and b share the start of the arena, a follows b on the next cache line
+	BOOST_CHECK( allocator.getTemporariesSize() == 60 );
+	BOOST_CHECK( allocator.getArenaSize() == 34 );
+	BOOST_CHECK( text.find( "union" ) != std::string::npos );
+	BOOST_CHECK( text.find( "real_t pad_a[ 24 ];" ) != std::string::npos );
+	BOOST_CHECK( text.find( "pad_b" ) == std::string::npos );
+	BOOST_CHECK( text.find( "pad_c" ) == std::string::npos );
+
+	// persistent data stays outside of the arena
+	BOOST_CHECK( text.find( "real_t p[ 10 ];" ) > text.find( "};\n\n" ) );
+}
+
+BOOST_AUTO_TEST_CASE( arguments_stay_live )
+{
+	ExportVariable a("a", 16, 1, REAL, ACADO_WORKSPACE);
+	ExportVariable b("b", 16, 1, REAL, ACADO_WORKSPACE);
+	ExportVariable p("p", 16, 1, REAL, ACADO_WORKSPACE);
+	a.setTemporary();
+	b.setTemporary();
+
+	ExportVariable in("in", 16, 1);
+	ExportVariable out("out", 16, 1);
+
+	ExportFunction copy("copy", in, out);
+	copy.addStatement( out == in );
+	copy.addStatement( b == in );
+
+	// a is an argument of the callee, so it is live while the callee uses b
+	ExportFunction step( "step" );
+	step.addFunctionCall(copy, p, a);
+	step.addStatement( p == a );
+
+	ExportStatementBlock code;
+	code.addFunction( copy );
+	code.addFunction( step );
+
+	ExportStatementBlock declarations;
+	declarations.addDeclaration( a );
+	declarations.addDeclaration( b );
+	declarations.addDeclaration( p );
+
+	WorkspaceAllocator allocator;
+	allocator.addCode( code );
+
+	std::stringstream ss;
+	BOOST_REQUIRE( allocator.exportDataDeclaration(ss, declarations) == SUCCESSFUL_RETURN );
+	BOOST_CHECK( allocator.getArenaSize() == 32 );
+
+	// without any code, the declarations are exported unchanged
+	WorkspaceAllocator empty;
+	std::stringstream plain, reference;
+	empty.exportDataDeclaration(plain, declarations);
+	declarations.exportCode( reference );
+	BOOST_CHECK( plain.str() == reference.str() );
+	BOOST_CHECK( empty.getArenaSize() == 0 );
+}